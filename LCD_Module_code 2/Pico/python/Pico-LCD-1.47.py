@@ -2,8 +2,35 @@
 from machine import Pin,SPI,PWM
 import framebuf
 import time
+from array import array
 import os
 
+# SPI1 data/status registers and its DMA request line for non-blocking
+# show_async(). Both differ between the RP2040 and the RP2350 (Pico 2);
+# on any other chip show_async() falls back to a blocking show().
+SPI1_BASES = {'RP2040': (0x40040000, 18), 'RP2350': (0x40088000, 26)}
+SPI1_BASE = DREQ_SPI1_TX = None
+for chip in SPI1_BASES:
+    if chip in os.uname().machine:
+        SPI1_BASE, DREQ_SPI1_TX = SPI1_BASES[chip]
+SPI_SSPDR = 0x008
+SPI_SSPSR = 0x00C
+SPI_SSPSR_BSY = 0x10
+
+try:
+    import rp2
+    from machine import mem32
+    # rp2.DMA exists from MicroPython 1.23
+    HAVE_DMA = hasattr(rp2, 'DMA') and SPI1_BASE is not None
+except ImportError:
+    HAVE_DMA = False
+
+try:
+    import micropython
+    HAVE_VIPER = hasattr(micropython, 'viper')
+except ImportError:
+    HAVE_VIPER = False
+
 BL = 13
 DC = 8
 RST = 12
@@ -11,6 +38,9 @@ MOSI = 11
 SCK = 10
 CS = 9
 
+# The 172 visible rows start at row 34 of the ST7789 frame memory
+ROW_OFFSET = 34
+
 
 class LCD_1inch47(framebuf.FrameBuffer):
     def __init__(self):
@@ -27,6 +57,16 @@ class LCD_1inch47(framebuf.FrameBuffer):
         self.dc = Pin(DC,Pin.OUT)
         self.dc(1)
         self.buffer = bytearray(self.height * self.width * 2)
+        self.fbuf = memoryview(self.buffer)
+        # Preallocated so that commands and windows never allocate
+        self.cmd_buf = bytearray(1)
+        self.param_buf = bytearray(4)
+        self.dma = None
+        # 8x8 scratch for reading glyphs of the built-in font
+        self.glyph_buf = bytearray(8)
+        self.glyph_fb = framebuf.FrameBuffer(self.glyph_buf, 8, 8, framebuf.MONO_HLSB)
+        self.glyphs = {}
+        self.blit_args = array('i', [0] * 8)
         super().__init__(self.buffer, self.width, self.height, framebuf.RGB565)
         self.init_display()
         
@@ -35,18 +75,24 @@ class LCD_1inch47(framebuf.FrameBuffer):
         self.BLUE  =   0xf800
         self.WHITE =   0xffff
         
-    def write_cmd(self, cmd):
-        self.cs(1)
+    def write_cmd(self, cmd, data=None):
+        """Send a command and, optionally, its parameters in one CS cycle"""
+        self.wait()
+        self.cmd_buf[0] = cmd
         self.dc(0)
         self.cs(0)
-        self.spi.write(bytearray([cmd]))
+        self.spi.write(self.cmd_buf)
+        if data:
+            self.dc(1)
+            self.spi.write(data)
         self.cs(1)
 
     def write_data(self, buf):
-        self.cs(1)
+        self.wait()
+        self.cmd_buf[0] = buf
         self.dc(1)
         self.cs(0)
-        self.spi.write(bytearray([buf]))
+        self.spi.write(self.cmd_buf)
         self.cs(1)
 
     def init_display(self):
@@ -55,124 +101,256 @@ class LCD_1inch47(framebuf.FrameBuffer):
         self.rst(0)
         self.rst(1)
         
-        self.write_cmd(0x36)
-        self.write_data(0x70)
-
-        self.write_cmd(0x3A) 
-        self.write_data(0x05)
-
-        self.write_cmd(0xB2)
-        self.write_data(0x0C)
-        self.write_data(0x0C)
-        self.write_data(0x00)
-        self.write_data(0x33)
-        self.write_data(0x33)
-
-        self.write_cmd(0xB7)
-        self.write_data(0x35) 
-
-        self.write_cmd(0xC0)
-        self.write_data(0x2C)
-
-        self.write_cmd(0xC2)
-        self.write_data(0x01)
-
-        self.write_cmd(0xC3)
-        self.write_data(0x13)   
-
-        self.write_cmd(0xC4)
-        self.write_data(0x20)
-
-        self.write_cmd(0xC6)
-        self.write_data(0x0F) 
-
-        self.write_cmd(0xD0)
-        self.write_data(0xA4)
-        self.write_data(0xA1)
-
-        self.write_cmd(0xE0)
-        self.write_data(0xF0)
-        self.write_data(0x00)
-        self.write_data(0x04)
-        self.write_data(0x04)
-        self.write_data(0x05)
-        self.write_data(0x29)
-        self.write_data(0x33)
-        self.write_data(0x3E)
-        self.write_data(0x38)
-        self.write_data(0x12)
-        self.write_data(0x12)
-        self.write_data(0x28)
-        self.write_data(0x30)
-
-        self.write_cmd(0xE1)
-        self.write_data(0xF0)
-        self.write_data(0x07)
-        self.write_data(0x0A)
-        self.write_data(0x0D)
-        self.write_data(0x0B)
-        self.write_data(0x07)
-        self.write_data(0x28)
-        self.write_data(0x33)
-        self.write_data(0x3E)
-        self.write_data(0x36)
-        self.write_data(0x14)
-        self.write_data(0x14)
-        self.write_data(0x29)
-        self.write_data(0x23)
-        
+        self.write_cmd(0x36, b'\x70')
+        self.write_cmd(0x3A, b'\x05')
+        self.write_cmd(0xB2, b'\x0C\x0C\x00\x33\x33')
+        self.write_cmd(0xB7, b'\x35')
+        self.write_cmd(0xC0, b'\x2C')
+        self.write_cmd(0xC2, b'\x01')
+        self.write_cmd(0xC3, b'\x13')
+        self.write_cmd(0xC4, b'\x20')
+        self.write_cmd(0xC6, b'\x0F')
+        self.write_cmd(0xD0, b'\xA4\xA1')
+        self.write_cmd(0xE0, b'\xF0\x00\x04\x04\x05\x29\x33\x3E\x38\x12\x12\x28\x30')
+        self.write_cmd(0xE1, b'\xF0\x07\x0A\x0D\x0B\x07\x28\x33\x3E\x36\x14\x14\x29\x23')
         self.write_cmd(0x21)
-
         self.write_cmd(0x11)
-
         self.write_cmd(0x29)
 
-    def show(self):
-        self.write_cmd(0x2A)
-        self.write_data(0x00)
-        self.write_data(0x00)
-        self.write_data(0x01)
-        self.write_data(0x3f)
-        
-        self.write_cmd(0x2B)
-        self.write_data(0x00)
-        self.write_data(0x22)
-        self.write_data(0x00)
-        self.write_data(0xCD)
-        
+    def set_window(self, x, y, w, h):
+        """CASET/RASET for a w x h area at (x, y), then RAMWR"""
+        p = self.param_buf
+        x1 = x + w - 1
+        p[0] = x >> 8
+        p[1] = x & 0xFF
+        p[2] = x1 >> 8
+        p[3] = x1 & 0xFF
+        self.write_cmd(0x2A, p)
+        y0 = y + ROW_OFFSET
+        y1 = y0 + h - 1
+        p[0] = y0 >> 8
+        p[1] = y0 & 0xFF
+        p[2] = y1 >> 8
+        p[3] = y1 & 0xFF
+        self.write_cmd(0x2B, p)
         self.write_cmd(0x2C)
-        
+
+    def clip(self, x, y, w, h):
+        if w is None:
+            w = self.width - x
+        if h is None:
+            h = self.height - y
+        if x < 0:
+            w += x
+            x = 0
+        if y < 0:
+            h += y
+            y = 0
+        w = min(w, self.width - x)
+        h = min(h, self.height - y)
+        return x, y, w, h
+
+    def show(self, x=0, y=0, w=None, h=None):
+        """Send the framebuffer, or only the w x h area at (x, y)
+
+        Full-width areas are contiguous in the framebuffer and go out in a
+        single write; narrower ones are sent row by row from memoryview
+        slices, all inside one CS-low transaction. Nothing is copied.
+        """
+        self.wait()
+        x, y, w, h = self.clip(x, y, w, h)
+        if w <= 0 or h <= 0:
+            return
+        self.set_window(x, y, w, h)
+        stride = self.width * 2
+        fb = self.fbuf
+        self.dc(1)
+        self.cs(0)
+        if w == self.width:
+            self.spi.write(fb[y * stride:(y + h) * stride])
+        else:
+            start = y * stride + x * 2
+            end = start + w * 2
+            for _ in range(h):
+                self.spi.write(fb[start:end])
+                start += stride
+                end += stride
         self.cs(1)
+
+    def show_async(self, y=0, h=None):
+        """Start sending full-width rows by DMA and return at once
+
+        Call wait() (or any show) before drawing into those rows again.
+        Without rp2.DMA this is a plain blocking show().
+        """
+        if not HAVE_DMA:
+            self.show(0, y, None, h)
+            return
+        self.wait()
+        _, y, _, h = self.clip(0, y, None, h)
+        if h <= 0:
+            return
+        self.set_window(0, y, self.width, h)
+        stride = self.width * 2
+        if self.dma is None:
+            self.dma = rp2.DMA()
+            self.dma_ctrl = self.dma.pack_ctrl(size=0, inc_write=False, treq_sel=DREQ_SPI1_TX)
         self.dc(1)
         self.cs(0)
-        self.spi.write(self.buffer)
+        self.dma.config(read=self.fbuf[y * stride:(y + h) * stride], write=SPI1_BASE + SPI_SSPDR,
+                        count=h * stride, ctrl=self.dma_ctrl, trigger=True)
+
+    def wait(self):
+        """Finish a transfer started by show_async()"""
+        if self.dma is None or self.cs.value():
+            return
+        while self.dma.active():
+            pass
+        while mem32[SPI1_BASE + SPI_SSPSR] & SPI_SSPSR_BSY:
+            pass
         self.cs(1)
-    def write_text(self,text,x,y,size,color):
+
+    def glyph(self, ch):
+        """8x8 bitmap of ch from the built-in font (MONO_HLSB, one byte per row)"""
+        g = self.glyphs.get(ch)
+        if g is None:
+            self.glyph_fb.fill(0)
+            self.glyph_fb.text(ch, 0, 0, 1)
+            g = bytes(self.glyph_buf)
+            self.glyphs[ch] = g
+        return g
+
+    def write_text(self, text, x, y, size, color, font=None):
         ''' Method to write Text on OLED/LCD Displays
             with a variable font size
             Args:
                 text: the string of chars to be displayed
                 x: x co-ordinate of starting position
                 y: y co-ordinate of starting position
-                size: font size of text
+                size: font size of text (integer scale)
                 color: color of text to be displayed
+                font: a BitmapFont, or None for the built-in 8x8 font
+
+            Each glyph row is drawn as horizontal runs of lit pixels, scaled
+            by size; with viper the runs go straight into the buffer.
         '''
-        background = self.pixel(x,y)
-        info = []
-        # Creating reference charaters to read their values
-        self.text(text,x,y,color)
-        for i in range(x,x+(8*len(text))):
-            for j in range(y,y+8):
-                # Fetching amd saving details of pixels, such as
-                # x co-ordinate, y co-ordinate, and color of the pixel
-                px_color = self.pixel(i,j)
-                info.append((i,j,px_color)) if px_color == color else None
-        # Clearing the reference characters from the screen
-        self.text(text,x,y,background)
-        # Writing the custom-sized font characters on screen
-        for px_info in info:
-            self.fill_rect(size*px_info[0] - (size-1)*x , size*px_info[1] - (size-1)*y, size, size, px_info[2])   
-  
+        if font is None and size == 1:
+            self.text(text, x, y, color)
+            return
+        gw = font.width if font else 8
+        gh = font.height if font else 8
+        args = self.blit_args
+        args[0] = self.width
+        args[1] = self.height
+        args[4] = gw
+        args[5] = gh
+        args[6] = size
+        args[7] = color
+        for ch in text:
+            g = font.glyph(ch) if font else self.glyph(ch)
+            if g is not None:
+                if text_blit:
+                    args[2] = x
+                    args[3] = y
+                    text_blit(self.buffer, g, args)
+                else:
+                    self.glyph_runs(x, y, g, gw, gh, size, color)
+            x += gw * size
+
+    def glyph_runs(self, x, y, g, gw, gh, size, color):
+        """write_text() without viper: one fill_rect per run of lit pixels"""
+        stride = (gw + 7) >> 3
+        for row in range(gh):
+            base = row * stride
+            col = 0
+            while col < gw:
+                if g[base + (col >> 3)] & (0x80 >> (col & 7)):
+                    start = col
+                    col += 1
+                    while col < gw and g[base + (col >> 3)] & (0x80 >> (col & 7)):
+                        col += 1
+                    self.fill_rect(x + start * size, y + row * size, (col - start) * size, size, color)
+                else:
+                    col += 1
+
+
+class BitmapFont:
+    """Fixed-width font table: gw x gh glyphs, rows MSB first, (gw + 7) // 8
+    bytes per row, glyphs in character order from first. This is the layout
+    of the sFONT tables in RaspberryPi/c/lib/Fonts (e.g. Font16_Table, 11x16
+    from ' '), so those can be pasted in as bytes."""
+
+    def __init__(self, width, height, data, first=32):
+        self.width = width
+        self.height = height
+        self.data = memoryview(data)
+        self.first = first
+        self.size = ((width + 7) >> 3) * height
+        self.count = len(data) // self.size
+
+    def glyph(self, ch):
+        i = ord(ch) - self.first
+        if i < 0 or i >= self.count:
+            return None
+        return self.data[i * self.size:(i + 1) * self.size]
+
+
+if HAVE_VIPER:
+    # Viper takes at most four arguments: the scalars come in args, an
+    # int32 array of width, height, x, y, glyph width, glyph height, size, color
+    @micropython.viper
+    def text_blit(buf, glyph, args):
+        fb = ptr16(buf)
+        g = ptr8(glyph)
+        a = ptr32(args)
+        width = a[0]
+        height = a[1]
+        x = a[2]
+        y = a[3]
+        gw = a[4]
+        gh = a[5]
+        size = a[6]
+        color = a[7]
+        stride = (gw + 7) >> 3
+        for row in range(gh):
+            ya = y + row * size
+            yb = ya + size
+            if ya < 0:
+                ya = 0
+            if yb > height:
+                yb = height
+            if ya >= yb:
+                continue
+            base = row * stride
+            col = 0
+            while col < gw:
+                if g[base + (col >> 3)] & (0x80 >> (col & 7)):
+                    start = col
+                    col += 1
+                    while col < gw:
+                        if (g[base + (col >> 3)] & (0x80 >> (col & 7))) == 0:
+                            break
+                        col += 1
+                    xa = x + start * size
+                    xb = x + col * size
+                    if xa < 0:
+                        xa = 0
+                    if xb > width:
+                        xb = width
+                    yy = ya
+                    while yy < yb:
+                        p = yy * width
+                        xx = xa
+                        while xx < xb:
+                            fb[p + xx] = color
+                            xx += 1
+                        yy += 1
+                else:
+                    col += 1
+else:
+    text_blit = None
+
+
 if __name__=='__main__':
     pwm = PWM(Pin(BL))
     pwm.freq(1000)
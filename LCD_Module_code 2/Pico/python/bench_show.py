@@ -0,0 +1,86 @@
+"""Updates per second of Pico-LCD-1.47.py, without a Pico
+
+Runs the driver against the counting mocks in pico_mock.py, on the
+MicroPython unix port or CPython:
+
+    cd Pico/python && micropython bench_show.py
+    python3 bench_show.py
+
+The time of an update is modelled from those counts: bytes at the real
+SPI clock plus a fixed cost per Python-level SPI write, pin change and
+buffer allocation. The costs below are assumptions for a 125 MHz RP2040;
+time a few calls with time.ticks_us() on the board to replace them.
+"""
+
+from pico_mock import Counters, load_driver
+
+SPI_HZ = 62_500_000     # SPI(1, 100 MHz) runs at clk_peri / 2 on the RP2040
+T_WRITE_US = 8.0        # one spi.write() call from Python
+T_PIN_US = 2.0          # one Pin.__call__()
+T_ALLOC_US = 4.0        # one bytearray([x])
+
+LCD_1inch47 = load_driver()['LCD_1inch47']
+
+
+class Legacy(LCD_1inch47):
+    """The driver before the change: one allocation and CS cycle per byte"""
+
+    def write_cmd(self, cmd, data=None):
+        self.cs(1)
+        self.dc(0)
+        self.cs(0)
+        self.spi.write(bytearray([cmd]))
+        self.cs(1)
+        for b in data or b'':
+            self.write_data(b)
+
+    def write_data(self, buf):
+        self.cs(1)
+        self.dc(1)
+        self.cs(0)
+        self.spi.write(bytearray([buf]))
+        self.cs(1)
+
+    def show(self, x=0, y=0, w=None, h=None):
+        for cmd, data in ((0x2A, b'\x00\x00\x01\x3f'), (0x2B, b'\x00\x22\x00\xCD')):
+            self.write_cmd(cmd)
+            for b in data:
+                self.write_data(b)
+        self.write_cmd(0x2C)
+        self.cs(1)
+        self.dc(1)
+        self.cs(0)
+        self.spi.write(self.buffer)
+        self.cs(1)
+
+
+def run(name, lcd, update, legacy=False):
+    Counters.reset()
+    update()
+    allocs = (Counters.writes - 1) if legacy else 0
+    bus_us = (Counters.bytes + Counters.dma_bytes) * 8e6 / SPI_HZ
+    cpu_us = Counters.writes * T_WRITE_US + Counters.pins * T_PIN_US + allocs * T_ALLOC_US
+    total_us = cpu_us + bus_us          # with DMA the CPU is free during bus_us
+    print('%-22s %7d %6d %5d %5d %8.0f %8.0f %8.1f' % (
+        name, Counters.bytes + Counters.dma_bytes, Counters.writes, Counters.pins, allocs,
+        cpu_us, total_us, 1e6 / total_us))
+
+
+def main():
+    old = Legacy()
+    new = LCD_1inch47()
+    new.fill_rect(10, 40, 100, 30, new.WHITE)
+
+    print('SPI %.1f MHz; assumed %.0f us per write, %.0f us per pin, %.0f us per alloc'
+          % (SPI_HZ / 1e6, T_WRITE_US, T_PIN_US, T_ALLOC_US))
+    print('%-22s %7s %6s %5s %5s %8s %8s %8s' % (
+        'update', 'bytes', 'writes', 'pins', 'alloc', 'cpu us', 'total us', 'per s'))
+    run('before: full', old, old.show, legacy=True)
+    run('full', new, new.show)
+    run('30 rows', new, lambda: new.show(0, 40, None, 30))
+    run('30 rows async (DMA)', new, lambda: (new.show_async(40, 30), new.wait()))
+    run('100x30 box', new, lambda: new.show(10, 40, 100, 30))
+    run('16x16 box', new, lambda: new.show(10, 40, 16, 16))
+
+
+main()
@@ -0,0 +1,105 @@
+"""Labels per second of write_text(), without a Pico
+
+Draws "Raspberry Pi Pico" at sizes 1-4 with the old write_text()
+(render, read back every pixel, one fill_rect per lit pixel), with
+fill_rect runs, and with the viper blitter, and checks that all three
+leave the same pixels. Uses the mocks in pico_mock.py:
+
+    cd Pico/python && micropython bench_text.py
+    python3 bench_text.py
+
+On the MicroPython unix port the timings show the interpreter cost that
+dominates on the Pico. Under CPython there is no viper emitter: the
+viper function runs as plain Python and its timing means nothing, but
+the pixel check and the call counts still hold.
+"""
+
+import time
+
+from pico_mock import MOCK_FRAMEBUF, load_driver
+
+LABEL = 'Raspberry Pi Pico'
+
+plain = load_driver()
+viper = load_driver(viper=True)
+
+
+class Legacy(plain['LCD_1inch47']):
+    def write_text(self, text, x, y, size, color, font=None):
+        background = self.pixel(x, y)
+        info = []
+        self.text(text, x, y, color)
+        for i in range(x, x + (8 * len(text))):
+            for j in range(y, y + 8):
+                px_color = self.pixel(i, j)
+                info.append((i, j, px_color)) if px_color == color else None
+        self.text(text, x, y, background)
+        for px_info in info:
+            self.fill_rect(size * px_info[0] - (size - 1) * x, size * px_info[1] - (size - 1) * y,
+                           size, size, px_info[2])
+
+
+def counting(cls):
+    """cls with pixel/fill_rect/text calls counted"""
+    class Counting(cls):
+        calls = 0
+
+        def pixel(self, *a):
+            self.calls += 1
+            return super().pixel(*a)
+
+        def fill_rect(self, *a):
+            self.calls += 1
+            return super().fill_rect(*a)
+
+        def text(self, *a):
+            self.calls += 1
+            return super().text(*a)
+    return Counting
+
+
+def ms():
+    try:
+        return time.ticks_ms()
+    except AttributeError:
+        return time.time() * 1000
+
+
+def run(cls, size, loops):
+    lcd = cls()
+    lcd.fill(0)
+    lcd.write_text(LABEL, 4, 4, size, 0xFFFF)   # warm the glyph cache
+    t0 = ms()
+    for _ in range(loops):
+        lcd.write_text(LABEL, 4, 4, size, 0xFFFF)
+    dt = ms() - t0
+    c = counting(cls)()
+    c.fill(0)
+    c.calls = 0
+    c.write_text(LABEL, 4, 4, size, 0xFFFF)
+    return loops * 1000.0 / max(dt, 1), c.calls, bytes(c.buffer)
+
+
+def main():
+    loops = 2 if MOCK_FRAMEBUF else 50
+    impls = (('before', Legacy), ('runs', plain['LCD_1inch47']), ('viper', viper['LCD_1inch47']))
+    print('"%s" (%d chars), %d loops%s' % (LABEL, len(LABEL), loops,
+                                           ', mock framebuf' if MOCK_FRAMEBUF else ''))
+    print('size  ' + ''.join('%10s/s %6s' % (name, 'calls') for name, _ in impls) + '  same')
+    ok = True
+    for size in range(1, 5):
+        line = '%4d  ' % size
+        ref = None
+        same = True
+        for name, cls in impls:
+            rate, calls, pixels = run(cls, size, loops)
+            line += '%12.1f %6d' % (rate, calls)
+            ref = ref or pixels
+            same = same and pixels == ref
+        ok = ok and same
+        print(line + '  ' + ('yes' if same else 'NO'))
+    return ok
+
+
+if not main():
+    raise SystemExit(1)
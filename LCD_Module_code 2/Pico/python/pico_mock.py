@@ -0,0 +1,194 @@
+"""Stand-ins for the Pico hardware modules, for running Pico-LCD-1.47.py on a PC
+
+Installs counting mocks of machine.Pin / machine.SPI / machine.PWM and
+rp2.DMA, plus framebuf when the interpreter has none (CPython), then
+loads the driver with load_driver(). Used by bench_show.py and
+bench_text.py; works on the MicroPython unix port and CPython.
+"""
+
+import sys
+
+
+class Counters:
+    writes = 0
+    bytes = 0
+    pins = 0
+    dma_bytes = 0
+
+    @classmethod
+    def reset(cls):
+        cls.writes = cls.bytes = cls.pins = cls.dma_bytes = 0
+
+
+class Pin:
+    OUT = 1
+
+    def __init__(self, *args, **kw):
+        self.level = 1
+
+    def __call__(self, level=None):
+        if level is None:
+            return self.level
+        Counters.pins += 1
+        self.level = level
+
+    def value(self, level=None):
+        return self(level)
+
+
+class SPI:
+    def __init__(self, *args, **kw):
+        pass
+
+    def write(self, buf):
+        Counters.writes += 1
+        Counters.bytes += len(buf)
+
+
+class PWM:
+    def __init__(self, pin):
+        pass
+
+
+class DMA:
+    def pack_ctrl(self, **kw):
+        return 0
+
+    def config(self, read=None, write=None, count=0, ctrl=0, trigger=False):
+        Counters.dma_bytes += count
+
+    def active(self):
+        return False
+
+
+class Mem32:
+    def __getitem__(self, addr):
+        return 0
+
+
+class machine:
+    Pin = Pin
+    SPI = SPI
+    PWM = PWM
+    mem32 = Mem32()
+
+
+class rp2:
+    DMA = DMA
+
+
+class os:
+    """Only uname(), so that the driver sees a Pico"""
+    chip = 'RP2040'
+
+    class _Uname:
+        pass
+
+    @classmethod
+    def uname(cls):
+        u = cls._Uname()
+        u.machine = 'Raspberry Pi Pico with ' + cls.chip
+        return u
+
+
+sys.modules['machine'] = machine
+sys.modules['rp2'] = rp2
+
+try:
+    import framebuf
+    MOCK_FRAMEBUF = False
+except ImportError:
+    MOCK_FRAMEBUF = True
+
+    class framebuf:
+        """RGB565 and MONO_HLSB only; text() uses made-up 8x8 glyphs"""
+        RGB565 = 1
+        MONO_HLSB = 3
+
+        class FrameBuffer:
+            def __init__(self, buf, width, height, fmt):
+                self._buf = buf
+                self._w = width
+                self._h = height
+                self._fmt = fmt
+
+            def pixel(self, x, y, c=None):
+                return self._px(x, y, c)
+
+            def _px(self, x, y, c=None):
+                if not (0 <= x < self._w and 0 <= y < self._h):
+                    return None
+                b = self._buf
+                if self._fmt == framebuf.MONO_HLSB:
+                    i = y * ((self._w + 7) >> 3) + (x >> 3)
+                    m = 0x80 >> (x & 7)
+                    if c is None:
+                        return 1 if b[i] & m else 0
+                    b[i] = (b[i] | m) if c else (b[i] & ~m)
+                else:
+                    i = 2 * (y * self._w + x)
+                    if c is None:
+                        return b[i] | (b[i + 1] << 8)
+                    b[i] = c & 0xFF
+                    b[i + 1] = (c >> 8) & 0xFF
+
+            def fill_rect(self, x, y, w, h, c):
+                for yy in range(max(y, 0), min(y + h, self._h)):
+                    for xx in range(max(x, 0), min(x + w, self._w)):
+                        self._px(xx, yy, c)
+
+            def fill(self, c):
+                self.fill_rect(0, 0, self._w, self._h, c)
+
+            def text(self, s, x, y, c=1):
+                for ch in s:
+                    for r in range(8):
+                        bits = 0 if ch == ' ' else ((ord(ch) * (r + 3) * 37) >> 2) & 0xFF
+                        for k in range(8):
+                            if bits & (0x80 >> k):
+                                self._px(x + k, y + r, c)
+                    x += 8
+
+    sys.modules['framebuf'] = framebuf
+
+
+class _Ptr16:
+    """ptr16() for running the viper code under CPython"""
+
+    def __init__(self, buf):
+        self.m = memoryview(buf).cast('H')
+
+    def __getitem__(self, i):
+        return self.m[i]
+
+    def __setitem__(self, i, v):
+        self.m[i] = v & 0xFFFF
+
+
+def load_driver(viper=False, chip='RP2040'):
+    """Globals of Pico-LCD-1.47.py; viper=True runs its viper code as plain
+    Python when the interpreter has no viper emitter. chip goes into
+    os.uname().machine, which picks the SPI1 registers for DMA"""
+    if viper and 'micropython' not in sys.modules:
+        try:
+            import micropython
+        except ImportError:
+            class micropython:
+                @staticmethod
+                def viper(fn):
+                    return fn
+            sys.modules['micropython'] = micropython
+    scope = {'__name__': 'lcd', 'ptr8': lambda b: b, 'ptr16': _Ptr16, 'ptr32': lambda b: b}
+    os.chip = chip
+    real_os = sys.modules.get('os')
+    sys.modules['os'] = os
+    try:
+        exec(open('Pico-LCD-1.47.py').read(), scope)
+    finally:
+        if real_os is not None:
+            sys.modules['os'] = real_os
+        else:
+            del sys.modules['os']
+    if not viper:
+        scope['text_blit'] = None
+    return scope
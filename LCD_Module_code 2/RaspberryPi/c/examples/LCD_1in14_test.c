@@ -33,8 +33,6 @@ void LCD_1IN14_test(void)
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
     Paint_NewImage(BlackImage,LCD_1IN14.WIDTH,LCD_1IN14.HEIGHT, 0, WHITE, 16);
     Paint_Clear(WHITE);
-	Paint_SetRotate(ROTATE_0);
-	
     // /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
@@ -67,7 +65,6 @@ void LCD_1IN14_test(void)
 	DEV_Delay_ms(2000);
     // /* show bmp */
 	printf("show bmp\r\n");
-	Paint_SetRotate(ROTATE_0);
 	GUI_ReadBmp("./pic/LCD_1inch14.bmp"); 
     LCD_1IN14_Display(BlackImage);
     DEV_Delay_ms(2000);
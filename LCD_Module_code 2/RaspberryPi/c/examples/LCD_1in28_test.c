@@ -35,7 +35,6 @@ void LCD_1IN28_test(void)
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
     Paint_NewImage(BlackImage, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, 0, BLACK, 16);
     Paint_Clear(BLACK);
-	Paint_SetRotate(ROTATE_0);
 	// /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
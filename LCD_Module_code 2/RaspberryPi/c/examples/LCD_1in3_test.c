@@ -21,6 +21,7 @@ void LCD_1IN3_test(void)
     /* LCD Init */
 	printf("1.3inch LCD demo...\r\n");
 	LCD_1IN3_Init(HORIZONTAL);
+	LCD_1IN3_SetOrientation(180, LCD_MIRROR_NONE);
 	LCD_1IN3_Clear(WHITE);
     LCD_SetBacklight(1023);
 	
@@ -32,9 +33,8 @@ void LCD_1IN3_test(void)
         exit(0);
     }
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
-    Paint_NewImage(BlackImage, LCD_1IN3_WIDTH, LCD_1IN3_HEIGHT, 0, WHITE, 16);
+    Paint_NewImage(BlackImage, LCD.WIDTH, LCD.HEIGHT, ROTATE_0, WHITE, 16);
     Paint_Clear(WHITE);
-	Paint_SetRotate(ROTATE_90);
     // /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
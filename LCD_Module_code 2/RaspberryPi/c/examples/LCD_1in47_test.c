@@ -22,6 +22,7 @@ void LCD_1IN47_test(void)
     /* LCD Init */
 	printf("1.47inch LCD demo...\r\n");
 	LCD_1IN47_Init(HORIZONTAL);
+	LCD_1IN47_SetOrientation(90, LCD_MIRROR_NONE);
     LCD_1IN47_Clear(BLACK);
 	LCD_SetBacklight(1023);
 	
@@ -33,7 +34,7 @@ void LCD_1IN47_test(void)
         exit(0);
     }
     /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
-    Paint_NewImage(BlackImage, LCD_1IN47_WIDTH, LCD_1IN47_HEIGHT, 90, BLACK, 16);
+    Paint_NewImage(BlackImage, LCD_1IN47.WIDTH, LCD_1IN47.HEIGHT, ROTATE_0, BLACK, 16);
     Paint_Clear(WHITE);
 	/* GUI */
 
@@ -127,7 +128,8 @@ void LCD_1IN47_test(void)
    
     // /* show bmp */
 	// printf("show bmp\r\n");
-    Paint_SetRotate(ROTATE_0);
+    LCD_1IN47_SetOrientation(0, LCD_MIRROR_NONE);
+    Paint_NewImage(BlackImage, LCD_1IN47.WIDTH, LCD_1IN47.HEIGHT, ROTATE_0, BLACK, 16);
 	GUI_ReadBmp("./pic/LCD_1inch47.bmp"); 
 
     LCD_1IN47_Display(BlackImage);
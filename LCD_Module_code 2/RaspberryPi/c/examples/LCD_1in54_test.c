@@ -21,6 +21,7 @@ void LCD_1IN54_test(void)
     /* LCD Init */
 	printf("1.54inch LCD demo...\r\n");
 	LCD_1IN54_Init(HORIZONTAL);
+	LCD_1IN54_SetOrientation(180, LCD_MIRROR_NONE);
 	LCD_1IN54_Clear(WHITE);
 	LCD_SetBacklight(1023);
     
@@ -31,9 +32,8 @@ void LCD_1IN54_test(void)
         exit(0);
     }
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
-    Paint_NewImage(BlackImage, LCD_1IN54_WIDTH, LCD_1IN54_HEIGHT, 0, WHITE, 16);
+    Paint_NewImage(BlackImage, LCD_1IN54.WIDTH, LCD_1IN54.HEIGHT, ROTATE_0, WHITE, 16);
     Paint_Clear(WHITE);
-	Paint_SetRotate(ROTATE_90);
     // /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
@@ -21,6 +21,7 @@ void LCD_1IN69_test(void)
     /* LCD Init */
     printf("1.69inch LCD demo...\r\n");
     LCD_1IN69_Init(VERTICAL);
+    LCD_1IN69_SetOrientation(90, LCD_MIRROR_NONE);
     LCD_1IN69_Clear(WHITE);
     
     LCD_SetBacklight(1023);
@@ -33,7 +34,7 @@ void LCD_1IN69_test(void)
         exit(0);
     }
     /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
-    Paint_NewImage(BlackImage, LCD_1IN69_WIDTH, LCD_1IN69_HEIGHT, 90, WHITE, 16);
+    Paint_NewImage(BlackImage, LCD_1IN69.WIDTH, LCD_1IN69.HEIGHT, ROTATE_0, WHITE, 16);
     Paint_SelectImage(BlackImage);
     Paint_Clear(WHITE);
     /* GUI */
@@ -67,7 +68,7 @@ void LCD_1IN69_test(void)
     LCD_1IN69_Display(BlackImage);
     DEV_Delay_ms(2000);
 
-    Paint_NewImage(BlackImage, 40, 110, 90, WHITE, 16);
+    Paint_NewImage(BlackImage, 110, 40, ROTATE_0, WHITE, 16);
     PAINT_TIME sPaint_time; //time struct
     sPaint_time.Hour = 12;
     sPaint_time.Min = 34;
@@ -96,14 +97,15 @@ void LCD_1IN69_test(void)
             break;
         }
 
-        LCD_1IN69_DisplayWindows(130, 170, 170, 280, BlackImage);
+        LCD_1IN69_DisplayWindows(170, 70, 280, 110, BlackImage);
         // DEV_Delay_ms(500);
     }
     DEV_Delay_ms(1000);
     
     // /* show bmp */
     printf("show bmp\r\n");
-    Paint_NewImage(BlackImage, LCD_1IN69_WIDTH, LCD_1IN69_HEIGHT, 0, BLACK, 16);
+    LCD_1IN69_SetOrientation(0, LCD_MIRROR_NONE);
+    Paint_NewImage(BlackImage, LCD_1IN69.WIDTH, LCD_1IN69.HEIGHT, ROTATE_0, BLACK, 16);
     char *BmpPath[3] = {"./pic/LCD_1inch69_1.bmp", "./pic/LCD_1inch69_2.bmp", "./pic/LCD_1inch69_3.bmp"};
     for(UBYTE i=0; i<3; i++) {
         GUI_ReadBmp(BmpPath[i]);
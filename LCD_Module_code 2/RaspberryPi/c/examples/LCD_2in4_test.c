@@ -34,7 +34,6 @@ void LCD_2IN4_test(void)
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
     Paint_NewImage(BlackImage, LCD_2IN4_WIDTH, LCD_2IN4_HEIGHT, 0, WHITE, 16);
     Paint_Clear(WHITE);
-	Paint_SetRotate(ROTATE_0);
     // /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
@@ -21,6 +21,7 @@ void LCD_2IN_test(void)
     /* LCD Init */
 	printf("2inch LCD demo...\r\n");
 	LCD_2IN_Init();
+	LCD_2IN_SetOrientation(270, LCD_MIRROR_NONE);
 	LCD_2IN_Clear(WHITE);
 	LCD_SetBacklight(1023);
 	
@@ -32,9 +33,8 @@ void LCD_2IN_test(void)
     }
 	
     // /*1.Create a new image cache named IMAGE_RGB and fill it with white*/
-    Paint_NewImage(BlackImage, LCD_2IN_WIDTH, LCD_2IN_HEIGHT, 90, WHITE, 16);
+    Paint_NewImage(BlackImage, LCD_2IN.WIDTH, LCD_2IN.HEIGHT, ROTATE_0, WHITE, 16);
     Paint_Clear(WHITE);
-	Paint_SetRotate(ROTATE_270);
     // /* GUI */
     printf("drawing...\r\n");
     // /*2.Drawing on the image*/
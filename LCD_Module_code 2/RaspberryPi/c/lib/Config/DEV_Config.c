@@ -11,6 +11,129 @@
 ******************************************************************************/
 #include "DEV_Config.h"
 
+#ifdef LCD_TRACE
+#include "lcd_trace.h"
+#include <stdlib.h>
+#include <time.h>
+
+#define TRACE_TICKS_PER_SEC 10000000    // 0.1 us, wraps after 7 minutes
+#ifdef USE_BCM2835_LIB
+#define TRACE_SPI_HZ        7812500     // 250 MHz core / BCM2835_SPI_CLOCK_DIVIDER_32
+#else
+#define TRACE_SPI_HZ        25000000
+#endif
+
+static LCD_Trace Trace;
+static uint8_t Trace_Buf[4096];
+static FILE *Trace_File = NULL;
+
+static uint32_t Trace_Clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * TRACE_TICKS_PER_SEC + ts.tv_nsec / 100);
+}
+
+static void Trace_Write(const uint8_t *data, uint16_t len, void *ctx)
+{
+    fwrite(data, 1, len, (FILE *)ctx);
+}
+
+static void Trace_Close(void)
+{
+    if(Trace_File == NULL)
+        return;
+    LCD_Trace_Flush(&Trace);
+    fclose(Trace_File);
+    Trace_File = NULL;
+}
+
+/******************************************************************************
+function:	Start the bus trace (build with TRACE = -D LCD_TRACE)
+parameter:
+Info:		Written to $LCD_TRACE, or lcd.trc; replay it with sim/trace_replay
+******************************************************************************/
+static void Trace_Open(void)
+{
+    const char *path = getenv("LCD_TRACE");
+
+    if(path == NULL || *path == 0)
+        path = "lcd.trc";
+    Trace_File = fopen(path, "wb");
+    if(Trace_File == NULL) {
+        DEBUG("cannot open trace file %s\r\n", path);
+        return;
+    }
+    LCD_Trace_Init(&Trace, Trace_Buf, sizeof(Trace_Buf), Trace_Clock, Trace_Write, Trace_File,
+                   TRACE_TICKS_PER_SEC, TRACE_SPI_HZ);
+    atexit(Trace_Close);
+}
+
+/******************************************************************************
+function:	Trace one SPI transfer
+parameter:
+Info:		The examples leave CS to the hardware CE0, which goes low for
+            each transfer, so the CS edges are recorded here. Bytes are
+            stamped from the start of the transfer.
+******************************************************************************/
+static void Trace_Transfer(const uint8_t *pData, uint32_t Len)
+{
+    if(Trace_File == NULL)
+        return;
+    LCD_Trace_Pin(&Trace, 0, LCD_TRACE_CS, 0);
+    LCD_Trace_Bytes(&Trace, pData, Len);
+}
+
+static void Trace_Pin(UWORD Pin, UBYTE Value)
+{
+    if(Trace_File == NULL)
+        return;
+    if(Pin == LCD_DC)
+        LCD_Trace_Pin(&Trace, 0, LCD_TRACE_DC, Value);
+    else if(Pin == LCD_RST)
+        LCD_Trace_Pin(&Trace, 0, LCD_TRACE_RST, Value);
+    else if(Pin == LCD_BL)
+        LCD_Trace_Pin(&Trace, 0, LCD_TRACE_BL, Value);
+}
+#endif
+
+#ifdef USE_FAKE_LIB
+#include <time.h>
+
+static UDOUBLE Fake_Hz = 25000000;
+static uint64_t Fake_Due = 0;      // ns, when the last transfer is done
+
+static uint64_t Fake_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/******************************************************************************
+function:	Take as long as Len bytes at Fake_Hz
+parameter:
+Info:		Transfers queue up on a timeline and the caller sleeps once
+            it is more than 1 ms ahead, so short transfers cost no sleep
+            overshoot each. Per-transfer gaps of a real controller are
+            not modelled.
+******************************************************************************/
+static void Fake_Transfer(uint32_t Len)
+{
+    uint64_t now = Fake_Now();
+    struct timespec ts;
+
+    if(Fake_Due < now)
+        Fake_Due = now;
+    Fake_Due += (uint64_t)Len * 8000000000ULL / Fake_Hz;
+    if(Fake_Due - now > 1000000) {
+        ts.tv_sec = Fake_Due / 1000000000ULL;
+        ts.tv_nsec = Fake_Due % 1000000000ULL;
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+    }
+}
+#endif
+
 #if USE_DEV_LIB
 int GPIO_Handle;
 int SPI_Handle;
@@ -57,9 +180,17 @@ void DEV_Digital_Write(UWORD Pin, UBYTE Value)
     digitalWrite(Pin, Value);
 
 #elif  USE_DEV_LIB  
+#ifdef DEV_GPIOMEM
+    if(GpioMem_Set != NULL)
+        DEV_GpioMem_Write(Pin, Value);
+    else
+#endif
     lgGpioWrite(GPIO_Handle, Pin, Value);
     
 #endif
+#ifdef LCD_TRACE
+    Trace_Pin(Pin, Value);
+#endif
 }
 
 UBYTE DEV_Digital_Read(UWORD Pin)
@@ -74,6 +205,9 @@ UBYTE DEV_Digital_Read(UWORD Pin)
 #elif  USE_DEV_LIB  
     Read_value = lgGpioRead(GPIO_Handle,Pin);
 
+#elif USE_FAKE_LIB
+    Read_value = 1;     // keys are pulled up: not pressed
+
 #endif
     return Read_value;
 }
@@ -112,6 +246,10 @@ void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
 **/
 void DEV_Delay_ms(UDOUBLE xms)
 {
+#ifdef LCD_TRACE
+    if(Trace_File != NULL)
+        LCD_Trace_Delay(&Trace, xms * 1000);
+#endif
 #ifdef USE_BCM2835_LIB
     bcm2835_delay(xms);
 #elif USE_WIRINGPI_LIB
@@ -120,6 +258,9 @@ void DEV_Delay_ms(UDOUBLE xms)
 #elif  USE_DEV_LIB  
     lguSleep(xms/1000.0);
 
+#elif USE_FAKE_LIB
+    usleep(xms * 1000);
+
 #endif
 }
 
@@ -149,6 +290,9 @@ Info:
 ******************************************************************************/
 UBYTE DEV_ModuleInit(void)
 {
+#ifdef LCD_TRACE
+    Trace_Open();
+#endif
 
  #ifdef USE_BCM2835_LIB
     if(!bcm2835_init()) {
@@ -215,14 +359,28 @@ UBYTE DEV_ModuleInit(void)
     }
     SPI_Handle = lgSpiOpen(0, 0, 25000000, 0);
     DEV_GPIO_Init();
+#ifdef DEV_GPIOMEM
+    // lgpio has claimed the lines as outputs; from now on writes are stores
+    if(DEV_GpioMem_Open() == 0)
+        DEBUG("GPIO writes through the mapped registers\r\n");
+    else
+        DEBUG("no /dev/gpiomem, GPIO writes through lgpio\r\n");
+#endif
     t1 = lgThreadStart(BL_PWM, "thread 1");
 	
+#elif USE_FAKE_LIB
+    DEV_GPIO_Init();
+    DEBUG("fake backend: no hardware, SPI transfers sleep for their bus time\r\n");
+
 #endif
     return 0;
 }
 
 void DEV_SPI_WriteByte(uint8_t Value)
 {
+#ifdef LCD_TRACE
+    Trace_Transfer(&Value, 1);
+#endif
 #ifdef USE_BCM2835_LIB
     bcm2835_spi_transfer(Value);
     
@@ -232,11 +390,21 @@ void DEV_SPI_WriteByte(uint8_t Value)
 #elif  USE_DEV_LIB 
     lgSpiWrite(SPI_Handle,(char*)&Value, 1);
     
+#elif USE_FAKE_LIB
+    Fake_Transfer(1);
+
+#endif
+#ifdef LCD_TRACE
+    if(Trace_File != NULL)
+        LCD_Trace_Pin(&Trace, 0, LCD_TRACE_CS, 1);
 #endif
 }
 
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
 {
+#ifdef LCD_TRACE
+    Trace_Transfer(pData, Len);
+#endif
 #ifdef USE_BCM2835_LIB
     uint8_t rData[Len];
     bcm2835_spi_transfernb((char *)pData,(char *)rData,Len);
@@ -247,9 +415,57 @@ void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
 #elif  USE_DEV_LIB 
     lgSpiWrite(SPI_Handle,(char*) pData, Len);
 
+#elif USE_FAKE_LIB
+    Fake_Transfer(Len);
+
+#endif
+#ifdef LCD_TRACE
+    if(Trace_File != NULL)
+        LCD_Trace_Pin(&Trace, 0, LCD_TRACE_CS, 1);
 #endif
 }
 
+/******************************************************************************
+function:	Change the SPI clock after DEV_ModuleInit()
+parameter:
+    Hz : Requested clock
+Info:		Returns the clock actually set. bcm2835 divides the 250 MHz
+            core clock by an even number, rounded down to at most Hz;
+            spidev (wiringPi, lgpio) is reopened at Hz and the kernel
+            driver rounds it; 0 if it could not be reopened, and SPI
+            stays closed until a later call succeeds.
+******************************************************************************/
+UDOUBLE DEV_SPI_SetSpeed(UDOUBLE Hz)
+{
+#ifdef USE_BCM2835_LIB
+    UDOUBLE Div = (BCM2835_CORE_CLK_HZ + Hz - 1) / Hz;
+
+    Div += Div & 1;
+    bcm2835_spi_setClockDivider(Div);
+    return BCM2835_CORE_CLK_HZ / Div;
+
+#elif USE_WIRINGPI_LIB
+    close(wiringPiSPIGetFd(0));
+    if(wiringPiSPISetup(0, Hz) < 0) {
+        DEBUG("spidev could not be reopened at %lu Hz\r\n", (unsigned long)Hz);
+        return 0;
+    }
+
+#elif  USE_DEV_LIB 
+    lgSpiClose(SPI_Handle);
+    SPI_Handle = lgSpiOpen(0, 0, Hz, 0);
+    if(SPI_Handle < 0) {
+        DEBUG("spidev could not be reopened at %lu Hz\r\n", (unsigned long)Hz);
+        return 0;
+    }
+
+#elif USE_FAKE_LIB
+    Fake_Hz = Hz;
+
+#endif
+    return Hz;
+}
+
 /******************************************************************************
 function:	Module exits, closes SPI and BCM2835 library
 parameter:
@@ -263,6 +479,11 @@ void DEV_ModuleExit(void)
 #elif USE_WIRINGPI_LIB
 
 #elif USE_DEV_LIB 
-
+#ifdef DEV_GPIOMEM
+    DEV_GpioMem_Close();
+#endif
+#endif
+#ifdef LCD_TRACE
+    Trace_Close();
 #endif
 }
\ No newline at end of file
@@ -16,13 +16,22 @@
 
 #ifdef USE_BCM2835_LIB
     #include <bcm2835.h>
+    #define DEV_BACKEND "bcm2835"
 #elif USE_WIRINGPI_LIB
     #include <wiringPi.h>
     #include <wiringPiSPI.h>
+    #define DEV_BACKEND "wiringPi"
 #elif USE_DEV_LIB
     #include <lgpio.h>
     #define LFLAGS 0
     #define NUM_MAXBUF  4
+    #define DEV_BACKEND "lgpio"
+#elif USE_FAKE_LIB
+    // No hardware: pins are ignored, SPI transfers take their time at the clock
+    #define DEV_BACKEND "fake"
+#endif
+#ifdef DEV_GPIOMEM
+    #include "DEV_Gpiomem.h"
 #endif
 #include <unistd.h>
 
@@ -48,14 +57,21 @@
 
 
 //LCD
-#define LCD_CS_0		DEV_Digital_Write(LCD_CS,0)
-#define LCD_CS_1		DEV_Digital_Write(LCD_CS,1)
+#if defined(DEV_GPIOMEM) && !defined(LCD_TRACE)
+// One store when the GPIO registers are mapped, lgpio otherwise (the trace needs every write)
+#define LCD_PIN_WRITE(Pin, Value)	(GpioMem_Set ? DEV_GpioMem_Write(Pin, Value) : DEV_Digital_Write(Pin, Value))
+#else
+#define LCD_PIN_WRITE(Pin, Value)	DEV_Digital_Write(Pin, Value)
+#endif
+
+#define LCD_CS_0		LCD_PIN_WRITE(LCD_CS,0)
+#define LCD_CS_1		LCD_PIN_WRITE(LCD_CS,1)
 
-#define LCD_RST_0		DEV_Digital_Write(LCD_RST,0)
-#define LCD_RST_1		DEV_Digital_Write(LCD_RST,1)
+#define LCD_RST_0		LCD_PIN_WRITE(LCD_RST,0)
+#define LCD_RST_1		LCD_PIN_WRITE(LCD_RST,1)
 
-#define LCD_DC_0		DEV_Digital_Write(LCD_DC,0)
-#define LCD_DC_1		DEV_Digital_Write(LCD_DC,1)
+#define LCD_DC_0		LCD_PIN_WRITE(LCD_DC,0)
+#define LCD_DC_1		LCD_PIN_WRITE(LCD_DC,1)
 
 #define LCD_BL_0		DEV_Digital_Write(LCD_BL,0)
 #define LCD_BL_1		DEV_Digital_Write(LCD_BL,1)
@@ -91,5 +107,6 @@ void DEV_Delay_ms(UDOUBLE xms);
 
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
+UDOUBLE DEV_SPI_SetSpeed(UDOUBLE Hz);
 void DEV_SetBacklight(UWORD Value);
 #endif
@@ -0,0 +1,101 @@
+/*****************************************************************************
+* | File      	:   DEV_Gpiomem.c
+* | Function    :   GPIO writes through the memory-mapped GPIO registers
+* | Info        :
+*   Under USE_DEV_LIB every DEV_Digital_Write() is an lgGpioWrite(), an
+*   ioctl into the kernel, and LCD_xxx_SetWindows() writes DC eleven
+*   times. /dev/gpiomem (Pi 0-4) and /dev/gpiomem0 (Pi 5, RP1) map the
+*   GPIO registers into user space without root. Both chips have
+*   write-only set and clear registers, so a pin write is one store with
+*   no read-modify-write and no lock.
+*
+*   lgpio still claims the lines and makes them outputs; only the writes
+*   take this path. When neither device can be mapped, DEV_Config.c
+*   keeps using lgpio.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "DEV_Gpiomem.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+volatile uint32_t *GpioMem_Set = NULL;
+volatile uint32_t *GpioMem_Clr = NULL;
+
+static void *GpioMem_Base = NULL;
+static size_t GpioMem_Len = 0;
+
+static const struct {
+    const char *path;
+    size_t size;        // Bytes mapped
+    uint32_t set, clr;  // Register offsets
+} GpioMem_Layout[] = {
+    // BCM2835..2711: GPIO block, GPSET0 and GPCLR0
+    [GPIOMEM_BCM] = { "/dev/gpiomem",  0x1000,  0x001C, 0x0028 },
+    // RP1: io_bank0, sys_rio0 at 0x10000, pads_bank0; RIO_OUT set (+0x2000) and clear (+0x3000)
+    [GPIOMEM_RP1] = { "/dev/gpiomem0", 0x30000, 0x12000, 0x13000 },
+};
+
+const char *DEV_GpioMem_Path(uint8_t Layout)
+{
+    return GpioMem_Layout[Layout].path;
+}
+
+size_t DEV_GpioMem_Size(uint8_t Layout)
+{
+    return GpioMem_Layout[Layout].size;
+}
+
+/******************************************************************************
+function:	Map a GPIO register page
+parameter:
+    Path   : Device, or any file at least DEV_GpioMem_Size() long (tests)
+    Layout : GPIOMEM_BCM or GPIOMEM_RP1
+Info:		Returns 0 on success; on failure nothing stays mapped
+******************************************************************************/
+int DEV_GpioMem_Map(const char *Path, uint8_t Layout)
+{
+    int fd;
+    void *base;
+
+    DEV_GpioMem_Close();
+    fd = open(Path, O_RDWR | O_SYNC);
+    if(fd < 0)
+        return -1;
+    base = mmap(NULL, GpioMem_Layout[Layout].size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED)
+        return -1;
+
+    GpioMem_Base = base;
+    GpioMem_Len = GpioMem_Layout[Layout].size;
+    GpioMem_Set = (volatile uint32_t *)((uint8_t *)base + GpioMem_Layout[Layout].set);
+    GpioMem_Clr = (volatile uint32_t *)((uint8_t *)base + GpioMem_Layout[Layout].clr);
+    return 0;
+}
+
+/******************************************************************************
+function:	Map the GPIO registers of this Pi
+parameter:
+Info:		/dev/gpiomem0 only exists on the Pi 5, so it is tried first
+******************************************************************************/
+int DEV_GpioMem_Open(void)
+{
+    if(DEV_GpioMem_Map(GpioMem_Layout[GPIOMEM_RP1].path, GPIOMEM_RP1) == 0)
+        return 0;
+    return DEV_GpioMem_Map(GpioMem_Layout[GPIOMEM_BCM].path, GPIOMEM_BCM);
+}
+
+void DEV_GpioMem_Close(void)
+{
+    if(GpioMem_Base != NULL)
+        munmap(GpioMem_Base, GpioMem_Len);
+    GpioMem_Base = NULL;
+    GpioMem_Set = NULL;
+    GpioMem_Clr = NULL;
+}
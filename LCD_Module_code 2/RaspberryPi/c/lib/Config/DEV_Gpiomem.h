@@ -0,0 +1,44 @@
+/*****************************************************************************
+* | File      	:   DEV_Gpiomem.h
+* | Function    :   GPIO writes through the memory-mapped GPIO registers
+* | Info        :
+*   Build with GPIOMEM = -D DEV_GPIOMEM (USE_DEV_LIB only) and the
+*   LCD_CS/DC/RST macros in DEV_Config.h become one store each.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef _DEV_GPIOMEM_H_
+#define _DEV_GPIOMEM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define GPIOMEM_BCM     0   // Pi 0-4: /dev/gpiomem, GPSET0 / GPCLR0
+#define GPIOMEM_RP1     1   // Pi 5: /dev/gpiomem0, RP1 SYS_RIO0 set / clear aliases
+
+extern volatile uint32_t *GpioMem_Set;  // NULL while nothing is mapped
+extern volatile uint32_t *GpioMem_Clr;
+
+int DEV_GpioMem_Open(void);
+int DEV_GpioMem_Map(const char *Path, uint8_t Layout);
+void DEV_GpioMem_Close(void);
+const char *DEV_GpioMem_Path(uint8_t Layout);
+size_t DEV_GpioMem_Size(uint8_t Layout);
+
+/******************************************************************************
+function:	Drive a pin of bank 0 (GPIO 0..27) with a single store
+parameter:
+Info:		Only valid once DEV_GpioMem_Open() or DEV_GpioMem_Map() succeeded
+******************************************************************************/
+static inline void DEV_GpioMem_Write(uint16_t Pin, uint8_t Value)
+{
+    if(Value)
+        *GpioMem_Set = 1UL << Pin;
+    else
+        *GpioMem_Clr = 1UL << Pin;
+}
+
+#endif
@@ -0,0 +1,471 @@
+/**
+ * @file font24aa.c
+ * @brief Font24AA: generated by tools/fontc.py, do not edit
+ *
+ * Source font48.c, 4 bpp, scale 1/2, 95 glyphs, line 24 px, ascent 20 px
+ * Flash 6256 bytes (bitmap 5474)
+ */
+
+#include "gfx_font.h"
+#include "fonts.h"
+
+static const uint8_t Font24AA_Bitmap[] = {
+    0x41, 0xA3, 0x8F, 0xF8, 0xFF, 0x8F, 0xF8, 0xBF, 0x88, 0xF8, 0x8F, 0x88, 0xF0, 0x8F, 0x08, 0xF0,
+    0x8F, 0x08, 0xF0, 0x48, 0x03, 0x88, 0x88, 0x4F, 0xF8, 0xFF, 0x80, 0xA9, 0x48, 0x40, 0x48, 0x48,
+    0xF8, 0x08, 0xF8, 0x8F, 0x80, 0x8F, 0x08, 0xF8, 0x08, 0xF0, 0x4F, 0x40, 0x8F, 0x00, 0x80, 0x04,
+    0x80, 0x02, 0x91, 0xBB, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x04, 0xF4, 0x03, 0x85, 0xF8, 0x00,
+    0x8F, 0x04, 0x85, 0xF8, 0x00, 0x8F, 0x01, 0x55, 0x01, 0x81, 0x8F, 0x02, 0x81, 0xF8, 0x03, 0x91,
+    0x8F, 0x00, 0x0F, 0x80, 0x00, 0x0B, 0xB0, 0x00, 0xF8, 0x03, 0x85, 0xF8, 0x00, 0x8F, 0x02, 0x4A,
+    0x9D, 0x88, 0xFB, 0x88, 0xBF, 0x88, 0x80, 0x4F, 0x40, 0x08, 0xF0, 0x00, 0x08, 0xF0, 0x00, 0xF8,
+    0x03, 0x91, 0x8F, 0x00, 0x0F, 0x80, 0x00, 0x08, 0xF0, 0x00, 0xF8, 0x02, 0x03, 0x81, 0x8F, 0x07,
+    0x81, 0x8F, 0x05, 0xAB, 0x4F, 0xFF, 0xFB, 0x40, 0x04, 0xFF, 0xBF, 0xBF, 0xB0, 0x0B, 0xF4, 0x8F,
+    0x0B, 0xF4, 0x0F, 0xF0, 0x8F, 0x08, 0xF8, 0x0F, 0xF4, 0x8F, 0x04, 0x83, 0x8F, 0xB8, 0x40, 0x05,
+    0x80, 0xB0, 0x42, 0x06, 0x84, 0xBF, 0xFB, 0x40, 0x05, 0x84, 0x8F, 0xFF, 0x40, 0x04, 0x85, 0x8F,
+    0xBF, 0xF4, 0x03, 0xB0, 0x8F, 0x0B, 0xF8, 0x4F, 0xF0, 0x8F, 0x08, 0xF8, 0x0F, 0xF0, 0x8F, 0x08,
+    0xF8, 0x0F, 0xF4, 0x8F, 0x0B, 0xF8, 0x04, 0xFF, 0xBF, 0xBF, 0xF0, 0x00, 0x80, 0x43, 0x81, 0xB4,
+    0x04, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07, 0x81, 0x48, 0x03, 0x83, 0x4F, 0xFB, 0x03, 0xAB, 0xB4,
+    0x08, 0xF4, 0xF8, 0x00, 0x4B, 0x00, 0xF8, 0x0F, 0x80, 0x08, 0x40, 0x0F, 0x80, 0xF8, 0x00, 0xB0,
+    0x00, 0xF8, 0x0F, 0x80, 0x88, 0x02, 0x91, 0xF8, 0x0F, 0x80, 0xF0, 0x00, 0x08, 0xB4, 0xF8, 0x88,
+    0x03, 0x85, 0x4F, 0xFB, 0x0B, 0x08, 0x85, 0x48, 0x4F, 0xFB, 0x04, 0x91, 0xB0, 0xBB, 0x4F, 0x80,
+    0x00, 0x4B, 0x0F, 0x80, 0xF8, 0x02, 0xB3, 0xB4, 0x0F, 0x80, 0xF8, 0x00, 0x0B, 0x00, 0xF8, 0x0F,
+    0x80, 0x08, 0x40, 0x0F, 0x80, 0xF8, 0x00, 0xF0, 0x00, 0xBB, 0x4F, 0x80, 0x88, 0x00, 0x04, 0xFF,
+    0xB0, 0x01, 0x85, 0x4B, 0xFF, 0xB4, 0x04, 0x85, 0xBF, 0xB8, 0xFB, 0x04, 0x81, 0xFB, 0x01, 0x41,
+    0x04, 0x81, 0xF8, 0x01, 0x41, 0x04, 0x85, 0xF8, 0x00, 0xFB, 0x04, 0x41, 0x83, 0x0B, 0xF4, 0x04,
+    0x84, 0x8F, 0xFF, 0x40, 0x05, 0x83, 0x8F, 0xF4, 0x05, 0x84, 0xBF, 0xFF, 0x40, 0x04, 0x95, 0x4F,
+    0xB4, 0xFF, 0x00, 0x8F, 0x0B, 0xF4, 0x08, 0xFB, 0x0F, 0xF0, 0x41, 0x02, 0x85, 0xBF, 0xBF, 0xF0,
+    0x41, 0x03, 0xA5, 0xBF, 0xF8, 0x08, 0xFB, 0x00, 0x04, 0xFF, 0xB4, 0x4F, 0xFB, 0x88, 0xFF, 0xBF,
+    0xB0, 0x4B, 0xFF, 0xFB, 0x40, 0xB4, 0x8E, 0x8F, 0xB0, 0xF8, 0x0F, 0x80, 0xF8, 0x08, 0x40, 0x02,
+    0x87, 0x4F, 0x40, 0x00, 0xBB, 0x02, 0x97, 0xBF, 0x40, 0x04, 0xF4, 0x00, 0x0F, 0xB0, 0x00, 0x4F,
+    0x40, 0x00, 0x8F, 0x03, 0x81, 0xF8, 0x03, 0x81, 0xF8, 0x03, 0x81, 0xF8, 0x03, 0x81, 0xF8, 0x03,
+    0x81, 0xF8, 0x03, 0x81, 0xF8, 0x03, 0x81, 0x8B, 0x03, 0x8F, 0x8F, 0x40, 0x00, 0x0F, 0xB0, 0x00,
+    0x08, 0xF4, 0x03, 0x81, 0xBF, 0x04, 0x40, 0x87, 0xB0, 0x00, 0x04, 0xF4, 0x81, 0xBB, 0x03, 0x89,
+    0x4F, 0xB0, 0x00, 0x04, 0xF4, 0x03, 0x81, 0xBF, 0x04, 0x81, 0xF8, 0x03, 0x81, 0x8F, 0x04, 0x81,
+    0xF8, 0x03, 0x81, 0xF8, 0x03, 0x81, 0x88, 0x03, 0x81, 0x8F, 0x03, 0x81, 0x8F, 0x03, 0x81, 0x88,
+    0x03, 0x81, 0xF8, 0x03, 0xA1, 0xF8, 0x00, 0x08, 0xF0, 0x00, 0x0F, 0xB0, 0x00, 0x8F, 0x40, 0x04,
+    0xF8, 0x00, 0x4F, 0xB0, 0x00, 0xBB, 0x03, 0x03, 0x82, 0x8F, 0x80, 0x07, 0x9F, 0x8F, 0x80, 0x00,
+    0x08, 0xB4, 0x08, 0xF8, 0x04, 0xB8, 0xBF, 0xF8, 0x8F, 0x88, 0xFF, 0xB0, 0x4B, 0x44, 0x81, 0xB4,
+    0x03, 0x84, 0x4F, 0xFF, 0x40, 0x04, 0x80, 0x80, 0x44, 0x9F, 0x80, 0x08, 0xFF, 0xBB, 0xFB, 0xBF,
+    0xF8, 0x8F, 0x40, 0x8F, 0x80, 0x4F, 0x80, 0x00, 0x08, 0xF8, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82,
+    0x48, 0x40, 0x03, 0x03, 0x81, 0x48, 0x08, 0x81, 0x8F, 0x08, 0x81, 0x8F, 0x08, 0x81, 0x8F, 0x08,
+    0x81, 0x8F, 0x04, 0x4A, 0x8A, 0x88, 0x88, 0xBF, 0x88, 0x88, 0x80, 0x03, 0x81, 0x8F, 0x08, 0x81,
+    0x8F, 0x08, 0x81, 0x8F, 0x08, 0x81, 0x8F, 0x04, 0x8D, 0x8F, 0x88, 0xF8, 0x0B, 0x80, 0xF0, 0x44,
+    0x00, 0x49, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x85, 0x8F, 0x88, 0xF8, 0x08, 0x81, 0x88,
+    0x08, 0x81, 0xF4, 0x07, 0x81, 0xB8, 0x07, 0x81, 0x4F, 0x08, 0x81, 0xB8, 0x07, 0x81, 0x4F, 0x08,
+    0x81, 0xF4, 0x07, 0x81, 0x8B, 0x08, 0x81, 0xF4, 0x07, 0x81, 0x8B, 0x07, 0x81, 0x4F, 0x08, 0x81,
+    0xB8, 0x07, 0x81, 0x4F, 0x08, 0x81, 0xB8, 0x07, 0x81, 0x4B, 0x08, 0x81, 0xF4, 0x07, 0x81, 0x8B,
+    0x08, 0x81, 0xF4, 0x08, 0x04, 0x80, 0x80, 0x06, 0x85, 0x4B, 0xFF, 0xFB, 0x04, 0x41, 0x9F, 0xB8,
+    0xBF, 0xB0, 0x00, 0xBF, 0xB0, 0x00, 0xBF, 0x40, 0x0F, 0xF0, 0x00, 0x04, 0xFB, 0x08, 0xF8, 0x04,
+    0x41, 0x83, 0x08, 0xF8, 0x04, 0x85, 0xBF, 0x08, 0xF8, 0x04, 0x83, 0x8F, 0x08, 0x40, 0x05, 0x83,
+    0x8F, 0x88, 0x40, 0x05, 0x85, 0x8F, 0x88, 0xF4, 0x04, 0x85, 0x8F, 0x08, 0xF8, 0x04, 0x85, 0xBF,
+    0x08, 0xF8, 0x04, 0x41, 0x01, 0x41, 0x03, 0x97, 0x4F, 0xB0, 0x08, 0xFB, 0x00, 0x0B, 0xF4, 0x00,
+    0x0F, 0xFB, 0x8F, 0xFB, 0x04, 0x84, 0xBF, 0xFF, 0xB0, 0x02, 0x03, 0x9B, 0xF8, 0x00, 0x0B, 0xF8,
+    0x00, 0xBF, 0xF8, 0x4F, 0xFB, 0xF8, 0x8B, 0x48, 0xF8, 0x40, 0xBF, 0x08, 0xF8, 0x00, 0x08, 0xF8,
+    0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00,
+    0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x03, 0x82, 0x48, 0x40, 0x04,
+    0x80, 0x80, 0x44, 0x8F, 0x40, 0x08, 0xFF, 0xB8, 0xBF, 0xF4, 0x4F, 0xF4, 0x02, 0x85, 0x8F, 0xB8,
+    0xF4, 0x04, 0x41, 0x07, 0x41, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0xBF, 0x40, 0x05, 0x82, 0x8F,
+    0xB0, 0x05, 0x80, 0x40, 0x41, 0x06, 0x41, 0x80, 0x40, 0x05, 0x82, 0xBF, 0x80, 0x05, 0x82, 0xBF,
+    0xB0, 0x05, 0x82, 0xBF, 0xB0, 0x05, 0x80, 0x80, 0x41, 0x06, 0x48, 0x80, 0x80, 0x48, 0x01, 0x81,
+    0x4B, 0x43, 0x8F, 0x40, 0x04, 0xFF, 0x88, 0xBF, 0xF4, 0x0B, 0xF4, 0x02, 0x85, 0x8F, 0xB4, 0xF8,
+    0x04, 0x41, 0x07, 0x81, 0xFB, 0x06, 0x82, 0x8F, 0x80, 0x04, 0x83, 0x4B, 0xFB, 0x04, 0x80, 0x80,
+    0x42, 0x06, 0x84, 0x8B, 0xFF, 0x40, 0x06, 0x82, 0x8F, 0xB0, 0x07, 0x41, 0x81, 0x04, 0x05, 0x41,
+    0x82, 0x8F, 0x80, 0x04, 0x41, 0x9B, 0x0F, 0xF4, 0x00, 0x0B, 0xFB, 0x04, 0xFF, 0xB8, 0xBF, 0xF0,
+    0x00, 0x4B, 0xFF, 0xFB, 0x01, 0x05, 0x80, 0x40, 0x41, 0x07, 0x80, 0xB0, 0x41, 0x06, 0x80, 0x80,
+    0x42, 0x05, 0x82, 0x4F, 0xB0, 0x41, 0x05, 0x82, 0xBF, 0x40, 0x41, 0x04, 0x83, 0x8F, 0x80, 0x41,
+    0x03, 0xA1, 0x4F, 0xB0, 0x0F, 0xF0, 0x00, 0x0F, 0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x0F,
+    0xF0, 0x04, 0xFB, 0x03, 0x41, 0x01, 0x41, 0x04, 0x41, 0x01, 0x4A, 0x8A, 0x88, 0x88, 0x88, 0x8F,
+    0xF8, 0x80, 0x06, 0x41, 0x08, 0x41, 0x08, 0x41, 0x01, 0x01, 0x46, 0x80, 0x80, 0x01, 0x46, 0x84,
+    0x80, 0x8F, 0x80, 0x06, 0x81, 0x8F, 0x07, 0x41, 0x07, 0x41, 0x87, 0x8B, 0xF8, 0x40, 0x04, 0x46,
+    0x8D, 0xB0, 0x8F, 0xB0, 0x00, 0x4F, 0xF4, 0x08, 0x04, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x07, 0x41,
+    0x81, 0x04, 0x05, 0x43, 0x04, 0x85, 0x4F, 0xFB, 0xF8, 0x03, 0x8F, 0xBF, 0x84, 0xFF, 0xB8, 0x8F,
+    0xFB, 0x00, 0x4B, 0x43, 0x80, 0x80, 0x01, 0x04, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x80, 0x40, 0x06,
+    0x82, 0xBF, 0x80, 0x06, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x80, 0x40, 0x06, 0x84, 0x8F, 0xB4, 0x80,
+    0x04, 0x80, 0x40, 0x45, 0x91, 0xB0, 0x00, 0xBF, 0xF8, 0x88, 0xBF, 0xB0, 0x4F, 0xF4, 0x03, 0x85,
+    0xBF, 0x88, 0xF8, 0x04, 0x85, 0x4F, 0xB8, 0xF8, 0x05, 0x41, 0x82, 0x8F, 0x80, 0x05, 0x41, 0x82,
+    0x8F, 0xB0, 0x04, 0x9B, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x04, 0xFF, 0xB8, 0x8F, 0xFB,
+    0x00, 0x04, 0x44, 0x80, 0x80, 0x01, 0x80, 0x80, 0x48, 0x81, 0x88, 0x48, 0x80, 0x80, 0x07, 0x81,
+    0xBF, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x41, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x41, 0x07, 0x82, 0x8F,
+    0x80, 0x07, 0x81, 0xBF, 0x07, 0x82, 0x4F, 0x80, 0x07, 0x82, 0x8F, 0x40, 0x07, 0x41, 0x07, 0x82,
+    0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x41, 0x07, 0x80, 0x40, 0x41, 0x05, 0x01, 0xA1, 0x8F,
+    0xFF, 0xFB, 0x40, 0x00, 0x8F, 0xB8, 0x8B, 0xFF, 0x40, 0x0F, 0xB0, 0x00, 0x08, 0xF8, 0x08, 0xF8,
+    0x04, 0x41, 0x83, 0x08, 0xF8, 0x04, 0x81, 0xFB, 0x01, 0x41, 0x03, 0x91, 0xBF, 0x80, 0x08, 0xFB,
+    0x88, 0xBF, 0xB0, 0x00, 0x0B, 0x44, 0x03, 0x97, 0xBF, 0xF8, 0x8B, 0xFF, 0x40, 0x8F, 0xB0, 0x00,
+    0x04, 0xFF, 0x0B, 0xF4, 0x04, 0x81, 0xBF, 0x00, 0x41, 0x05, 0x85, 0x8F, 0x8B, 0xF4, 0x04, 0x85,
+    0xBF, 0x08, 0xFB, 0x03, 0x91, 0x4F, 0xF0, 0x0F, 0xFF, 0x88, 0xBF, 0xF4, 0x00, 0x4B, 0x44, 0x80,
+    0x40, 0x01, 0x03, 0x81, 0x48, 0x05, 0xA3, 0x8F, 0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0x88, 0xFF, 0xF0,
+    0x8F, 0xB0, 0x00, 0x0B, 0xFB, 0xBF, 0x40, 0x00, 0x04, 0x43, 0x05, 0x43, 0x05, 0x43, 0x80, 0x40,
+    0x03, 0x99, 0x4F, 0xB8, 0xFB, 0x00, 0x04, 0xFF, 0x80, 0xFF, 0xF8, 0x8F, 0xFF, 0x00, 0x08, 0x44,
+    0x80, 0x80, 0x05, 0x82, 0x8F, 0xB0, 0x06, 0x41, 0x80, 0x40, 0x05, 0x82, 0x8F, 0xB0, 0x06, 0x41,
+    0x80, 0x40, 0x05, 0x82, 0x8F, 0x80, 0x06, 0x41, 0x04, 0x88, 0x88, 0x4F, 0xF8, 0x88, 0x40, 0x11,
+    0x41, 0x83, 0x8F, 0xF8, 0x88, 0x88, 0x4F, 0xF8, 0x88, 0x40, 0x11, 0x41, 0x8B, 0x8F, 0xF8, 0x0F,
+    0x08, 0xB0, 0x44, 0x00, 0x08, 0x80, 0x40, 0x08, 0x82, 0xBF, 0x40, 0x06, 0x82, 0xBF, 0x40, 0x06,
+    0x82, 0xBF, 0x40, 0x06, 0x82, 0xBF, 0x40, 0x06, 0x82, 0xBF, 0x40, 0x06, 0x81, 0xBB, 0x06, 0x82,
+    0x4F, 0xB0, 0x06, 0x82, 0x4F, 0xB0, 0x07, 0x82, 0x4F, 0xB0, 0x08, 0x82, 0x4F, 0xB0, 0x08, 0x82,
+    0x4F, 0xB0, 0x09, 0x82, 0xBB, 0x40, 0x08, 0x82, 0xBF, 0x40, 0x08, 0x82, 0xBF, 0x40, 0x08, 0x82,
+    0xBF, 0x40, 0x08, 0x82, 0x8F, 0x40, 0x08, 0x81, 0x40, 0x49, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x84, 0x2B, 0x49, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x81, 0x04, 0x08, 0x82, 0x8F, 0x40,
+    0x08, 0x82, 0x8F, 0x40, 0x08, 0x82, 0x4F, 0x80, 0x08, 0x82, 0x4F, 0xB0, 0x08, 0x82, 0x4F, 0xB0,
+    0x08, 0x82, 0x4F, 0xB0, 0x08, 0x82, 0x4F, 0xB0, 0x09, 0x81, 0xBB, 0x08, 0x82, 0xBF, 0x40, 0x06,
+    0x81, 0xBB, 0x06, 0x82, 0x4F, 0xB0, 0x06, 0x82, 0x4F, 0xB0, 0x06, 0x82, 0x4F, 0xB0, 0x06, 0x82,
+    0x4F, 0xB0, 0x06, 0x82, 0xBF, 0x40, 0x06, 0x82, 0x8F, 0x40, 0x08, 0x80, 0x40, 0x08, 0x01, 0xAF,
+    0x4B, 0xFF, 0xFB, 0x40, 0x04, 0xFF, 0xB8, 0xFF, 0xF0, 0x0B, 0xF8, 0x00, 0x0B, 0xF8, 0x0F, 0xF0,
+    0x00, 0x08, 0xF8, 0x4F, 0xF0, 0x00, 0x08, 0xF8, 0x06, 0x41, 0x80, 0x80, 0x05, 0x82, 0xBF, 0xB0,
+    0x05, 0x83, 0xBF, 0xF4, 0x04, 0x80, 0x40, 0x41, 0x06, 0x82, 0x8F, 0x40, 0x06, 0x81, 0x8F, 0x25,
+    0x41, 0x07, 0x41, 0x03, 0x02, 0x85, 0x8B, 0x88, 0xF4, 0x03, 0x81, 0xB4, 0x03, 0x85, 0xB4, 0x00,
+    0xB4, 0x05, 0xAD, 0xF0, 0x4B, 0x00, 0x4B, 0xBB, 0x88, 0x48, 0x80, 0x4F, 0x44, 0xF8, 0x88, 0xB0,
+    0x0B, 0xB0, 0x4F, 0x04, 0x8F, 0x04, 0xF4, 0x08, 0xF0, 0x08, 0xBF, 0xF0, 0x8F, 0x00, 0x8B, 0x00,
+    0x8F, 0x0F, 0x80, 0x0B, 0x80, 0x88, 0xF0, 0xF8, 0x00, 0xF8, 0x08, 0x8F, 0x0B, 0xB0, 0x4F, 0x80,
+    0xB4, 0xB4, 0x8F, 0x8B, 0xBB, 0xBB, 0x08, 0x80, 0x88, 0x44, 0x88, 0x02, 0x40, 0x09, 0x82, 0x4B,
+    0x40, 0x03, 0x8B, 0xB0, 0x00, 0x04, 0xBB, 0x88, 0xB4, 0x01, 0x03, 0x82, 0xBF, 0x80, 0x07, 0x42,
+    0x06, 0x80, 0x40, 0x42, 0x06, 0x84, 0x8F, 0xFF, 0x80, 0x05, 0x41, 0x82, 0x4F, 0xB0, 0x05, 0x40,
+    0x81, 0xB0, 0x41, 0x04, 0x91, 0x8F, 0x80, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x08, 0xF8, 0x03, 0x41,
+    0x01, 0x91, 0x4F, 0xF0, 0x00, 0x8F, 0xF8, 0x88, 0xFF, 0x00, 0x08, 0x46, 0x8D, 0x80, 0x0F, 0xF4,
+    0x00, 0x08, 0xFB, 0x04, 0x41, 0x04, 0x41, 0x83, 0x08, 0xFB, 0x04, 0x41, 0x83, 0x4B, 0xF8, 0x04,
+    0x82, 0x8F, 0x80, 0x41, 0x05, 0x80, 0x80, 0x41, 0x80, 0x80, 0x45, 0x84, 0xB4, 0x00, 0x80, 0x47,
+    0x8F, 0x40, 0x8F, 0x80, 0x00, 0x0B, 0xFB, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x08, 0xF8, 0x04, 0x41,
+    0x83, 0x08, 0xF8, 0x03, 0x8F, 0x4F, 0xF0, 0x8F, 0xB8, 0x88, 0x8F, 0xF4, 0x08, 0x46, 0x9B, 0x40,
+    0x08, 0xFB, 0x88, 0x8B, 0xFF, 0x40, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x48, 0xF8, 0x04, 0x85, 0xBF,
+    0x88, 0xF8, 0x04, 0x85, 0x8F, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x03, 0x84, 0x8F, 0xF4,
+    0x80, 0x47, 0x82, 0xB0, 0x80, 0x45, 0x81, 0xB4, 0x01, 0x02, 0x85, 0x8F, 0xFF, 0xF4, 0x03, 0x97,
+    0xBF, 0xF8, 0x8F, 0xF4, 0x00, 0x8F, 0xB0, 0x00, 0x4F, 0xF0, 0x0F, 0xF4, 0x03, 0x83, 0xBF, 0x84,
+    0x41, 0x04, 0x85, 0x8F, 0x88, 0xFB, 0x04, 0x85, 0x48, 0x48, 0xF8, 0x07, 0x82, 0x8F, 0x80, 0x07,
+    0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x04, 0x85, 0x48, 0x48, 0xF8, 0x04, 0x83, 0x8F, 0x88,
+    0x41, 0x04, 0x86, 0x8F, 0x80, 0xFF, 0x40, 0x03, 0x41, 0x95, 0x40, 0xBF, 0xB0, 0x00, 0x4F, 0xF0,
+    0x00, 0xBF, 0xF8, 0xBF, 0xF4, 0x03, 0x85, 0xBF, 0xFF, 0xF4, 0x01, 0x80, 0x80, 0x44, 0x85, 0x84,
+    0x00, 0x08, 0x46, 0x85, 0x40, 0x08, 0xF8, 0x02, 0x87, 0xBF, 0xF4, 0x08, 0xF8, 0x03, 0x91, 0xBF,
+    0xB0, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83,
+    0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88,
+    0xF8, 0x04, 0x41, 0x83, 0x48, 0xF8, 0x03, 0x86, 0x4F, 0xF0, 0x8F, 0x80, 0x03, 0x8F, 0xBF, 0xB0,
+    0x8F, 0x80, 0x00, 0x8F, 0xF4, 0x08, 0x46, 0x83, 0x40, 0x08, 0x44, 0x80, 0x80, 0x03, 0x48, 0x00,
+    0x48, 0x00, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x87, 0x88, 0x88, 0x88, 0x40,
+    0x47, 0x8B, 0x80, 0xFF, 0x88, 0x88, 0x88, 0x40, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07,
+    0x41, 0x07, 0x48, 0x80, 0x80, 0x48, 0x80, 0x80, 0x80, 0x80, 0x48, 0x81, 0x88, 0x48, 0x81, 0x88,
+    0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80,
+    0x41, 0x07, 0x80, 0x80, 0x46, 0x83, 0x80, 0x08, 0x46, 0x83, 0x80, 0x08, 0x41, 0x07, 0x80, 0x80,
+    0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80,
+    0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x02, 0xA5, 0xBF, 0xFF, 0xB4, 0x00, 0x0B, 0xFB, 0x8B, 0xFF,
+    0x00, 0x8F, 0xB0, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x0F, 0xF4, 0x41, 0x04, 0x41, 0x82, 0x8F,
+    0xB0, 0x04, 0x84, 0x88, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x85, 0x8F, 0x80, 0x08, 0x43,
+    0x85, 0x8F, 0x80, 0x08, 0x43, 0x82, 0x8F, 0x80, 0x04, 0x82, 0x8F, 0x80, 0x41, 0x04, 0x85, 0x8F,
+    0x0F, 0xF4, 0x03, 0x41, 0x9D, 0x0B, 0xFB, 0x00, 0x04, 0xFF, 0x00, 0xFF, 0xF8, 0xBF, 0xFF, 0x00,
+    0x0B, 0xFF, 0xFB, 0x8F, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F,
+    0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80,
+    0x04, 0x41, 0x8A, 0x8F, 0xB8, 0x88, 0x88, 0xFF, 0x80, 0x48, 0x8C, 0x8F, 0xB8, 0x88, 0x88, 0xFF,
+    0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F,
+    0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80,
+    0x04, 0x41, 0xAF, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F,
+    0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x07, 0x41, 0x07, 0x41, 0x07,
+    0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x80,
+    0x80, 0x41, 0x04, 0x41, 0x80, 0x40, 0x41, 0x04, 0x41, 0x00, 0x41, 0x03, 0x8E, 0x8F, 0xF0, 0xFF,
+    0xB0, 0x00, 0xBF, 0x80, 0x40, 0x46, 0x02, 0x87, 0x4F, 0xFF, 0xFB, 0x40, 0xBD, 0x8F, 0x80, 0x00,
+    0x04, 0xFF, 0x48, 0xF8, 0x00, 0x04, 0xFF, 0x40, 0x8F, 0x80, 0x00, 0xBF, 0xB0, 0x08, 0xF8, 0x00,
+    0xBF, 0xB0, 0x00, 0x8F, 0x80, 0x4F, 0xF0, 0x00, 0x08, 0xF8, 0x4F, 0xF4, 0x03, 0x85, 0x8F, 0x8F,
+    0xFB, 0x04, 0x80, 0x80, 0x44, 0x80, 0x40, 0x03, 0xB9, 0x8F, 0xFB, 0x8F, 0xB0, 0x00, 0x08, 0xFF,
+    0x40, 0xFF, 0x40, 0x00, 0x8F, 0x80, 0x08, 0xFF, 0x00, 0x08, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x8F,
+    0x80, 0x00, 0x8F, 0xF0, 0x08, 0xF8, 0x03, 0x91, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x08,
+    0xF8, 0x04, 0x82, 0xBF, 0xB0, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41,
+    0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41,
+    0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41,
+    0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x48,
+    0x81, 0x88, 0x48, 0x80, 0x80, 0x99, 0x8F, 0xF8, 0x00, 0x08, 0xFF, 0x88, 0xFF, 0x80, 0x00, 0xBF,
+    0xF8, 0x8F, 0xFB, 0x02, 0x42, 0x81, 0x88, 0x42, 0x02, 0x42, 0x87, 0x88, 0xFB, 0xF0, 0x08, 0x42,
+    0xB9, 0x88, 0xF8, 0xF8, 0x08, 0xFB, 0xF8, 0x8F, 0x4F, 0x80, 0xBF, 0x8F, 0x88, 0xF0, 0xFB, 0x0F,
+    0xF8, 0xF8, 0x8F, 0x0F, 0xF0, 0xF8, 0x8F, 0x88, 0xF0, 0x8F, 0x4F, 0x88, 0xF8, 0x8F, 0xBF, 0x08,
+    0xFB, 0xF4, 0x8F, 0x88, 0xF0, 0x4F, 0xFF, 0x08, 0xF8, 0x8F, 0x00, 0xFF, 0xF0, 0x8F, 0x88, 0xF0,
+    0x0F, 0xF8, 0x08, 0xF8, 0x8F, 0x00, 0x8F, 0x80, 0x8F, 0x88, 0xF0, 0x08, 0xF4, 0x08, 0xF8, 0x80,
+    0x80, 0x41, 0x04, 0x41, 0x83, 0x8F, 0xF8, 0x03, 0x41, 0x80, 0x80, 0x42, 0x03, 0x41, 0x95, 0x8F,
+    0xFF, 0x40, 0x00, 0xFF, 0x8F, 0xBF, 0xB0, 0x00, 0xFF, 0x8F, 0xBF, 0x8B, 0xF4, 0x00, 0xFF, 0x8F,
+    0x88, 0xFB, 0x00, 0xFF, 0x8F, 0x80, 0xFF, 0x00, 0xFF, 0x8F, 0x80, 0x8F, 0x80, 0xFF, 0x8F, 0x80,
+    0x0F, 0xF0, 0xFF, 0x8F, 0x80, 0x08, 0xF8, 0xFF, 0x8F, 0x80, 0x04, 0x43, 0xA5, 0x8F, 0x80, 0x00,
+    0xBF, 0xFF, 0x8F, 0x80, 0x00, 0x4F, 0xFF, 0x8F, 0x80, 0x00, 0x0B, 0xFF, 0x8F, 0x80, 0x00, 0x08,
+    0x41, 0x01, 0x81, 0x4B, 0x42, 0x89, 0xB4, 0x00, 0x04, 0xFF, 0xB8, 0x42, 0x02, 0x41, 0x95, 0xB0,
+    0x00, 0xBF, 0xB0, 0x4F, 0xF0, 0x00, 0x04, 0xFF, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x48, 0xF8, 0x04,
+    0x41, 0x83, 0x8F, 0xF8, 0x04, 0x85, 0x8F, 0x8F, 0xF8, 0x04, 0x85, 0x8F, 0x8F, 0xF8, 0x04, 0x85,
+    0x8F, 0x8F, 0xF8, 0x04, 0x85, 0x8F, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x81,
+    0x44, 0x41, 0x03, 0x87, 0x4F, 0xF0, 0x0F, 0xFB, 0x02, 0x97, 0xBF, 0xB0, 0x04, 0xFF, 0xB8, 0xBF,
+    0xF0, 0x00, 0x04, 0xBF, 0xFF, 0xB4, 0x01, 0x80, 0x80, 0x45, 0x84, 0xB4, 0x00, 0x80, 0x47, 0x8D,
+    0x40, 0x8F, 0xF0, 0x00, 0x04, 0xFF, 0x08, 0x41, 0x04, 0x83, 0xBF, 0x88, 0x41, 0x04, 0x83, 0x8F,
+    0x88, 0x41, 0x04, 0x83, 0x8F, 0x88, 0x41, 0x04, 0x41, 0x81, 0x88, 0x41, 0x02, 0x85, 0x4B, 0xFF,
+    0x08, 0x47, 0x8D, 0x40, 0x8F, 0xFF, 0xFB, 0x88, 0x00, 0x08, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07,
+    0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07, 0x80, 0x80, 0x41, 0x07,
+    0x01, 0x81, 0x4B, 0x42, 0x89, 0xB4, 0x00, 0x04, 0xFF, 0xB8, 0x42, 0x02, 0x41, 0x95, 0xB0, 0x00,
+    0xBF, 0xB0, 0x4F, 0xF0, 0x00, 0x04, 0xFF, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x48, 0xF8, 0x04, 0x41,
+    0x83, 0x8F, 0xF8, 0x04, 0x85, 0x8F, 0x8F, 0xF8, 0x04, 0x85, 0x8F, 0x8F, 0xF8, 0x04, 0x85, 0x8F,
+    0x8F, 0xF8, 0x02, 0x9B, 0x40, 0x8F, 0x88, 0xF8, 0x00, 0x4F, 0x4F, 0xF8, 0x8F, 0x80, 0x08, 0xFB,
+    0xFF, 0x44, 0x41, 0x02, 0x43, 0x01, 0x41, 0x91, 0xB0, 0x08, 0xFF, 0xB0, 0x04, 0xFF, 0xB8, 0xBF,
+    0xF4, 0x02, 0x81, 0x4B, 0x44, 0x80, 0xB0, 0x08, 0x40, 0x81, 0x40, 0x80, 0x80, 0x45, 0x84, 0x84,
+    0x00, 0x80, 0x47, 0x8F, 0x40, 0x8F, 0x80, 0x00, 0x0B, 0xFF, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x08,
+    0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x48, 0xF8, 0x03, 0x8F, 0xBF, 0xF0, 0x8F,
+    0xB8, 0x88, 0xFF, 0xF4, 0x08, 0x45, 0x8B, 0xB4, 0x00, 0x8F, 0x80, 0x0B, 0xF8, 0x02, 0xA3, 0x8F,
+    0x80, 0x04, 0xFF, 0x00, 0x08, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0x8F, 0x80, 0x00, 0x4F, 0xF0, 0x08,
+    0xF8, 0x03, 0x91, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x08, 0xF8, 0x04, 0x82, 0xBF, 0x80,
+    0x01, 0x81, 0x4B, 0x42, 0x89, 0xB4, 0x00, 0x04, 0xFF, 0xB8, 0x42, 0x02, 0x41, 0x93, 0x40, 0x00,
+    0xBF, 0x80, 0x4F, 0xF0, 0x00, 0x08, 0xFF, 0x04, 0x41, 0x04, 0x86, 0x88, 0x00, 0xFF, 0xB0, 0x07,
+    0x84, 0x4F, 0xFB, 0x80, 0x06, 0x85, 0x4F, 0xFF, 0xF8, 0x06, 0x84, 0x8B, 0xFF, 0xB0, 0x07, 0x83,
+    0x4F, 0xFB, 0x07, 0x86, 0x4F, 0xF4, 0x8F, 0x80, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x99,
+    0x84, 0xFF, 0x40, 0x00, 0x4F, 0xF0, 0x0B, 0xFF, 0xB8, 0xBF, 0xF4, 0x00, 0x08, 0x44, 0x80, 0x40,
+    0x01, 0x80, 0x80, 0x48, 0x80, 0x80, 0x48, 0x03, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06,
+    0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06,
+    0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06,
+    0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x02,
+    0x82, 0x8F, 0x80, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83,
+    0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88,
+    0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8,
+    0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x83, 0x88, 0xF8, 0x04, 0x41, 0x81, 0x88, 0x41, 0x04,
+    0x41, 0x01, 0x41, 0x95, 0x40, 0x00, 0x8F, 0xF0, 0x0B, 0xFF, 0xB8, 0xBF, 0xF4, 0x00, 0x08, 0x44,
+    0x80, 0x80, 0x01, 0x41, 0x05, 0x85, 0x8F, 0xBF, 0xF8, 0x04, 0x85, 0xBF, 0x88, 0xF8, 0x04, 0x41,
+    0x81, 0x44, 0x41, 0x03, 0x9D, 0x4F, 0xF0, 0x0F, 0xF0, 0x00, 0x08, 0xF8, 0x00, 0xBF, 0x80, 0x00,
+    0xBF, 0x80, 0x08, 0xF8, 0x02, 0x41, 0x03, 0x41, 0x01, 0x82, 0x4F, 0xB0, 0x03, 0x41, 0x8F, 0x40,
+    0x8F, 0x80, 0x00, 0x08, 0xF8, 0x0F, 0xF4, 0x03, 0x83, 0x4F, 0xB0, 0x41, 0x05, 0x41, 0x82, 0x8F,
+    0x80, 0x05, 0x84, 0xBF, 0xBF, 0x80, 0x05, 0x80, 0x80, 0x42, 0x07, 0x41, 0x80, 0xB0, 0x07, 0x41,
+    0x80, 0x80, 0x03, 0xB4, 0x8F, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xF8, 0x00, 0xFF,
+    0x0F, 0xF0, 0x0F, 0xF8, 0x08, 0xF8, 0x0F, 0xF0, 0x0F, 0xFF, 0x08, 0xF8, 0x0F, 0xF0, 0x80, 0xBF,
+    0xF8, 0xF0, 0x8F, 0x80, 0x8F, 0x08, 0xF8, 0xF0, 0x8F, 0x80, 0x8F, 0x88, 0xF4, 0xF4, 0x8F, 0x00,
+    0x8F, 0x8B, 0xB0, 0xF8, 0xFF, 0x00, 0x8F, 0x8F, 0x80, 0xF8, 0xFF, 0x00, 0x0F, 0x8F, 0x80, 0xF8,
+    0x41, 0x02, 0x42, 0x85, 0x80, 0x8F, 0xF8, 0x02, 0x42, 0x01, 0x83, 0x8F, 0xF8, 0x02, 0x42, 0x01,
+    0x95, 0x8F, 0xF8, 0x00, 0x08, 0xFF, 0x00, 0x8F, 0xF8, 0x00, 0x08, 0xFB, 0x02, 0x41, 0x03, 0x82,
+    0x8F, 0x80, 0x02, 0x41, 0x01, 0xA9, 0x8F, 0xB0, 0x00, 0x04, 0xFF, 0x00, 0xBF, 0x40, 0x00, 0xBF,
+    0x80, 0x04, 0xFB, 0x00, 0x4F, 0xF0, 0x00, 0x0B, 0xF4, 0x08, 0xF8, 0x03, 0x83, 0x4F, 0xB0, 0x41,
+    0x05, 0x84, 0xBF, 0xBF, 0x80, 0x05, 0x80, 0x40, 0x42, 0x07, 0x41, 0x80, 0x80, 0x06, 0x83, 0x4F,
+    0xFB, 0x06, 0x84, 0xBF, 0xBF, 0x40, 0x04, 0x85, 0x4F, 0xB4, 0xFB, 0x04, 0x8F, 0xBF, 0x40, 0xBF,
+    0x80, 0x00, 0x4F, 0xB0, 0x04, 0x41, 0x02, 0x97, 0xBF, 0x40, 0x00, 0xBF, 0x80, 0x4F, 0xB0, 0x00,
+    0x04, 0xFF, 0x0B, 0xF8, 0x04, 0x82, 0xBF, 0x80, 0x41, 0x80, 0x40, 0x04, 0x85, 0x8F, 0x88, 0xFB,
+    0x04, 0x41, 0x01, 0x41, 0x8B, 0x40, 0x00, 0x8F, 0x80, 0x08, 0xFB, 0x02, 0x41, 0x03, 0x41, 0x84,
+    0x40, 0x8F, 0x80, 0x03, 0x83, 0x8F, 0xB0, 0x41, 0x05, 0x41, 0x82, 0xBF, 0x80, 0x05, 0x80, 0x80,
+    0x42, 0x07, 0x41, 0x80, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F,
+    0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F,
+    0x80, 0x03, 0x00, 0x48, 0x01, 0x48, 0x07, 0x82, 0x8F, 0xB0, 0x06, 0x80, 0x40, 0x41, 0x07, 0x82,
+    0xBF, 0x80, 0x06, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x80, 0x40, 0x06, 0x82, 0x8F, 0xB0, 0x06, 0x80,
+    0x40, 0x41, 0x07, 0x82, 0xBF, 0x40, 0x06, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x80, 0x40, 0x06, 0x82,
+    0x8F, 0x80, 0x06, 0x80, 0x40, 0x41, 0x07, 0x80, 0x80, 0x48, 0x81, 0x88, 0x48, 0x80, 0x80, 0x85,
+    0x88, 0x88, 0x88, 0x47, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41,
+    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x45, 0x85, 0x88, 0x88, 0x88, 0x81, 0x84, 0x06, 0x81,
+    0xF8, 0x06, 0x81, 0x8F, 0x07, 0x81, 0xF8, 0x06, 0x81, 0x8F, 0x06, 0x82, 0x4F, 0x40, 0x06, 0x81,
+    0xBB, 0x06, 0x81, 0x8F, 0x07, 0x81, 0xF8, 0x06, 0x81, 0x8F, 0x06, 0x82, 0x4F, 0x40, 0x06, 0x81,
+    0xBB, 0x06, 0x81, 0x8F, 0x07, 0x81, 0xF8, 0x06, 0x81, 0x8F, 0x06, 0x82, 0x4F, 0x40, 0x06, 0x81,
+    0xBB, 0x06, 0x81, 0x8F, 0x07, 0x81, 0xF8, 0x06, 0x81, 0x8F, 0x87, 0x48, 0x88, 0x88, 0x48, 0x44,
+    0x80, 0x80, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81,
+    0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8,
+    0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04,
+    0x81, 0xF8, 0x04, 0x81, 0xF8, 0x04, 0x40, 0x81, 0x88, 0x44, 0x87, 0x84, 0x88, 0x88, 0x84, 0x01,
+    0x83, 0x4F, 0xFB, 0x04, 0x98, 0xBF, 0xBF, 0xB0, 0x00, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0x00,
+    0x8F, 0x40, 0x99, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
+    0x97, 0x4F, 0xF8, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x4F, 0xB0, 0x00, 0x04, 0xF4, 0x03, 0x81, 0x88,
+    0x02, 0x89, 0x88, 0x88, 0x40, 0x00, 0x0B, 0x44, 0x95, 0xB0, 0x0B, 0xFB, 0x00, 0x0B, 0xF4, 0x08,
+    0x80, 0x00, 0x08, 0xF8, 0x04, 0x87, 0x48, 0xFF, 0x80, 0x08, 0x45, 0x8D, 0x80, 0xBF, 0xB8, 0x40,
+    0x8F, 0x88, 0xFB, 0x03, 0x85, 0x8F, 0x88, 0xF8, 0x02, 0x8F, 0x4F, 0xF8, 0x4F, 0xF8, 0x8B, 0xFF,
+    0xF8, 0x04, 0x43, 0x81, 0xB4, 0x41, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F,
+    0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x8C, 0x8F, 0x84, 0x88, 0x84, 0x00,
+    0x8F, 0xB0, 0x44, 0x8C, 0xB0, 0x8F, 0xFB, 0x00, 0x4F, 0xF4, 0x80, 0x41, 0x03, 0x85, 0x8F, 0xB8,
+    0xF8, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0xA7, 0x8F, 0xB0,
+    0x00, 0x04, 0xFF, 0x8F, 0xF4, 0x00, 0x0B, 0xF8, 0x8F, 0xFF, 0x88, 0xBF, 0xF4, 0x8F, 0x8B, 0xFF,
+    0xFB, 0x40, 0x02, 0x89, 0x48, 0x88, 0x40, 0x00, 0x0B, 0x44, 0x8C, 0xB0, 0x0B, 0xFB, 0x40, 0x4B,
+    0xF8, 0x40, 0x41, 0x03, 0x85, 0x4F, 0xF8, 0xF8, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80,
+    0x06, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x9D, 0x0F, 0xF4, 0x00, 0x04, 0xFF, 0x04, 0xFF, 0x88, 0x8F,
+    0xF4, 0x00, 0x4F, 0xFF, 0xFB, 0x40, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x02, 0x88, 0x88, 0x88, 0x0F, 0xF0, 0x40, 0x44, 0x8F, 0xBF, 0xF0, 0xFF, 0xB0, 0x04, 0xFF, 0xF8,
+    0xFB, 0x03, 0x85, 0x8F, 0xF8, 0xF8, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80,
+    0x04, 0x41, 0xA5, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x4F, 0xF4, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0x88,
+    0xBF, 0xFF, 0x00, 0x8F, 0xFF, 0xF4, 0x41, 0x02, 0x89, 0x48, 0x88, 0x40, 0x00, 0x0B, 0x44, 0x85,
+    0xB0, 0x0B, 0xFB, 0x02, 0x83, 0xBF, 0x84, 0x41, 0x03, 0x8D, 0x4F, 0xF8, 0xFB, 0x88, 0x88, 0x8F,
+    0xF8, 0x48, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0xB0, 0x04, 0x99, 0x88, 0x0F, 0xF4, 0x00, 0x04,
+    0xFF, 0x04, 0xFF, 0x88, 0x8F, 0xF4, 0x00, 0x4B, 0x43, 0x81, 0x40, 0x03, 0x81, 0x4B, 0x43, 0x03,
+    0x85, 0xBF, 0xB8, 0x8B, 0x03, 0x81, 0xFB, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x91, 0x8F, 0x80, 0x00,
+    0x04, 0x88, 0xBF, 0xB8, 0x88, 0x48, 0x47, 0x86, 0x80, 0x00, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80,
+    0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80,
+    0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x8F, 0x80, 0x03, 0x02, 0x8A, 0x88,
+    0x88, 0x04, 0x84, 0x00, 0xB0, 0x46, 0x89, 0x80, 0x8F, 0xB0, 0x0B, 0xF8, 0x02, 0x81, 0x8F, 0x03,
+    0x97, 0xFB, 0x00, 0x08, 0xF0, 0x00, 0x0F, 0xB0, 0x00, 0x8F, 0xB0, 0x0B, 0xF8, 0x03, 0x44, 0x80,
+    0xB0, 0x03, 0x85, 0xBB, 0x88, 0x88, 0x04, 0x40, 0x81, 0xB4, 0x07, 0x80, 0xB0, 0x45, 0x90, 0xB4,
+    0x00, 0xBF, 0x88, 0x88, 0xBF, 0xF0, 0x8F, 0x40, 0x04, 0x85, 0x8F, 0x88, 0xF8, 0x04, 0x84, 0xBF,
+    0x00, 0xB0, 0x46, 0x89, 0x40, 0x00, 0x08, 0x88, 0x84, 0x02, 0x81, 0xF8, 0x06, 0x81, 0xF8, 0x06,
+    0x81, 0xF8, 0x06, 0x81, 0xF8, 0x06, 0x81, 0xF8, 0x06, 0x8B, 0xF8, 0x04, 0x88, 0x84, 0x0F, 0x84,
+    0x44, 0x87, 0x4F, 0xBF, 0x40, 0x08, 0x43, 0x80, 0x80, 0x03, 0x43, 0x04, 0x42, 0x80, 0xB0, 0x04,
+    0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04,
+    0x42, 0x80, 0x80, 0x04, 0x41, 0x88, 0x8F, 0x88, 0xF8, 0x48, 0x40, 0x05, 0xA0, 0x48, 0x48, 0xF8,
+    0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x80, 0x04, 0x41,
+    0x04, 0x41, 0x04, 0x81, 0x88, 0x12, 0x81, 0x88, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+    0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x87, 0x88,
+    0x40, 0x8F, 0xB8, 0x44, 0x85, 0x40, 0x48, 0x88, 0x01, 0x41, 0x07, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x41, 0x07, 0x41, 0x03, 0x9D, 0x88, 0x40, 0xFF, 0x00, 0x0B, 0xFB, 0x00, 0xFF, 0x00, 0xBF,
+    0xB0, 0x00, 0xFF, 0x0B, 0xFB, 0x03, 0x41, 0x83, 0xBF, 0xF8, 0x03, 0x42, 0x80, 0xB0, 0x41, 0x03,
+    0x41, 0x99, 0xB0, 0x4F, 0xB0, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x04, 0xFB, 0x01,
+    0x41, 0x03, 0x83, 0x8F, 0x80, 0x41, 0x04, 0x41, 0x80, 0x40, 0xAF, 0x8F, 0x88, 0xF8, 0x8F, 0x88,
+    0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8,
+    0x8F, 0x88, 0xF8, 0x8D, 0x88, 0x08, 0x84, 0x04, 0x88, 0x0F, 0xFB, 0x42, 0x8D, 0x4F, 0xFF, 0xBF,
+    0xFB, 0x0B, 0xFF, 0x44, 0x43, 0x01, 0x8D, 0x8F, 0x80, 0x0F, 0xFF, 0xF0, 0x08, 0xF8, 0x01, 0x43,
+    0x01, 0x8D, 0x8F, 0x80, 0x0F, 0xFF, 0xF0, 0x08, 0xF8, 0x01, 0x43, 0x01, 0x8D, 0x8F, 0x80, 0x0F,
+    0xFF, 0xF0, 0x08, 0xF8, 0x01, 0x43, 0x01, 0x8D, 0x8F, 0x80, 0x0F, 0xFF, 0xF0, 0x08, 0xF8, 0x01,
+    0x41, 0x8B, 0x84, 0x04, 0x88, 0x84, 0x0F, 0x84, 0x44, 0x87, 0x4F, 0xBF, 0x40, 0x08, 0x43, 0x80,
+    0x80, 0x03, 0x43, 0x04, 0x42, 0x80, 0xB0, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04,
+    0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x41, 0x02, 0x84, 0x48,
+    0x88, 0x40, 0x04, 0x80, 0xB0, 0x44, 0x9B, 0xB0, 0x00, 0xBF, 0xB4, 0x04, 0xFF, 0x80, 0x4F, 0xF0,
+    0x00, 0x04, 0xFF, 0x08, 0xF8, 0x04, 0x85, 0xBF, 0x88, 0xF8, 0x04, 0x85, 0x8F, 0x88, 0xF8, 0x04,
+    0x85, 0x8F, 0x88, 0xFB, 0x04, 0x41, 0x9F, 0x40, 0xFF, 0x40, 0x00, 0x4F, 0xB0, 0x04, 0xFF, 0x88,
+    0xBF, 0xF4, 0x00, 0x04, 0xBF, 0xFF, 0xB4, 0x01, 0x8C, 0x48, 0x40, 0x88, 0x84, 0x00, 0x8F, 0xB0,
+    0x44, 0x8C, 0xB0, 0x8F, 0xFB, 0x00, 0x4F, 0xF4, 0x80, 0x41, 0x03, 0x85, 0x8F, 0xB8, 0xF8, 0x04,
+    0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0xB0, 0x03, 0xAD,
+    0x4F, 0xF8, 0xFF, 0x40, 0x00, 0xBF, 0x88, 0xFF, 0xF8, 0x8B, 0xFF, 0x48, 0xF8, 0xBF, 0xFF, 0xB4,
+    0x08, 0xF8, 0x00, 0x84, 0x00, 0x08, 0xF8, 0x06, 0x82, 0x8F, 0x80, 0x06, 0x82, 0x48, 0x40, 0x06,
+    0x02, 0x88, 0x88, 0x84, 0x08, 0x80, 0x40, 0x44, 0x8F, 0xBF, 0xF0, 0xFF, 0xB0, 0x08, 0xFF, 0xF8,
+    0xFB, 0x03, 0x85, 0x8F, 0xF8, 0xF8, 0x04, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x82, 0x8F, 0x80,
+    0x04, 0x41, 0xA5, 0x8F, 0x80, 0x00, 0x04, 0xFF, 0x4F, 0xF0, 0x00, 0x0B, 0xFF, 0x0B, 0xFF, 0x88,
+    0xBF, 0xFF, 0x00, 0xBF, 0xFF, 0xF4, 0x41, 0x03, 0x81, 0x84, 0x01, 0x41, 0x07, 0x41, 0x07, 0x41,
+    0x07, 0x81, 0x88, 0x8A, 0x88, 0x00, 0x48, 0x8F, 0xF0, 0xB0, 0x44, 0x8E, 0xBF, 0x88, 0x8F, 0xFF,
+    0x40, 0x00, 0xFF, 0x80, 0x03, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41, 0x04, 0x41,
+    0x04, 0x01, 0x88, 0x88, 0x88, 0x40, 0x00, 0xB0, 0x44, 0x97, 0xB0, 0x8F, 0xB0, 0x00, 0xBF, 0x88,
+    0xF8, 0x00, 0x04, 0x84, 0x8F, 0xB4, 0x05, 0x99, 0xBF, 0xFF, 0xF8, 0x40, 0x00, 0x08, 0x8B, 0xFF,
+    0x48, 0x80, 0x00, 0x04, 0xFB, 0x41, 0x03, 0x8D, 0x4F, 0xF8, 0xFB, 0x88, 0x8F, 0xF8, 0x08, 0x44,
+    0x81, 0x80, 0x02, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x04, 0x89, 0x88, 0x8B, 0xF8,
+    0x88, 0x80, 0x48, 0x03, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07,
+    0x81, 0x8F, 0x07, 0x81, 0x8F, 0x07, 0x82, 0x8F, 0x80, 0x06, 0x8B, 0x4F, 0xF8, 0x88, 0xF0, 0x00,
+    0x04, 0x44, 0x81, 0x84, 0x04, 0x83, 0x88, 0xF8, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80,
+    0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x80, 0x80, 0x04, 0x42, 0x85, 0x80,
+    0x00, 0x04, 0x43, 0x03, 0x42, 0x89, 0xBF, 0xB8, 0x8F, 0xBF, 0xF4, 0x43, 0x81, 0xB0, 0x41, 0x82,
+    0x48, 0x40, 0x04, 0x84, 0x88, 0x4F, 0x80, 0x04, 0x41, 0x00, 0x41, 0x03, 0x95, 0x8F, 0x80, 0x8F,
+    0x80, 0x00, 0xBF, 0x40, 0x4F, 0xB0, 0x00, 0xFB, 0x02, 0x8F, 0xBF, 0x00, 0x8F, 0x80, 0x00, 0x8F,
+    0x80, 0xBF, 0x04, 0x40, 0x83, 0xB4, 0xFB, 0x04, 0x84, 0xBF, 0xBF, 0x80, 0x04, 0x80, 0x80, 0x42,
+    0x06, 0x41, 0x80, 0x80, 0x02, 0xB3, 0x48, 0x40, 0x08, 0x84, 0x00, 0x88, 0x0F, 0xB0, 0x0F, 0xF8,
+    0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xFB, 0x04, 0xF8, 0x0B, 0xF0, 0x4F, 0x8F, 0x08, 0xF8, 0x08, 0xF4,
+    0xBF, 0x8F, 0x8F, 0x08, 0xF0, 0x08, 0xF8, 0x8B, 0x0F, 0x4F, 0xF0, 0x00, 0xF8, 0xF8, 0x0F, 0x8F,
+    0xB0, 0x00, 0xFB, 0xF8, 0x0B, 0xBF, 0x80, 0x00, 0x8F, 0xF4, 0x08, 0xFF, 0x40, 0x00, 0x8F, 0xF0,
+    0x08, 0x41, 0x03, 0x85, 0x4F, 0xF0, 0x04, 0x41, 0x01, 0xA3, 0x08, 0x80, 0x00, 0x04, 0x88, 0x0B,
+    0xF8, 0x00, 0x0B, 0xF4, 0x00, 0xFF, 0x00, 0x8F, 0xB0, 0x00, 0x4F, 0xB0, 0x41, 0x04, 0x84, 0xBF,
+    0xBF, 0x40, 0x05, 0x41, 0x80, 0x80, 0x05, 0x80, 0x40, 0x42, 0x04, 0x85, 0x4F, 0xF4, 0xFB, 0x03,
+    0x9B, 0xBF, 0x40, 0xBF, 0x80, 0x08, 0xFB, 0x00, 0x0F, 0xF4, 0x4F, 0xF0, 0x00, 0x04, 0xFB, 0x82,
+    0x48, 0x40, 0x04, 0x85, 0x88, 0x48, 0xFB, 0x04, 0x41, 0x01, 0x41, 0x03, 0x87, 0x8F, 0x80, 0x08,
+    0xF8, 0x02, 0x87, 0xBF, 0x40, 0x04, 0xFB, 0x02, 0x41, 0x03, 0x41, 0x01, 0x82, 0x8F, 0x80, 0x03,
+    0x85, 0x8F, 0x80, 0xBF, 0x05, 0x41, 0x00, 0x81, 0xFB, 0x05, 0x84, 0xBF, 0xBF, 0x80, 0x05, 0x80,
+    0x80, 0x42, 0x07, 0x41, 0x80, 0x80, 0x07, 0x82, 0x8F, 0x40, 0x04, 0x84, 0x48, 0x8F, 0xB0, 0x05,
+    0x84, 0x8F, 0xFF, 0x40, 0x05, 0x83, 0x48, 0x84, 0x05, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0x47,
+    0x80, 0x80, 0x04, 0x83, 0x4F, 0xF4, 0x03, 0x83, 0x4F, 0xF4, 0x04, 0x82, 0xBF, 0x40, 0x04, 0x82,
+    0xBF, 0x80, 0x04, 0x82, 0xBF, 0xB0, 0x04, 0x82, 0x4F, 0xB0, 0x04, 0x82, 0x4F, 0xB0, 0x05, 0x41,
+    0x86, 0xB8, 0x88, 0x88, 0x80, 0x48, 0x01, 0x87, 0x48, 0x80, 0x8F, 0xB8, 0x00, 0x41, 0x02, 0x41,
+    0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x01, 0x87, 0xBF, 0x80,
+    0x0F, 0xF8, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41, 0x02, 0x41,
+    0x02, 0x41, 0x02, 0x88, 0x8F, 0xB8, 0x00, 0x88, 0x80, 0x87, 0x8F, 0x88, 0xF8, 0x8F, 0xBF, 0x88,
+    0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8,
+    0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x88, 0xF8, 0x8F, 0x84, 0x84, 0x8D,
+    0x88, 0x40, 0x08, 0xFF, 0x40, 0x04, 0xF8, 0x02, 0x9F, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00,
+    0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x02, 0xB7, 0xBF, 0x80, 0x0B, 0xFB, 0x00,
+    0xFB, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8,
+    0x00, 0x4F, 0x80, 0x8F, 0xF4, 0x08, 0x84, 0x01, 0x83, 0x08, 0xF8, 0x03, 0xA7, 0x40, 0x4F, 0xFF,
+    0xB0, 0x00, 0xF4, 0xBB, 0x08, 0xFF, 0x8F, 0xB0, 0xB0, 0x00, 0x4F, 0xFF, 0x40, 0x40, 0x00, 0x04,
+    0x84, 0x01,
+};
+
+static const GFX_Glyph Font24AA_Glyphs[] = {
+    {    0,   0,   0,   0,   0,  14}, // ' '
+    {    0,   3,  17,   5,   3,  14}, // '!'
+    {   27,   7,   6,   3,   3,  14}, // '"'
+    {   49,  11,  16,   1,   4,  14}, // '#'
+    {  124,  10,  21,   1,   2,  14}, // '$'
+    {  218,  11,  16,   1,   4,  14}, // '%'
+    {  305,  11,  16,   1,   4,  14}, // '&'
+    {  390,   3,   5,   4,   4,  14}, // '\''
+    {  399,   6,  20,   6,   2,  14}, // '('
+    {  460,   6,  20,   1,   2,  14}, // ')'
+    {  519,  11,  12,   1,   4,  14}, // '*'
+    {  579,  11,  11,   1,   6,  14}, // '+'
+    {  616,   3,   5,   2,  18,  14}, // ','
+    {  625,  11,   2,   1,  11,  14}, // '-'
+    {  633,   3,   2,   2,  18,  14}, // '.'
+    {  637,  11,  18,   1,   3,  14}, // '/'
+    {  692,  11,  17,   1,   3,  14}, // '0'
+    {  778,   6,  16,   2,   4,  14}, // '1'
+    {  827,  10,  17,   1,   3,  14}, // '2'
+    {  894,  10,  16,   1,   4,  14}, // '3'
+    {  965,  11,  16,   1,   4,  14}, // '4'
+    { 1033,  10,  16,   1,   4,  14}, // '5'
+    { 1095,  11,  16,   1,   4,  14}, // '6'
+    { 1174,  11,  16,   1,   4,  14}, // '7'
+    { 1229,  11,  16,   1,   4,  14}, // '8'
+    { 1314,  10,  17,   1,   3,  14}, // '9'
+    { 1385,   3,  11,   5,   9,  14}, // ':'
+    { 1396,   3,  14,   5,   9,  14}, // ';'
+    { 1412,  11,  18,   1,   3,  14}, // '<'
+    { 1481,  11,   8,   1,   8,  14}, // '='
+    { 1498,  11,  18,   1,   3,  14}, // '>'
+    { 1566,  10,  16,   1,   4,  14}, // '?'
+    { 1620,  11,  16,   1,   4,  14}, // '@'
+    { 1706,  11,  16,   1,   4,  14}, // 'A'
+    { 1784,  11,  16,   1,   4,  14}, // 'B'
+    { 1865,  11,  16,   1,   4,  14}, // 'C'
+    { 1947,  11,  16,   1,   4,  14}, // 'D'
+    { 2030,  10,  16,   2,   4,  14}, // 'E'
+    { 2072,  11,  16,   1,   4,  14}, // 'F'
+    { 2134,  10,  16,   1,   4,  14}, // 'G'
+    { 2212,  10,  16,   1,   4,  14}, // 'H'
+    { 2290,   3,  16,   5,   4,  14}, // 'I'
+    { 2315,  10,  16,   1,   4,  14}, // 'J'
+    { 2364,  11,  16,   1,   4,  14}, // 'K'
+    { 2453,  11,  16,   1,   4,  14}, // 'L'
+    { 2517,  11,  16,   1,   4,  14}, // 'M'
+    { 2607,  10,  16,   1,   4,  14}, // 'N'
+    { 2689,  11,  16,   1,   4,  14}, // 'O'
+    { 2775,  11,  16,   1,   4,  14}, // 'P'
+    { 2848,  11,  17,   1,   4,  14}, // 'Q'
+    { 2939,  11,  16,   1,   4,  14}, // 'R'
+    { 3024,  11,  16,   1,   4,  14}, // 'S'
+    { 3105,  10,  16,   1,   4,  14}, // 'T'
+    { 3168,  11,  16,   1,   4,  14}, // 'U'
+    { 3251,  11,  16,   1,   4,  14}, // 'V'
+    { 3331,  12,  16,   0,   4,  14}, // 'W'
+    { 3429,  11,  16,   1,   4,  14}, // 'X'
+    { 3512,  11,  16,   1,   4,  14}, // 'Y'
+    { 3586,  11,  16,   1,   4,  14}, // 'Z'
+    { 3647,   6,  22,   5,   1,  14}, // '['
+    { 3692,   9,  20,   2,   3,  14}, // '\\'
+    { 3754,   7,  22,   1,   1,  14}, // ']'
+    { 3823,   9,   4,   2,   1,  14}, // '^'
+    { 3842,  13,   2,   0,  22,  14}, // '_'
+    { 3856,   6,   5,   3,   1,  14}, // '`'
+    { 3872,  10,  11,   1,   9,  14}, // 'a'
+    { 3926,  10,  16,   1,   4,  14}, // 'b'
+    { 4002,  10,  11,   1,   9,  14}, // 'c'
+    { 4054,  10,  16,   1,   4,  14}, // 'd'
+    { 4119,  10,  11,   1,   9,  14}, // 'e'
+    { 4171,  10,  16,   1,   4,  14}, // 'f'
+    { 4237,  11,  15,   1,   9,  14}, // 'g'
+    { 4314,   9,  16,   2,   4,  14}, // 'h'
+    { 4373,   3,  16,   5,   4,  14}, // 'i'
+    { 4398,   7,  20,   2,   4,  14}, // 'j'
+    { 4441,  10,  16,   2,   4,  14}, // 'k'
+    { 4506,   3,  16,   5,   4,  14}, // 'l'
+    { 4531,  11,  11,   1,   9,  14}, // 'm'
+    { 4593,   9,  11,   2,   9,  14}, // 'n'
+    { 4637,  11,  11,   1,   9,  14}, // 'o'
+    { 4696,  10,  15,   1,   9,  14}, // 'p'
+    { 4768,  10,  15,   1,   9,  14}, // 'q'
+    { 4835,   7,  11,   3,   9,  14}, // 'r'
+    { 4865,   9,  11,   2,   9,  14}, // 's'
+    { 4914,  10,  14,   1,   6,  14}, // 't'
+    { 4962,   9,  11,   2,   9,  14}, // 'u'
+    { 5007,  10,  11,   1,   9,  14}, // 'v'
+    { 5061,  12,  11,   0,   9,  14}, // 'w'
+    { 5129,  10,  11,   1,   9,  14}, // 'x'
+    { 5183,  11,  15,   1,   9,  14}, // 'y'
+    { 5257,   9,  11,   2,   9,  14}, // 'z'
+    { 5302,   5,  22,   6,   1,  14}, // '{'
+    { 5353,   3,  24,   5,   0,  14}, // '|'
+    { 5391,   5,  22,   2,   1,  14}, // '}'
+    { 5448,  10,   5,   2,   0,  14}, // '~'
+};
+
+static const GFX_FontRange Font24AA_Ranges[] = {
+    {0x0020, 95, 0},
+};
+
+const GFX_Font Font24AA_Font = {
+    Font24AA_Bitmap, Font24AA_Glyphs, Font24AA_Ranges, 1,
+    4, 24, 20
+};
+
+// Fixed-pitch adapter for Paint_DrawChar() / Paint_DrawString_EN()
+sFONT Font24AA = {
+  0,
+  14, /* Width */
+  24, /* Height */
+  &Font24AA_Font,
+};
@@ -0,0 +1,249 @@
+/**
+ * @file font24r.c
+ * @brief Font24R: generated by tools/fontc.py, do not edit
+ *
+ * Source font24.c, 1 bpp, 95 glyphs, line 24 px, ascent 17 px
+ * Flash 2715 bytes (bitmap 1933)
+ */
+
+#include "gfx_font.h"
+#include "fonts.h"
+
+static const uint8_t Font24R_Bitmap[] = {
+    0x5A, 0x84, 0x48, 0x06, 0x45, 0xB7, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42, 0xB6, 0x19, 0x83,
+    0x30, 0x66, 0x0C, 0xC1, 0x98, 0x55, 0x95, 0x19, 0x86, 0x60, 0x55, 0xB6, 0x33, 0x06, 0x60, 0xCC,
+    0x19, 0x83, 0x30, 0x03, 0xA6, 0xC0, 0x60, 0xF6, 0xFF, 0xC2, 0xBF, 0xF0, 0xFC, 0x07, 0xC1, 0xF8,
+    0x1F, 0x83, 0xE1, 0xBF, 0xF1, 0xFF, 0xDB, 0xC0, 0xC0, 0x60, 0x30, 0x18, 0x8F, 0x3C, 0x1F, 0xBF,
+    0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0x48, 0xBC, 0x1C, 0xE6, 0x19, 0x86, 0x73, 0x8F,
+    0xC1, 0xE0, 0x8E, 0x1F, 0x86, 0xBF, 0xF8, 0xC6, 0x18, 0x03, 0x00, 0x30, 0x07, 0x01, 0xBF, 0xF3,
+    0xF7, 0xFC, 0x79, 0x87, 0x1F, 0xF9, 0xF7, 0x48, 0x8B, 0x49, 0x20, 0x03, 0xA7, 0xC7, 0x39, 0xE7,
+    0x1C, 0xE3, 0xBF, 0x8E, 0x38, 0xE3, 0x87, 0x1C, 0x38, 0xE1, 0xC3, 0xA7, 0xC3, 0x87, 0x1C, 0x38,
+    0xE1, 0xBF, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C, 0xE3, 0x03, 0x03, 0x9F, 0xC0, 0x30, 0x0C,
+    0x3B, 0xBF, 0x7F, 0xFC, 0xFC, 0x1E, 0x07, 0x83, 0x30, 0xCC, 0x04, 0xB6, 0xC0, 0x0C, 0x00, 0xC0,
+    0x0C, 0x00, 0xC0, 0x57, 0x04, 0xB6, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x9F, 0x39, 0x9C,
+    0xC6, 0x63, 0x02, 0x53, 0x4B, 0x07, 0xB7, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0xBF, 0x30,
+    0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18, 0xBF, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03,
+    0x07, 0x95, 0x1E, 0x0F, 0xC4, 0xBF, 0x86, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0xBF, 0x3C,
+    0x0F, 0x03, 0x61, 0x98, 0x63, 0xF0, 0x78, 0x04, 0xBC, 0x81, 0xE1, 0xF8, 0x76, 0x01, 0x80, 0x60,
+    0x18, 0x07, 0xB7, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x53, 0x02, 0x44, 0xBE, 0x0F, 0xFB,
+    0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0xBF, 0x18, 0x06, 0x03, 0x80, 0xE0, 0x30, 0x0C, 0x03, 0x07,
+    0x55, 0x02, 0xBF, 0xF0, 0xFE, 0x31, 0xC0, 0x30, 0x0C, 0x06, 0x0F, 0x05, 0x44, 0x07, 0xBF, 0xE0,
+    0x0C, 0x03, 0x00, 0xF0, 0x7F, 0xF9, 0xF8, 0x05, 0xA7, 0xE0, 0x3C, 0x07, 0x81, 0xB0, 0xBF, 0x66,
+    0x0C, 0xC3, 0x18, 0x63, 0x18, 0x66, 0x0C, 0x55, 0x06, 0x41, 0x05, 0x46, 0x03, 0x46, 0xA3, 0x7F,
+    0xCF, 0xF9, 0x80, 0x30, 0x08, 0xB7, 0xC0, 0x1B, 0xC3, 0xFE, 0x70, 0xC0, 0x0C, 0xBF, 0x01, 0x80,
+    0x30, 0x07, 0x81, 0xBF, 0xF1, 0xF8, 0x95, 0x07, 0xC7, 0xF0, 0xBF, 0xE0, 0x70, 0x18, 0x0C, 0x03,
+    0x78, 0xFF, 0xB8, 0xBF, 0x6C, 0x0F, 0x03, 0xC0, 0xD8, 0x77, 0xF8, 0x7C, 0x55, 0xB7, 0x03, 0xC1,
+    0xC0, 0x60, 0x18, 0x0E, 0x03, 0x07, 0xBF, 0xC0, 0x70, 0x18, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x95,
+    0x3F, 0x1F, 0xEC, 0xBF, 0x87, 0xC0, 0xF0, 0x36, 0x18, 0xFC, 0x3F, 0x18, 0xBF, 0x6C, 0x0F, 0x03,
+    0xC0, 0xF8, 0x77, 0xF8, 0xFC, 0x95, 0x3E, 0x1F, 0xEC, 0xBF, 0x86, 0xC0, 0xF0, 0x3C, 0x0D, 0x87,
+    0x7F, 0xC7, 0xBF, 0xB0, 0x0C, 0x06, 0x03, 0x81, 0xCF, 0xE3, 0xE0, 0x4B, 0x13, 0x4B, 0x01, 0x8F,
+    0xF3, 0xCF, 0x19, 0x42, 0x9E, 0x38, 0xC3, 0x18, 0x40, 0x0A, 0x42, 0x09, 0xBF, 0xF0, 0x0F, 0x00,
+    0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0A,
+    0x42, 0x59, 0x19, 0x59, 0x42, 0x0A, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x0B,
+    0xBF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x09, 0x42, 0x0A, 0x95, 0x3E, 0x3F, 0xB0,
+    0xBF, 0x3E, 0x0F, 0x06, 0x07, 0x07, 0x0F, 0x07, 0x03, 0x17, 0x8F, 0xE0, 0x70, 0x02, 0xA6, 0xF8,
+    0x7F, 0x38, 0xEC, 0x1E, 0xBF, 0x0F, 0xC7, 0xF3, 0xBC, 0xCF, 0x33, 0xCC, 0xF1, 0xBF, 0xFC, 0x3F,
+    0x00, 0x60, 0x1C, 0x33, 0xFC, 0x7C, 0x02, 0x45, 0x09, 0x46, 0x0C, 0x42, 0x0B, 0x41, 0xA7, 0x60,
+    0x03, 0x60, 0x06, 0x30, 0xBF, 0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0xBF, 0x18, 0x0C,
+    0x30, 0x0C, 0xFC, 0x7F, 0xFC, 0x7F, 0x49, 0x02, 0x4A, 0x03, 0xB6, 0xC1, 0xC6, 0x06, 0x30, 0x31,
+    0x83, 0x8E, 0xBF, 0xFC, 0x3F, 0xF1, 0x81, 0xCC, 0x06, 0x60, 0x33, 0x06, 0x4D, 0x00, 0x4A, 0x01,
+    0xA6, 0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x06, 0xBF, 0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03,
+    0x0A, 0xAE, 0xC0, 0x6E, 0x0E, 0x7F, 0xC1, 0xF8, 0x48, 0x03, 0x4A, 0x03, 0xBF, 0xC1, 0xC6, 0x06,
+    0x30, 0x19, 0x80, 0xCC, 0x06, 0xBF, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0xC6, 0x0E, 0x4A, 0x01,
+    0x49, 0x02, 0x57, 0xAF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0xBF, 0x3F, 0x03, 0xF0, 0x33, 0x03,
+    0x33, 0x30, 0x33, 0x05, 0x59, 0x57, 0x8F, 0x30, 0x33, 0xBF, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03,
+    0xF0, 0x33, 0xBF, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0, 0x03, 0xBE, 0xFB, 0x1F, 0xF9,
+    0xC1, 0xCC, 0x06, 0xC0, 0x36, 0x0A, 0x9F, 0xC0, 0x06, 0x1F, 0xF0, 0x48, 0x07, 0xB6, 0xDC, 0x06,
+    0x70, 0x71, 0xFF, 0x83, 0xF0, 0x45, 0x01, 0x4B, 0xAF, 0x3F, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0xBF,
+    0x0C, 0x0C, 0x3F, 0xF0, 0xFF, 0xC3, 0x03, 0x0C, 0xBF, 0x0C, 0x30, 0x30, 0xC0, 0xCF, 0xCF, 0xFF,
+    0x3F, 0x53, 0x03, 0x9F, 0xC0, 0x30, 0x0C, 0x03, 0x07, 0xB7, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+    0x30, 0x53, 0x02, 0x49, 0xBD, 0x1F, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x0A, 0x9F, 0xC6,
+    0x06, 0x30, 0x31, 0xBF, 0x81, 0x8C, 0x0C, 0x60, 0xC3, 0xFE, 0x07, 0xC0, 0x46, 0xAF, 0x3E, 0xFE,
+    0x7C, 0x60, 0xC0, 0xC3, 0x06, 0xBF, 0xC6, 0x01, 0x98, 0x03, 0x70, 0x07, 0xF0, 0x0E, 0xBF, 0x70,
+    0x18, 0x70, 0x30, 0x60, 0x60, 0xE3, 0xF8, 0x4B, 0x02, 0x44, 0x47, 0x04, 0x47, 0x07, 0x41, 0x0A,
+    0xAF, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0xBF, 0x0C, 0x00, 0x60, 0x63, 0x03, 0x18, 0x18, 0xC0,
+    0x5B, 0x43, 0x07, 0x48, 0x05, 0x44, 0xBF, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C, 0xBF,
+    0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0xBF, 0x30, 0x0C, 0x30, 0x0C, 0xFE, 0x7F, 0xFE,
+    0x7F, 0x43, 0xBF, 0x1F, 0xFC, 0x7F, 0x38, 0x30, 0xF0, 0xC3, 0xE3, 0xBF, 0x0D, 0x8C, 0x37, 0x30,
+    0xCE, 0xC3, 0x1B, 0x0C, 0xBF, 0x7C, 0x30, 0xF0, 0xC1, 0xCF, 0xE3, 0x3F, 0x8C, 0xA7, 0x0F, 0x03,
+    0xFC, 0x70, 0xE6, 0xBF, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0xBF, 0x3E, 0x07, 0x60,
+    0x67, 0x0E, 0x3F, 0xC0, 0xF0, 0x49, 0x01, 0x4A, 0xBE, 0x18, 0x39, 0x81, 0x98, 0x19, 0x81, 0x98,
+    0x30, 0x48, 0x02, 0x46, 0xBE, 0x06, 0x00, 0x60, 0x06, 0x01, 0xFE, 0x1F, 0xE0, 0x03, 0x43, 0x05,
+    0x47, 0xB5, 0x1C, 0x39, 0x81, 0xB8, 0x1F, 0x00, 0xF0, 0xBF, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x76,
+    0x06, 0x70, 0xBF, 0xE3, 0xFC, 0x1F, 0x01, 0xF3, 0x3F, 0xF3, 0x0E, 0x49, 0x03, 0x4A, 0x04, 0xA5,
+    0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0xBF, 0x0C, 0x1C, 0x3F, 0xE0, 0xFE, 0x03, 0x1C, 0x0C, 0xBF, 0x38,
+    0x30, 0x60, 0xC1, 0xCF, 0xE3, 0xFF, 0x87, 0x8A, 0x3E, 0xC0, 0x4B, 0xB4, 0x0F, 0x81, 0xE0, 0x7E,
+    0x03, 0xF0, 0x38, 0xBF, 0xE0, 0x3F, 0x03, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C, 0x59, 0x02, 0xBD, 0xC7,
+    0x8C, 0x78, 0xC7, 0x8C, 0x60, 0xC0, 0x0C, 0x09, 0x41, 0x09, 0xB6, 0xC0, 0x0C, 0x00, 0xC0, 0x7F,
+    0x87, 0xF8, 0x45, 0x01, 0x4B, 0xAF, 0x3F, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0xBF, 0x0C, 0x0C, 0x30,
+    0x30, 0xC0, 0xC3, 0x03, 0x0C, 0xBF, 0x0C, 0x30, 0x30, 0x61, 0x81, 0xFE, 0x01, 0xE0, 0x46, 0x00,
+    0x4D, 0x97, 0x7F, 0x30, 0x18, 0xBF, 0x30, 0x60, 0x60, 0xC0, 0xC1, 0x80, 0xC6, 0x01, 0xBF, 0x8C,
+    0x01, 0xB0, 0x03, 0x60, 0x06, 0xC0, 0x07, 0x0B, 0x42, 0x0C, 0x40, 0x06, 0x46, 0x02, 0x4D, 0x02,
+    0x46, 0xBF, 0x30, 0x06, 0x18, 0x03, 0x0C, 0x21, 0x83, 0x39, 0xBF, 0x81, 0x9C, 0xC0, 0xDB, 0x60,
+    0x6D, 0xB0, 0x3C, 0x44, 0x06, 0xBF, 0xE3, 0x80, 0x71, 0xC0, 0x30, 0x60, 0x18, 0x30, 0x45, 0x01,
+    0x4B, 0xAF, 0x3F, 0x30, 0x30, 0x61, 0x80, 0xCC, 0xBF, 0x01, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x78,
+    0x03, 0xBF, 0x30, 0x18, 0x60, 0xC0, 0xCF, 0xCF, 0xFF, 0x3F, 0xB7, 0xF8, 0xFF, 0xE3, 0xF3, 0x03,
+    0x06, 0x18, 0xBF, 0x0C, 0xC0, 0x33, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x0B, 0xBF, 0xC0, 0x03, 0x00,
+    0x0C, 0x01, 0xFE, 0x07, 0xF8, 0x00, 0x49, 0xAF, 0x7F, 0xEC, 0x0D, 0x83, 0x30, 0xC6, 0xBF, 0x30,
+    0x0C, 0x03, 0x00, 0xC3, 0x30, 0x6C, 0x0F, 0x06, 0x57, 0x4B, 0x02, 0x41, 0xBE, 0x18, 0xC6, 0x31,
+    0x8C, 0x63, 0x18, 0xC6, 0x30, 0x49, 0xBE, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x02, 0xBF,
+    0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x08, 0xBF, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70,
+    0x0C, 0x03, 0x49, 0x02, 0x41, 0xBE, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x30, 0x4B, 0x97,
+    0x04, 0x01, 0xC0, 0xBF, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01, 0x5F, 0x93, 0xC7, 0x0E,
+    0x30, 0xBC, 0x3F, 0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC0, 0x48, 0xBD, 0x38, 0x33, 0x03, 0x30,
+    0x71, 0xFF, 0xCF, 0xBC, 0x43, 0x08, 0x43, 0x0A, 0x41, 0x0A, 0xBF, 0xC0, 0x06, 0xF8, 0x3F, 0xF1,
+    0xC1, 0x8C, 0x06, 0xBF, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x67, 0x06, 0x4B, 0x8D, 0x7B, 0xE0,
+    0x03, 0xBF, 0xFB, 0x3F, 0xF7, 0x07, 0xE0, 0x3C, 0x03, 0xC0, 0xBF, 0x0C, 0x00, 0xE0, 0x37, 0x07,
+    0x3F, 0xE0, 0xFC, 0x06, 0x43, 0x08, 0x43, 0x0A, 0x9E, 0xC0, 0x06, 0x0F, 0xB0, 0x49, 0xB6, 0x18,
+    0x39, 0x80, 0xCC, 0x06, 0x60, 0x32, 0xBF, 0x80, 0xCC, 0x06, 0x30, 0x71, 0xFF, 0xE3, 0xEF, 0xA5,
+    0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x07, 0x5B, 0x09, 0xAF, 0xC0, 0x06, 0x03, 0x7F, 0xF1, 0xFC, 0x04,
+    0x46, 0xA7, 0x0F, 0xF1, 0x80, 0x18, 0x0F, 0xBF, 0xFE, 0xFF, 0xE1, 0x80, 0x18, 0x01, 0x80, 0x18,
+    0xBF, 0x01, 0x80, 0x18, 0x01, 0x80, 0xFF, 0xCF, 0xFC, 0x8C, 0x1F, 0x78, 0xBF, 0x7F, 0xFB, 0x07,
+    0x30, 0x19, 0x80, 0xCC, 0x06, 0xBF, 0x60, 0x33, 0x01, 0x8C, 0x1C, 0x7F, 0xE0, 0xFB, 0x0A, 0xB7,
+    0xC0, 0x06, 0x00, 0x70, 0xFF, 0x07, 0xE0, 0x43, 0x09, 0x43, 0x0B, 0x41, 0x0B, 0x41, 0x0B, 0x97,
+    0xDF, 0x03, 0xFE, 0xBF, 0x0E, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0xBF, 0x0C, 0x30, 0x30,
+    0xC0, 0xCF, 0xCF, 0xFF, 0x3F, 0x04, 0x41, 0x09, 0x41, 0x1D, 0x45, 0x05, 0x45, 0x09, 0x41, 0x09,
+    0x41, 0x09, 0xB6, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x57, 0x8F, 0x06, 0x03, 0x13, 0x51,
+    0x06, 0xB6, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0xBF, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x1F,
+    0xFD, 0xF8, 0x43, 0x07, 0xA7, 0xF0, 0x03, 0x00, 0x30, 0x03, 0xBF, 0x3E, 0x33, 0xE3, 0x30, 0x36,
+    0x03, 0xE0, 0x3C, 0xBF, 0x03, 0xE0, 0x37, 0x03, 0x38, 0xF1, 0xFF, 0x1F, 0x00, 0x45, 0x05, 0x45,
+    0x09, 0xBD, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x09, 0xB6, 0xC0, 0x0C, 0x00, 0xC0,
+    0x0C, 0x00, 0xC0, 0x57, 0xAF, 0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0xBF, 0x31, 0x8C, 0x31, 0x8C,
+    0x31, 0x8C, 0x31, 0x8C, 0xBF, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF, 0x43, 0x8F, 0x7C,
+    0x3F, 0xBF, 0xF8, 0x38, 0x70, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xBF, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+    0x3F, 0x3F, 0xFC, 0x45, 0x03, 0xBF, 0xF0, 0x3F, 0xC7, 0x0E, 0xE0, 0x7C, 0x03, 0xC0, 0xBF, 0x3C,
+    0x03, 0xE0, 0x77, 0x0E, 0x3F, 0xC0, 0xF0, 0x43, 0xBE, 0x7C, 0x7F, 0xF8, 0xE0, 0xC6, 0x03, 0x30,
+    0x18, 0xBF, 0xC0, 0x66, 0x03, 0x30, 0x19, 0xC1, 0x8F, 0xFC, 0xBF, 0x6F, 0x83, 0x00, 0x18, 0x00,
+    0xC0, 0x1F, 0xC0, 0x46, 0x05, 0x02, 0xBF, 0xFB, 0xDF, 0xFE, 0xC1, 0xCC, 0x06, 0x60, 0x33, 0x06,
+    0xBE, 0xCC, 0x06, 0x60, 0x31, 0x83, 0x8F, 0xFC, 0x1E, 0xBF, 0xB0, 0x01, 0x80, 0x0C, 0x00, 0x60,
+    0x1F, 0xC0, 0x46, 0x44, 0xBE, 0x3D, 0xF7, 0xE3, 0xE6, 0x38, 0x03, 0x00, 0x30, 0xBF, 0x01, 0x80,
+    0x18, 0x01, 0x80, 0xFF, 0xCF, 0xFC, 0x9F, 0x3F, 0xDF, 0xFC, 0x0F, 0x05, 0x47, 0xBF, 0x07, 0xF8,
+    0x1F, 0xC0, 0xF0, 0x7F, 0xFB, 0xFC, 0xA7, 0x30, 0x03, 0x00, 0x30, 0x03, 0x07, 0x49, 0x01, 0x49,
+    0xAD, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xBF, 0x03, 0x00, 0x30, 0x03, 0x07, 0x1F, 0xF0, 0xFC,
+    0x43, 0x95, 0x0F, 0x3C, 0x3C, 0xBF, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0xBF, 0x0C,
+    0x30, 0x30, 0xC1, 0xC1, 0xFF, 0xC3, 0xEF, 0x44, 0x03, 0x49, 0x03, 0x44, 0xBD, 0x30, 0x30, 0xC0,
+    0xC1, 0x86, 0x06, 0x18, 0x0C, 0xBF, 0x30, 0x0C, 0xC0, 0x3F, 0x00, 0x78, 0x01, 0xE0, 0x43, 0x04,
+    0x47, 0xBD, 0x07, 0xB1, 0x19, 0x9C, 0xCC, 0xE6, 0x35, 0x60, 0xBF, 0x7B, 0xC3, 0xDE, 0x1C, 0x60,
+    0x63, 0x03, 0x18, 0x44, 0xBD, 0x3F, 0xF3, 0xE6, 0x18, 0x33, 0x01, 0xE0, 0x0C, 0x08, 0xB7, 0xF0,
+    0x19, 0x83, 0x0C, 0xF9, 0xFF, 0x9F, 0x45, 0x03, 0x4A, 0x03, 0xB6, 0xF9, 0x80, 0xC1, 0x83, 0x03,
+    0x06, 0x02, 0xBF, 0x8C, 0x03, 0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x0C, 0x41, 0x0B, 0x41, 0x0C,
+    0x41, 0x0B, 0x41, 0x08, 0x47, 0x06, 0x47, 0x05, 0x55, 0x04, 0xB7, 0xD8, 0x60, 0x30, 0x18, 0x0C,
+    0x06, 0x1B, 0x04, 0x55, 0xA7, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x03, 0xBF, 0xC7, 0x38, 0x70, 0xC3,
+    0x0C, 0x30, 0xC3, 0xC7, 0x63, 0xA7, 0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x03, 0xBF, 0xC3, 0x87, 0x38,
+    0xC3, 0x0C, 0x30, 0xCF, 0x38, 0xB6, 0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38,
+};
+
+static const GFX_Glyph Font24R_Glyphs[] = {
+    {    0,   0,   0,   0,   0,  17}, // ' '
+    {    0,   3,  15,   6,   2,  17}, // '!'
+    {    5,   8,   7,   4,   3,  17}, // '"'
+    {   13,  11,  16,   2,   2,  17}, // '#'
+    {   35,   9,  19,   3,   1,  17}, // '$'
+    {   60,  10,  15,   3,   2,  17}, // '%'
+    {   82,  11,  13,   3,   4,  17}, // '&'
+    {  103,   3,   7,   6,   3,  17}, // '\''
+    {  107,   6,  18,   7,   2,  17}, // '('
+    {  123,   6,  18,   3,   2,  17}, // ')'
+    {  139,  10,  10,   3,   2,  17}, // '*'
+    {  154,  12,  12,   2,   4,  17}, // '+'
+    {  173,   5,   7,   6,  14,  17}, // ','
+    {  179,  10,   2,   3,   9,  17}, // '-'
+    {  180,   4,   3,   6,  14,  17}, // '.'
+    {  181,  10,  20,   3,   0,  17}, // '/'
+    {  209,  10,  15,   3,   2,  17}, // '0'
+    {  231,  10,  15,   3,   2,  17}, // '1'
+    {  251,  11,  15,   2,   2,  17}, // '2'
+    {  273,  10,  15,   3,   2,  17}, // '3'
+    {  295,  11,  15,   2,   2,  17}, // '4'
+    {  318,  11,  15,   2,   2,  17}, // '5'
+    {  342,  10,  15,   3,   2,  17}, // '6'
+    {  364,  10,  15,   3,   2,  17}, // '7'
+    {  383,  10,  15,   3,   2,  17}, // '8'
+    {  405,  10,  15,   3,   2,  17}, // '9'
+    {  427,   4,  11,   6,   6,  17}, // ':'
+    {  430,   6,  13,   6,   6,  17}, // ';'
+    {  441,  14,  13,   0,   4,  17}, // '<'
+    {  465,  13,   6,   1,   7,  17}, // '='
+    {  468,  14,  13,   1,   4,  17}, // '>'
+    {  492,   9,  14,   3,   3,  17}, // '?'
+    {  509,  10,  17,   3,   2,  17}, // '@'
+    {  534,  16,  14,   0,   3,  17}, // 'A'
+    {  566,  13,  14,   1,   3,  17}, // 'B'
+    {  592,  12,  14,   2,   3,  17}, // 'C'
+    {  616,  13,  14,   1,   3,  17}, // 'D'
+    {  642,  12,  14,   1,   3,  17}, // 'E'
+    {  661,  12,  14,   2,   3,  17}, // 'F'
+    {  683,  13,  14,   2,   3,  17}, // 'G'
+    {  709,  14,  14,   1,   3,  17}, // 'H'
+    {  737,  10,  14,   3,   3,  17}, // 'I'
+    {  754,  13,  14,   2,   3,  17}, // 'J'
+    {  780,  15,  14,   1,   3,  17}, // 'K'
+    {  810,  13,  14,   1,   3,  17}, // 'L'
+    {  833,  16,  14,   0,   3,  17}, // 'M'
+    {  865,  14,  14,   1,   3,  17}, // 'N'
+    {  893,  12,  14,   2,   3,  17}, // 'O'
+    {  917,  12,  14,   2,   3,  17}, // 'P'
+    {  941,  12,  17,   2,   3,  17}, // 'Q'
+    {  971,  14,  14,   1,   3,  17}, // 'R'
+    {  999,  10,  14,   3,   3,  17}, // 'S'
+    { 1020,  12,  14,   2,   3,  17}, // 'T'
+    { 1042,  14,  14,   1,   3,  17}, // 'U'
+    { 1070,  15,  14,   1,   3,  17}, // 'V'
+    { 1100,  17,  14,   0,   3,  17}, // 'W'
+    { 1134,  14,  14,   1,   3,  17}, // 'X'
+    { 1162,  14,  14,   1,   3,  17}, // 'Y'
+    { 1189,  11,  14,   2,   3,  17}, // 'Z'
+    { 1209,   5,  18,   7,   2,  17}, // '['
+    { 1222,  10,  20,   3,   0,  17}, // '\\'
+    { 1250,   5,  18,   4,   2,  17}, // ']'
+    { 1263,  11,   8,   3,   1,  17}, // '^'
+    { 1276,  16,   2,   0,  22,  17}, // '_'
+    { 1277,   5,   4,   6,   1,  17}, // '`'
+    { 1281,  12,  11,   2,   6,  17}, // 'a'
+    { 1300,  13,  15,   1,   2,  17}, // 'b'
+    { 1328,  12,  11,   2,   6,  17}, // 'c'
+    { 1347,  13,  15,   2,   2,  17}, // 'd'
+    { 1375,  12,  11,   2,   6,  17}, // 'e'
+    { 1391,  12,  15,   2,   2,  17}, // 'f'
+    { 1417,  13,  16,   2,   6,  17}, // 'g'
+    { 1447,  14,  15,   1,   2,  17}, // 'h'
+    { 1477,  12,  15,   2,   2,  17}, // 'i'
+    { 1499,   9,  20,   3,   2,  17}, // 'j'
+    { 1522,  12,  15,   2,   2,  17}, // 'k'
+    { 1548,  12,  15,   2,   2,  17}, // 'l'
+    { 1572,  16,  11,   0,   6,  17}, // 'm'
+    { 1597,  14,  11,   1,   6,  17}, // 'n'
+    { 1620,  12,  11,   2,   6,  17}, // 'o'
+    { 1639,  13,  16,   1,   6,  17}, // 'p'
+    { 1669,  13,  16,   2,   6,  17}, // 'q'
+    { 1699,  12,  11,   2,   6,  17}, // 'r'
+    { 1718,  10,  11,   3,   6,  17}, // 's'
+    { 1734,  12,  15,   2,   2,  17}, // 't'
+    { 1760,  14,  11,   1,   6,  17}, // 'u'
+    { 1783,  14,  11,   1,   6,  17}, // 'v'
+    { 1806,  13,  11,   1,   6,  17}, // 'w'
+    { 1827,  12,  11,   2,   6,  17}, // 'x'
+    { 1846,  15,  16,   1,   6,  17}, // 'y'
+    { 1880,  10,  11,   3,   6,  17}, // 'z'
+    { 1892,   6,  18,   5,   2,  17}, // '{'
+    { 1908,   2,  18,   7,   2,  17}, // '|'
+    { 1909,   6,  18,   5,   2,  17}, // '}'
+    { 1925,  11,   5,   2,   8,  17}, // '~'
+};
+
+static const GFX_FontRange Font24R_Ranges[] = {
+    {0x0020, 95, 0},
+};
+
+const GFX_Font Font24R_Font = {
+    Font24R_Bitmap, Font24R_Glyphs, Font24R_Ranges, 1,
+    1, 24, 17
+};
+
+// Fixed-pitch adapter for Paint_DrawChar() / Paint_DrawString_EN()
+sFONT Font24R = {
+  0,
+  17, /* Width */
+  24, /* Height */
+  &Font24R_Font,
+};
@@ -51,12 +51,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+struct GFX_Font;
+
 //ASCII
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const struct GFX_Font *Compressed;  // tools/fontc.py output, used instead of table when set
   
 } sFONT;
 
@@ -84,6 +87,8 @@ extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
+extern sFONT Font24AA;
+extern sFONT Font24R;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
@@ -0,0 +1,144 @@
+/*****************************************************************************
+* | File      	:   GUI_AA.c
+* | Function    :   Anti-aliased lines, circles, rings and arcs on the
+*                   Paint canvas
+* | Info        :
+*   Each shape is rasterised one canvas row at a time. With no rotation
+*   or mirroring the row is blended in place; otherwise the row is
+*   gathered through the Paint_SetPixel mapping, blended and written back.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_AA.h"
+
+#include <math.h>
+
+#define AA_FIX(v)   ((int32_t)lround((v) * GFX_FIX_ONE))
+#define AA_ANGLE(d) ((int32_t)lround((d) * GFX_ANGLE_360 / 360.0))
+
+/******************************************************************************
+function: Memory index of a logical canvas pixel (same mapping as Paint_SetPixel)
+******************************************************************************/
+static UDOUBLE AA_Addr(UWORD Xpoint, UWORD Ypoint)
+{
+    UWORD X = Xpoint, Y = Ypoint;
+
+    switch(Paint.Rotate) {
+    case 90:
+        X = Paint.WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+        break;
+    case 180:
+        X = Paint.WidthMemory - Xpoint - 1;
+        Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        X = Ypoint;
+        Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    }
+    if(Paint.Mirror & MIRROR_HORIZONTAL)
+        X = Paint.WidthMemory - X - 1;
+    if(Paint.Mirror & MIRROR_VERTICAL)
+        Y = Paint.HeightMemory - Y - 1;
+
+    return X + Y * Paint.WidthByte;
+}
+
+/******************************************************************************
+function: Blend a prepared shape into the canvas
+parameter:
+    Shape : Set up with GFX_AA_Line(), GFX_AA_Circle(), GFX_AA_Ring() or
+            GFX_AA_Arc()
+******************************************************************************/
+void Paint_DrawShapeAA(const GFX_AAShape *Shape)
+{
+    if(Paint.Depth != 16) {
+        DEBUG("Anti-aliasing needs a 16-bit canvas\r\n");
+        return;
+    }
+
+    int32_t Xstart = Shape->left < 0 ? 0 : Shape->left;
+    int32_t Xend = Shape->right >= Paint.Width ? Paint.Width - 1 : Shape->right;
+    int32_t Ystart = Shape->top < 0 ? 0 : Shape->top;
+    int32_t Yend = Shape->bottom >= Paint.Height ? Paint.Height - 1 : Shape->bottom;
+    if(Xstart > Xend || Ystart > Yend)
+        return;
+
+    UWORD Width = Xend - Xstart + 1;
+    UBYTE Direct = (Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE);
+    UWORD Row[Direct ? 1 : Width];
+
+    for(int32_t Y = Ystart; Y <= Yend; Y++) {
+        if(Direct) {
+            UWORD *Line = Paint.Image + Y * Paint.WidthByte + Xstart;
+            GFX_AA_RenderRow(Shape, Y, Xstart, Width, Line, GFX_ORDER_SWAPPED);
+            continue;
+        }
+        for(UWORD i = 0; i < Width; i++)
+            Row[i] = Paint.Image[AA_Addr(Xstart + i, Y)];
+        GFX_AA_RenderRow(Shape, Y, Xstart, Width, Row, GFX_ORDER_SWAPPED);
+        for(UWORD i = 0; i < Width; i++)
+            Paint.Image[AA_Addr(Xstart + i, Y)] = Row[i];
+    }
+}
+
+/******************************************************************************
+function: Draw an anti-aliased line
+parameter:
+    Xstart, Ystart : Start point
+    Xend, Yend     : End point
+    Line_width     : Width in pixels; 1 or less draws a Wu line
+    Color          : Line color
+******************************************************************************/
+void Paint_DrawLineAA(double Xstart, double Ystart, double Xend, double Yend,
+                      double Line_width, UWORD Color)
+{
+    GFX_AAShape Shape;
+    GFX_AA_Line(&Shape, AA_FIX(Xstart), AA_FIX(Ystart), AA_FIX(Xend), AA_FIX(Yend),
+                AA_FIX(Line_width), Color);
+    Paint_DrawShapeAA(&Shape);
+}
+
+/******************************************************************************
+function: Draw an anti-aliased circle
+parameter:
+    X_Center, Y_Center : Centre
+    Radius             : Radius to the middle of the outline
+    Line_width         : Outline width (ignored when filled)
+    Color              : Circle color
+    Draw_Fill          : DRAW_FILL_FULL for a disc, DRAW_FILL_EMPTY for a ring
+******************************************************************************/
+void Paint_DrawCircleAA(double X_Center, double Y_Center, double Radius,
+                        double Line_width, UWORD Color, DRAW_FILL Draw_Fill)
+{
+    GFX_AAShape Shape;
+    if(Draw_Fill == DRAW_FILL_FULL)
+        GFX_AA_Circle(&Shape, AA_FIX(X_Center), AA_FIX(Y_Center), AA_FIX(Radius), Color);
+    else
+        GFX_AA_Ring(&Shape, AA_FIX(X_Center), AA_FIX(Y_Center), AA_FIX(Radius + Line_width / 2),
+                    AA_FIX(Radius - Line_width / 2), Color);
+    Paint_DrawShapeAA(&Shape);
+}
+
+/******************************************************************************
+function: Draw an anti-aliased arc (ring sector)
+parameter:
+    X_Center, Y_Center : Centre
+    Radius             : Radius to the middle of the arc
+    Line_width         : Arc thickness
+    Start_deg, End_deg : Sweep, clockwise from 12 o'clock; equal angles
+                         draw the full ring
+    Color              : Arc color
+******************************************************************************/
+void Paint_DrawArcAA(double X_Center, double Y_Center, double Radius,
+                     double Line_width, double Start_deg, double End_deg, UWORD Color)
+{
+    GFX_AAShape Shape;
+    GFX_AA_Arc(&Shape, AA_FIX(X_Center), AA_FIX(Y_Center), AA_FIX(Radius + Line_width / 2),
+               AA_FIX(Radius - Line_width / 2), AA_ANGLE(Start_deg), AA_ANGLE(End_deg), Color);
+    Paint_DrawShapeAA(&Shape);
+}
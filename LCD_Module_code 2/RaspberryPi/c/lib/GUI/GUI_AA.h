@@ -0,0 +1,31 @@
+/*****************************************************************************
+* | File      	:   GUI_AA.h
+* | Function    :   Anti-aliased lines, circles, rings and arcs on the
+*                   Paint canvas
+* | Info        :
+*   Thin wrapper over the shared fixed-point core in lib/gfx/gfx_aa.c,
+*   which is also used by the CH32V003 band renderer.
+*   Coordinates are in pixels with sub-pixel precision (1/64 px);
+*   angles are in degrees, clockwise from 12 o'clock.
+*   Only 16-bit canvases (Depth 16) are supported.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_AA_H
+#define __GUI_AA_H
+
+#include "GUI_Paint.h"
+#include "gfx_aa.h"
+
+void Paint_DrawShapeAA(const GFX_AAShape *Shape);
+void Paint_DrawLineAA(double Xstart, double Ystart, double Xend, double Yend,
+                      double Line_width, UWORD Color);
+void Paint_DrawCircleAA(double X_Center, double Y_Center, double Radius,
+                        double Line_width, UWORD Color, DRAW_FILL Draw_Fill);
+void Paint_DrawArcAA(double X_Center, double Y_Center, double Radius,
+                     double Line_width, double Start_deg, double End_deg, UWORD Color);
+
+#endif
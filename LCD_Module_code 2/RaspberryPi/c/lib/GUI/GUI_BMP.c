@@ -19,10 +19,19 @@
 #include <stdlib.h>	//memset
 
 #include "GUI_Paint.h"
+#include "gfx_dither.h"
 // #include "GUI_Cache.h"
 
 
-UBYTE GUI_ReadBmp(const char *path)
+/******************************************************************************
+function:	Load a BMP into the Paint canvas, converting 24/32-bit and palette
+			colours to RGB565 with the given dither
+parameter:
+	path :	BMP file
+	Mode :	BMP_DITHER_NONE (truncate, as GUI_ReadBmp), BMP_DITHER_ORDERED
+			or BMP_DITHER_FS
+******************************************************************************/
+UBYTE GUI_ReadBmp_Dither(const char *path, UBYTE Mode)
 {
     FILE *fp;                     //Define a file pointer 
     BMPFILEHEADER bmpFileHeader;  //Define a bmp file header structure
@@ -71,9 +80,32 @@ UBYTE GUI_ReadBmp(const char *path)
 	
 	int 		row, col; 	
     short 		data;			//All data formats are converted to RGB565 format
-	char		pixels,temp;		
+	UBYTE		pixels,temp;		
 	int len  = 	bmpInfoHeader.bBitCount / 8;
-	ARGBQUAD 	argb;
+
+	//Everything but 16-bit goes through the converter one row at a time:
+	//32-bit rows as BGRX8888, 24-bit rows and palette colours as BGR888
+	GFX_RGBFormat fmt = (bmpInfoHeader.bBitCount == 32) ? GFX_BGRX8888 : GFX_BGR888;
+	UBYTE *line = NULL;
+	UWORD *rgb565 = NULL;
+	int16_t *err = NULL;
+	GFX_DitherFS fs;
+	if(bmpInfoHeader.bBitCount != 16) {
+		line = malloc(bmpInfoHeader.bWidth * 4);
+		rgb565 = malloc(bmpInfoHeader.bWidth * sizeof(UWORD));
+		if(Mode == BMP_DITHER_FS)
+			err = malloc(GFX_DITHER_FS_ERR_LEN(bmpInfoHeader.bWidth) * sizeof(int16_t));
+		if(line == NULL || rgb565 == NULL || (Mode == BMP_DITHER_FS && err == NULL)) {
+			DEBUG("Not enough memory for the BMP row buffers\n");
+			free(line);
+			free(rgb565);
+			free(err);
+			fclose(fp);
+			return 0;
+		}
+		if(Mode == BMP_DITHER_FS)
+			GFX_DitherFS_Init(&fs, err, bmpInfoHeader.bWidth);
+	}
 	/*
 	fseek(fp, bmpFileHeader.bOffset, SEEK_SET);
 	printf("frist add:0x%x \r\n",bmpFileHeader.bOffset);
@@ -83,9 +115,10 @@ UBYTE GUI_ReadBmp(const char *path)
 	// get bmp data and show
 	for(row = 0; row < bmpInfoHeader.bHeight;row++) 
 	{		
-		for(col = 0; col < bmpInfoHeader.bWidth; ) 
+		UWORD y = bmpInfoHeader.bHeight - row - 1;
+		if(bmpInfoHeader.bBitCount==16)
 		{
-			if(bmpInfoHeader.bBitCount==16)
+			for(col = 0; col < bmpInfoHeader.bWidth; col++) 
 			{
 				if(fread((char *)&data, 1, len, fp) != len)
 				{
@@ -95,57 +128,71 @@ UBYTE GUI_ReadBmp(const char *path)
 				//ARGB4444 format cannot be recognized for the time being. It can only be used to identify RGB565 format information!!
 				if(bmpInfoHeader.bInfoSize==0x38)
 				{	
-					Paint_SetPixel(col, bmpInfoHeader.bHeight - row - 1, data);
+					Paint_SetPixel(col, y, data);
 				}
 				//Used to identify the XRGB1555 format
 				else if((bmpInfoHeader.bInfoSize==0x28)&&(bmpInfoHeader.bCompression==0x00))
 				{
 					data=((((long)((data>>5)&0x1f)*0X3F)/0X1F)<<5)+(data&0x1f)+((data&0xEC00)<<1);
-					Paint_SetPixel(col, bmpInfoHeader.bHeight - row - 1, data);
+					Paint_SetPixel(col, y, data);
 				}
-				col++;
 			}
-			//For RGB888 ARGB8888 XRGB8888 format uniform compression and removal of alpha
-			else if(bmpInfoHeader.bBitCount>16)
+		}
+		else
+		{
+			//For RGB888 ARGB8888 XRGB8888 format the row is used as is (alpha ignored)
+			if(bmpInfoHeader.bBitCount>16)
 			{
-				if(fread((char *)&argb, 1, len, fp) != len)
+				if(fread(line, len, bmpInfoHeader.bWidth, fp) != bmpInfoHeader.bWidth)
 				{
-					printf("x:%d,y:%d\r\n",col,row);
+					printf("y:%d\r\n",row);
 					perror("get bmpdata: \r\n");
 					break;
 				}
-				data = RGB((argb.rgbRed), (argb.rgbGreen), (argb.rgbBlue));
-				Paint_SetPixel(col, bmpInfoHeader.bHeight - row - 1, data);
-				col++;
-			}	
-			//bBitCount<8 format
-			else		
+			}
+			//bBitCount<8 format: look the indices up in the palette
+			else
 			{
-				if(fread((char *)&pixels, 1, 1, fp) != 1)
-				{
-					perror("get bmpdata:\r\n");
-					break;
-				}
-				for(temp=0;(temp<(8/bmpInfoHeader.bBitCount))&&(col < bmpInfoHeader.bWidth);temp++,col++)
+				for(col = 0; col < bmpInfoHeader.bWidth; )
 				{
-					if(bmpInfoHeader.bBitCount==1){
-						data=(pixels<<temp)>>7;
-						data&=0x01;
+					if(fread((char *)&pixels, 1, 1, fp) != 1)
+					{
+						perror("get bmpdata:\r\n");
+						break;
 					}
-					else if(bmpInfoHeader.bBitCount==4){	
-						data=(pixels<<(temp*4))>>4;
-						data&=0x0f;					
+					for(temp=0;(temp<(8/bmpInfoHeader.bBitCount))&&(col < bmpInfoHeader.bWidth);temp++,col++)
+					{
+						if(bmpInfoHeader.bBitCount==1)		data=(pixels>>(7-temp))&0x01;
+						else if(bmpInfoHeader.bBitCount==4)	data=(pixels>>(4-temp*4))&0x0f;
+						else 								data=pixels;
+						line[col*3+0]=RGBPAD[data].rgbBlue;
+						line[col*3+1]=RGBPAD[data].rgbGreen;
+						line[col*3+2]=RGBPAD[data].rgbRed;
 					}
-					else {data=pixels;}
-					data=RGB((RGBPAD[data].rgbRed), (RGBPAD[data].rgbGreen), (RGBPAD[data].rgbBlue));					
-					Paint_SetPixel(col, bmpInfoHeader.bHeight - row - 1, data);
-				}				
-			}	
+				}
+			}
+
+			if(Mode == BMP_DITHER_ORDERED)
+				GFX_DitherOrdered(rgb565, line, bmpInfoHeader.bWidth, 0, y, fmt, GFX_ORDER_NATIVE);
+			else if(Mode == BMP_DITHER_FS)
+				GFX_DitherFS_Row(&fs, rgb565, line, fmt, GFX_ORDER_NATIVE);
+			else
+				GFX_Convert565(rgb565, line, bmpInfoHeader.bWidth, fmt, GFX_ORDER_NATIVE);
+			for(col = 0; col < bmpInfoHeader.bWidth; col++)
+				Paint_SetPixel(col, y, rgb565[col]);
 		}
 		//indent!4 byte alignment
 		fseek(fp, indent, SEEK_CUR);
 	}
 	
+	free(line);
+	free(rgb565);
+	free(err);
 	fclose(fp);
     return 0;
-}
\ No newline at end of file
+}
+
+UBYTE GUI_ReadBmp(const char *path)
+{
+	return GUI_ReadBmp_Dither(path, BMP_DITHER_NONE);
+}
@@ -23,6 +23,11 @@
 
 #define  RGB(r,g,b)         (((r>>3)<<11)|((g>>2)<<5)|(b>>3))
 
+/*Colour conversion for GUI_ReadBmp_Dither (16-bit BMPs are copied as is)*/
+#define  BMP_DITHER_NONE     0   //Truncate like RGB()
+#define  BMP_DITHER_ORDERED  1   //8x8 Bayer, fast
+#define  BMP_DITHER_FS       2   //Floyd-Steinberg, best for stills
+
 
 /****************************** Bitmap standard information*************************************/
 /*Bitmap file header   14bit*/
@@ -66,4 +71,5 @@ typedef struct ARGB_QUAD {
 /**************************************** end ***********************************************/
 
 UBYTE GUI_ReadBmp(const char *path);
+UBYTE GUI_ReadBmp_Dither(const char *path, UBYTE Mode);
 #endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*****************************************************************************
+* | File      	:   GUI_Blit.c
+* | Function    :   Scaled / rotated image drawing on the Paint canvas
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Blit.h"
+
+static UWORD Mask_X, Mask_Y, Mask_R;
+
+static UBYTE Blit_CanvasOk(void)
+{
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Blit needs a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+    return 1;
+}
+
+static int32_t Blit_Angle(double Angle_deg)
+{
+    double a = Angle_deg * GFX_ANGLE_360 / 360.0;
+    return (int32_t)(a < 0 ? a - 0.5 : a + 0.5);
+}
+
+static void Blit_Draw(GFX_Blit *Blit)
+{
+    UWORD Y;
+
+    if(Mask_R)
+        GFX_Blit_SetMask(Blit, Mask_X, Mask_Y, Mask_R);
+    for(Y = 0; Y < Paint.Height; Y++)
+        GFX_Blit_RenderRow(Blit, Y, 0, Paint.Width, Paint.Image + Y * Paint.WidthByte,
+                           GFX_ORDER_SWAPPED);
+}
+
+/******************************************************************************
+function: Limit image drawing to a circle (the visible area of a round panel)
+parameter:
+    X_Center, Y_Center : Centre, in pixel edges (120, 120 on a 240x240 panel)
+    Radius             : 0 removes the mask
+******************************************************************************/
+void Paint_SetImageMask(UWORD X_Center, UWORD Y_Center, UWORD Radius)
+{
+    Mask_X = X_Center;
+    Mask_Y = Y_Center;
+    Mask_R = Radius;
+}
+
+/******************************************************************************
+function: Draw an image with its centre at (X_Center, Y_Center), scaled
+          and rotated clockwise by Angle_deg
+parameter:
+    Image     : Width x Height RGB565 pixels, MSB first
+    X_Center  : Canvas position of the image centre (pixel centres are
+    Y_Center    whole numbers)
+    Scale     : 1.0 = one image pixel per canvas pixel
+    Filter    : GFX_FILTER_NEAREST or GFX_FILTER_BILINEAR
+******************************************************************************/
+void Paint_DrawImageTransform(const UWORD *Image, UWORD Width, UWORD Height,
+                              double X_Center, double Y_Center, double Scale,
+                              double Angle_deg, GFX_Filter Filter)
+{
+    GFX_Blit Blit;
+    int32_t S = (int32_t)(Scale * GFX_BLIT_ONE + 0.5);
+
+    if(!Blit_CanvasOk() || Width == 0 || Height == 0)
+        return;
+    GFX_Blit_Init(&Blit, Image, Width, Height, Width, GFX_ORDER_SWAPPED, Filter);
+    GFX_Blit_Transform(&Blit, (int32_t)(X_Center * GFX_FIX_ONE), (int32_t)(Y_Center * GFX_FIX_ONE),
+                       S, S, Blit_Angle(Angle_deg));
+    Blit_Draw(&Blit);
+}
+
+/******************************************************************************
+function: Scale an image of any size to the canvas, keeping its aspect
+parameter:
+    Cover : 1 = fill the canvas and crop, 0 = fit inside it
+******************************************************************************/
+void Paint_DrawImageFit(const UWORD *Image, UWORD Width, UWORD Height,
+                        UBYTE Cover, double Angle_deg, GFX_Filter Filter)
+{
+    GFX_Blit Blit;
+
+    if(!Blit_CanvasOk() || Width == 0 || Height == 0)
+        return;
+    GFX_Blit_Init(&Blit, Image, Width, Height, Width, GFX_ORDER_SWAPPED, Filter);
+    GFX_Blit_Fit(&Blit, 0, 0, Paint.Width, Paint.Height, Cover, Blit_Angle(Angle_deg));
+    Blit_Draw(&Blit);
+}
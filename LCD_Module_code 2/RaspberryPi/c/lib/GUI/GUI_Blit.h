@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   GUI_Blit.h
+* | Function    :   Scaled / rotated image drawing on the Paint canvas
+* | Info        :
+*   Paint front end for the shared fixed-point blitter (lib/gfx/gfx_blit.c).
+*   Images are RGB565 stored MSB first, like Paint canvases and the
+*   gImage arrays, and can be any size: they are scaled (nearest or
+*   bilinear) and rotated while drawing, so no pre-resizing is needed.
+*   With Paint_SetImageMask() only the visible circle of a round panel
+*   is drawn.
+*
+*   The canvas must be 16-bit with ROTATE_0 and MIRROR_NONE.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_BLIT_H
+#define __GUI_BLIT_H
+
+#include "GUI_Paint.h"
+#include "gfx_blit.h"
+
+void Paint_SetImageMask(UWORD X_Center, UWORD Y_Center, UWORD Radius);
+void Paint_DrawImageTransform(const UWORD *Image, UWORD Width, UWORD Height,
+                              double X_Center, double Y_Center, double Scale,
+                              double Angle_deg, GFX_Filter Filter);
+void Paint_DrawImageFit(const UWORD *Image, UWORD Width, UWORD Height,
+                        UBYTE Cover, double Angle_deg, GFX_Filter Filter);
+
+#endif
@@ -0,0 +1,571 @@
+/*****************************************************************************
+* | File      	:   GUI_Console.c
+* | Function    :   Text console with cell damage tracking and a glyph cache
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Console.h"
+#include "gfx_font.h"
+
+#include <stdlib.h>
+
+enum {
+    CONSOLE_GROUND = 0,
+    CONSOLE_ESC,
+    CONSOLE_CSI,
+    CONSOLE_OSC,
+};
+
+// VGA text mode colours: 0-7 normal, 8-15 bright
+static const UWORD Console_Vga[16] = {
+    0x0000, 0xA800, 0x0540, 0xAAA0, 0x0015, 0xA815, 0x0555, 0xAD55,
+    0x52AA, 0xFAAA, 0x57EA, 0xFFEA, 0x52BF, 0xFABF, 0x57FF, 0xFFFF,
+};
+
+typedef struct {
+    UWORD *Glyph;
+    UWORD Width, Height;
+    UWORD Color;
+} CONSOLE_PEN;
+
+static void Console_Attr(CONSOLE *Con)
+{
+    UBYTE Fg = Con->Fg | (Con->Bold ? 8 : 0);
+
+    Con->Attr = Con->Inverse ? (Con->Bg | Fg << 4) : (Fg | Con->Bg << 4);
+}
+
+static UWORD Console_Blank(CONSOLE *Con)
+{
+    return ' ' | (UWORD)(7 | Con->Bg << 4) << 8;
+}
+
+/******************************************************************************
+function: First cell of text row Row in the grid (the rows are a ring)
+******************************************************************************/
+static UDOUBLE Console_Line(CONSOLE *Con, UWORD Row)
+{
+    UWORD Line = Con->Top + Row;
+
+    if(Line >= Con->Rows)
+        Line -= Con->Rows;
+    return (UDOUBLE)Line * Con->Cols;
+}
+
+static void Console_Put(CONSOLE *Con, UWORD Col, UWORD Row, UWORD Value)
+{
+    UDOUBLE i = Console_Line(Con, Row) + Col;
+
+    if(Con->Cell[i] != Value) {
+        Con->Cell[i] = Value;
+        Con->Dirty[i] = 1;
+    }
+}
+
+static void Console_ClearRow(CONSOLE *Con, UWORD Row, UWORD Col0, UWORD Col1)
+{
+    UWORD Blank = Console_Blank(Con);
+
+    for(; Col0 < Col1; Col0++)
+        Console_Put(Con, Col0, Row, Blank);
+}
+
+/******************************************************************************
+function: Move the text up one row
+info:
+    With a scroll function the ring turns and only the new bottom row
+    changes; otherwise each cell takes the one below it and is marked if
+    that differs.
+******************************************************************************/
+static void Console_ScrollUp(CONSOLE *Con)
+{
+    UDOUBLE i, n = (UDOUBLE)(Con->Rows - 1) * Con->Cols;
+
+    Con->Stats.Scrolls++;
+    if(Con->Scroll) {
+        if(++Con->Top == Con->Rows)
+            Con->Top = 0;
+    } else {
+        for(i = 0; i < n; i++) {
+            UWORD Value = Con->Cell[i + Con->Cols];
+            if(Con->Cell[i] != Value) {
+                Con->Cell[i] = Value;
+                Con->Dirty[i] = 1;
+            }
+        }
+    }
+    Console_ClearRow(Con, Con->Rows - 1, 0, Con->Cols);
+}
+
+static void Console_LineFeed(CONSOLE *Con)
+{
+    Con->Col = 0;
+    Con->Wrap = 0;
+    if(Con->Row + 1 < Con->Rows)
+        Con->Row++;
+    else
+        Console_ScrollUp(Con);
+}
+
+static void Console_Print(CONSOLE *Con, UBYTE Char)
+{
+    if(Con->Wrap)
+        Console_LineFeed(Con);
+    Console_Put(Con, Con->Col, Con->Row, Char | (UWORD)Con->Attr << 8);
+    if(Con->Col + 1 < Con->Cols)
+        Con->Col++;
+    else
+        Con->Wrap = 1;
+}
+
+static UWORD Console_Param(CONSOLE *Con, UBYTE i)
+{
+    return (i < Con->Nparam && i < CONSOLE_PARAMS) ? Con->Param[i] : 0;
+}
+
+static void Console_Sgr(CONSOLE *Con)
+{
+    UBYTE i, n = Con->Nparam ? Con->Nparam : 1;
+
+    for(i = 0; i < n && i < CONSOLE_PARAMS; i++) {
+        UWORD p = Console_Param(Con, i);
+        if(p == 0) {
+            Con->Fg = 7;
+            Con->Bg = 0;
+            Con->Bold = Con->Inverse = 0;
+        } else if(p == 1) {
+            Con->Bold = 1;
+        } else if(p == 22) {
+            Con->Bold = 0;
+        } else if(p == 7) {
+            Con->Inverse = 1;
+        } else if(p == 27) {
+            Con->Inverse = 0;
+        } else if(p >= 30 && p <= 37) {
+            Con->Fg = p - 30;
+        } else if(p == 39) {
+            Con->Fg = 7;
+        } else if(p >= 40 && p <= 47) {
+            Con->Bg = p - 40;
+        } else if(p == 49) {
+            Con->Bg = 0;
+        } else if(p >= 90 && p <= 97) {
+            Con->Fg = p - 90 + 8;
+        } else if(p >= 100 && p <= 107) {
+            Con->Bg = p - 100 + 8;
+        }
+    }
+    Console_Attr(Con);
+}
+
+/******************************************************************************
+function: Act on ESC [ ... Final
+info:
+    Cursor: A B C D (up, down, right, left), G (column), H f (position)
+    Erase:  J (0 to end, 1 from start, 2 all), K (same, in the row)
+    Colour: m (SGR)
+    Anything else is ignored.
+******************************************************************************/
+static void Console_Csi(CONSOLE *Con, UBYTE Final)
+{
+    UWORD P0 = Console_Param(Con, 0), P1 = Console_Param(Con, 1);
+    UWORD n = P0 ? P0 : 1;
+    UWORD Row;
+
+    if(Final != 'm')
+        Con->Wrap = 0;
+    switch(Final) {
+    case 'A':
+        Con->Row = Con->Row > n ? Con->Row - n : 0;
+        break;
+    case 'B':
+        Con->Row = Con->Row + n < Con->Rows ? Con->Row + n : Con->Rows - 1;
+        break;
+    case 'C':
+        Con->Col = Con->Col + n < Con->Cols ? Con->Col + n : Con->Cols - 1;
+        break;
+    case 'D':
+        Con->Col = Con->Col > n ? Con->Col - n : 0;
+        break;
+    case 'G':
+        Con->Col = n <= Con->Cols ? n - 1 : Con->Cols - 1;
+        break;
+    case 'H':
+    case 'f':
+        Con->Row = P0 == 0 ? 0 : (P0 <= Con->Rows ? P0 - 1 : Con->Rows - 1);
+        Con->Col = P1 == 0 ? 0 : (P1 <= Con->Cols ? P1 - 1 : Con->Cols - 1);
+        break;
+    case 'J':
+        if(P0 == 0) {
+            Console_ClearRow(Con, Con->Row, Con->Col, Con->Cols);
+            for(Row = Con->Row + 1; Row < Con->Rows; Row++)
+                Console_ClearRow(Con, Row, 0, Con->Cols);
+        } else if(P0 == 1) {
+            for(Row = 0; Row < Con->Row; Row++)
+                Console_ClearRow(Con, Row, 0, Con->Cols);
+            Console_ClearRow(Con, Con->Row, 0, Con->Col + 1);
+        } else {
+            for(Row = 0; Row < Con->Rows; Row++)
+                Console_ClearRow(Con, Row, 0, Con->Cols);
+        }
+        break;
+    case 'K':
+        if(P0 == 0)
+            Console_ClearRow(Con, Con->Row, Con->Col, Con->Cols);
+        else if(P0 == 1)
+            Console_ClearRow(Con, Con->Row, 0, Con->Col + 1);
+        else
+            Console_ClearRow(Con, Con->Row, 0, Con->Cols);
+        break;
+    case 'm':
+        Console_Sgr(Con);
+        break;
+    }
+}
+
+static void Console_Reset(CONSOLE *Con)
+{
+    UWORD Row;
+
+    Con->Fg = 7;
+    Con->Bg = 0;
+    Con->Bold = Con->Inverse = 0;
+    Console_Attr(Con);
+    for(Row = 0; Row < Con->Rows; Row++)
+        Console_ClearRow(Con, Row, 0, Con->Cols);
+    Con->Col = Con->Row = 0;
+    Con->Wrap = 0;
+}
+
+/******************************************************************************
+function: Set up a console filling Width x Height pixels at Xstart, Ystart
+parameter:
+    Font : sFONT table, or one with Compressed set (Font24AA)
+return:
+    0 on success, 1 if the area holds no cell or memory ran out
+******************************************************************************/
+UBYTE Console_Init(CONSOLE *Con, sFONT *Font, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height)
+{
+    UDOUBLE i, Cells, Px = (UDOUBLE)Font->Width * Font->Height;
+
+    memset(Con, 0, sizeof(CONSOLE));
+    Con->Font = Font;
+    Con->Cols = Width / Font->Width;
+    Con->Rows = Height / Font->Height;
+    Con->Xstart = Xstart;
+    Con->Ystart = Ystart;
+    if(Con->Cols == 0 || Con->Rows == 0) {
+        DEBUG("Console_Init: no room for a cell\r\n");
+        return 1;
+    }
+    Cells = (UDOUBLE)Con->Cols * Con->Rows;
+    Con->Cell = malloc(Cells * sizeof(UWORD));
+    Con->Dirty = calloc(Cells, 1);
+    Con->Glyph = malloc(CONSOLE_CACHE * Px * sizeof(UWORD));
+    Con->Key = malloc(CONSOLE_CACHE * sizeof(UWORD));
+    Con->Band = malloc(Con->Cols * Px * sizeof(UWORD));
+    if(!Con->Cell || !Con->Dirty || !Con->Glyph || !Con->Key || !Con->Band) {
+        DEBUG("Console_Init: out of memory\r\n");
+        Console_Exit(Con);
+        return 1;
+    }
+    memcpy(Con->Palette, Console_Vga, sizeof(Console_Vga));
+    for(i = 0; i < CONSOLE_CACHE; i++)
+        Con->Key[i] = 0xFFFF;
+    Con->Fg = 7;
+    Console_Attr(Con);
+    for(i = 0; i < Cells; i++)
+        Con->Cell[i] = Console_Blank(Con);
+    return 0;
+}
+
+void Console_Exit(CONSOLE *Con)
+{
+    free(Con->Cell);
+    free(Con->Dirty);
+    free(Con->Glyph);
+    free(Con->Key);
+    free(Con->Band);
+    Con->Cell = Con->Key = Con->Glyph = Con->Band = NULL;
+    Con->Dirty = NULL;
+}
+
+/******************************************************************************
+function: Where Console_Flush() sends its windows
+parameter:
+    Scroll : Sets the controller's vertical scroll start; NULL scrolls by
+             resending. The scroll area must be the console's rows:
+             Ystart to Ystart + Rows * Font->Height.
+******************************************************************************/
+void Console_SetOutput(CONSOLE *Con, CONSOLE_WINDOW Window, CONSOLE_WRITE Write,
+                       CONSOLE_SCROLL Scroll, void *Ctx)
+{
+    Con->Window = Window;
+    Con->Write = Write;
+    Con->Scroll = Scroll;
+    Con->Ctx = Ctx;
+}
+
+/******************************************************************************
+function: Change palette entry Index (RGB565); the whole console is resent
+******************************************************************************/
+void Console_SetColor(CONSOLE *Con, UBYTE Index, UWORD Color)
+{
+    UWORD i;
+
+    Con->Palette[Index & 15] = Color;
+    for(i = 0; i < CONSOLE_CACHE; i++)
+        Con->Key[i] = 0xFFFF;
+    Console_Invalidate(Con);
+}
+
+/******************************************************************************
+function: Feed terminal output
+info:
+    Bytes from 0xC0 (UTF-8 lead bytes) show as '?', continuation bytes
+    and other controls are dropped.
+******************************************************************************/
+void Console_Write(CONSOLE *Con, const char *Data, UDOUBLE Len)
+{
+    UDOUBLE i;
+
+    Con->Stats.Chars += Len;
+    for(i = 0; i < Len; i++) {
+        UBYTE b = Data[i];
+
+        switch(Con->State) {
+        case CONSOLE_ESC:
+            Con->State = CONSOLE_GROUND;
+            if(b == '[') {
+                Con->State = CONSOLE_CSI;
+                Con->Nparam = 0;
+                memset(Con->Param, 0, sizeof(Con->Param));
+            } else if(b == ']') {
+                Con->State = CONSOLE_OSC;
+            } else if(b == 'c') {
+                Console_Reset(Con);
+            } else if(b == 0x1B) {
+                Con->State = CONSOLE_ESC;
+            }
+            continue;
+        case CONSOLE_CSI:
+            if(b >= '0' && b <= '9') {
+                if(Con->Nparam == 0)
+                    Con->Nparam = 1;
+                if(Con->Nparam <= CONSOLE_PARAMS) {
+                    UWORD *p = &Con->Param[Con->Nparam - 1];
+                    *p = *p < 1000 ? *p * 10 + (b - '0') : 9999;
+                }
+            } else if(b == ';') {
+                if(Con->Nparam == 0)
+                    Con->Nparam = 1;
+                if(Con->Nparam <= CONSOLE_PARAMS)
+                    Con->Nparam++;
+            } else if(b >= 0x40 && b <= 0x7E) {
+                Console_Csi(Con, b);
+                Con->State = CONSOLE_GROUND;
+            } else if(b == 0x1B) {
+                Con->State = CONSOLE_ESC;
+            } else if(b == 0x18 || b == 0x1A) {
+                Con->State = CONSOLE_GROUND;
+            }
+            continue;   // '?' and other markers are ignored
+        case CONSOLE_OSC:
+            if(b == 0x07)
+                Con->State = CONSOLE_GROUND;
+            else if(b == 0x1B)
+                Con->State = CONSOLE_ESC;
+            continue;
+        }
+
+        if(b >= 0x20 && b < 0x7F) {
+            Console_Print(Con, b);
+        } else if(b >= 0xC0) {
+            Console_Print(Con, '?');
+        } else if(b == 0x1B) {
+            Con->State = CONSOLE_ESC;
+        } else if(b == '\n' || b == 0x0B || b == 0x0C) {
+            Console_LineFeed(Con);
+        } else if(b == '\r') {
+            Con->Col = 0;
+            Con->Wrap = 0;
+        } else if(b == '\b') {
+            if(Con->Col > 0 && !Con->Wrap)
+                Con->Col--;
+            Con->Wrap = 0;
+        } else if(b == '\t') {
+            Con->Col = (Con->Col / 8 + 1) * 8;
+            if(Con->Col >= Con->Cols)
+                Con->Col = Con->Cols - 1;
+        }
+    }
+}
+
+static void Console_Span(int16_t X, int16_t Y, uint16_t N, uint8_t Alpha, void *Ctx)
+{
+    CONSOLE_PEN *Pen = (CONSOLE_PEN *)Ctx;
+
+    if(Y < 0 || Y >= Pen->Height)
+        return;
+    for(; N > 0; X++, N--)
+        if(X >= 0 && X < Pen->Width)
+            GFX_BlendPixel(&Pen->Glyph[Y * Pen->Width + X], Pen->Color, Alpha, GFX_ORDER_SWAPPED);
+}
+
+/******************************************************************************
+function: Pixels of a cell value, from the cache or expanded into it
+info:
+    Direct-mapped: the slot depends on character and colours, so the
+    usual text of one colour never evicts itself.
+******************************************************************************/
+static const UWORD *Console_Glyph(CONSOLE *Con, UWORD Value)
+{
+    sFONT *Font = Con->Font;
+    UWORD Slot = ((Value & 0xFF) + (Value >> 8) * 67) & (CONSOLE_CACHE - 1);
+    UDOUBLE i, Px = (UDOUBLE)Font->Width * Font->Height;
+    UWORD *Glyph = Con->Glyph + Slot * Px;
+    UWORD Fg = Con->Palette[(Value >> 8) & 15], Bg = Con->Palette[Value >> 12];
+    UWORD Char = Value & 0xFF;
+
+    if(Con->Key[Slot] == Value)
+        return Glyph;
+    Con->Key[Slot] = Value;
+    Con->Stats.Misses++;
+
+    Fg = (Fg << 8) | (Fg >> 8);
+    Bg = (Bg << 8) | (Bg >> 8);
+    if(Font->Compressed) {
+        const GFX_Glyph *g = GFX_Font_Glyph(Font->Compressed, Char);
+        CONSOLE_PEN Pen = {Glyph, Font->Width, Font->Height, Con->Palette[(Value >> 8) & 15]};
+        for(i = 0; i < Px; i++)
+            Glyph[i] = Bg;
+        if(g != NULL)
+            GFX_Font_DrawGlyph(Font->Compressed, g, 0, 0, Console_Span, &Pen);
+    } else {
+        UWORD Bpr = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+        const UBYTE *Bits = &Font->table[(Char - ' ') * Font->Height * Bpr];
+        UWORD X, Y;
+        for(Y = 0; Y < Font->Height; Y++, Bits += Bpr)
+            for(X = 0; X < Font->Width; X++)
+                *Glyph++ = (Bits[X / 8] & (0x80 >> (X % 8))) ? Fg : Bg;
+        Glyph -= Px;
+    }
+    return Glyph;
+}
+
+/******************************************************************************
+function: Next run of dirty cells in grid row Line at or after From
+info:
+    Up to CONSOLE_GAP clean cells between dirty ones stay in the run:
+    resending them costs less than another window (11 bytes of address
+    plus the per-transfer overhead of the backend).
+******************************************************************************/
+static UBYTE Console_NextSpan(CONSOLE *Con, UWORD Line, UWORD From, UWORD *Col0, UWORD *Col1)
+{
+    const UBYTE *Dirty = Con->Dirty + (UDOUBLE)Line * Con->Cols;
+    UWORD Col = From, Last;
+
+    while(Col < Con->Cols && !Dirty[Col])
+        Col++;
+    if(Col >= Con->Cols)
+        return 0;
+    *Col0 = Last = Col;
+    for(Col++; Col < Con->Cols && Col <= Last + CONSOLE_GAP + 1; Col++)
+        if(Dirty[Col])
+            Last = Col;
+    *Col1 = Last + 1;
+    return 1;
+}
+
+/******************************************************************************
+function: Send grid rows Line0..Line1-1, columns Col0..Col1-1 as one window
+******************************************************************************/
+static void Console_Send(CONSOLE *Con, UWORD Col0, UWORD Line0, UWORD Col1, UWORD Line1)
+{
+    UWORD W = Con->Font->Width, H = Con->Font->Height;
+    UDOUBLE Stride = (UDOUBLE)(Col1 - Col0) * W;
+    UWORD Line, Col, Y;
+
+    Con->Window(Con->Xstart + Col0 * W, Con->Ystart + Line0 * H,
+                Con->Xstart + Col1 * W, Con->Ystart + Line1 * H, Con->Ctx);
+    Con->Stats.Windows++;
+    for(Line = Line0; Line < Line1; Line++) {
+        UDOUBLE Base = (UDOUBLE)Line * Con->Cols;
+        for(Col = Col0; Col < Col1; Col++) {
+            const UWORD *Glyph = Console_Glyph(Con, Con->Cell[Base + Col]);
+            UWORD *Dst = Con->Band + (Col - Col0) * W;
+            for(Y = 0; Y < H; Y++)
+                memcpy(Dst + Y * Stride, Glyph + Y * W, W * sizeof(UWORD));
+            Con->Dirty[Base + Col] = 0;
+        }
+        Con->Write(Con->Band, Stride * H, Con->Ctx);
+        Con->Stats.Cells += Col1 - Col0;
+    }
+}
+
+/******************************************************************************
+function: Send the changed cells, then the scroll position
+info:
+    A row with a single run joins the window of the rows above when the
+    columns match, so a full repaint is one window.
+******************************************************************************/
+void Console_Flush(CONSOLE *Con)
+{
+    UWORD Line, Col0, Col1, Next0, Next1;
+    UWORD Pend_Col0 = 0, Pend_Col1 = 0, Pend_Line0 = 0, Pend_Line1 = 0;
+
+    if(Con->Window == NULL || Con->Write == NULL)
+        return;
+    for(Line = 0; Line < Con->Rows; Line++) {
+        UWORD From = 0;
+        UBYTE First = 1;
+        while(Console_NextSpan(Con, Line, From, &Col0, &Col1)) {
+            UBYTE Only = First && !Console_NextSpan(Con, Line, Col1, &Next0, &Next1);
+            if(Only && Pend_Line1 > Pend_Line0 && Pend_Line1 == Line &&
+               Pend_Col0 == Col0 && Pend_Col1 == Col1) {
+                Pend_Line1++;
+            } else {
+                if(Pend_Line1 > Pend_Line0)
+                    Console_Send(Con, Pend_Col0, Pend_Line0, Pend_Col1, Pend_Line1);
+                Pend_Line0 = Pend_Line1 = 0;
+                if(Only) {
+                    Pend_Col0 = Col0;
+                    Pend_Col1 = Col1;
+                    Pend_Line0 = Line;
+                    Pend_Line1 = Line + 1;
+                } else {
+                    Console_Send(Con, Col0, Line, Col1, Line + 1);
+                }
+            }
+            First = 0;
+            From = Col1;
+        }
+    }
+    if(Pend_Line1 > Pend_Line0)
+        Console_Send(Con, Pend_Col0, Pend_Line0, Pend_Col1, Pend_Line1);
+
+    if(Con->Scroll && Con->Shown != Con->Top) {
+        Con->Scroll(Con->Ystart + Con->Top * Con->Font->Height, Con->Ctx);
+        Con->Shown = Con->Top;
+    }
+}
+
+/******************************************************************************
+function: Mark every cell, e.g. after the panel was cleared or reset
+******************************************************************************/
+void Console_Invalidate(CONSOLE *Con)
+{
+    memset(Con->Dirty, 1, (UDOUBLE)Con->Cols * Con->Rows);
+}
+
+/******************************************************************************
+function: Character | Attr << 8 at text position Col, Row
+******************************************************************************/
+UWORD Console_GetCell(CONSOLE *Con, UWORD Col, UWORD Row)
+{
+    return Con->Cell[Console_Line(Con, Row) + Col];
+}
@@ -0,0 +1,87 @@
+/*****************************************************************************
+* | File      	:   GUI_Console.h
+* | Function    :   Text console with cell damage tracking and a glyph cache
+* | Info        :
+*   A grid of character cells fed with terminal output (printable ASCII,
+*   CR, LF, BS, TAB and a subset of ANSI escapes: cursor moves, erase,
+*   SGR colours). Writing only changes cells and marks the ones whose
+*   character or colours differ; Console_Flush() sends those as windows,
+*   merged along rows and down columns, from glyphs expanded once per
+*   character and colour pair.
+*
+*   Scrolling: with a scroll function (the controller's vertical scroll
+*   start, e.g. LCD_2IN_SetScrollStart()) the rows are a ring in GRAM
+*   and a scroll only clears the new bottom row. Without one the rows
+*   move in the grid and every cell that changes is resent.
+*
+*   The console assumes its area starts cleared to palette colour 0
+*   (Console_Invalidate() otherwise). No cursor is drawn; LF implies CR
+*   so that plain pipes (dmesg | ...) look right.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_CONSOLE_H
+#define __GUI_CONSOLE_H
+
+#include "DEV_Config.h"
+#include "../Fonts/fonts.h"
+
+#define CONSOLE_CACHE   256     // Glyph cache entries (power of 2)
+#define CONSOLE_GAP     2       // Clean cells bridged to keep one window
+#define CONSOLE_PARAMS  4       // CSI parameters kept
+
+/**
+ * Output, pixels in panel byte order (as in a Paint image)
+**/
+typedef void (*CONSOLE_WINDOW)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, void *Ctx);
+typedef void (*CONSOLE_WRITE)(const UWORD *Pixels, UDOUBLE Count, void *Ctx);
+typedef void (*CONSOLE_SCROLL)(UWORD Line, void *Ctx);  // GRAM line shown at the top
+
+typedef struct {
+    UDOUBLE Chars;          // Bytes written
+    UDOUBLE Scrolls;
+    UDOUBLE Windows;
+    UDOUBLE Cells;          // Cells sent
+    UDOUBLE Misses;         // Glyphs expanded
+} CONSOLE_STATS;
+
+typedef struct {
+    sFONT *Font;
+    UWORD Cols, Rows;
+    UWORD Xstart, Ystart;   // Top left of the grid on the panel
+    UWORD *Cell;            // Character | Attr << 8, rows in GRAM order
+    UBYTE *Dirty;
+    UWORD Top;              // GRAM row of the first text row
+    UWORD Shown;            // Top as last sent to the scroll function
+    UWORD Col, Row;         // Cursor, Row counts from the first text row
+    UBYTE Wrap;             // Next character goes to a new line
+    UBYTE Attr;             // Foreground | background << 4, after bold/inverse
+    UBYTE Fg, Bg, Bold, Inverse;
+    UBYTE State;            // Escape parser
+    UBYTE Nparam;
+    UWORD Param[CONSOLE_PARAMS];
+    UWORD Palette[16];      // RGB565, CPU order
+    UWORD *Glyph;           // CONSOLE_CACHE glyphs of Font->Width x Font->Height
+    UWORD *Key;             // Cell value each glyph was expanded for
+    UWORD *Band;            // One text row of pixels
+    CONSOLE_WINDOW Window;
+    CONSOLE_WRITE Write;
+    CONSOLE_SCROLL Scroll;
+    void *Ctx;
+    CONSOLE_STATS Stats;
+} CONSOLE;
+
+UBYTE Console_Init(CONSOLE *Con, sFONT *Font, UWORD Xstart, UWORD Ystart, UWORD Width, UWORD Height);
+void Console_Exit(CONSOLE *Con);
+void Console_SetOutput(CONSOLE *Con, CONSOLE_WINDOW Window, CONSOLE_WRITE Write,
+                       CONSOLE_SCROLL Scroll, void *Ctx);
+void Console_SetColor(CONSOLE *Con, UBYTE Index, UWORD Color);
+void Console_Write(CONSOLE *Con, const char *Data, UDOUBLE Len);
+void Console_Flush(CONSOLE *Con);
+void Console_Invalidate(CONSOLE *Con);
+UWORD Console_GetCell(CONSOLE *Con, UWORD Col, UWORD Row);
+
+#endif
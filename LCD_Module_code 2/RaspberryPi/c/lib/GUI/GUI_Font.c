@@ -0,0 +1,136 @@
+/*****************************************************************************
+* | File      	:   GUI_Font.c
+* | Function    :   Compressed anti-aliased fonts on the Paint canvas
+* | Info        :
+*   Glyph spans from the decoder are blended one pixel at a time through
+*   the Paint_SetPixel mapping, so any rotation or mirroring works.
+*   With an opaque background the blend needs no read back; on a
+*   transparent (FONT_BACKGROUND) 16-bit canvas the pixel underneath is
+*   read. 1-bit and 8-bit canvases get the glyph thresholded at 50%.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Font.h"
+
+typedef struct {
+    UWORD Foreground;
+    UWORD Background;
+    UBYTE Opaque;
+} Font_Pen;
+
+/******************************************************************************
+function: Memory index of a logical canvas pixel (same mapping as Paint_SetPixel)
+******************************************************************************/
+static UDOUBLE Font_Addr(UWORD Xpoint, UWORD Ypoint)
+{
+    UWORD X = Xpoint, Y = Ypoint;
+
+    switch(Paint.Rotate) {
+    case 90:
+        X = Paint.WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+        break;
+    case 180:
+        X = Paint.WidthMemory - Xpoint - 1;
+        Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        X = Ypoint;
+        Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    }
+    if(Paint.Mirror & MIRROR_HORIZONTAL)
+        X = Paint.WidthMemory - X - 1;
+    if(Paint.Mirror & MIRROR_VERTICAL)
+        Y = Paint.HeightMemory - Y - 1;
+
+    return X + Y * Paint.WidthByte;
+}
+
+static void Font_Span(int16_t x, int16_t y, uint16_t n, uint8_t alpha, void *ctx)
+{
+    const Font_Pen *Pen = (const Font_Pen *)ctx;
+
+    if(y < 0 || y >= Paint.Height)
+        return;
+    for(; n; n--, x++) {
+        if(x < 0 || x >= Paint.Width)
+            continue;
+        if(Paint.Depth != 16) {
+            if(alpha >= 128)
+                Paint_SetPixel(x, y, Pen->Foreground);
+        } else if(alpha == 255) {
+            Paint_SetPixel(x, y, Pen->Foreground);
+        } else if(Pen->Opaque) {
+            Paint_SetPixel(x, y, GFX_Blend565(Pen->Background, Pen->Foreground, alpha));
+        } else {
+            GFX_BlendPixel(&Paint.Image[Font_Addr(x, y)], Pen->Foreground, alpha,
+                           GFX_ORDER_SWAPPED);
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw one glyph
+parameter:
+    Xpoint, Ypoint   : Pen position, top of the line
+    Code             : Character code
+    Cell_Width       : Width of the background cell (0 = glyph advance)
+    Color_Foreground : Ink color
+    Color_Background : Cell color; FONT_BACKGROUND leaves the canvas showing
+******************************************************************************/
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, UWORD Code, const GFX_Font *Font,
+                     UWORD Cell_Width, UWORD Color_Foreground, UWORD Color_Background)
+{
+    const GFX_Glyph *Glyph = GFX_Font_Glyph(Font, Code);
+    Font_Pen Pen = {Color_Foreground, Color_Background, Color_Background != FONT_BACKGROUND};
+
+    if(Glyph == NULL)
+        return;
+    if(Pen.Opaque) {
+        UWORD Xend = Xpoint + (Cell_Width ? Cell_Width : Glyph->advance);
+        UWORD Yend = Ypoint + Font->line_height;
+        for(UWORD Y = Ypoint; Y < Yend && Y < Paint.Height; Y++)
+            for(UWORD X = Xpoint; X < Xend && X < Paint.Width; X++)
+                Paint_SetPixel(X, Y, Color_Background);
+    }
+    GFX_Font_DrawGlyph(Font, Glyph, Xpoint, Ypoint, Font_Span, &Pen);
+}
+
+/******************************************************************************
+function: Draw a string with proportional spacing
+parameter:
+    Xstart, Ystart   : Pen position, top of the line
+    Color_Foreground : Ink color
+    Color_Background : Cell color; FONT_BACKGROUND leaves the canvas showing
+return:
+    X after the last glyph
+******************************************************************************/
+UWORD Paint_DrawText(UWORD Xstart, UWORD Ystart, const char *pString, const GFX_Font *Font,
+                     UWORD Color_Foreground, UWORD Color_Background)
+{
+    UWORD Xpoint = Xstart;
+
+    if(Xstart > Paint.Width || Ystart > Paint.Height) {
+        DEBUG("Paint_DrawText Input exceeds the normal display range\r\n");
+        return Xstart;
+    }
+
+    for(; *pString; pString++) {
+        if(*pString == '\n') {
+            Xpoint = Xstart;
+            Ystart += Font->line_height;
+            continue;
+        }
+        const GFX_Glyph *Glyph = GFX_Font_Glyph(Font, (uint8_t)*pString);
+        if(Glyph == NULL)
+            continue;
+        Paint_DrawGlyph(Xpoint, Ystart, (uint8_t)*pString, Font, 0,
+                        Color_Foreground, Color_Background);
+        Xpoint += Glyph->advance;
+    }
+    return Xpoint;
+}
@@ -0,0 +1,29 @@
+/*****************************************************************************
+* | File      	:   GUI_Font.h
+* | Function    :   Compressed anti-aliased fonts on the Paint canvas
+* | Info        :
+*   Draws fonts made by tools/fontc.py (lib/gfx/gfx_font.c): glyphs are
+*   cropped, run-length coded and hold 1, 2 or 4 bit coverage, so they
+*   take a fraction of the flash of the sFONT tables and are smooth at
+*   large sizes. Strings are spaced with the glyph advances.
+*
+*   An sFONT whose Compressed field is set (e.g. Font24AA) also works
+*   with Paint_DrawChar() / Paint_DrawString_EN() as a fixed-pitch font.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_FONT_H
+#define __GUI_FONT_H
+
+#include "GUI_Paint.h"
+#include "gfx_font.h"
+
+void Paint_DrawGlyph(UWORD Xpoint, UWORD Ypoint, UWORD Code, const GFX_Font *Font,
+                     UWORD Cell_Width, UWORD Color_Foreground, UWORD Color_Background);
+UWORD Paint_DrawText(UWORD Xstart, UWORD Ystart, const char *pString, const GFX_Font *Font,
+                     UWORD Color_Foreground, UWORD Color_Background);
+
+#endif
@@ -0,0 +1,87 @@
+/*****************************************************************************
+* | File      	:   GUI_Gauge.c
+* | Function    :   Analog gauge on the Paint canvas
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Gauge.h"
+
+typedef struct {
+    const GFX_Gauge *Gauge;
+    int32_t Xstart, Ystart, Xend, Yend;     // Bounding box of the spans
+} GAUGE_UPDATE;
+
+static UBYTE Gauge_CanvasOk(void)
+{
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Gauge needs a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function: Render columns [Xstart, Xend) of canvas row Y
+******************************************************************************/
+static void Gauge_Span(const GFX_Gauge *Gauge, int32_t Y, int32_t Xstart, int32_t Xend)
+{
+    if(Y < 0 || Y >= Paint.Height)
+        return;
+    if(Xstart < 0) Xstart = 0;
+    if(Xend > Paint.Width) Xend = Paint.Width;
+    if(Xstart >= Xend)
+        return;
+    GFX_Gauge_RenderRow(Gauge, Y, Xstart, Xend - Xstart,
+                        Paint.Image + Y * Paint.WidthByte + Xstart, GFX_ORDER_SWAPPED);
+}
+
+static void Gauge_Emit(int16_t Y, int16_t Xstart, int16_t Xend, void *Ctx)
+{
+    GAUGE_UPDATE *Update = (GAUGE_UPDATE *)Ctx;
+
+    Gauge_Span(Update->Gauge, Y, Xstart, Xend);
+    if(Xstart < Update->Xstart) Update->Xstart = Xstart;
+    if(Xend > Update->Xend) Update->Xend = Xend;
+    if(Y < Update->Ystart) Update->Ystart = Y;
+    if(Y + 1 > Update->Yend) Update->Yend = Y + 1;
+}
+
+/******************************************************************************
+function: Draw the whole gauge (the square around its scale ring)
+******************************************************************************/
+void Paint_DrawGauge(const GFX_Gauge *Gauge)
+{
+    if(!Gauge_CanvasOk())
+        return;
+    for(int32_t Y = Gauge->cy - Gauge->radius - 1; Y <= Gauge->cy + Gauge->radius + 1; Y++)
+        Gauge_Span(Gauge, Y, Gauge->cx - Gauge->radius - 1, Gauge->cx + Gauge->radius + 2);
+}
+
+/******************************************************************************
+function: Move the needle, repainting only what it touches
+parameter:
+    Gauge : Gauge drawn with Paint_DrawGauge()
+    Value : New value (clamped to min..max)
+    Flush : Pushes the changed window to the panel; may be NULL
+return:
+    Number of pixels repainted
+******************************************************************************/
+UDOUBLE Paint_SetGaugeValue(GFX_Gauge *Gauge, int16_t Value, GAUGE_FLUSH Flush)
+{
+    GAUGE_UPDATE Update = {Gauge, Paint.Width, Paint.Height, 0, 0};
+    UDOUBLE Pixels;
+
+    if(!Gauge_CanvasOk())
+        return 0;
+    Pixels = GFX_Gauge_SetValue(Gauge, Value, Gauge_Emit, &Update);
+
+    if(Update.Xend > Paint.Width) Update.Xend = Paint.Width;
+    if(Update.Yend > Paint.Height) Update.Yend = Paint.Height;
+    if(Flush && Update.Xstart < Update.Xend && Update.Ystart < Update.Yend)
+        Flush(Update.Xstart, Update.Ystart, Update.Xend, Update.Yend, Paint.Image);
+    return Pixels;
+}
@@ -0,0 +1,31 @@
+/*****************************************************************************
+* | File      	:   GUI_Gauge.h
+* | Function    :   Analog gauge on the Paint canvas
+* | Info        :
+*   Paint front end for the shared gauge widget (lib/gfx/gfx_gauge.c).
+*   Needle moves repaint only the spans the old and new needle touch,
+*   then push their bounding box through the flush callback (e.g.
+*   LCD_1IN28_DisplayWindows).
+*
+*   The canvas must be 16-bit with ROTATE_0 and MIRROR_NONE.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_GAUGE_H
+#define __GUI_GAUGE_H
+
+#include "GUI_Paint.h"
+#include "gfx_gauge.h"
+
+/**
+ * Window push, end exclusive; Image is the whole canvas
+**/
+typedef void (*GAUGE_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+
+void Paint_DrawGauge(const GFX_Gauge *Gauge);
+UDOUBLE Paint_SetGaugeValue(GFX_Gauge *Gauge, int16_t Value, GAUGE_FLUSH Flush);
+
+#endif
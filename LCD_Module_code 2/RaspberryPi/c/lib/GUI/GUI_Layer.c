@@ -0,0 +1,328 @@
+/*****************************************************************************
+* | File      	:   GUI_Layer.c
+* | Function    :   Alpha-composited layers over a Paint canvas
+* | Info        :
+*   Compositing a dirty rectangle: copy the background rows into the
+*   canvas, then blend every visible layer that overlaps it, bottom to
+*   top, one span per row. Overlapping dirty rectangles are merged first
+*   so no pixel is composited twice.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Layer.h"
+
+#include <string.h>
+
+/******************************************************************************
+Rectangle helpers
+******************************************************************************/
+static UBYTE Rect_Empty(const LAYER_RECT *r)
+{
+    return r->Xstart >= r->Xend || r->Ystart >= r->Yend;
+}
+
+static void Rect_Union(LAYER_RECT *r, const LAYER_RECT *a)
+{
+    if(Rect_Empty(a))
+        return;
+    if(Rect_Empty(r)) {
+        *r = *a;
+        return;
+    }
+    if(a->Xstart < r->Xstart) r->Xstart = a->Xstart;
+    if(a->Ystart < r->Ystart) r->Ystart = a->Ystart;
+    if(a->Xend > r->Xend) r->Xend = a->Xend;
+    if(a->Yend > r->Yend) r->Yend = a->Yend;
+}
+
+static UBYTE Rect_Overlap(const LAYER_RECT *a, const LAYER_RECT *b)
+{
+    return a->Xstart < b->Xend && b->Xstart < a->Xend &&
+           a->Ystart < b->Yend && b->Ystart < a->Yend;
+}
+
+/******************************************************************************
+function: Clip a rectangle given in signed canvas coordinates
+******************************************************************************/
+static LAYER_RECT Rect_Clip(int32_t Xstart, int32_t Ystart, int32_t Xend, int32_t Yend)
+{
+    LAYER_RECT r = {0, 0, 0, 0};
+    if(Xstart < 0) Xstart = 0;
+    if(Ystart < 0) Ystart = 0;
+    if(Xend > Paint.Width) Xend = Paint.Width;
+    if(Yend > Paint.Height) Yend = Paint.Height;
+    if(Xstart < Xend && Ystart < Yend) {
+        r.Xstart = Xstart;
+        r.Ystart = Ystart;
+        r.Xend = Xend;
+        r.Yend = Yend;
+    }
+    return r;
+}
+
+static void Layer_MarkBounds(LAYER *Layer)
+{
+    LAYER_RECT r = Rect_Clip(Layer->X, Layer->Y, Layer->X + Layer->Width, Layer->Y + Layer->Height);
+    Rect_Union(&Layer->Dirty, &r);
+}
+
+/******************************************************************************
+function: Create a layer
+parameter:
+    Layer  : Layer to set up
+    Image  : Width x Height RGB565 pixels (CPU byte order), or NULL to use
+             Layer->Color everywhere (A8/A4 masks)
+    Alpha  : Alpha plane matching Format
+    Width  : Layer width
+    Height : Layer height
+    Format : LAYER_A8, LAYER_A4 or LAYER_PREMUL
+******************************************************************************/
+void Layer_Init(LAYER *Layer, UWORD *Image, UBYTE *Alpha, UWORD Width, UWORD Height, LAYER_FORMAT Format)
+{
+    Layer->Image = Image;
+    Layer->Alpha = Alpha;
+    Layer->Width = Width;
+    Layer->Height = Height;
+    Layer->X = 0;
+    Layer->Y = 0;
+    Layer->Color = WHITE;
+    Layer->Format = Format;
+    Layer->Opacity = 255;
+    Layer->Visible = 1;
+    Layer->Dirty = (LAYER_RECT){0, 0, 0, 0};
+    Layer_MarkBounds(Layer);
+}
+
+/******************************************************************************
+function: Move a layer; both the old and the new area are recomposited
+******************************************************************************/
+void Layer_SetPosition(LAYER *Layer, int16_t X, int16_t Y)
+{
+    if(X == Layer->X && Y == Layer->Y)
+        return;
+    Layer_MarkBounds(Layer);
+    Layer->X = X;
+    Layer->Y = Y;
+    Layer_MarkBounds(Layer);
+}
+
+void Layer_SetOpacity(LAYER *Layer, UBYTE Opacity)
+{
+    if(Opacity == Layer->Opacity)
+        return;
+    Layer->Opacity = Opacity;
+    Layer_MarkBounds(Layer);
+}
+
+void Layer_SetVisible(LAYER *Layer, UBYTE Visible)
+{
+    if(Visible == Layer->Visible)
+        return;
+    Layer->Visible = Visible;
+    Layer_MarkBounds(Layer);
+}
+
+/******************************************************************************
+function: Mark part of a layer as changed after writing Image/Alpha directly
+parameter:
+    Xstart, Ystart, Xend, Yend : Layer coordinates, end exclusive
+******************************************************************************/
+void Layer_Invalidate(LAYER *Layer, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    LAYER_RECT r = Rect_Clip(Layer->X + Xstart, Layer->Y + Ystart, Layer->X + Xend, Layer->Y + Yend);
+    Rect_Union(&Layer->Dirty, &r);
+}
+
+/******************************************************************************
+function: Write one layer pixel
+parameter:
+    Xpoint, Ypoint : Layer coordinates
+    Color          : Straight (non-premultiplied) RGB565
+    Alpha          : 0 (transparent) - 255 (opaque)
+******************************************************************************/
+static void Layer_Put(LAYER *Layer, UWORD Xpoint, UWORD Ypoint, UWORD Color, UBYTE Alpha)
+{
+    UDOUBLE Addr = Xpoint + Ypoint * Layer->Width;
+
+    if(Layer->Format == LAYER_A4) {
+        UDOUBLE Byte = Xpoint / 2 + Ypoint * ((Layer->Width + 1) / 2);
+        UBYTE Nibble = Alpha >> 4;
+        if(Xpoint & 1)
+            Layer->Alpha[Byte] = (Layer->Alpha[Byte] & 0xF0) | Nibble;
+        else
+            Layer->Alpha[Byte] = (Layer->Alpha[Byte] & 0x0F) | (Nibble << 4);
+    } else {
+        Layer->Alpha[Addr] = Alpha;
+    }
+
+    if(Layer->Image == NULL)
+        return;
+    if(Layer->Format == LAYER_PREMUL) {
+        UWORD r = ((Color >> 11) * Alpha + 127) / 255;
+        UWORD g = (((Color >> 5) & 0x3F) * Alpha + 127) / 255;
+        UWORD b = ((Color & 0x1F) * Alpha + 127) / 255;
+        Color = (r << 11) | (g << 5) | b;
+    }
+    Layer->Image[Addr] = Color;
+}
+
+void Layer_SetPixel(LAYER *Layer, UWORD Xpoint, UWORD Ypoint, UWORD Color, UBYTE Alpha)
+{
+    if(Xpoint >= Layer->Width || Ypoint >= Layer->Height)
+        return;
+    Layer_Put(Layer, Xpoint, Ypoint, Color, Alpha);
+    Layer_Invalidate(Layer, Xpoint, Ypoint, Xpoint + 1, Ypoint + 1);
+}
+
+/******************************************************************************
+function: Fill a rectangle of a layer (layer coordinates, end exclusive)
+******************************************************************************/
+void Layer_Fill(LAYER *Layer, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, UBYTE Alpha)
+{
+    if(Xend > Layer->Width) Xend = Layer->Width;
+    if(Yend > Layer->Height) Yend = Layer->Height;
+    for(UWORD Y = Ystart; Y < Yend; Y++)
+        for(UWORD X = Xstart; X < Xend; X++)
+            Layer_Put(Layer, X, Y, Color, Alpha);
+    Layer_Invalidate(Layer, Xstart, Ystart, Xend, Yend);
+}
+
+/******************************************************************************
+function: Set up an empty stack
+parameter:
+    Background : Canvas-sized image in the canvas byte order, or NULL to
+                 composite over Paint.Color
+******************************************************************************/
+void LayerStack_Init(LAYER_STACK *Stack, const UWORD *Background)
+{
+    Stack->Background = Background;
+    Stack->Count = 0;
+    Stack->Dirty = Rect_Clip(0, 0, Paint.Width, Paint.Height);
+}
+
+UBYTE LayerStack_Add(LAYER_STACK *Stack, LAYER *Layer)
+{
+    if(Stack->Count >= LAYER_MAX) {
+        DEBUG("Layer stack full\r\n");
+        return 1;
+    }
+    Stack->Layer[Stack->Count++] = Layer;
+    Layer_MarkBounds(Layer);
+    return 0;
+}
+
+/******************************************************************************
+function: Mark part of the canvas as changed (e.g. after redrawing the background)
+******************************************************************************/
+void LayerStack_Invalidate(LAYER_STACK *Stack, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    LAYER_RECT r = Rect_Clip(Xstart, Ystart, Xend, Yend);
+    Rect_Union(&Stack->Dirty, &r);
+}
+
+/******************************************************************************
+function: Blend one layer into canvas row Y, columns [Xstart, Xend)
+******************************************************************************/
+static void LayerStack_BlendRow(const LAYER *Layer, UWORD Y, UWORD Xstart, UWORD Xend)
+{
+    int32_t Ly = (int32_t)Y - Layer->Y;
+    int32_t X0 = Xstart > Layer->X ? Xstart : Layer->X;
+    int32_t X1 = Xend < Layer->X + Layer->Width ? Xend : Layer->X + Layer->Width;
+    if(Ly < 0 || Ly >= Layer->Height || X0 >= X1)
+        return;
+
+    UWORD Lx = X0 - Layer->X;
+    UWORD n = X1 - X0;
+    UWORD *Dst = Paint.Image + Y * Paint.WidthByte + X0;
+    const UWORD *Src = Layer->Image ? Layer->Image + Ly * Layer->Width + Lx : NULL;
+    const UBYTE *Alpha;
+    UBYTE A8[n];
+
+    if(Layer->Format == LAYER_A4) {
+        GFX_SpanExpandA4(A8, Layer->Alpha + Ly * ((Layer->Width + 1) / 2), Lx, n);
+        Alpha = A8;
+    } else {
+        Alpha = Layer->Alpha + Ly * Layer->Width + Lx;
+    }
+
+    if(Layer->Format == LAYER_PREMUL && Src)
+        GFX_SpanBlendPremul(Dst, Src, Alpha, n, Layer->Opacity, GFX_ORDER_SWAPPED);
+    else if(Src)
+        GFX_SpanBlendA8(Dst, Src, Alpha, n, Layer->Opacity, GFX_ORDER_SWAPPED);
+    else
+        GFX_SpanBlendColorA8(Dst, Layer->Color, Alpha, n, Layer->Opacity, GFX_ORDER_SWAPPED);
+}
+
+/******************************************************************************
+function: Recomposite every dirty area into the canvas
+parameter:
+    Rects : Receives the recomposited rectangles, to push to the panel with
+            windowed writes; may be NULL
+    Max   : Size of Rects; extra rectangles are merged into the last one
+return:
+    Number of rectangles recomposited
+******************************************************************************/
+UBYTE LayerStack_Composite(LAYER_STACK *Stack, LAYER_RECT *Rects, UBYTE Max)
+{
+    LAYER_RECT Area[LAYER_MAX + 1];
+    UBYTE Count = 0;
+
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Layers need a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+
+    // Collect and merge the dirty rectangles
+    if(!Rect_Empty(&Stack->Dirty))
+        Area[Count++] = Stack->Dirty;
+    Stack->Dirty = (LAYER_RECT){0, 0, 0, 0};
+    for(UBYTE i = 0; i < Stack->Count; i++) {
+        LAYER *Layer = Stack->Layer[i];
+        if(!Rect_Empty(&Layer->Dirty))
+            Area[Count++] = Layer->Dirty;
+        Layer->Dirty = (LAYER_RECT){0, 0, 0, 0};
+    }
+    UBYTE Merged;
+    do {
+        // A grown rectangle may overlap ones already checked: rescan
+        Merged = 0;
+        for(UBYTE i = 0; i < Count && !Merged; i++) {
+            for(UBYTE j = i + 1; j < Count; j++) {
+                if(Rect_Overlap(&Area[i], &Area[j])) {
+                    Rect_Union(&Area[i], &Area[j]);
+                    Area[j] = Area[--Count];
+                    Merged = 1;
+                    break;
+                }
+            }
+        }
+    } while(Merged);
+    while(Rects && Max > 0 && Count > Max) {
+        Rect_Union(&Area[Max - 1], &Area[Count - 1]);
+        Count--;
+    }
+
+    for(UBYTE i = 0; i < Count; i++) {
+        const LAYER_RECT *r = &Area[i];
+        UWORD n = r->Xend - r->Xstart;
+        UWORD Fill = (Paint.Color << 8) | (Paint.Color >> 8);
+
+        for(UWORD Y = r->Ystart; Y < r->Yend; Y++) {
+            UWORD *Dst = Paint.Image + Y * Paint.WidthByte + r->Xstart;
+            if(Stack->Background)
+                memcpy(Dst, Stack->Background + Y * Paint.WidthByte + r->Xstart, n * sizeof(UWORD));
+            else
+                for(UWORD X = 0; X < n; X++)
+                    Dst[X] = Fill;
+            for(UBYTE l = 0; l < Stack->Count; l++)
+                if(Stack->Layer[l]->Visible)
+                    LayerStack_BlendRow(Stack->Layer[l], Y, r->Xstart, r->Xend);
+        }
+        if(Rects && i < Max)
+            Rects[i] = *r;
+    }
+    return Count;
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+* | File      	:   GUI_Layer.h
+* | Function    :   Alpha-composited layers over a Paint canvas
+* | Info        :
+*   A layer is an RGB565 image (or a solid colour) with A8, A4 or
+*   premultiplied alpha, placed anywhere on the canvas. Layers are stacked
+*   on top of a background image and only the rectangles they mark dirty
+*   are recomposited, using the span kernels in lib/gfx/gfx_span.c.
+*
+*   The output canvas is the current Paint image; it must be 16-bit with
+*   ROTATE_0 and MIRROR_NONE. The background has the canvas' size and
+*   byte order (e.g. a copy of a Paint image).
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_LAYER_H
+#define __GUI_LAYER_H
+
+#include "GUI_Paint.h"
+#include "gfx_span.h"
+
+#define LAYER_MAX   8
+
+/**
+ * Alpha format
+**/
+typedef enum {
+    LAYER_A8 = 0,       // 1 byte per pixel, straight colour
+    LAYER_A4,           // 2 pixels per byte (high nibble first), straight colour
+    LAYER_PREMUL,       // 1 byte per pixel, colour premultiplied by alpha
+} LAYER_FORMAT;
+
+/**
+ * Rectangle, end exclusive; empty when Xstart >= Xend
+**/
+typedef struct {
+    UWORD Xstart, Ystart;
+    UWORD Xend, Yend;
+} LAYER_RECT;
+
+typedef struct {
+    UWORD *Image;       // RGB565 in CPU byte order, NULL = solid Color (A8/A4 only)
+    UBYTE *Alpha;       // A8/PREMUL: Width bytes per row, A4: (Width + 1) / 2
+    UWORD Width;
+    UWORD Height;
+    int16_t X;          // Position of the top left corner on the canvas
+    int16_t Y;
+    UWORD Color;
+    UBYTE Format;
+    UBYTE Opacity;      // 0 - 255, applied on top of the per-pixel alpha
+    UBYTE Visible;
+    LAYER_RECT Dirty;   // Canvas coordinates
+} LAYER;
+
+typedef struct {
+    const UWORD *Background;    // NULL = Paint.Color
+    LAYER *Layer[LAYER_MAX];    // Bottom to top
+    UBYTE Count;
+    LAYER_RECT Dirty;           // Areas not covered by a layer (background changes)
+} LAYER_STACK;
+
+//Layer
+void Layer_Init(LAYER *Layer, UWORD *Image, UBYTE *Alpha, UWORD Width, UWORD Height, LAYER_FORMAT Format);
+void Layer_SetPosition(LAYER *Layer, int16_t X, int16_t Y);
+void Layer_SetOpacity(LAYER *Layer, UBYTE Opacity);
+void Layer_SetVisible(LAYER *Layer, UBYTE Visible);
+void Layer_SetPixel(LAYER *Layer, UWORD Xpoint, UWORD Ypoint, UWORD Color, UBYTE Alpha);
+void Layer_Fill(LAYER *Layer, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, UBYTE Alpha);
+void Layer_Invalidate(LAYER *Layer, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+//Stack
+void LayerStack_Init(LAYER_STACK *Stack, const UWORD *Background);
+UBYTE LayerStack_Add(LAYER_STACK *Stack, LAYER *Layer);
+void LayerStack_Invalidate(LAYER_STACK *Stack, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UBYTE LayerStack_Composite(LAYER_STACK *Stack, LAYER_RECT *Rects, UBYTE Max);
+
+#endif
@@ -35,6 +35,8 @@
 *
 ******************************************************************************/
 #include "GUI_Paint.h"
+#include "GUI_Font.h"
+#include "gfx_readout.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -43,12 +45,21 @@
 
 PAINT Paint;
 
+/******************************************************************************
+function: 2, 4 or 8 bits per pixel: Color is a palette index (GUI_Palette.h)
+******************************************************************************/
+static UBYTE Paint_Indexed(void)
+{
+    return Paint.Depth == 2 || Paint.Depth == 4 || Paint.Depth == 8;
+}
+
 /******************************************************************************
 function: Create Image
 parameter:
     image   :   Pointer to the image cache
     width   :   The width of the picture
     Height  :   The height of the picture
+    Rotate  :   ROTATE_0; anything else is deprecated, see Paint_SetRotate()
     Color   :   Whether the picture is inverted
 ******************************************************************************/
 void Paint_NewImage(UWORD *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color, UWORD Depth)
@@ -62,6 +73,8 @@ void Paint_NewImage(UWORD *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
     Paint.WidthByte = Width;
     Paint.HeightByte = Height;    
     Paint.Depth = Depth;    
+    if(Paint_Indexed())
+        Paint.WidthByte = (Width * Depth + 7) / 8;
 //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
@@ -91,6 +104,10 @@ void Paint_SelectImage(UWORD *image)
 function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
+info:
+    Deprecated. Every pixel then goes through the transform below; the
+    drivers with an LCD_Orient.c entry rotate in the controller instead
+    with LCD_xxx_SetOrientation() and a ROTATE_0 canvas.
 ******************************************************************************/
 void Paint_SetRotate(UWORD Rotate)
 {
@@ -113,6 +130,9 @@ void Paint_SetRotate(UWORD Rotate)
 function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
+info:
+    Deprecated, like Paint_SetRotate(): pass LCD_MIRROR_X / LCD_MIRROR_Y
+    to LCD_xxx_SetOrientation() instead.
 ******************************************************************************/
 void Paint_SetMirroring(UBYTE mirror)
 {
@@ -135,6 +155,14 @@ parameter:
 ******************************************************************************/
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
+    // Unrotated 16-bit canvas, e.g. with LCD_xxx_SetOrientation(): no transform
+    if(Paint.Depth == 16 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE) {
+        if(Xpoint >= Paint.Width || Ypoint >= Paint.Height)
+            return;
+        Paint.Image[Xpoint + Ypoint * Paint.WidthByte] = (Color << 8) | (Color >> 8);
+        return;
+    }
+
     if(Xpoint > Paint.Width || Ypoint > Paint.Height){
        // DEBUG("Exceeding display boundaries\r\n");
         return;
@@ -185,7 +213,16 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
     }
     
     
-    if(Paint.Depth == 1){
+    if(Paint_Indexed()){
+        // Packed high bits first, like the 1-bit canvas
+        if(X >= Paint.WidthMemory || Y >= Paint.HeightMemory)
+            return;
+        UDOUBLE Bit = (UDOUBLE)X * Paint.Depth;
+        UBYTE *Addr = (UBYTE *)Paint.Image + Y * Paint.WidthByte + (Bit >> 3);
+        UBYTE Shift = 8 - Paint.Depth - (Bit & 7);
+        UBYTE Mask = ((1 << Paint.Depth) - 1) << Shift;
+        *Addr = (*Addr & ~Mask) | ((Color << Shift) & Mask);
+    } else if(Paint.Depth == 1){
         UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
         UBYTE Rdata = Paint.Image[Addr];
         if(Color == BLACK)
@@ -206,6 +243,14 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
+    if(Paint_Indexed()) {
+        UBYTE Byte = Color & ((1 << Paint.Depth) - 1);
+        UBYTE Bits;
+        for(Bits = Paint.Depth; Bits < 8; Bits <<= 1)
+            Byte |= Byte << Bits;
+        memset(Paint.Image, Byte, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
+        return;
+    }
     for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
         for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
             UDOUBLE Addr = X + Y*Paint.WidthByte;
@@ -453,6 +498,12 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
         return;
     }
 
+    if (Font->Compressed) {
+        Paint_DrawGlyph(Xpoint, Ypoint, (uint8_t)Acsii_Char, Font->Compressed, Font->Width,
+                        Color_Foreground, Color_Background);
+        return;
+    }
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char *ptr = &Font->table[Char_Offset];
 
@@ -633,36 +684,21 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-#define  ARRAY_LEN 255
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
-
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
+    char Str[13];
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         DEBUG("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
 
-    //Converts a number to a string
-    while (Nummber) {
-        Num_Array[Num_Bit] = Nummber % 10 + '0';
-        Num_Bit++;
-        Nummber /= 10;
-    }
-
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
+    //Converts a number to a string (integer only, see gfx_readout.c)
+    GFX_FormatFixed(Str, Nummber, 0);
 
     //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Foreground , Color_Background);
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Foreground , Color_Background);
 }
 /******************************************************************************
 function:	Display Float Nummber
@@ -670,22 +706,31 @@ parameter:
     Xstart           ：X coordinate
     Ystart           : Y coordinate
     Nummber          : The float data that you want to display
-	Decimal_Point	 : Show decimal places
+	Decimal_Point	 : Show decimal places (rounded, at most 9)
     Font             ：A structure pointer that displays a character size
     Color            : Select the background color of the English character
 ******************************************************************************/
 void Paint_DrawFloatNum(UWORD Xpoint, UWORD Ypoint, double Nummber,  UBYTE Decimal_Point, 
                         sFONT* Font,  UWORD Color_Foreground, UWORD  Color_Background)
 {
-    char Str[ARRAY_LEN];
-    sprintf(Str,"%.*lf",Decimal_Point+1,Nummber);
-    char * pStr= (char *)malloc((strlen(Str))*sizeof(char));
-    memcpy(pStr,Str,(strlen(Str)-1));
-    * (pStr+strlen(Str)-1)='\0';
+    char Str[32];
+    double Scaled = Nummber;
+    UBYTE i;
+
+    if (Decimal_Point > 9)
+        Decimal_Point = 9;
+    for (i = 0; i < Decimal_Point; i++)
+        Scaled *= 10;
+    Scaled += Scaled < 0 ? -0.5 : 0.5;
+
+    //Fixed point when it fits 32 bits, no heap either way
+    if (Scaled > -2147483648.0 && Scaled < 2147483648.0)
+        GFX_FormatFixed(Str, (int32_t)Scaled, Decimal_Point);
+    else
+        snprintf(Str, sizeof(Str), "%.*f", Decimal_Point, Nummber);
+
     //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Foreground , Color_Background);
-    free(pStr);
-    pStr=NULL;
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Foreground , Color_Background);
 }
 
 /******************************************************************************
@@ -747,12 +792,21 @@ parameter:
 info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
+    On a 2, 4 or 8-bit canvas every byte is one palette index, drawn
+    through Paint_SetPixel() (Paint.Width x Paint.Height bytes).
 ******************************************************************************/
 void Paint_DrawBitMap(const unsigned char* image_buffer)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
 
+    if(Paint_Indexed()) {
+        // WidthByte is a byte stride here, Paint.Image a UWORD pointer
+        for (y = 0; y < Paint.Height; y++)
+            for (x = 0; x < Paint.Width; x++)
+                Paint_SetPixel(x, y, image_buffer[x + (UDOUBLE)y * Paint.Width]);
+        return;
+    }
     for (y = 0; y < Paint.HeightByte; y++) {
         for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * Paint.WidthByte;
@@ -144,6 +144,8 @@ extern PAINT_TIME sPaint_time;
 //init and Clear
 void Paint_NewImage(UWORD *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color, UWORD Depth);
 void Paint_SelectImage(UWORD *image);
+//Deprecated: rotate in software. Panels in LCD_Orient.c use LCD_xxx_SetOrientation()
+//and a ROTATE_0 canvas; only the 0.96, 1.8 and 1.9 inch drivers still need these.
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
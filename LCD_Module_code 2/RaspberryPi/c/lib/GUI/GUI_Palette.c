@@ -0,0 +1,119 @@
+/*****************************************************************************
+* | File      	:   GUI_Palette.c
+* | Function    :   Palette-indexed canvases, expanded to RGB565 on the way out
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Palette.h"
+
+#include <string.h>
+
+/******************************************************************************
+function: Bytes of canvas memory for Paint_NewImage()
+******************************************************************************/
+UDOUBLE Paint_ImageSize(UWORD Width, UWORD Height, UWORD Depth)
+{
+    return (UDOUBLE)((Width * Depth + 7) / 8) * Height;
+}
+
+/******************************************************************************
+function: Rebuild the per-byte tables from Pixel[]
+******************************************************************************/
+static void Palette_Build(PAINT_PALETTE *Palette)
+{
+    UWORD b;
+    UWORD Px[4];
+
+    for(b = 0; b < 256; b++) {
+        if(Palette->Depth == 4) {
+            Px[0] = Palette->Pixel[b >> 4];
+            Px[1] = Palette->Pixel[b & 0x0F];
+            memcpy(&Palette->Byte.Pair[b], Px, 4);
+        } else if(Palette->Depth == 2) {
+            Px[0] = Palette->Pixel[b >> 6];
+            Px[1] = Palette->Pixel[(b >> 4) & 3];
+            Px[2] = Palette->Pixel[(b >> 2) & 3];
+            Px[3] = Palette->Pixel[b & 3];
+            memcpy(&Palette->Byte.Quad[b], Px, 8);
+        }
+    }
+}
+
+/******************************************************************************
+function: Set up a palette
+parameter:
+    Depth   :   Canvas depth, 2, 4 or 8
+    Colors  :   RGB565; entries past Count are black
+******************************************************************************/
+void Paint_NewPalette(PAINT_PALETTE *Palette, UBYTE Depth, const UWORD *Colors, UWORD Count)
+{
+    memset(Palette->Pixel, 0, sizeof(Palette->Pixel));
+    Palette->Depth = Depth;
+    Paint_SetPaletteColors(Palette, 0, Colors, Count);
+}
+
+/******************************************************************************
+function: Change entries First.. (theme switch); flush to show the result
+******************************************************************************/
+void Paint_SetPaletteColors(PAINT_PALETTE *Palette, UBYTE First, const UWORD *Colors, UWORD Count)
+{
+    UWORD i;
+
+    for(i = 0; i < Count && First + i < (1 << Palette->Depth); i++)
+        Palette->Pixel[First + i] = (Colors[i] << 8) | (Colors[i] >> 8);
+    Palette_Build(Palette);
+}
+
+/******************************************************************************
+function: Expand Width pixels of a canvas row from column Xstart
+parameter:
+    Line    :   RGB565 out, byte-swapped (ready for DEV_SPI_Write_nByte)
+    Row     :   Start of the canvas row
+******************************************************************************/
+void Paint_ExpandRow(UWORD *Line, const UBYTE *Row, UWORD Xstart, UWORD Width,
+                     const PAINT_PALETTE *Palette)
+{
+    UBYTE Depth = Palette->Depth;
+    UBYTE Per_Byte = 8 / Depth;
+    UBYTE Mask = (1 << Depth) - 1;
+    UDOUBLE X = Xstart, Xend = (UDOUBLE)Xstart + Width;
+    const UBYTE *p;
+
+    if(Depth == 8) {
+        for(p = Row + X; X < Xend; X++)
+            *Line++ = Palette->Pixel[*p++];
+        return;
+    }
+
+    // Up to the first whole byte
+    for(; X < Xend && (X & (Per_Byte - 1)); X++)
+        *Line++ = Palette->Pixel[(Row[X / Per_Byte] >> (8 - Depth - (X & (Per_Byte - 1)) * Depth)) & Mask];
+
+    p = Row + X / Per_Byte;
+    if(Depth == 4) {
+        for(; X + 2 <= Xend; X += 2, Line += 2)
+            memcpy(Line, &Palette->Byte.Pair[*p++], 4);
+    } else {
+        for(; X + 4 <= Xend; X += 4, Line += 4)
+            memcpy(Line, &Palette->Byte.Quad[*p++], 8);
+    }
+
+    // Rest of the last byte
+    for(; X < Xend; X++)
+        *Line++ = Palette->Pixel[(Row[X / Per_Byte] >> (8 - Depth - (X & (Per_Byte - 1)) * Depth)) & Mask];
+}
+
+/******************************************************************************
+function: Row callback for LCD_xxx_DisplayRows(): row Y of the current canvas
+parameter:
+    Palette :   PAINT_PALETTE *
+******************************************************************************/
+void Paint_PaletteRow(UWORD Y, UWORD Xstart, UWORD Width, UWORD *Line, void *Palette)
+{
+    Paint_ExpandRow(Line, (const UBYTE *)Paint.Image + (UDOUBLE)Y * Paint.WidthByte,
+                    Xstart, Width, (const PAINT_PALETTE *)Palette);
+}
@@ -0,0 +1,47 @@
+/*****************************************************************************
+* | File      	:   GUI_Palette.h
+* | Function    :   Palette-indexed canvases, expanded to RGB565 on the way out
+* | Info        :
+*   Paint_NewImage(..., Depth) with Depth 2, 4 or 8 gives a canvas of
+*   palette indices, packed high bits first. Every Paint primitive takes
+*   an index as its Color. Nothing 16-bit is stored: the transport
+*   expands one row at a time through the palette, e.g.
+*
+*       LCD_1IN28_DisplayRows(0, 0, 240, 240, Paint_PaletteRow, &Palette);
+*
+*   Changing palette entries recolours the whole UI on the next flush
+*   without touching the canvas.
+*
+*   Expansion looks up a whole canvas byte at a time: at 4 bpp one
+*   lookup gives two pixels (one 32-bit store), at 2 bpp four (one 64-bit
+*   store). The per-byte tables are rebuilt when the palette changes.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_PALETTE_H
+#define __GUI_PALETTE_H
+
+#include "GUI_Paint.h"
+
+typedef struct {
+    UBYTE Depth;                // 2, 4 or 8
+    UWORD Pixel[256];           // Index -> RGB565, byte-swapped like a 16-bit canvas
+    union {
+        uint32_t Pair[256];     // 4 bpp: canvas byte -> 2 pixels
+        uint64_t Quad[256];     // 2 bpp: canvas byte -> 4 pixels
+    } Byte;
+} PAINT_PALETTE;
+
+UDOUBLE Paint_ImageSize(UWORD Width, UWORD Height, UWORD Depth);
+
+void Paint_NewPalette(PAINT_PALETTE *Palette, UBYTE Depth, const UWORD *Colors, UWORD Count);
+void Paint_SetPaletteColors(PAINT_PALETTE *Palette, UBYTE First, const UWORD *Colors, UWORD Count);
+
+void Paint_ExpandRow(UWORD *Line, const UBYTE *Row, UWORD Xstart, UWORD Width,
+                     const PAINT_PALETTE *Palette);
+void Paint_PaletteRow(UWORD Y, UWORD Xstart, UWORD Width, UWORD *Line, void *Palette);
+
+#endif
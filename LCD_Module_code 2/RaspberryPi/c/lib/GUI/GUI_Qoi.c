@@ -0,0 +1,104 @@
+/*****************************************************************************
+* | File      	:   GUI_Qoi.c
+* | Function    :   Q565 images on the Paint canvas
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Qoi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/******************************************************************************
+function: Draw a Q565 image held in memory
+parameter:
+    Data   : Encoded image (e.g. a const array from qoi565 -c)
+    Size   : Bytes in Data
+    Xstart : Left edge on the canvas
+    Ystart : Top edge on the canvas
+return:
+    1 on success, 0 if Data is not Q565 or ends early
+Info:
+    Rows of a 16-bit, unrotated canvas are decoded in place; anything
+    else goes through Paint_SetPixel(). Parts outside the canvas are cut.
+******************************************************************************/
+UBYTE Paint_DrawQoi(const UBYTE *Data, UDOUBLE Size, UWORD Xstart, UWORD Ystart)
+{
+    GFX_Qoi Qoi;
+    UWORD *Row = NULL;
+    UBYTE Direct;
+
+    if(!GFX_Qoi_Open(&Qoi, Data, Size)) {
+        DEBUG("Paint_DrawQoi: not a Q565 image\r\n");
+        return 0;
+    }
+    Direct = Paint.Depth == 16 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE
+             && Xstart + Qoi.width <= Paint.WidthMemory;
+    if(!Direct) {
+        Row = malloc(Qoi.width * sizeof(UWORD));
+        if(Row == NULL) {
+            DEBUG("Paint_DrawQoi: not enough memory for a row\r\n");
+            return 0;
+        }
+    }
+
+    for(UWORD j = 0; j < Qoi.height; j++) {
+        if(Direct) {
+            // Rows below the canvas are not needed
+            if(Ystart + j >= Paint.HeightMemory)
+                break;
+            GFX_Qoi_DecodeRow(&Qoi, Paint.Image + (Ystart + j) * Paint.WidthByte + Xstart,
+                              GFX_ORDER_SWAPPED);
+            continue;
+        }
+        GFX_Qoi_DecodeRow(&Qoi, Row, GFX_ORDER_NATIVE);
+        for(UWORD i = 0; i < Qoi.width; i++)
+            if(Xstart + i < Paint.Width && Ystart + j < Paint.Height)
+                Paint_SetPixel(Xstart + i, Ystart + j, Row[i]);
+    }
+    free(Row);
+    return !Qoi.error;
+}
+
+/******************************************************************************
+function: Draw a Q565 file
+parameter:
+    path   : .q565 file
+    Xstart : Left edge on the canvas
+    Ystart : Top edge on the canvas
+return:
+    1 on success, 0 on error
+Info:
+    Only the compressed file is read into memory.
+******************************************************************************/
+UBYTE GUI_ReadQoi(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    FILE *fp;
+    UBYTE *Data;
+    long Size;
+    UBYTE Ok;
+
+    if((fp = fopen(path, "rb")) == NULL) {
+        DEBUG("Cann't open the file!\n");
+        return 0;
+    }
+    fseek(fp, 0, SEEK_END);
+    Size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    Data = Size > 0 ? malloc(Size) : NULL;
+    if(Data == NULL || fread(Data, 1, Size, fp) != (size_t)Size) {
+        DEBUG("GUI_ReadQoi: cannot read %s\n", path);
+        free(Data);
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+
+    Ok = Paint_DrawQoi(Data, Size, Xstart, Ystart);
+    free(Data);
+    return Ok;
+}
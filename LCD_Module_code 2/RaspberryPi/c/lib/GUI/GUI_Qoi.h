@@ -0,0 +1,24 @@
+/*****************************************************************************
+* | File      	:   GUI_Qoi.h
+* | Function    :   Q565 images on the Paint canvas
+* | Info        :
+*   Paint front end for the Q565 codec (lib/gfx/gfx_qoi.c): lossless
+*   RGB565, typically 2-10x smaller than a 16-bit BMP and decoded row by
+*   row, so only the compressed data and one row are held. Encode with
+*   tools/qoi565.c.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_QOI_H
+#define __GUI_QOI_H
+
+#include "GUI_Paint.h"
+#include "gfx_qoi.h"
+
+UBYTE Paint_DrawQoi(const UBYTE *Data, UDOUBLE Size, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_ReadQoi(const char *path, UWORD Xstart, UWORD Ystart);
+
+#endif
@@ -0,0 +1,86 @@
+/*****************************************************************************
+* | File      	:   GUI_Readout.c
+* | Function    :   Numeric and clock readouts on the Paint canvas
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Readout.h"
+
+typedef struct {
+    const GFX_Readout *Readout;
+    READOUT_FLUSH Flush;
+} READOUT_UPDATE;
+
+static UBYTE Readout_CanvasOk(void)
+{
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Readout needs a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function: Render one changed cell into the canvas and push it
+******************************************************************************/
+static void Readout_Cell(int16_t Xstart, int16_t Ystart, int16_t Xend, int16_t Yend, void *Ctx)
+{
+    const READOUT_UPDATE *Update = (const READOUT_UPDATE *)Ctx;
+
+    if(Xstart < 0) Xstart = 0;
+    if(Ystart < 0) Ystart = 0;
+    if(Xend > Paint.Width) Xend = Paint.Width;
+    if(Yend > Paint.Height) Yend = Paint.Height;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    for(int16_t Y = Ystart; Y < Yend; Y++)
+        GFX_Readout_RenderRow(Update->Readout, Y, Xstart, Xend - Xstart,
+                              Paint.Image + Y * Paint.WidthByte + Xstart, GFX_ORDER_SWAPPED);
+    if(Update->Flush)
+        Update->Flush(Xstart, Ystart, Xend, Yend, Paint.Image);
+}
+
+/******************************************************************************
+function: Show Text (right-aligned), repainting only the changed cells
+parameter:
+    Readout : Set up with GFX_Readout_Init(); a fresh one paints every cell
+    Text    : Longer than the readout shows as all '-'
+    Flush   : Pushes each changed cell to the panel; may be NULL
+return:
+    Number of cells repainted
+******************************************************************************/
+UBYTE Paint_SetReadout(GFX_Readout *Readout, const char *Text, READOUT_FLUSH Flush)
+{
+    READOUT_UPDATE Update = {Readout, Flush};
+
+    if(!Readout_CanvasOk())
+        return 0;
+    return GFX_Readout_Set(Readout, Text, Readout_Cell, &Update);
+}
+
+/******************************************************************************
+function: Show Value / 10^Decimals, e.g. (-1234, 2) shows "-12.34"
+******************************************************************************/
+UBYTE Paint_SetReadoutNum(GFX_Readout *Readout, int32_t Value, UBYTE Decimals, READOUT_FLUSH Flush)
+{
+    char Str[13];
+
+    GFX_FormatFixed(Str, Value, Decimals);
+    return Paint_SetReadout(Readout, Str, Flush);
+}
+
+/******************************************************************************
+function: Show "HH:MM:SS"; a tick usually repaints one or two cells
+******************************************************************************/
+UBYTE Paint_SetReadoutTime(GFX_Readout *Readout, PAINT_TIME *pTime, READOUT_FLUSH Flush)
+{
+    char Str[9];
+
+    GFX_FormatClock(Str, pTime->Hour, pTime->Min, pTime->Sec);
+    return Paint_SetReadout(Readout, Str, Flush);
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   GUI_Readout.h
+* | Function    :   Numeric and clock readouts on the Paint canvas
+* | Info        :
+*   Paint front end for the shared readout widget (lib/gfx/gfx_readout.c).
+*   Only the character cells that change are rendered, and each one is
+*   pushed as its own window through the flush callback (e.g.
+*   LCD_1IN28_DisplayWindows). Formatting is integer only.
+*
+*   The canvas must be 16-bit with ROTATE_0 and MIRROR_NONE.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_READOUT_H
+#define __GUI_READOUT_H
+
+#include "GUI_Paint.h"
+#include "gfx_readout.h"
+
+/**
+ * Window push, end exclusive; Image is the whole canvas
+**/
+typedef void (*READOUT_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+
+UBYTE Paint_SetReadout(GFX_Readout *Readout, const char *Text, READOUT_FLUSH Flush);
+UBYTE Paint_SetReadoutNum(GFX_Readout *Readout, int32_t Value, UBYTE Decimals, READOUT_FLUSH Flush);
+UBYTE Paint_SetReadoutTime(GFX_Readout *Readout, PAINT_TIME *pTime, READOUT_FLUSH Flush);
+
+#endif
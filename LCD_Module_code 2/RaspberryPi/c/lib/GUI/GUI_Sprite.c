@@ -0,0 +1,339 @@
+/*****************************************************************************
+* | File      	:   GUI_Sprite.c
+* | Function    :   Moving sprites with saved backgrounds
+* | Info        :
+*   Invariant: the canvas holds the background with every drawn sprite
+*   on top in list order, and each sprite's Save holds what was under it
+*   when it was drawn. A sprite can therefore be lifted off only after
+*   every sprite drawn later that overlaps it has been lifted, so
+*   updates work on a closed set of "affected" sprites:
+*     - changed sprites
+*     - sprites drawn above an affected sprite and overlapping it
+*     - sprites that will be above an affected sprite's new position
+*   Affected sprites are restored top to bottom in the old order and
+*   redrawn bottom to top in the new Z order. Only the areas of the
+*   sprites that changed are flushed.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Sprite.h"
+
+typedef struct {
+    int32_t Xstart, Ystart, Xend, Yend;     // End exclusive
+} SPRITE_RECT;
+
+static UBYTE Rect_Empty(const SPRITE_RECT *r)
+{
+    return r->Xstart >= r->Xend || r->Ystart >= r->Yend;
+}
+
+static UBYTE Rect_Overlap(const SPRITE_RECT *a, const SPRITE_RECT *b)
+{
+    return !Rect_Empty(a) && !Rect_Empty(b) &&
+           a->Xstart < b->Xend && b->Xstart < a->Xend &&
+           a->Ystart < b->Yend && b->Ystart < a->Yend;
+}
+
+static void Rect_Union(SPRITE_RECT *r, const SPRITE_RECT *a)
+{
+    if(Rect_Empty(a))
+        return;
+    if(Rect_Empty(r)) {
+        *r = *a;
+        return;
+    }
+    if(a->Xstart < r->Xstart) r->Xstart = a->Xstart;
+    if(a->Ystart < r->Ystart) r->Ystart = a->Ystart;
+    if(a->Xend > r->Xend) r->Xend = a->Xend;
+    if(a->Yend > r->Yend) r->Yend = a->Yend;
+}
+
+static SPRITE_RECT Rect_Clip(int32_t X, int32_t Y, UWORD Width, UWORD Height)
+{
+    SPRITE_RECT r = {X, Y, X + Width, Y + Height};
+    if(r.Xstart < 0) r.Xstart = 0;
+    if(r.Ystart < 0) r.Ystart = 0;
+    if(r.Xend > Paint.Width) r.Xend = Paint.Width;
+    if(r.Yend > Paint.Height) r.Yend = Paint.Height;
+    return r;
+}
+
+// Area currently occupied on the canvas
+static SPRITE_RECT Sprite_OldRect(const SPRITE *Sprite)
+{
+    SPRITE_RECT r = {0, 0, 0, 0};
+    if(Sprite->Drawn)
+        r = Rect_Clip(Sprite->DrawnX, Sprite->DrawnY, Sprite->Width, Sprite->Height);
+    return r;
+}
+
+// Area it will occupy after the update
+static SPRITE_RECT Sprite_NewRect(const SPRITE *Sprite)
+{
+    SPRITE_RECT r = {0, 0, 0, 0};
+    if(Sprite->Visible)
+        r = Rect_Clip(Sprite->X, Sprite->Y, Sprite->Width, Sprite->Height);
+    return r;
+}
+
+/******************************************************************************
+function: Put the saved background back
+******************************************************************************/
+static void Sprite_Restore(SPRITE *Sprite)
+{
+    SPRITE_RECT r = Sprite_OldRect(Sprite);
+    for(int32_t Y = r.Ystart; Y < r.Yend; Y++) {
+        const UWORD *Src = Sprite->Save + (Y - Sprite->DrawnY) * Sprite->Width + (r.Xstart - Sprite->DrawnX);
+        UWORD *Dst = Paint.Image + Y * Paint.WidthByte;
+        for(int32_t X = r.Xstart; X < r.Xend; X++)
+            Dst[X] = *Src++;
+    }
+    Sprite->Drawn = 0;
+}
+
+/******************************************************************************
+function: Save the background at the new position and draw the sprite
+******************************************************************************/
+static void Sprite_Draw(SPRITE *Sprite)
+{
+    SPRITE_RECT r = Sprite_NewRect(Sprite);
+    for(int32_t Y = r.Ystart; Y < r.Yend; Y++) {
+        UDOUBLE Offset = (Y - Sprite->Y) * Sprite->Width + (r.Xstart - Sprite->X);
+        const UWORD *Src = Sprite->Image + Offset;
+        UWORD *Save = Sprite->Save + Offset;
+        UWORD *Dst = Paint.Image + Y * Paint.WidthByte;
+        for(int32_t X = r.Xstart; X < r.Xend; X++, Src++) {
+            *Save++ = Dst[X];
+            if(!Sprite->Keyed || *Src != Sprite->Key)
+                Dst[X] = (*Src << 8) | (*Src >> 8);    // Canvas stores MSB first
+        }
+    }
+    Sprite->DrawnX = Sprite->X;
+    Sprite->DrawnY = Sprite->Y;
+    Sprite->Drawn = 1;
+}
+
+/******************************************************************************
+function: Create a sprite (hidden until added to a list)
+parameter:
+    Image  : Width x Height RGB565 pixels, CPU byte order
+    Save   : Width x Height UWORD scratch buffer owned by the sprite
+******************************************************************************/
+void Sprite_Init(SPRITE *Sprite, const UWORD *Image, UWORD *Save, UWORD Width, UWORD Height)
+{
+    Sprite->Image = Image;
+    Sprite->Save = Save;
+    Sprite->Width = Width;
+    Sprite->Height = Height;
+    Sprite->X = 0;
+    Sprite->Y = 0;
+    Sprite->Z = 0;
+    Sprite->Key = 0;
+    Sprite->Keyed = 0;
+    Sprite->Visible = 1;
+    Sprite->Changed = 1;
+    Sprite->Drawn = 0;
+    Sprite->DrawnX = 0;
+    Sprite->DrawnY = 0;
+}
+
+/******************************************************************************
+function: Swap the sprite's pixels (animation frames); same size
+******************************************************************************/
+void Sprite_SetImage(SPRITE *Sprite, const UWORD *Image)
+{
+    Sprite->Image = Image;
+    Sprite->Changed = 1;
+}
+
+/******************************************************************************
+function: Pixels equal to Key are not drawn
+******************************************************************************/
+void Sprite_SetColorKey(SPRITE *Sprite, UWORD Key)
+{
+    Sprite->Key = Key;
+    Sprite->Keyed = 1;
+    Sprite->Changed = 1;
+}
+
+void Sprite_ClearColorKey(SPRITE *Sprite)
+{
+    Sprite->Keyed = 0;
+    Sprite->Changed = 1;
+}
+
+void Sprite_MoveTo(SPRITE *Sprite, int16_t X, int16_t Y)
+{
+    if(X == Sprite->X && Y == Sprite->Y)
+        return;
+    Sprite->X = X;
+    Sprite->Y = Y;
+    Sprite->Changed = 1;
+}
+
+void Sprite_SetZ(SPRITE *Sprite, int16_t Z)
+{
+    if(Z == Sprite->Z)
+        return;
+    Sprite->Z = Z;
+    Sprite->Changed = 1;
+}
+
+void Sprite_SetVisible(SPRITE *Sprite, UBYTE Visible)
+{
+    if(Visible == Sprite->Visible)
+        return;
+    Sprite->Visible = Visible;
+    Sprite->Changed = 1;
+}
+
+/******************************************************************************
+function: Set up an empty list
+parameter:
+    Flush : Pushes a canvas window to the panel, e.g. LCD_1IN28_DisplayWindows;
+            may be NULL
+******************************************************************************/
+void SpriteList_Init(SPRITE_LIST *List, SPRITE_FLUSH Flush)
+{
+    List->Count = 0;
+    List->Flush = Flush;
+}
+
+UBYTE SpriteList_Add(SPRITE_LIST *List, SPRITE *Sprite)
+{
+    if(List->Count >= SPRITE_MAX) {
+        DEBUG("Sprite list full\r\n");
+        return 1;
+    }
+    Sprite->Changed = 1;
+    List->Sprite[List->Count++] = Sprite;
+    return 0;
+}
+
+/******************************************************************************
+function: Take a sprite off the canvas (flushed immediately) and out of the list
+******************************************************************************/
+void SpriteList_Remove(SPRITE_LIST *List, SPRITE *Sprite)
+{
+    UBYTE Visible = Sprite->Visible;
+
+    Sprite_SetVisible(Sprite, 0);
+    SpriteList_Update(List);
+    Sprite->Visible = Visible;
+    for(UBYTE i = 0; i < List->Count; i++) {
+        if(List->Sprite[i] == Sprite) {
+            for(UBYTE j = i + 1; j < List->Count; j++)
+                List->Sprite[j - 1] = List->Sprite[j];
+            List->Count--;
+            break;
+        }
+    }
+}
+
+/******************************************************************************
+function: Redraw changed sprites and push the areas that changed
+return:
+    Number of pixels pushed through the flush callback
+******************************************************************************/
+UDOUBLE SpriteList_Update(SPRITE_LIST *List)
+{
+    UBYTE n = List->Count;
+    SPRITE *Order[SPRITE_MAX];      // New Z order
+    UBYTE Rank[SPRITE_MAX];         // Position of List->Sprite[i] in Order
+    UBYTE Changed[SPRITE_MAX];
+    UBYTE Affected[SPRITE_MAX];
+    SPRITE_RECT Old[SPRITE_MAX], New[SPRITE_MAX];
+    UBYTE i, j;
+
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Sprites need a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+
+    // Stable sort by Z into Order
+    for(i = 0; i < n; i++) {
+        SPRITE *s = List->Sprite[i];
+        for(j = i; j > 0 && Order[j - 1]->Z > s->Z; j--)
+            Order[j] = Order[j - 1];
+        Order[j] = s;
+    }
+    for(i = 0; i < n; i++) {
+        for(j = 0; j < n; j++)
+            if(Order[j] == List->Sprite[i])
+                Rank[i] = j;
+        Changed[i] = Affected[i] = List->Sprite[i]->Changed;
+        Old[i] = Sprite_OldRect(List->Sprite[i]);
+        New[i] = Sprite_NewRect(List->Sprite[i]);
+    }
+
+    // Close the affected set (indices are the current, i.e. drawn, order)
+    UBYTE Grew;
+    do {
+        Grew = 0;
+        for(i = 0; i < n; i++) {
+            if(!Affected[i])
+                continue;
+            for(j = 0; j < n; j++) {
+                if(Affected[j] || !List->Sprite[j]->Drawn)
+                    continue;
+                if((j > i && Rect_Overlap(&Old[j], &Old[i])) ||
+                   (Rank[j] > Rank[i] && Rect_Overlap(&Old[j], &New[i]))) {
+                    Affected[j] = 1;
+                    Grew = 1;
+                }
+            }
+        }
+    } while(Grew);
+
+    // Lift off top to bottom, redraw bottom to top in the new order
+    for(i = n; i-- > 0;)
+        if(Affected[i] && List->Sprite[i]->Drawn)
+            Sprite_Restore(List->Sprite[i]);
+    for(i = 0; i < n; i++) {
+        SPRITE *s = Order[i];
+        if(!s->Drawn && s->Visible)
+            Sprite_Draw(s);
+        s->Changed = 0;
+    }
+
+    // One window per changed sprite, overlapping windows merged. Sprites
+    // only lifted because of an overlap end up with the same pixels.
+    SPRITE_RECT Area[SPRITE_MAX];
+    UBYTE Count = 0;
+    for(i = 0; i < n; i++) {
+        if(!Changed[i])
+            continue;
+        SPRITE_RECT r = Old[i];
+        Rect_Union(&r, &New[i]);
+        if(!Rect_Empty(&r))
+            Area[Count++] = r;
+    }
+    UBYTE Merged;
+    do {
+        Merged = 0;
+        for(i = 0; i < Count && !Merged; i++) {
+            for(j = i + 1; j < Count; j++) {
+                if(Rect_Overlap(&Area[i], &Area[j])) {
+                    Rect_Union(&Area[i], &Area[j]);
+                    Area[j] = Area[--Count];
+                    Merged = 1;
+                    break;
+                }
+            }
+        }
+    } while(Merged);
+
+    UDOUBLE Pixels = 0;
+    for(i = 0; i < Count; i++) {
+        if(List->Flush)
+            List->Flush(Area[i].Xstart, Area[i].Ystart, Area[i].Xend, Area[i].Yend, Paint.Image);
+        Pixels += (Area[i].Xend - Area[i].Xstart) * (Area[i].Yend - Area[i].Ystart);
+    }
+
+    for(i = 0; i < n; i++)
+        List->Sprite[i] = Order[i];
+    return Pixels;
+}
@@ -0,0 +1,70 @@
+/*****************************************************************************
+* | File      	:   GUI_Sprite.h
+* | Function    :   Moving sprites with saved backgrounds
+* | Info        :
+*   Each sprite keeps a copy of the canvas pixels it covers. On
+*   SpriteList_Update() changed sprites (and any sprites stacked above
+*   them) are lifted off the canvas by restoring those copies, redrawn at
+*   their new position in Z order, and only the union of each sprite's
+*   old and new bounding box is pushed to the panel through the flush
+*   callback (e.g. LCD_1IN28_DisplayWindows).
+*
+*   The canvas is the current Paint image; it must be 16-bit with
+*   ROTATE_0 and MIRROR_NONE.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_SPRITE_H
+#define __GUI_SPRITE_H
+
+#include "GUI_Paint.h"
+
+#define SPRITE_MAX  16
+
+/**
+ * Window push, end exclusive; Image is the whole canvas
+**/
+typedef void (*SPRITE_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+
+typedef struct {
+    const UWORD *Image;     // Width x Height RGB565, CPU byte order
+    UWORD *Save;            // Width x Height scratch for the background
+    UWORD Width;
+    UWORD Height;
+    int16_t X;              // Requested position
+    int16_t Y;
+    int16_t Z;              // Higher is drawn on top
+    UWORD Key;              // Transparent colour when Keyed
+    UBYTE Keyed;
+    UBYTE Visible;
+    UBYTE Changed;          // Needs redrawing on the next update
+    UBYTE Drawn;            // Currently on the canvas at DrawnX, DrawnY
+    int16_t DrawnX;
+    int16_t DrawnY;
+} SPRITE;
+
+typedef struct {
+    SPRITE *Sprite[SPRITE_MAX];     // Kept sorted by Z
+    UBYTE Count;
+    SPRITE_FLUSH Flush;
+} SPRITE_LIST;
+
+//Sprite
+void Sprite_Init(SPRITE *Sprite, const UWORD *Image, UWORD *Save, UWORD Width, UWORD Height);
+void Sprite_SetImage(SPRITE *Sprite, const UWORD *Image);
+void Sprite_SetColorKey(SPRITE *Sprite, UWORD Key);
+void Sprite_ClearColorKey(SPRITE *Sprite);
+void Sprite_MoveTo(SPRITE *Sprite, int16_t X, int16_t Y);
+void Sprite_SetZ(SPRITE *Sprite, int16_t Z);
+void Sprite_SetVisible(SPRITE *Sprite, UBYTE Visible);
+
+//List
+void SpriteList_Init(SPRITE_LIST *List, SPRITE_FLUSH Flush);
+UBYTE SpriteList_Add(SPRITE_LIST *List, SPRITE *Sprite);
+void SpriteList_Remove(SPRITE_LIST *List, SPRITE *Sprite);
+UDOUBLE SpriteList_Update(SPRITE_LIST *List);
+
+#endif
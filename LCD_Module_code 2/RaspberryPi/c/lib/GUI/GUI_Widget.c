@@ -0,0 +1,539 @@
+/*****************************************************************************
+* | File      	:   GUI_Widget.c
+* | Function    :   Retained widgets redrawn only where they change
+* | Info        :
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Widget.h"
+#include "gfx_readout.h"
+
+#include <string.h>
+
+typedef struct {
+    const GFX_Gauge *Gauge;
+    WIDGET_RECT Moved;          // Bounding box of the needle spans
+} WIDGET_NEEDLE;
+
+static UBYTE Widget_CanvasOk(void)
+{
+    if(Paint.Depth != 16 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE) {
+        DEBUG("Widgets need a 16-bit, unrotated canvas\r\n");
+        return 0;
+    }
+    return 1;
+}
+
+static void Rect_Union(WIDGET_RECT *Rect, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+    if(Rect->Xstart >= Rect->Xend) {
+        Rect->Xstart = Xstart;
+        Rect->Ystart = Ystart;
+        Rect->Xend = Xend;
+        Rect->Yend = Yend;
+        return;
+    }
+    if(Xstart < Rect->Xstart) Rect->Xstart = Xstart;
+    if(Ystart < Rect->Ystart) Rect->Ystart = Ystart;
+    if(Xend > Rect->Xend) Rect->Xend = Xend;
+    if(Yend > Rect->Yend) Rect->Yend = Yend;
+}
+
+static void Widget_Box(WIDGET *Widget, UBYTE Type, UWORD X, UWORD Y, UWORD Width, UWORD Height,
+                       UWORD Color, UWORD Background)
+{
+    memset(Widget, 0, sizeof(WIDGET));
+    Widget->Type = Type;
+    Widget->Visible = 1;
+    Widget->Box.Xstart = X;
+    Widget->Box.Ystart = Y;
+    Widget->Box.Xend = X + Width;
+    Widget->Box.Yend = Y + Height;
+    Widget->Color = Color;
+    Widget->Background = Background;
+}
+
+/******************************************************************************
+function: Text line of Chars cells; starts blank
+******************************************************************************/
+void Widget_Label(WIDGET *Widget, UWORD X, UWORD Y, UBYTE Chars, sFONT *Font,
+                  UWORD Color, UWORD Background)
+{
+    if(Chars > WIDGET_CHARS)
+        Chars = WIDGET_CHARS;
+    Widget_Box(Widget, WIDGET_LABEL, X, Y, Chars * Font->Width, Font->Height, Color, Background);
+    Widget->Text.Font = Font;
+    Widget->Text.Chars = Chars;
+    memset(Widget->Text.Text, ' ', Chars);
+}
+
+/******************************************************************************
+function: Right-aligned fixed-point number, see Widget_SetValue()
+******************************************************************************/
+void Widget_Readout(WIDGET *Widget, UWORD X, UWORD Y, UBYTE Chars, UBYTE Decimals, sFONT *Font,
+                    UWORD Color, UWORD Background)
+{
+    Widget_Label(Widget, X, Y, Chars, Font, Color, Background);
+    Widget->Type = WIDGET_READOUT;
+    Widget->Text.Decimals = Decimals;
+}
+
+/******************************************************************************
+function: Horizontal bar filled from the left; starts at Min
+******************************************************************************/
+void Widget_Bar(WIDGET *Widget, UWORD X, UWORD Y, UWORD Width, UWORD Height,
+                int32_t Min, int32_t Max, UWORD Color, UWORD Background)
+{
+    Widget_Box(Widget, WIDGET_BAR, X, Y, Width, Height, Color, Background);
+    Widget->Bar.Min = Min;
+    Widget->Bar.Max = Max > Min ? Max : Min + 1;
+}
+
+/******************************************************************************
+function: Gauge set up and laid out with GFX_Gauge_Init/GFX_Gauge_Layout
+Info:
+    The box is the square Paint_DrawGauge() covers. Background is only
+    used while the widget is hidden.
+******************************************************************************/
+void Widget_Gauge(WIDGET *Widget, GFX_Gauge *Gauge, UWORD Background)
+{
+    int32_t R = Gauge->radius + 1;
+    int32_t Xstart = Gauge->cx - R, Ystart = Gauge->cy - R;
+
+    if(Xstart < 0) Xstart = 0;
+    if(Ystart < 0) Ystart = 0;
+    Widget_Box(Widget, WIDGET_GAUGE, Xstart, Ystart, Gauge->cx + R + 1 - Xstart,
+               Gauge->cy + R + 1 - Ystart, Gauge->needle_color, Background);
+    Widget->Gauge.Gauge = Gauge;
+    Widget->Gauge.Value = Gauge->value;
+}
+
+/******************************************************************************
+function: Width x Height RGB565 image (CPU byte order, rows packed)
+******************************************************************************/
+void Widget_Icon(WIDGET *Widget, UWORD X, UWORD Y, const UWORD *Image, UWORD Width, UWORD Height,
+                 UWORD Background)
+{
+    Widget_Box(Widget, WIDGET_ICON, X, Y, Width, Height, Background, Background);
+    Widget->Icon.Image = Image;
+}
+
+/******************************************************************************
+function: Strip chart sweeping left to right
+parameter:
+    Level : Width bytes owned by the caller, one trace row per column
+Info:
+    Each sample overwrites the oldest column; the column after the
+    newest is left blank so the sweep position is visible.
+******************************************************************************/
+void Widget_Chart(WIDGET *Widget, UWORD X, UWORD Y, UWORD Width, UWORD Height, UBYTE *Level,
+                  int32_t Min, int32_t Max, UWORD Color, UWORD Background)
+{
+    if(Height > 256)
+        Height = 256;
+    Widget_Box(Widget, WIDGET_CHART, X, Y, Width, Height, Color, Background);
+    Widget->Chart.Level = Level;
+    Widget->Chart.Min = Min;
+    Widget->Chart.Max = Max > Min ? Max : Min + 1;
+    memset(Level, 0, Width);
+}
+
+/******************************************************************************
+function: Add a rectangle (canvas coordinates, end exclusive) to the
+          part repainted on the next update; clipped to the box
+******************************************************************************/
+void Widget_Invalidate(WIDGET *Widget, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if(Xstart < Widget->Box.Xstart) Xstart = Widget->Box.Xstart;
+    if(Ystart < Widget->Box.Ystart) Ystart = Widget->Box.Ystart;
+    if(Xend > Widget->Box.Xend) Xend = Widget->Box.Xend;
+    if(Yend > Widget->Box.Yend) Yend = Widget->Box.Yend;
+    Rect_Union(&Widget->Dirty, Xstart, Ystart, Xend, Yend);
+}
+
+static void Widget_InvalidateAll(WIDGET *Widget)
+{
+    Widget_Invalidate(Widget, Widget->Box.Xstart, Widget->Box.Ystart,
+                      Widget->Box.Xend, Widget->Box.Yend);
+}
+
+/******************************************************************************
+function: Replace the cells of a label or readout, invalidating those
+          that differ
+Info:
+    Labels are left aligned, readouts right aligned; both are padded with
+    spaces and cut to the cell count. Non-printable characters show as
+    spaces.
+******************************************************************************/
+void Widget_SetText(WIDGET *Widget, const char *Text)
+{
+    char Cells[WIDGET_CHARS];
+    UBYTE Chars = Widget->Text.Chars, Len = strlen(Text) > Chars ? Chars : strlen(Text);
+    UBYTE Pad = Widget->Type == WIDGET_READOUT ? Chars - Len : 0;
+    UWORD Width;
+
+    if(Widget->Type != WIDGET_LABEL && Widget->Type != WIDGET_READOUT)
+        return;
+    memset(Cells, ' ', Chars);
+    for(UBYTE i = 0; i < Len; i++)
+        Cells[Pad + i] = (Text[i] >= ' ' && Text[i] <= '~') ? Text[i] : ' ';
+
+    Width = Widget->Text.Font->Width;
+    for(UBYTE i = 0; i < Chars; i++) {
+        if(Cells[i] == Widget->Text.Text[i])
+            continue;
+        Widget->Text.Text[i] = Cells[i];
+        Widget_Invalidate(Widget, Widget->Box.Xstart + i * Width, Widget->Box.Ystart,
+                          Widget->Box.Xstart + (i + 1) * Width, Widget->Box.Yend);
+    }
+}
+
+static UWORD Bar_Fill(const WIDGET *Widget, int32_t Value)
+{
+    int32_t Width = Widget->Box.Xend - Widget->Box.Xstart;
+
+    if(Value <= Widget->Bar.Min)
+        return 0;
+    if(Value >= Widget->Bar.Max)
+        return Width;
+    return (int64_t)(Value - Widget->Bar.Min) * Width / (Widget->Bar.Max - Widget->Bar.Min);
+}
+
+static UBYTE Chart_Level(const WIDGET *Widget, int32_t Value)
+{
+    int32_t Top = Widget->Box.Yend - Widget->Box.Ystart - 1;
+
+    if(Value <= Widget->Chart.Min)
+        return 0;
+    if(Value >= Widget->Chart.Max)
+        return Top;
+    return ((int64_t)(Value - Widget->Chart.Min) * Top * 2 + (Widget->Chart.Max - Widget->Chart.Min))
+           / (2 * (Widget->Chart.Max - Widget->Chart.Min));
+}
+
+/******************************************************************************
+function: Set the value of a readout, bar, gauge or chart
+Info:
+    Readout: formatted with Decimals (123, 1 -> "12.3"); only the cells
+        that differ are invalidated.
+    Bar: only the columns between the old and the new end.
+    Gauge: applied on the next update, which repaints the spans of the
+        old and new needle.
+    Chart: appends a sample; the new column and the blank after it.
+******************************************************************************/
+void Widget_SetValue(WIDGET *Widget, int32_t Value)
+{
+    char Buf[16];
+
+    switch(Widget->Type) {
+    case WIDGET_READOUT:
+        GFX_FormatFixed(Buf, Value, Widget->Text.Decimals);
+        Widget_SetText(Widget, Buf);
+        break;
+    case WIDGET_BAR: {
+        UWORD Fill = Bar_Fill(Widget, Value), Old = Widget->Bar.Fill;
+        if(Fill == Old)
+            break;
+        Widget->Bar.Fill = Fill;
+        Widget_Invalidate(Widget, Widget->Box.Xstart + (Fill < Old ? Fill : Old), Widget->Box.Ystart,
+                          Widget->Box.Xstart + (Fill > Old ? Fill : Old), Widget->Box.Yend);
+        break;
+    }
+    case WIDGET_GAUGE: {
+        const GFX_Gauge *Gauge = Widget->Gauge.Gauge;
+        if(Value < Gauge->min) Value = Gauge->min;
+        if(Value > Gauge->max) Value = Gauge->max;
+        Widget->Gauge.Value = Value;
+        break;
+    }
+    case WIDGET_CHART: {
+        UWORD Width = Widget->Box.Xend - Widget->Box.Xstart, Col = Widget->Chart.Cursor;
+        Widget->Chart.Level[Col] = Chart_Level(Widget, Value);
+        Widget->Chart.Cursor = Col + 1 < Width ? Col + 1 : 0;
+        // The blank wraps to column 0 once per sweep: the rectangle then spans the box
+        Widget_Invalidate(Widget, Widget->Box.Xstart + Col, Widget->Box.Ystart,
+                          Widget->Box.Xstart + Col + 1, Widget->Box.Yend);
+        Widget_Invalidate(Widget, Widget->Box.Xstart + Widget->Chart.Cursor, Widget->Box.Ystart,
+                          Widget->Box.Xstart + Widget->Chart.Cursor + 1, Widget->Box.Yend);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function: Replace an icon's image (same size); the whole box repaints
+******************************************************************************/
+void Widget_SetImage(WIDGET *Widget, const UWORD *Image)
+{
+    if(Widget->Type != WIDGET_ICON || Widget->Icon.Image == Image)
+        return;
+    Widget->Icon.Image = Image;
+    Widget_InvalidateAll(Widget);
+}
+
+/******************************************************************************
+function: Show Background instead of icon pixels equal to Key
+******************************************************************************/
+void Widget_SetColorKey(WIDGET *Widget, UWORD Key)
+{
+    if(Widget->Type != WIDGET_ICON)
+        return;
+    Widget->Icon.Key = Key;
+    Widget->Icon.Keyed = 1;
+    Widget_InvalidateAll(Widget);
+}
+
+/******************************************************************************
+function: Change the foreground and background colours
+Info:
+    Gauges take their colours from the GFX_Gauge; after changing those,
+    call Widget_Invalidate() on the box.
+******************************************************************************/
+void Widget_SetColor(WIDGET *Widget, UWORD Color, UWORD Background)
+{
+    if(Widget->Color == Color && Widget->Background == Background)
+        return;
+    Widget->Color = Color;
+    Widget->Background = Background;
+    Widget_InvalidateAll(Widget);
+}
+
+/******************************************************************************
+function: Show or hide a widget; a hidden one paints its box in Background
+******************************************************************************/
+void Widget_SetVisible(WIDGET *Widget, UBYTE Visible)
+{
+    Visible = Visible ? 1 : 0;
+    if(Widget->Visible == Visible)
+        return;
+    Widget->Visible = Visible;
+    Widget_InvalidateAll(Widget);
+}
+
+/******************************************************************************
+function: Paint rectangle Rect (clipped to the canvas) of a widget
+******************************************************************************/
+static void Widget_Fill(const WIDGET_RECT *Rect, UWORD Color)
+{
+    UWORD Swapped = (Color << 8) | (Color >> 8);
+
+    for(UWORD Y = Rect->Ystart; Y < Rect->Yend; Y++) {
+        UWORD *Row = Paint.Image + Y * Paint.WidthByte;
+        for(UWORD X = Rect->Xstart; X < Rect->Xend; X++)
+            Row[X] = Swapped;
+    }
+}
+
+static void Widget_RenderText(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    sFONT *Font = Widget->Text.Font;
+    UWORD First = (Rect->Xstart - Widget->Box.Xstart) / Font->Width;
+    UWORD Last = (Rect->Xend - Widget->Box.Xstart + Font->Width - 1) / Font->Width;
+
+    // The font may leave its background transparent (FONT_BACKGROUND)
+    Widget_Fill(Rect, Widget->Background);
+    for(UWORD i = First; i < Last && i < Widget->Text.Chars; i++) {
+        if(Widget->Text.Text[i] != ' ')
+            Paint_DrawChar(Widget->Box.Xstart + i * Font->Width, Widget->Box.Ystart,
+                           Widget->Text.Text[i], Font, Widget->Color, Widget->Background);
+    }
+}
+
+static void Widget_RenderBar(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    WIDGET_RECT Part = *Rect;
+    UWORD Edge = Widget->Box.Xstart + Widget->Bar.Fill;
+
+    if(Part.Xstart < Edge) {
+        Part.Xend = Rect->Xend < Edge ? Rect->Xend : Edge;
+        Widget_Fill(&Part, Widget->Color);
+        Part.Xstart = Part.Xend;
+    }
+    Part.Xend = Rect->Xend;
+    if(Part.Xstart < Part.Xend)
+        Widget_Fill(&Part, Widget->Background);
+}
+
+static void Widget_RenderGauge(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    for(UWORD Y = Rect->Ystart; Y < Rect->Yend; Y++)
+        GFX_Gauge_RenderRow(Widget->Gauge.Gauge, Y, Rect->Xstart, Rect->Xend - Rect->Xstart,
+                            Paint.Image + Y * Paint.WidthByte + Rect->Xstart, GFX_ORDER_SWAPPED);
+}
+
+static void Widget_RenderIcon(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    UWORD Width = Widget->Box.Xend - Widget->Box.Xstart;
+    UWORD Background = (Widget->Background << 8) | (Widget->Background >> 8);
+
+    for(UWORD Y = Rect->Ystart; Y < Rect->Yend; Y++) {
+        const UWORD *Src = Widget->Icon.Image + (Y - Widget->Box.Ystart) * Width - Widget->Box.Xstart;
+        UWORD *Row = Paint.Image + Y * Paint.WidthByte;
+        for(UWORD X = Rect->Xstart; X < Rect->Xend; X++) {
+            UWORD Color = Src[X];
+            Row[X] = (Widget->Icon.Keyed && Color == Widget->Icon.Key) ? Background
+                     : (UWORD)((Color << 8) | (Color >> 8));
+        }
+    }
+}
+
+/******************************************************************************
+function: Chart columns: a vertical run from the previous column's row to
+          this one's, so the trace stays connected; the cursor column is
+          blank. A sample only changes its own column and the next one.
+******************************************************************************/
+static void Widget_RenderChart(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    UWORD Bottom = Widget->Box.Yend - 1;
+    UWORD Color = (Widget->Color << 8) | (Widget->Color >> 8);
+
+    Widget_Fill(Rect, Widget->Background);
+    for(UWORD X = Rect->Xstart; X < Rect->Xend; X++) {
+        UWORD Col = X - Widget->Box.Xstart;
+        if(Col == Widget->Chart.Cursor)
+            continue;
+        UBYTE Lo = Widget->Chart.Level[Col], Hi = Lo;
+        if(Col > 0) {
+            UBYTE Prev = Widget->Chart.Level[Col - 1];
+            if(Prev < Lo) Lo = Prev + 1;
+            if(Prev > Hi) Hi = Prev - 1;
+        }
+        for(UWORD Level = Lo; Level <= Hi; Level++) {
+            UWORD Y = Bottom - Level;
+            if(Y >= Rect->Ystart && Y < Rect->Yend)
+                Paint.Image[Y * Paint.WidthByte + X] = Color;
+        }
+    }
+}
+
+static void Widget_Render(const WIDGET *Widget, const WIDGET_RECT *Rect)
+{
+    if(!Widget->Visible) {
+        Widget_Fill(Rect, Widget->Background);
+        return;
+    }
+    switch(Widget->Type) {
+    case WIDGET_LABEL:
+    case WIDGET_READOUT:
+        Widget_RenderText(Widget, Rect);
+        break;
+    case WIDGET_BAR:
+        Widget_RenderBar(Widget, Rect);
+        break;
+    case WIDGET_GAUGE:
+        Widget_RenderGauge(Widget, Rect);
+        break;
+    case WIDGET_ICON:
+        Widget_RenderIcon(Widget, Rect);
+        break;
+    case WIDGET_CHART:
+        Widget_RenderChart(Widget, Rect);
+        break;
+    default:
+        break;
+    }
+}
+
+static void Needle_Emit(int16_t Y, int16_t Xstart, int16_t Xend, void *Ctx)
+{
+    WIDGET_NEEDLE *Needle = (WIDGET_NEEDLE *)Ctx;
+
+    if(Y >= Paint.Height)
+        return;
+    if(Xend > Paint.Width)
+        Xend = Paint.Width;
+    if(Xstart >= Xend)
+        return;
+    GFX_Gauge_RenderRow(Needle->Gauge, Y, Xstart, Xend - Xstart,
+                        Paint.Image + Y * Paint.WidthByte + Xstart, GFX_ORDER_SWAPPED);
+    Rect_Union(&Needle->Moved, Xstart, Y, Xend, Y + 1);
+}
+
+/******************************************************************************
+function: Start with no widgets
+parameter:
+    Flush : Pushes a window to the panel; may be NULL (render only)
+******************************************************************************/
+void WidgetList_Init(WIDGET_LIST *List, WIDGET_FLUSH Flush)
+{
+    List->Count = 0;
+    List->Flush = Flush;
+}
+
+/******************************************************************************
+function: Add a widget; it is painted whole on the next update
+return:
+    0 when the list is full
+******************************************************************************/
+UBYTE WidgetList_Add(WIDGET_LIST *List, WIDGET *Widget)
+{
+    if(List->Count >= WIDGET_MAX) {
+        DEBUG("WidgetList_Add: list full\r\n");
+        return 0;
+    }
+    List->Widget[List->Count++] = Widget;
+    Widget_InvalidateAll(Widget);
+    return 1;
+}
+
+/******************************************************************************
+function: Repaint every widget whole on the next update
+******************************************************************************/
+void WidgetList_Invalidate(WIDGET_LIST *List)
+{
+    for(UBYTE i = 0; i < List->Count; i++)
+        Widget_InvalidateAll(List->Widget[i]);
+}
+
+/******************************************************************************
+function: Frame pass: repaint what the setters invalidated, one window
+          per changed widget
+return:
+    Number of pixels pushed
+Info:
+    Widgets nothing happened to cost one comparison.
+******************************************************************************/
+UDOUBLE WidgetList_Update(WIDGET_LIST *List)
+{
+    UDOUBLE Pixels = 0;
+
+    if(!Widget_CanvasOk())
+        return 0;
+    for(UBYTE i = 0; i < List->Count; i++) {
+        WIDGET *Widget = List->Widget[i];
+        WIDGET_RECT Push = Widget->Dirty;
+
+        if(Widget->Type == WIDGET_GAUGE && Widget->Gauge.Value != Widget->Gauge.Gauge->value) {
+            WIDGET_NEEDLE Needle = {Widget->Gauge.Gauge, {0, 0, 0, 0}};
+            // Moves the needle even while hidden; only visible spans are painted
+            GFX_Gauge_SetValue(Widget->Gauge.Gauge, Widget->Gauge.Value,
+                               Widget->Visible ? Needle_Emit : NULL, &Needle);
+            Rect_Union(&Push, Needle.Moved.Xstart, Needle.Moved.Ystart,
+                       Needle.Moved.Xend, Needle.Moved.Yend);
+        }
+        if(Push.Xstart >= Push.Xend)
+            continue;
+
+        if(Widget->Dirty.Xend > Paint.Width) Widget->Dirty.Xend = Paint.Width;
+        if(Widget->Dirty.Yend > Paint.Height) Widget->Dirty.Yend = Paint.Height;
+        if(Widget->Dirty.Xstart < Widget->Dirty.Xend && Widget->Dirty.Ystart < Widget->Dirty.Yend)
+            Widget_Render(Widget, &Widget->Dirty);
+        Widget->Dirty.Xstart = Widget->Dirty.Xend = 0;
+
+        if(Push.Xend > Paint.Width) Push.Xend = Paint.Width;
+        if(Push.Yend > Paint.Height) Push.Yend = Paint.Height;
+        if(Push.Xstart >= Push.Xend || Push.Ystart >= Push.Yend)
+            continue;
+        if(List->Flush)
+            List->Flush(Push.Xstart, Push.Ystart, Push.Xend, Push.Yend, Paint.Image);
+        Pixels += (UDOUBLE)(Push.Xend - Push.Xstart) * (Push.Yend - Push.Ystart);
+    }
+    return Pixels;
+}
@@ -0,0 +1,122 @@
+/*****************************************************************************
+* | File      	:   GUI_Widget.h
+* | Function    :   Retained widgets redrawn only where they change
+* | Info        :
+*   Label, readout, bar, gauge, icon and chart widgets, each owning an
+*   opaque box on the Paint canvas. Setters store the new property and
+*   invalidate only the part of the box it changes: the character cells
+*   that differ, the strip between the old and new bar end, the spans of
+*   the old and new needle, the chart columns around the new sample.
+*   WidgetList_Update() repaints those parts into the canvas and pushes
+*   each widget's rectangle through the flush callback (e.g.
+*   LCD_1IN28_DisplayWindows).
+*
+*   Boxes must not overlap. The canvas is the current Paint image; it
+*   must be 16-bit with ROTATE_0 and MIRROR_NONE.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __GUI_WIDGET_H
+#define __GUI_WIDGET_H
+
+#include "GUI_Paint.h"
+#include "gfx_gauge.h"
+
+#define WIDGET_MAX      32
+#define WIDGET_CHARS    24      // Label and readout length
+
+/**
+ * Window push, end exclusive; Image is the whole canvas
+**/
+typedef void (*WIDGET_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+
+typedef enum {
+    WIDGET_LABEL = 0,
+    WIDGET_READOUT,
+    WIDGET_BAR,
+    WIDGET_GAUGE,
+    WIDGET_ICON,
+    WIDGET_CHART,
+} WIDGET_TYPE;
+
+/**
+ * Rectangle, end exclusive; empty when Xstart >= Xend
+**/
+typedef struct {
+    UWORD Xstart, Ystart;
+    UWORD Xend, Yend;
+} WIDGET_RECT;
+
+typedef struct {
+    UBYTE Type;
+    UBYTE Visible;
+    WIDGET_RECT Box;            // Canvas area the widget paints, all of it
+    WIDGET_RECT Dirty;          // Part of Box to repaint on the next update
+    UWORD Color;                // Text, bar, trace
+    UWORD Background;
+    union {
+        struct {                // Label, readout
+            sFONT *Font;
+            UBYTE Chars;
+            UBYTE Decimals;     // Readout
+            char Text[WIDGET_CHARS + 1];
+        } Text;
+        struct {                // Bar
+            int32_t Min, Max;
+            UWORD Fill;         // Columns filled
+        } Bar;
+        struct {                // Gauge
+            GFX_Gauge *Gauge;
+            int16_t Value;      // Applied on the next update
+        } Gauge;
+        struct {                // Icon, RGB565 in CPU byte order
+            const UWORD *Image;
+            UWORD Key;
+            UBYTE Keyed;
+        } Icon;
+        struct {                // Chart, sweeping left to right
+            UBYTE *Level;       // Box width entries, 0 = bottom row
+            int32_t Min, Max;
+            UWORD Cursor;       // Column of the next sample, shown as a gap
+        } Chart;
+    };
+} WIDGET;
+
+typedef struct {
+    WIDGET *Widget[WIDGET_MAX];
+    UBYTE Count;
+    WIDGET_FLUSH Flush;
+} WIDGET_LIST;
+
+//Widgets
+void Widget_Label(WIDGET *Widget, UWORD X, UWORD Y, UBYTE Chars, sFONT *Font,
+                  UWORD Color, UWORD Background);
+void Widget_Readout(WIDGET *Widget, UWORD X, UWORD Y, UBYTE Chars, UBYTE Decimals, sFONT *Font,
+                    UWORD Color, UWORD Background);
+void Widget_Bar(WIDGET *Widget, UWORD X, UWORD Y, UWORD Width, UWORD Height,
+                int32_t Min, int32_t Max, UWORD Color, UWORD Background);
+void Widget_Gauge(WIDGET *Widget, GFX_Gauge *Gauge, UWORD Background);
+void Widget_Icon(WIDGET *Widget, UWORD X, UWORD Y, const UWORD *Image, UWORD Width, UWORD Height,
+                 UWORD Background);
+void Widget_Chart(WIDGET *Widget, UWORD X, UWORD Y, UWORD Width, UWORD Height, UBYTE *Level,
+                  int32_t Min, int32_t Max, UWORD Color, UWORD Background);
+
+//Properties
+void Widget_SetText(WIDGET *Widget, const char *Text);
+void Widget_SetValue(WIDGET *Widget, int32_t Value);
+void Widget_SetImage(WIDGET *Widget, const UWORD *Image);
+void Widget_SetColorKey(WIDGET *Widget, UWORD Key);
+void Widget_SetColor(WIDGET *Widget, UWORD Color, UWORD Background);
+void Widget_SetVisible(WIDGET *Widget, UBYTE Visible);
+void Widget_Invalidate(WIDGET *Widget, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+//List
+void WidgetList_Init(WIDGET_LIST *List, WIDGET_FLUSH Flush);
+UBYTE WidgetList_Add(WIDGET_LIST *List, WIDGET *Widget);
+void WidgetList_Invalidate(WIDGET_LIST *List);
+UDOUBLE WidgetList_Update(WIDGET_LIST *List);
+
+#endif
@@ -167,10 +167,14 @@ static void LCD_1IN14_SetAttributes(UBYTE Scan_dir)
     if(Scan_dir == HORIZONTAL) {
         LCD_1IN14.HEIGHT	= LCD_1IN14_WIDTH;
         LCD_1IN14.WIDTH   = LCD_1IN14_HEIGHT;
+        LCD_1IN14.X_OFFSET = 40;
+        LCD_1IN14.Y_OFFSET = 53;
         MemoryAccessReg = 0X70;
     } else {
         LCD_1IN14.HEIGHT	= LCD_1IN14_HEIGHT;       
         LCD_1IN14.WIDTH   = LCD_1IN14_WIDTH;
+        LCD_1IN14.X_OFFSET = 52;
+        LCD_1IN14.Y_OFFSET = 40;
         MemoryAccessReg = 0X00;
     }
 
@@ -179,6 +183,32 @@ static void LCD_1IN14_SetAttributes(UBYTE Scan_dir)
     LCD_1IN14_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
 }
 
+/******************************************************************************
+function :	Rotate and mirror in the controller, see LCD_Orient.h
+parameter:
+	Rotate :   0, 90, 180 or 270, clockwise
+	Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_1IN14_Init(). Draw on a canvas of LCD_1IN14.WIDTH x
+	LCD_1IN14.HEIGHT with ROTATE_0 and MIRROR_NONE, then redraw.
+******************************************************************************/
+UBYTE LCD_1IN14_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+    LCD_ORIENT Orient;
+
+    if(!LCD_Orient_Get(&LCD_PANEL_1IN14, Rotate, Mirror, &Orient))
+        return 0;
+    LCD_1IN14.WIDTH = Orient.Width;
+    LCD_1IN14.HEIGHT = Orient.Height;
+    LCD_1IN14.X_OFFSET = Orient.X_Offset;
+    LCD_1IN14.Y_OFFSET = Orient.Y_Offset;
+    LCD_1IN14.SCAN_DIR = Orient.Width > Orient.Height ? HORIZONTAL : VERTICAL;
+
+    LCD_1IN14_SendCommand(0x36);
+    LCD_1IN14_SendData_8Bit(Orient.Madctl);
+    return 1;
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
@@ -208,9 +238,7 @@ parameter:
 ********************************************************************************/
 void LCD_1IN14_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    UBYTE x,y;
-    if(LCD_1IN14.SCAN_DIR == HORIZONTAL){x=40;y=53;}
-    else{ x=52; y=40; }
+    UWORD x = LCD_1IN14.X_OFFSET, y = LCD_1IN14.Y_OFFSET;
     //set the X coordinates
     LCD_1IN14_SendCommand(0x2A);
     
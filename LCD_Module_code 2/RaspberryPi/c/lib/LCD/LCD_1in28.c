@@ -345,6 +345,30 @@ static void LCD_1IN28_SetAttributes(UBYTE Scan_dir)
 	LCD_1IN28_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
 }
 
+/******************************************************************************
+function :	Rotate and mirror in the controller, see LCD_Orient.h
+parameter:
+	Rotate :   0, 90, 180 or 270, clockwise
+	Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_1IN28_Init(): LCD_1IN28_InitReg() sets MADCTL back to
+	0x08 whatever Scan_dir was. Draw on a ROTATE_0, MIRROR_NONE canvas
+	and redraw afterwards.
+******************************************************************************/
+UBYTE LCD_1IN28_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+    LCD_ORIENT Orient;
+
+    if(!LCD_Orient_Get(&LCD_PANEL_1IN28, Rotate, Mirror, &Orient))
+        return 0;
+    LCD_1IN28.WIDTH = Orient.Width;
+    LCD_1IN28.HEIGHT = Orient.Height;
+
+    LCD_1IN28_SendCommand(0x36);
+    LCD_1IN28_SendData_8Bit(Orient.Madctl);
+    return 1;
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
@@ -434,13 +458,43 @@ void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend
     UWORD j;
     LCD_1IN28_SetWindows(Xstart, Ystart, Xend , Yend);
     LCD_1IN28_DC_1;
-    for (j = Ystart; j < Yend - 1; j++) {
+    for (j = Ystart; j < Yend; j++) {
         Addr = Xstart + j * LCD_1IN28_WIDTH ;
         DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
     }
 }
 
 
+/******************************************************************************
+function :	Send a window whose rows are produced on the fly
+parameter:
+	Xend, Yend :   Exclusive
+	Row        :   Fills one row at a time (e.g. Paint_PaletteRow)
+info:
+	Only one row of RGB565 exists at a time, so the canvas behind it can
+	be in any format (see GUI_Palette.h).
+******************************************************************************/
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           LCD_1IN28_ROW_FUNC Row, void *Ctx)
+{
+    UWORD Line[LCD_1IN28_WIDTH];
+    UWORD j;
+
+    if(Xend > LCD_1IN28.WIDTH)
+        Xend = LCD_1IN28.WIDTH;
+    if(Yend > LCD_1IN28.HEIGHT)
+        Yend = LCD_1IN28.HEIGHT;
+    if(Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    LCD_1IN28_SetWindows(Xstart, Ystart, Xend, Yend);
+    LCD_1IN28_DC_1;
+    for(j = Ystart; j < Yend; j++) {
+        Row(j, Xstart, Xend - Xstart, Line, Ctx);
+        DEV_SPI_Write_nByte((uint8_t *)Line, (Xend - Xstart) * 2);
+    }
+}
+
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
     LCD_1IN28_SetWindows(X,Y,X,Y);
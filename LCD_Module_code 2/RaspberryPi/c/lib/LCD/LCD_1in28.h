@@ -15,6 +15,7 @@
 #define __LCD_1IN28_H	
 	
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 #include <stdint.h>
 
 #include <stdlib.h>		//itoa()
@@ -49,14 +50,23 @@ typedef struct{
 }LCD_1IN28_ATTRIBUTES;
 extern LCD_1IN28_ATTRIBUTES LCD_1IN28;
 
+/**
+ * Row producer for LCD_1IN28_DisplayRows(): fill Line[0..Width-1] with
+ * byte-swapped RGB565 (canvas order) for columns Xstart.. of row Y
+**/
+typedef void (*LCD_1IN28_ROW_FUNC)(UWORD Y, UWORD Xstart, UWORD Width, UWORD *Line, void *Ctx);
+
 /********************************************************************************
 function:	
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN28_Init(UBYTE Scan_dir);
+UBYTE LCD_1IN28_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_1IN28_Clear(UWORD Color);
 void LCD_1IN28_Display(UWORD *Image);
 void LCD_1IN28_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+void LCD_1IN28_DisplayRows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           LCD_1IN28_ROW_FUNC Row, void *Ctx);
 void LCD_1IN28_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 void Handler_1IN28_LCD(int signo);
 #endif
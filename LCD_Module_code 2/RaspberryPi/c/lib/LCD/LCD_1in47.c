@@ -171,16 +171,21 @@ static void LCD_1IN47_SetAttributes(UBYTE Scan_dir)
 	UBYTE MemoryAccessReg = 0x00;
 
 	// Get GRAM and LCD width and height
+	// HORIZONTAL is the portrait one on this panel
 	if (Scan_dir == HORIZONTAL)
 	{
-		LCD_1IN47.HEIGHT = LCD_1IN47_WIDTH;
-		LCD_1IN47.WIDTH = LCD_1IN47_HEIGHT;
+		LCD_1IN47.HEIGHT = LCD_1IN47_HEIGHT;
+		LCD_1IN47.WIDTH = LCD_1IN47_WIDTH;
+		LCD_1IN47.X_OFFSET = 0x22;
+		LCD_1IN47.Y_OFFSET = 0;
 		MemoryAccessReg = 0X00;
 	}
 	else
 	{
-		LCD_1IN47.HEIGHT = LCD_1IN47_HEIGHT;
-		LCD_1IN47.WIDTH = LCD_1IN47_WIDTH;		
+		LCD_1IN47.HEIGHT = LCD_1IN47_WIDTH;
+		LCD_1IN47.WIDTH = LCD_1IN47_HEIGHT;
+		LCD_1IN47.X_OFFSET = 0;
+		LCD_1IN47.Y_OFFSET = 0x22;
 		MemoryAccessReg = 0X70;
 	}
 
@@ -190,6 +195,32 @@ static void LCD_1IN47_SetAttributes(UBYTE Scan_dir)
 	LCD_1IN47_SendData_8Bit(MemoryAccessReg); // 0x08 set RGB
 }
 
+/******************************************************************************
+function :	Rotate and mirror in the controller, see LCD_Orient.h
+parameter:
+	Rotate :   0, 90, 180 or 270, clockwise
+	Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_1IN47_Init(). Draw on a canvas of LCD_1IN47.WIDTH x
+	LCD_1IN47.HEIGHT with ROTATE_0 and MIRROR_NONE, then redraw.
+******************************************************************************/
+UBYTE LCD_1IN47_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+	LCD_ORIENT Orient;
+
+	if (!LCD_Orient_Get(&LCD_PANEL_1IN47, Rotate, Mirror, &Orient))
+		return 0;
+	LCD_1IN47.WIDTH = Orient.Width;
+	LCD_1IN47.HEIGHT = Orient.Height;
+	LCD_1IN47.X_OFFSET = Orient.X_Offset;
+	LCD_1IN47.Y_OFFSET = Orient.Y_Offset;
+	LCD_1IN47.SCAN_DIR = (Orient.Madctl & LCD_MADCTL_MV) ? VERTICAL : HORIZONTAL;
+
+	LCD_1IN47_SendCommand(0x36);
+	LCD_1IN47_SendData_8Bit(Orient.Madctl);
+	return 1;
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
@@ -216,39 +247,21 @@ parameter:
 ********************************************************************************/
 void LCD_1IN47_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-	if (LCD_1IN47.SCAN_DIR == HORIZONTAL)
-	{ 
-		
-		// set the X coordinates
-		LCD_1IN47_SendCommand(0x2A);
-		LCD_1IN47_SendData_8Bit(0x00);
-		LCD_1IN47_SendData_8Bit(Xstart + 0x22);
-		LCD_1IN47_SendData_8Bit(((Xend + 0x22) - 1) >> 8);
-		LCD_1IN47_SendData_8Bit((Xend + 0x22) - 1);
-
-		// set the Y coordinates
-		LCD_1IN47_SendCommand(0x2B);
-		LCD_1IN47_SendData_8Bit(0x00);
-		LCD_1IN47_SendData_8Bit(Ystart);
-		LCD_1IN47_SendData_8Bit((Yend - 1) >> 8);
-		LCD_1IN47_SendData_8Bit(Yend - 1);
-	}
-	else
-	{ 
-		// set the X coordinates
-		LCD_1IN47_SendCommand(0x2A);
-		LCD_1IN47_SendData_8Bit(Xstart >> 8);
-		LCD_1IN47_SendData_8Bit(Xstart);
-		LCD_1IN47_SendData_8Bit((Xend - 1) >> 8);
-		LCD_1IN47_SendData_8Bit(Xend - 1);
-
-		// set the Y coordinates
-		LCD_1IN47_SendCommand(0x2B);
-		LCD_1IN47_SendData_8Bit(Ystart >> 8);
-		LCD_1IN47_SendData_8Bit(Ystart + 0x22);
-		LCD_1IN47_SendData_8Bit((Yend - 1 + 0x22) >> 8);
-		LCD_1IN47_SendData_8Bit(Yend - 1 + 0x22);
-	}
+	UWORD x = LCD_1IN47.X_OFFSET, y = LCD_1IN47.Y_OFFSET;
+
+	// set the X coordinates
+	LCD_1IN47_SendCommand(0x2A);
+	LCD_1IN47_SendData_8Bit((Xstart + x) >> 8);
+	LCD_1IN47_SendData_8Bit(Xstart + x);
+	LCD_1IN47_SendData_8Bit((Xend - 1 + x) >> 8);
+	LCD_1IN47_SendData_8Bit(Xend - 1 + x);
+
+	// set the Y coordinates
+	LCD_1IN47_SendCommand(0x2B);
+	LCD_1IN47_SendData_8Bit((Ystart + y) >> 8);
+	LCD_1IN47_SendData_8Bit(Ystart + y);
+	LCD_1IN47_SendData_8Bit((Yend - 1 + y) >> 8);
+	LCD_1IN47_SendData_8Bit(Yend - 1 + y);
 
 	LCD_1IN47_SendCommand(0X2C);
 }
@@ -269,11 +282,11 @@ void LCD_1IN47_Clear(UWORD Color)
 		Image[j] = Color;
 	}
 
-	LCD_1IN47_SetWindows(0, 0, LCD_1IN47.HEIGHT, LCD_1IN47.WIDTH);
+	LCD_1IN47_SetWindows(0, 0, LCD_1IN47.WIDTH, LCD_1IN47.HEIGHT);
 	LCD_1IN47_DC_1;
-	for (j = 0; j < LCD_1IN47.WIDTH; j++)
+	for (j = 0; j < LCD_1IN47.HEIGHT; j++)
 	{
-		DEV_SPI_Write_nByte((uint8_t *)&Image[j * LCD_1IN47.HEIGHT], LCD_1IN47.HEIGHT * 2);
+		DEV_SPI_Write_nByte((uint8_t *)&Image[j * LCD_1IN47.WIDTH], LCD_1IN47.WIDTH * 2);
 	}
 }
 
@@ -284,11 +297,11 @@ parameter:
 void LCD_1IN47_Display(UWORD *Image)
 {
 	UWORD j;
-	LCD_1IN47_SetWindows(0, 0, LCD_1IN47.HEIGHT, LCD_1IN47.WIDTH);
+	LCD_1IN47_SetWindows(0, 0, LCD_1IN47.WIDTH, LCD_1IN47.HEIGHT);
 	LCD_1IN47_DC_1;
-	for (j = 0; j < LCD_1IN47.WIDTH; j++)
+	for (j = 0; j < LCD_1IN47.HEIGHT; j++)
 	{
-		DEV_SPI_Write_nByte((uint8_t *)&Image[j * LCD_1IN47.HEIGHT], LCD_1IN47.HEIGHT * 2);
+		DEV_SPI_Write_nByte((uint8_t *)&Image[j * LCD_1IN47.WIDTH], LCD_1IN47.WIDTH * 2);
 	}
 
 }
@@ -302,7 +315,7 @@ void LCD_1IN47_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend
 	LCD_1IN47_DC_1;
 	for (j = Ystart; j < Yend - 1; j++)
 	{
-		Addr = Xstart + j * LCD_1IN47.HEIGHT;
+		Addr = Xstart + j * LCD_1IN47.WIDTH;
 		DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend - Xstart) * 2);
 	}
 }
@@ -15,6 +15,7 @@
 #define __LCD_1IN47_H	
 	
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 #include <stdint.h>
 
 #include <stdlib.h>		//itoa()
@@ -46,6 +47,8 @@ typedef struct{
 	UWORD WIDTH;
 	UWORD HEIGHT;
 	UBYTE SCAN_DIR;
+	UWORD X_OFFSET;     // Window offset in controller memory
+	UWORD Y_OFFSET;
 }LCD_1IN47_ATTRIBUTES;
 extern LCD_1IN47_ATTRIBUTES LCD_1IN47;
 
@@ -54,6 +57,7 @@ function:
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN47_Init(UBYTE Scan_dir);
+UBYTE LCD_1IN47_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_1IN47_Clear(UWORD Color);
 void LCD_1IN47_Display(UWORD *Image);
 void LCD_1IN47_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
@@ -173,12 +173,41 @@ static void LCD_1IN54_SetAttributes(UBYTE Scan_dir)
         LCD_1IN54.WIDTH   = LCD_1IN54_HEIGHT;
         MemoryAccessReg = 0X00;
     }
+    LCD_1IN54.X_OFFSET = 0;
+    LCD_1IN54.Y_OFFSET = 0;
 
     // Set the read / write scan direction of the frame memory
     LCD_1IN54_SendCommand(0x36); //MX, MY, RGB mode
     LCD_1IN54_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
 }
 
+/******************************************************************************
+function :	Rotate and mirror in the controller, see LCD_Orient.h
+parameter:
+	Rotate :   0, 90, 180 or 270, clockwise
+	Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_1IN54_Init(). The glass only covers 240 of the 320
+	memory rows, so 180 and 270 move the window to rows 80-319. Draw on
+	a ROTATE_0, MIRROR_NONE canvas and redraw afterwards.
+******************************************************************************/
+UBYTE LCD_1IN54_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+    LCD_ORIENT Orient;
+
+    if(!LCD_Orient_Get(&LCD_PANEL_1IN54, Rotate, Mirror, &Orient))
+        return 0;
+    LCD_1IN54.WIDTH = Orient.Width;
+    LCD_1IN54.HEIGHT = Orient.Height;
+    LCD_1IN54.X_OFFSET = Orient.X_Offset;
+    LCD_1IN54.Y_OFFSET = Orient.Y_Offset;
+    LCD_1IN54.SCAN_DIR = (Orient.Madctl & LCD_MADCTL_MV) ? HORIZONTAL : VERTICAL;
+
+    LCD_1IN54_SendCommand(0x36);
+    LCD_1IN54_SendData_8Bit(Orient.Madctl);
+    return 1;
+}
+
 /********************************************************************************
 function :	Initialize the lcd
 parameter:
@@ -208,19 +237,20 @@ parameter:
 ********************************************************************************/
 void LCD_1IN54_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
+    UWORD x = LCD_1IN54.X_OFFSET, y = LCD_1IN54.Y_OFFSET;
     //set the X coordinates
     LCD_1IN54_SendCommand(0x2A);
-    LCD_1IN54_SendData_8Bit((Xstart >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit(Xstart & 0xFF);
-    LCD_1IN54_SendData_8Bit(((Xend  - 1) >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit((Xend  - 1) & 0xFF);
+    LCD_1IN54_SendData_8Bit(((Xstart + x) >> 8) & 0xFF);
+    LCD_1IN54_SendData_8Bit((Xstart + x) & 0xFF);
+    LCD_1IN54_SendData_8Bit(((Xend - 1 + x) >> 8) & 0xFF);
+    LCD_1IN54_SendData_8Bit((Xend - 1 + x) & 0xFF);
 
     //set the Y coordinates
     LCD_1IN54_SendCommand(0x2B);
-    LCD_1IN54_SendData_8Bit((Ystart >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit(Ystart & 0xFF);
-    LCD_1IN54_SendData_8Bit(((Yend  - 1) >> 8) & 0xFF);
-    LCD_1IN54_SendData_8Bit((Yend  - 1) & 0xFF);
+    LCD_1IN54_SendData_8Bit(((Ystart + y) >> 8) & 0xFF);
+    LCD_1IN54_SendData_8Bit((Ystart + y) & 0xFF);
+    LCD_1IN54_SendData_8Bit(((Yend - 1 + y) >> 8) & 0xFF);
+    LCD_1IN54_SendData_8Bit((Yend - 1 + y) & 0xFF);
 
     LCD_1IN54_SendCommand(0X2C);
 }
@@ -15,6 +15,7 @@
 #define __LCD_1IN54_H	
 	
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 #include <stdint.h>
 
 #include <stdlib.h>		//itoa()
@@ -48,6 +49,8 @@ typedef struct{
 	UWORD WIDTH;
 	UWORD HEIGHT;
 	UBYTE SCAN_DIR;
+	UWORD X_OFFSET;     // Window offset in controller memory
+	UWORD Y_OFFSET;
 }LCD_1IN54_ATTRIBUTES;
 extern LCD_1IN54_ATTRIBUTES LCD_1IN54;
 
@@ -56,6 +59,7 @@ function:
 			Macro definition variable name
 ********************************************************************************/
 void LCD_1IN54_Init(UBYTE Scan_dir);
+UBYTE LCD_1IN54_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_1IN54_Clear(UWORD Color);
 void LCD_1IN54_Display(UWORD *Image);
 void LCD_1IN54_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
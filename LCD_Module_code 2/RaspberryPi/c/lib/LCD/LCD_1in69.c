@@ -180,11 +180,15 @@ static void LCD_1IN69_SetAttributes(UBYTE Scan_dir)
     if (Scan_dir == HORIZONTAL) {
         LCD_1IN69.HEIGHT = LCD_1IN69_WIDTH;
         LCD_1IN69.WIDTH = LCD_1IN69_HEIGHT;
+        LCD_1IN69.X_OFFSET = 20;
+        LCD_1IN69.Y_OFFSET = 0;
         MemoryAccessReg = 0X70;
     }
     else {
         LCD_1IN69.HEIGHT = LCD_1IN69_HEIGHT;
-        LCD_1IN69.WIDTH = LCD_1IN69_WIDTH;      
+        LCD_1IN69.WIDTH = LCD_1IN69_WIDTH;
+        LCD_1IN69.X_OFFSET = 0;
+        LCD_1IN69.Y_OFFSET = 20;
         MemoryAccessReg = 0X00;
     }
 
@@ -193,6 +197,33 @@ static void LCD_1IN69_SetAttributes(UBYTE Scan_dir)
     LCD_1IN69_SendData_8Bit(MemoryAccessReg); // 0x08 set RGB
 }
 
+/******************************************************************************
+function :  Rotate and mirror in the controller, see LCD_Orient.h
+parameter:
+    Rotate :   0, 90, 180 or 270, clockwise
+    Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+    Call after LCD_1IN69_Init(): LCD_1IN69_InitReg() sets MADCTL back to
+    0x00 whatever Scan_dir was. Draw on a canvas of LCD_1IN69.WIDTH x
+    LCD_1IN69.HEIGHT with ROTATE_0 and MIRROR_NONE, then redraw.
+******************************************************************************/
+UBYTE LCD_1IN69_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+    LCD_ORIENT Orient;
+
+    if (!LCD_Orient_Get(&LCD_PANEL_1IN69, Rotate, Mirror, &Orient))
+        return 0;
+    LCD_1IN69.WIDTH = Orient.Width;
+    LCD_1IN69.HEIGHT = Orient.Height;
+    LCD_1IN69.X_OFFSET = Orient.X_Offset;
+    LCD_1IN69.Y_OFFSET = Orient.Y_Offset;
+    LCD_1IN69.SCAN_DIR = (Orient.Madctl & LCD_MADCTL_MV) ? HORIZONTAL : VERTICAL;
+
+    LCD_1IN69_SendCommand(0x36);
+    LCD_1IN69_SendData_8Bit(Orient.Madctl);
+    return 1;
+}
+
 /********************************************************************************
 function :  Initialize the lcd
 parameter:
@@ -218,37 +249,22 @@ parameter:
         Yend    :   Y direction end coordinates
 ********************************************************************************/
 void LCD_1IN69_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
-{    
-    if (LCD_1IN69.SCAN_DIR == VERTICAL) { 
-        // set the X coordinates
-        LCD_1IN69_SendCommand(0x2A);
-        LCD_1IN69_SendData_8Bit(Xstart >> 8);
-        LCD_1IN69_SendData_8Bit(Xstart);
-        LCD_1IN69_SendData_8Bit((Xend-1) >> 8);
-        LCD_1IN69_SendData_8Bit(Xend-1);
-
-        // set the Y coordinates
-        LCD_1IN69_SendCommand(0x2B);
-        LCD_1IN69_SendData_8Bit((Ystart+20) >> 8);
-        LCD_1IN69_SendData_8Bit(Ystart+20);
-        LCD_1IN69_SendData_8Bit((Yend+20-1) >> 8);
-        LCD_1IN69_SendData_8Bit(Yend+20-1);
-    }
-    else { 
-        // set the X coordinates
-        LCD_1IN69_SendCommand(0x2A);
-        LCD_1IN69_SendData_8Bit((Xstart+20) >> 8);
-        LCD_1IN69_SendData_8Bit(Xstart+20);
-        LCD_1IN69_SendData_8Bit((Xend+20-1) >> 8);
-        LCD_1IN69_SendData_8Bit(Xend+20-1);
-
-        // set the Y coordinates
-        LCD_1IN69_SendCommand(0x2B);
-        LCD_1IN69_SendData_8Bit(Ystart >> 8);
-        LCD_1IN69_SendData_8Bit(Ystart);
-        LCD_1IN69_SendData_8Bit((Yend-1) >> 8);
-        LCD_1IN69_SendData_8Bit(Yend-1);
-    }
+{
+    UWORD x = LCD_1IN69.X_OFFSET, y = LCD_1IN69.Y_OFFSET;
+
+    // set the X coordinates
+    LCD_1IN69_SendCommand(0x2A);
+    LCD_1IN69_SendData_8Bit((Xstart+x) >> 8);
+    LCD_1IN69_SendData_8Bit(Xstart+x);
+    LCD_1IN69_SendData_8Bit((Xend+x-1) >> 8);
+    LCD_1IN69_SendData_8Bit(Xend+x-1);
+
+    // set the Y coordinates
+    LCD_1IN69_SendCommand(0x2B);
+    LCD_1IN69_SendData_8Bit((Ystart+y) >> 8);
+    LCD_1IN69_SendData_8Bit(Ystart+y);
+    LCD_1IN69_SendData_8Bit((Yend+y-1) >> 8);
+    LCD_1IN69_SendData_8Bit(Yend+y-1);
     LCD_1IN69_SendCommand(0x2C);   
 }
 
@@ -259,8 +275,8 @@ parameter:
 void LCD_1IN69_Clear(UWORD Color)
 {
     UWORD j;
-    UWORD Image[LCD_1IN69_WIDTH];
-    for (j=0; j<LCD_1IN69_WIDTH; j++) {
+    UWORD Image[LCD_1IN69_HEIGHT];     // Longest row in any orientation
+    for (j=0; j<LCD_1IN69_HEIGHT; j++) {
         Image[j] = Color;
     }
 
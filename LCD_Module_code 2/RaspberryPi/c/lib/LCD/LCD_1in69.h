@@ -13,6 +13,7 @@
 #define __LCD_1IN69_H   
     
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 #include <stdint.h>
 
 #include <stdlib.h>     //itoa()
@@ -42,6 +43,8 @@ typedef struct{
     UWORD WIDTH;
     UWORD HEIGHT;
     UBYTE SCAN_DIR;
+    UWORD X_OFFSET;     // Window offset in controller memory
+    UWORD Y_OFFSET;
 }LCD_1IN69_ATTRIBUTES;
 extern LCD_1IN69_ATTRIBUTES LCD_1IN69;
 
@@ -49,6 +52,7 @@ extern LCD_1IN69_ATTRIBUTES LCD_1IN69;
 function:   Macro definition variable name
 ********************************************************************************/
 void LCD_1IN69_Init(UBYTE Scan_dir);
+UBYTE LCD_1IN69_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_1IN69_Clear(UWORD Color);
 void LCD_1IN69_Display(UWORD *Image);
 void LCD_1IN69_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
@@ -30,6 +30,9 @@
 #include "LCD_2inch.h"
 #include <string.h>
 #include <stdlib.h>		//itoa()
+
+LCD_2IN_ATTRIBUTES LCD_2IN = {LCD_2IN_WIDTH, LCD_2IN_HEIGHT};
+
 /*******************************************************************************
 function:
 	Hardware reset
@@ -80,6 +83,8 @@ function:
 void LCD_2IN_Init(void)
 {
 	LCD_2IN_Reset();
+	LCD_2IN.WIDTH = LCD_2IN_WIDTH;
+	LCD_2IN.HEIGHT = LCD_2IN_HEIGHT;
 
 	LCD_2IN_Write_Command(0x36);
 	LCD_2IN_WriteData_Byte(0x00); 
@@ -171,6 +176,31 @@ void LCD_2IN_Init(void)
 	LCD_2IN_Write_Command(0x29);
 }
 
+/******************************************************************************
+function:	Rotate and mirror in the controller, see LCD_Orient.h
+parameter	:
+	  Rotate :	0, 90, 180 or 270, clockwise
+	  Mirror :	LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_2IN_Init(), which sets MADCTL to 0x00. The panel covers
+	all of the controller memory, so there is no window offset. Draw on
+	a canvas of LCD_2IN.WIDTH x LCD_2IN.HEIGHT with ROTATE_0 and
+	MIRROR_NONE, then redraw.
+******************************************************************************/
+UBYTE LCD_2IN_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+	LCD_ORIENT Orient;
+
+	if(!LCD_Orient_Get(&LCD_PANEL_2IN, Rotate, Mirror, &Orient))
+		return 0;
+	LCD_2IN.WIDTH = Orient.Width;
+	LCD_2IN.HEIGHT = Orient.Height;
+
+	LCD_2IN_Write_Command(0x36);
+	LCD_2IN_WriteData_Byte(Orient.Madctl);
+	return 1;
+}
+
 /******************************************************************************
 function:	Set the cursor position
 parameter	:
@@ -228,15 +258,15 @@ parameter	:
 void LCD_2IN_Clear(UWORD Color)
 {
 	UWORD i;
-	UWORD image[LCD_2IN_WIDTH];
-	for(i=0;i<LCD_2IN_WIDTH;i++){
+	UWORD image[LCD_2IN_HEIGHT];	// Longest row in any orientation
+	for(i=0;i<LCD_2IN_HEIGHT;i++){
 		image[i] = Color>>8 | (Color&0xff)<<8;
 	}
 	UBYTE *p = (UBYTE *)(image);
-	LCD_2IN_SetWindow(0, 0, LCD_2IN_WIDTH, LCD_2IN_HEIGHT);
+	LCD_2IN_SetWindow(0, 0, LCD_2IN.WIDTH, LCD_2IN.HEIGHT);
 	DEV_Digital_Write(LCD_DC, 1);
-	for(i = 0; i < LCD_2IN_HEIGHT; i++){
-		DEV_SPI_Write_nByte(p,LCD_2IN_WIDTH*2);
+	for(i = 0; i < LCD_2IN.HEIGHT; i++){
+		DEV_SPI_Write_nByte(p,LCD_2IN.WIDTH*2);
 	}
 }
 
@@ -260,6 +290,37 @@ void LCD_2IN_ClearWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,UWOR
 	}
 }
 
+/******************************************************************************
+function:	Define the vertically scrolling part of the frame memory
+parameter	:
+	  Top    :	Fixed lines above it
+	  Height :	Lines that scroll; the rest of the 320 are fixed below
+******************************************************************************/
+void LCD_2IN_SetScrollArea(UWORD Top, UWORD Height)
+{
+	UWORD Bottom = LCD_2IN_HEIGHT - Top - Height;
+
+	LCD_2IN_Write_Command(0x33);
+	LCD_2IN_WriteData_Byte(Top >> 8);
+	LCD_2IN_WriteData_Byte(Top & 0xff);
+	LCD_2IN_WriteData_Byte(Height >> 8);
+	LCD_2IN_WriteData_Byte(Height & 0xff);
+	LCD_2IN_WriteData_Byte(Bottom >> 8);
+	LCD_2IN_WriteData_Byte(Bottom & 0xff);
+}
+
+/******************************************************************************
+function:	Frame memory line shown at the top of the scroll area
+parameter	:
+	  Line :	From Top to Top + Height - 1 (LCD_2IN_SetScrollArea)
+******************************************************************************/
+void LCD_2IN_SetScrollStart(UWORD Line)
+{
+	LCD_2IN_Write_Command(0x37);
+	LCD_2IN_WriteData_Byte(Line >> 8);
+	LCD_2IN_WriteData_Byte(Line & 0xff);
+}
+
 /******************************************************************************
 function: Show a picture
 parameter	:
@@ -268,10 +329,10 @@ parameter	:
 void LCD_2IN_Display(UBYTE *image)
 {
 	UWORD i;
-	LCD_2IN_SetWindow(0, 0, LCD_2IN_WIDTH, LCD_2IN_HEIGHT);
+	LCD_2IN_SetWindow(0, 0, LCD_2IN.WIDTH, LCD_2IN.HEIGHT);
 	DEV_Digital_Write(LCD_DC, 1);
-	for(i = 0; i < LCD_2IN_HEIGHT; i++){
-		DEV_SPI_Write_nByte((UBYTE *)image+LCD_2IN_WIDTH*2*i,LCD_2IN_WIDTH*2);
+	for(i = 0; i < LCD_2IN.HEIGHT; i++){
+		DEV_SPI_Write_nByte((UBYTE *)image+LCD_2IN.WIDTH*2*i,LCD_2IN.WIDTH*2);
 	}
 }
 
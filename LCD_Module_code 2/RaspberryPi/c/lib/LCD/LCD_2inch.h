@@ -31,6 +31,7 @@
 #define __LCD_2IN_DRIVER_H
 
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 
 #define LCD_2IN_WIDTH   240 //LCD width
 #define LCD_2IN_HEIGHT  320 //LCD height
@@ -48,7 +49,14 @@
 #define LCD_2IN_BL_0	LCD_BL_0	
 #define LCD_2IN_BL_1	LCD_BL_1	
 
+typedef struct{
+	UWORD WIDTH;       // Canvas size, swapped by a quarter turn
+	UWORD HEIGHT;
+}LCD_2IN_ATTRIBUTES;
+extern LCD_2IN_ATTRIBUTES LCD_2IN;
+
 void LCD_2IN_Init(void); 
+UBYTE LCD_2IN_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_2IN_Clear(UWORD Color);
 void LCD_2IN_Display(UBYTE *image);
 void LCD_2IN_DrawPaint(UWORD x, UWORD y, UWORD Color);
@@ -58,6 +66,8 @@ void LCD_2IN_WriteData_Word(UWORD da);
 void LCD_2IN_SetCursor(UWORD X, UWORD Y);
 void LCD_2IN_SetWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD  Yend);
 void LCD_2IN_ClearWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,UWORD color);
+void LCD_2IN_SetScrollArea(UWORD Top, UWORD Height);
+void LCD_2IN_SetScrollStart(UWORD Line);
 
 
 #endif
@@ -30,6 +30,9 @@
 #include "LCD_2inch4.h"
 #include <string.h>
 #include <stdlib.h>		//itoa()
+
+LCD_2IN4_ATTRIBUTES LCD_2IN4 = {LCD_2IN4_WIDTH, LCD_2IN4_HEIGHT};
+
 /*******************************************************************************
 function:
 	Hardware reset
@@ -80,6 +83,8 @@ function:
 void LCD_2IN4_Init(void)
 {
 	LCD_2IN4_Reset();
+	LCD_2IN4.WIDTH = LCD_2IN4_WIDTH;
+	LCD_2IN4.HEIGHT = LCD_2IN4_HEIGHT;
 
 	LCD_2IN4_Write_Command(0x11); //Sleep out
 	
@@ -169,6 +174,31 @@ void LCD_2IN4_Init(void)
 	LCD_2IN4_Write_Command(0x29); //Display on
 }
 
+/******************************************************************************
+function:	Rotate and mirror in the controller, see LCD_Orient.h
+parameter	:
+	  Rotate :	0, 90, 180 or 270, clockwise
+	  Mirror :	LCD_MIRROR_X / LCD_MIRROR_Y
+info:
+	Call after LCD_2IN4_Init(), which sets MADCTL to 0x08. The panel covers
+	all of the controller memory, so there is no window offset. Draw on
+	a canvas of LCD_2IN4.WIDTH x LCD_2IN4.HEIGHT with ROTATE_0 and
+	MIRROR_NONE, then redraw.
+******************************************************************************/
+UBYTE LCD_2IN4_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+	LCD_ORIENT Orient;
+
+	if(!LCD_Orient_Get(&LCD_PANEL_2IN4, Rotate, Mirror, &Orient))
+		return 0;
+	LCD_2IN4.WIDTH = Orient.Width;
+	LCD_2IN4.HEIGHT = Orient.Height;
+
+	LCD_2IN4_Write_Command(0x36);
+	LCD_2IN4_WriteData_Byte(Orient.Madctl);
+	return 1;
+}
+
 /******************************************************************************
 function:	Set the cursor position
 parameter	:
@@ -226,15 +256,15 @@ parameter	:
 void LCD_2IN4_Clear(UWORD Color)
 {
 	UWORD i;
-	UWORD image[LCD_2IN4_WIDTH];
-	for(i=0;i<LCD_2IN4_WIDTH;i++){
+	UWORD image[LCD_2IN4_HEIGHT];	// Longest row in any orientation
+	for(i=0;i<LCD_2IN4_HEIGHT;i++){
 		image[i] = Color>>8 | (Color&0xff)<<8;
 	}
 	UBYTE *p = (UBYTE *)(image);
-	LCD_2IN4_SetWindow(0, 0, LCD_2IN4_WIDTH, LCD_2IN4_HEIGHT);
+	LCD_2IN4_SetWindow(0, 0, LCD_2IN4.WIDTH, LCD_2IN4.HEIGHT);
 	DEV_Digital_Write(LCD_DC, 1);
-	for(i = 0; i < LCD_2IN4_HEIGHT; i++){
-		DEV_SPI_Write_nByte(p,LCD_2IN4_WIDTH*2);
+	for(i = 0; i < LCD_2IN4.HEIGHT; i++){
+		DEV_SPI_Write_nByte(p,LCD_2IN4.WIDTH*2);
 	}
 }
 
@@ -266,10 +296,10 @@ parameter	:
 void LCD_2IN4_Display(UBYTE *image)
 {
 	UWORD i;
-	LCD_2IN4_SetWindow(0, 0, LCD_2IN4_WIDTH, LCD_2IN4_HEIGHT);
+	LCD_2IN4_SetWindow(0, 0, LCD_2IN4.WIDTH, LCD_2IN4.HEIGHT);
 	DEV_Digital_Write(LCD_DC, 1);
-	for(i = 0; i < LCD_2IN4_HEIGHT; i++){
-		DEV_SPI_Write_nByte((UBYTE *)image+LCD_2IN4_WIDTH*2*i,LCD_2IN4_WIDTH*2);
+	for(i = 0; i < LCD_2IN4.HEIGHT; i++){
+		DEV_SPI_Write_nByte((UBYTE *)image+LCD_2IN4.WIDTH*2*i,LCD_2IN4.WIDTH*2);
 	}
 }
 
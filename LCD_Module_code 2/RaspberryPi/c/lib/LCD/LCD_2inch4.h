@@ -31,6 +31,7 @@
 #define __LCD_2IN4_DRIVER_H
 
 #include "DEV_Config.h"
+#include "LCD_Orient.h"
 
 #define LCD_2IN4_WIDTH   240 //LCD width
 #define LCD_2IN4_HEIGHT  320 //LCD height
@@ -48,7 +49,14 @@
 #define LCD_2IN4_BL_0	LCD_BL_0	
 #define LCD_2IN4_BL_1	LCD_BL_1	
 
+typedef struct{
+	UWORD WIDTH;       // Canvas size, swapped by a quarter turn
+	UWORD HEIGHT;
+}LCD_2IN4_ATTRIBUTES;
+extern LCD_2IN4_ATTRIBUTES LCD_2IN4;
+
 void LCD_2IN4_Init(void); 
+UBYTE LCD_2IN4_SetOrientation(UWORD Rotate, UBYTE Mirror);
 void LCD_2IN4_Clear(UWORD Color);
 void LCD_2IN4_Display(UBYTE *image);
 void LCD_2IN4_DrawPaint(UWORD x, UWORD y, UWORD Color);
@@ -0,0 +1,102 @@
+/*****************************************************************************
+* | File      	:   LCD_Orient.c
+* | Function    :   Rotation and mirroring in the controller (MADCTL 0x36)
+* | Info        :
+*   Offsets are those the drivers use at ROTATE_0 (LCD_1IN14_SetWindows:
+*   x=52, y=40 vertical). The ST7789 has 240x320 of memory whatever the
+*   glass, which is why a 240x240 panel needs a row offset of 80 once
+*   MY is set.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "LCD_Orient.h"
+#include <string.h>
+
+const LCD_PANEL LCD_PANEL_1IN14 = {"1in14", 135, 240, 240, 320, 52, 40, 0x00};
+const LCD_PANEL LCD_PANEL_1IN28 = {"1in28", 240, 240, 240, 240,  0,  0, 0x08};
+const LCD_PANEL LCD_PANEL_1IN3  = {"1in3",  240, 240, 240, 320,  0,  0, 0x00};
+const LCD_PANEL LCD_PANEL_1IN47 = {"1in47", 172, 320, 240, 320, 34,  0, 0x00};
+const LCD_PANEL LCD_PANEL_1IN54 = {"1in54", 240, 240, 240, 320,  0,  0, 0x00};
+const LCD_PANEL LCD_PANEL_1IN69 = {"1in69", 240, 280, 240, 320,  0, 20, 0x00};
+const LCD_PANEL LCD_PANEL_2IN   = {"2in",   240, 320, 240, 320,  0,  0, 0x00};
+const LCD_PANEL LCD_PANEL_2IN4  = {"2in4",  240, 320, 240, 320,  0,  0, 0x08};
+
+const LCD_PANEL *const LCD_Panels[] = {
+    &LCD_PANEL_1IN14, &LCD_PANEL_1IN28, &LCD_PANEL_1IN3, &LCD_PANEL_1IN47,
+    &LCD_PANEL_1IN54, &LCD_PANEL_1IN69, &LCD_PANEL_2IN, &LCD_PANEL_2IN4,
+    NULL,
+};
+
+/******************************************************************************
+function:	Panel by name ("1in14", ...)
+parameter:
+	Name :   Panel name
+return: NULL if unknown
+******************************************************************************/
+const LCD_PANEL *LCD_Panel_Find(const char *Name)
+{
+    UBYTE i;
+    for(i = 0; LCD_Panels[i]; i++) {
+        if(strcmp(LCD_Panels[i]->Name, Name) == 0)
+            return LCD_Panels[i];
+    }
+    return NULL;
+}
+
+/******************************************************************************
+function:	MADCTL, canvas size and window offsets for an orientation
+parameter:
+	Panel  :   Panel table entry
+	Rotate :   0, 90, 180 or 270, clockwise
+	Mirror :   LCD_MIRROR_X / LCD_MIRROR_Y, applied after the rotation
+	Out    :   Result
+info:
+	A quarter turn takes canvas x down the physical rows and y from right
+	to left along them (MV, MX); the mirrors act on physical axes after
+	that, so they toggle MX / MY whatever the rotation:
+	   0: -        90: MV MX      180: MX MY      270: MV MY
+return: 0 if Rotate is not a quarter turn
+******************************************************************************/
+UBYTE LCD_Orient_Get(const LCD_PANEL *Panel, UWORD Rotate, UBYTE Mirror, LCD_ORIENT *Out)
+{
+    UBYTE Turn, Flip_X, Flip_Y;
+    UWORD Col, Row;
+
+    switch(Rotate) {
+    case 0:   Turn = 0; break;
+    case 90:  Turn = 1; break;
+    case 180: Turn = 2; break;
+    case 270: Turn = 3; break;
+    default:  return 0;
+    }
+
+    Flip_X = (Turn == 1 || Turn == 2) ^ ((Mirror & LCD_MIRROR_X) ? 1 : 0);
+    Flip_Y = (Turn >= 2) ^ ((Mirror & LCD_MIRROR_Y) ? 1 : 0);
+
+    // Reversing an axis moves the panel to the other end of memory
+    Col = Flip_X ? Panel->Gram_Width - Panel->Width - Panel->Col_Offset : Panel->Col_Offset;
+    Row = Flip_Y ? Panel->Gram_Height - Panel->Height - Panel->Row_Offset : Panel->Row_Offset;
+
+    Out->Madctl = Panel->Madctl;
+    if(Flip_X)
+        Out->Madctl ^= LCD_MADCTL_MX;
+    if(Flip_Y)
+        Out->Madctl ^= LCD_MADCTL_MY;
+
+    if(Turn & 1) {
+        Out->Madctl |= LCD_MADCTL_MV;
+        Out->Width = Panel->Height;
+        Out->Height = Panel->Width;
+        Out->X_Offset = Row;
+        Out->Y_Offset = Col;
+    } else {
+        Out->Width = Panel->Width;
+        Out->Height = Panel->Height;
+        Out->X_Offset = Col;
+        Out->Y_Offset = Row;
+    }
+    return 1;
+}
@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:   LCD_Orient.h
+* | Function    :   Rotation and mirroring in the controller (MADCTL 0x36)
+* | Info        :
+*   Instead of transforming every pixel in Paint_SetPixel(), the canvas
+*   is kept in display order (ROTATE_0, MIRROR_NONE) and the controller
+*   is told how to walk its memory:
+*   - MV exchanges rows and columns
+*   - MX / MY then reverse the physical column / row address
+*   Panels smaller than the controller memory sit at an offset in it, and
+*   the offset moves to the other end when an axis is reversed; the panel
+*   table holds what is needed to work that out for every orientation.
+*
+*   Rotate and Mirror mean the same as in Paint_SetRotate() and
+*   Paint_SetMirroring(): rotate clockwise, then mirror the result.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#ifndef __LCD_ORIENT_H
+#define __LCD_ORIENT_H
+
+#include "DEV_Config.h"
+
+/**
+ * MADCTL bits
+**/
+#define LCD_MADCTL_MY   0x80
+#define LCD_MADCTL_MX   0x40
+#define LCD_MADCTL_MV   0x20
+#define LCD_MADCTL_ML   0x10
+#define LCD_MADCTL_BGR  0x08
+
+/**
+ * Mirror flags, same values as MIRROR_HORIZONTAL / MIRROR_VERTICAL
+**/
+#define LCD_MIRROR_NONE 0x00
+#define LCD_MIRROR_X    0x01
+#define LCD_MIRROR_Y    0x02
+
+/**
+ * A panel as its driver sees it at ROTATE_0
+**/
+typedef struct {
+    const char *Name;
+    UWORD Width, Height;            // Visible pixels
+    UWORD Gram_Width, Gram_Height;  // Controller memory, same axes
+    UWORD Col_Offset, Row_Offset;   // First visible column / row in memory
+    UBYTE Madctl;                   // MADCTL, MV clear
+} LCD_PANEL;
+
+/**
+ * What to program for one orientation
+**/
+typedef struct {
+    UBYTE Madctl;
+    UWORD Width, Height;            // Canvas size
+    UWORD X_Offset, Y_Offset;       // Add to CASET / RASET
+} LCD_ORIENT;
+
+extern const LCD_PANEL LCD_PANEL_1IN14;
+extern const LCD_PANEL LCD_PANEL_1IN28;
+extern const LCD_PANEL LCD_PANEL_1IN3;
+extern const LCD_PANEL LCD_PANEL_1IN47;
+extern const LCD_PANEL LCD_PANEL_1IN54;
+extern const LCD_PANEL LCD_PANEL_1IN69;
+extern const LCD_PANEL LCD_PANEL_2IN;
+extern const LCD_PANEL LCD_PANEL_2IN4;
+extern const LCD_PANEL *const LCD_Panels[];     // NULL terminated
+
+const LCD_PANEL *LCD_Panel_Find(const char *Name);
+UBYTE LCD_Orient_Get(const LCD_PANEL *Panel, UWORD Rotate, UBYTE Mirror, LCD_ORIENT *Out);
+
+#endif
@@ -0,0 +1,164 @@
+/*****************************************************************************
+* | File      	:   bench_font.c
+* | Function    :   Compressed fonts: flash size, exactness and glyphs/s
+* | Info        :
+*   Compares the sFONT tables with the fonts made by tools/fontc.py:
+*     - Font24R:  Font24, 1 bpp run-length coded (lossless)
+*     - Font24AA: Font48 averaged 2x2, 4 bpp anti-aliased
+*   Font24R must draw exactly what Font24 draws through Paint_DrawString_EN(),
+*   with an opaque and with a transparent background. Speed is measured
+*   for Paint_DrawString_EN(), the bare span decoder and the band
+*   renderer (GFX_Text_RenderRow(), as used on the CH32v003).
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_font
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Font.h"
+
+#include <string.h>
+#include <time.h>
+
+#define SIZE    240
+#define ROUNDS  200
+
+extern sFONT Font48;
+
+static UWORD Canvas[SIZE * SIZE];
+static UWORD Reference[SIZE * SIZE];
+static char Ascii[96];
+static UDOUBLE Spans;
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Bytes of a glyph stream: walk the tokens until the ink box is covered
+static UDOUBLE Stream_Bytes(const GFX_Font *Font, const GFX_Glyph *Glyph)
+{
+    const uint8_t *p = Font->bitmap + Glyph->offset;
+    UDOUBLE Left = (UDOUBLE)Glyph->width * Glyph->height;
+
+    while(Left) {
+        uint8_t t = *p++;
+        uint8_t n = (t & 0x3F) + 1;
+        if(t & 0x80)
+            p += (n * Font->bpp + 7) / 8;
+        Left -= n;
+    }
+    return p - (Font->bitmap + Glyph->offset);
+}
+
+static UDOUBLE Font_Bytes(const GFX_Font *Font, UWORD Glyphs)
+{
+    UDOUBLE Bitmap = 0;
+    for(UWORD i = 0; i < Glyphs; i++)
+        Bitmap += Stream_Bytes(Font, &Font->glyphs[i]);
+    return Bitmap + Glyphs * sizeof(GFX_Glyph) + Font->range_count * sizeof(GFX_FontRange)
+           + sizeof(GFX_Font);
+}
+
+static void Report_Size(const char *Name, const sFONT *Table, const sFONT *Packed)
+{
+    UDOUBLE Old = 95 * Table->Height * ((Table->Width + 7) / 8);
+    UDOUBLE New = Font_Bytes(Packed->Compressed, 95);
+    printf("  %-9s %2dx%-2d table %6lu B   %-9s %d bpp %6lu B  (%.0f%%)\n",
+           Table == &Font48 ? "Font48" : "Font24", Table->Width, Table->Height, (unsigned long)Old,
+           Packed == &Font24R ? "Font24R" : "Font24AA", Packed->Compressed->bpp,
+           (unsigned long)New, 100.0 * New / Old);
+}
+
+// Print the glyphs as four lines of text
+static void Draw_Ascii(sFONT *Font, UWORD Background)
+{
+    for(int Line = 0; Line < 4; Line++) {
+        char Text[25];
+        memcpy(Text, Ascii + Line * 24, 24);
+        Text[24] = 0;
+        Paint_DrawString_EN(0, 8 + Line * Font->Height, Text, Font, Background, WHITE);
+    }
+}
+
+static int Same_As_Table(UWORD Background)
+{
+    Paint_SelectImage(Reference);
+    Paint_Clear(BLACK);
+    Draw_Ascii(&Font24, Background);
+    Paint_SelectImage(Canvas);
+    Paint_Clear(BLACK);
+    Draw_Ascii(&Font24R, Background);
+    return memcmp(Canvas, Reference, sizeof(Canvas)) == 0;
+}
+
+static void Time_Paint(const char *Name, sFONT *Font, UWORD Background)
+{
+    double t0 = Now_s();
+    for(int r = 0; r < ROUNDS; r++)
+        Draw_Ascii(Font, Background);
+    printf("  %-9s %-11s %9.0f glyphs/s\n", Name,
+           Background == FONT_BACKGROUND ? "transparent" : "opaque",
+           ROUNDS * 96 / (Now_s() - t0));
+}
+
+static void Count_Span(int16_t x, int16_t y, uint16_t n, uint8_t alpha, void *ctx)
+{
+    Spans += n;
+}
+
+static void Time_Decode(const char *Name, const GFX_Font *Font)
+{
+    double t0 = Now_s();
+    for(int r = 0; r < ROUNDS * 10; r++)
+        for(int c = 0; c < 95; c++)
+            GFX_Font_DrawGlyph(Font, &Font->glyphs[c], 0, 0, Count_Span, NULL);
+    printf("  %-9s %-11s %9.0f glyphs/s\n", Name, "decode", ROUNDS * 10 * 95 / (Now_s() - t0));
+}
+
+static void Time_Rows(const char *Name, const GFX_Font *Font)
+{
+    GFX_Text Text = {Font, "12:34:56 -7.8", 4, 0, 0xFFFF};
+    UWORD Row[SIZE];
+
+    double t0 = Now_s();
+    for(int r = 0; r < ROUNDS; r++)
+        for(int y = 0; y < Font->line_height; y++) {
+            memset(Row, 0, sizeof(Row));
+            GFX_Text_RenderRow(&Text, y, 0, SIZE, Row, GFX_ORDER_NATIVE);
+        }
+    printf("  %-9s %-11s %9.0f glyphs/s\n", Name, "band rows", ROUNDS * 13 / (Now_s() - t0));
+}
+
+int main(void)
+{
+    for(int i = 0; i < 95; i++)
+        Ascii[i] = ' ' + i;
+    Ascii[95] = ' ';
+
+    Paint_NewImage(Canvas, SIZE, SIZE, ROTATE_0, BLACK, 16);
+
+    printf("Flash:\n");
+    Report_Size("Font24", &Font24, &Font24R);
+    Report_Size("Font48", &Font48, &Font24AA);
+
+    int Ok = Same_As_Table(BLACK) && Same_As_Table(FONT_BACKGROUND);
+    printf("Font24R draws the same pixels as Font24: %s\n", Ok ? "yes" : "NO");
+
+    printf("Speed:\n");
+    Time_Paint("Font24", &Font24, BLACK);
+    Time_Paint("Font24R", &Font24R, BLACK);
+    Time_Paint("Font24AA", &Font24AA, BLACK);
+    Time_Paint("Font24", &Font24, FONT_BACKGROUND);
+    Time_Paint("Font24R", &Font24R, FONT_BACKGROUND);
+    Time_Paint("Font24AA", &Font24AA, FONT_BACKGROUND);
+    Time_Decode("Font24R", Font24R.Compressed);
+    Time_Decode("Font24AA", Font24AA.Compressed);
+    Time_Rows("Font24R", Font24R.Compressed);
+    Time_Rows("Font24AA", Font24AA.Compressed);
+    return Ok ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/*****************************************************************************
+* | File      	:   bench_gauge.c
+* | Function    :   Gauge ticks per second: full repaint vs needle spans
+* | Info        :
+*   Sweeps the needle of a 240x240 gauge through 0..100..0 and reports
+*   CPU ticks/s and bus bytes per tick for:
+*     - full:  Paint_DrawGauge() + full-screen push every tick
+*     - spans: Paint_SetGaugeValue() (needle spans, one window push)
+*   After the sweep the incrementally updated canvas is compared with a
+*   fresh full render.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_gauge
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Gauge.h"
+
+#include <string.h>
+#include <time.h>
+
+#define SIZE        240
+#define SWEEPS      20
+#define SPI_HZ      25000000
+#define WINDOW_COST 11
+
+static UWORD Canvas[SIZE * SIZE];
+static UWORD Fresh[SIZE * SIZE];
+static UDOUBLE Bytes;
+
+static void Count_Flush(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+{
+    Bytes += WINDOW_COST + 2 * (Xend - Xstart) * (Yend - Ystart);
+}
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int Next_Value(int Tick)
+{
+    int v = Tick % 200;
+    return v <= 100 ? v : 200 - v;
+}
+
+static void Report(const char *Name, int Ticks, double Seconds)
+{
+    double PerTick = (double)Bytes / Ticks;
+    printf("  %-6s %9.0f ticks/s cpu  %8.0f B/tick  %7.1f ticks/s at %d MHz SPI\n",
+           Name, Ticks / Seconds, PerTick, SPI_HZ / 8.0 / PerTick, SPI_HZ / 1000000);
+}
+
+int main(void)
+{
+    GFX_Gauge Gauge;
+    int Ticks = SWEEPS * 200;
+
+    Paint_NewImage(Canvas, SIZE, SIZE, ROTATE_0, BLACK, 16);
+    Paint_Clear(BLACK);
+    GFX_Gauge_Init(&Gauge, 120, 120, 116);
+    printf("Gauge r=%d, %d ticks:\n", Gauge.radius, Ticks);
+
+    // Full repaint per tick
+    Bytes = 0;
+    double t0 = Now_s();
+    for(int t = 1; t <= Ticks; t++) {
+        GFX_Gauge_SetValue(&Gauge, Next_Value(t), NULL, NULL);
+        Paint_DrawGauge(&Gauge);
+        Count_Flush(0, 0, SIZE, SIZE, Canvas);
+    }
+    Report("full", Ticks, Now_s() - t0);
+
+    // Needle spans
+    GFX_Gauge_SetValue(&Gauge, 0, NULL, NULL);
+    Paint_DrawGauge(&Gauge);
+    Bytes = 0;
+    UDOUBLE Pixels = 0;
+    t0 = Now_s();
+    for(int t = 1; t <= Ticks; t++)
+        Pixels += Paint_SetGaugeValue(&Gauge, Next_Value(t), Count_Flush);
+    Report("spans", Ticks, Now_s() - t0);
+    printf("  %.0f px repainted per tick (%.1f%% of the screen)\n",
+           (double)Pixels / Ticks, 100.0 * Pixels / Ticks / (SIZE * SIZE));
+
+    // Incremental result must match a fresh render
+    Paint_SetGaugeValue(&Gauge, 63, NULL);
+    memcpy(Fresh, Canvas, sizeof(Canvas));
+    Paint_DrawGauge(&Gauge);
+    printf("  incremental == full render: %s\n", memcmp(Fresh, Canvas, sizeof(Canvas)) ? "NO" : "yes");
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*****************************************************************************
+* | File      	:   bench_gpiomem.c
+* | Function    :   lgpio vs memory-mapped GPIO writes: init time, windows/s
+* | Info        :
+*   Runs the real LCD_1in28 driver, built with DEV_GPIOMEM, over a DEV_*
+*   shim with a file-backed fake register page in place of /dev/gpiomem:
+*   1. Register map: for both layouts (Pi 0-4 and Pi 5 / RP1) a pin
+*      write must land in the set or clear register from the datasheet,
+*      read back through the file, and nowhere else.
+*   2. Timing with writes through lgpio and with the page mapped:
+*      LCD_1IN28_Init() without its delays, SetWindows alone, and
+*      SetWindows with a 16x16 tile.
+*
+*   There is no kernel GPIO on the host. Each lgpio pin write and each
+*   SPI transfer stands in as one write(2) to /dev/null. That is a lower
+*   bound for the ioctl lgGpioWrite() and lgSpiWrite() make, so on a
+*   Pi the gap is wider.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_gpiomem
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define INITS       2000
+#define WINDOWS     200000
+#define TILES       50000
+#define PAGE        "gpiomem.fake"
+
+// Exported by LCD_1in28.c, not declared in its header
+void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+static int Null_Fd = -1;
+static UDOUBLE Pin_Writes, Spi_Calls, Delay_ms;
+
+/******************************************************************************
+function:	DEV_* shim: syscall stand-ins, no delays
+******************************************************************************/
+UBYTE DEV_ModuleInit(void)
+{
+    return 0;
+}
+
+void DEV_ModuleExit(void)
+{
+}
+
+void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
+{
+}
+
+void DEV_Digital_Write(UWORD Pin, UBYTE Value)
+{
+    Pin_Writes++;
+    if(GpioMem_Set != NULL)
+        DEV_GpioMem_Write(Pin, Value);
+    else if(write(Null_Fd, &Value, 1) < 0)
+        perror("write");
+}
+
+UBYTE DEV_Digital_Read(UWORD Pin)
+{
+    return 0;
+}
+
+void DEV_Delay_ms(UDOUBLE xms)
+{
+    Delay_ms += xms;
+}
+
+void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
+{
+    Spi_Calls++;
+    if(write(Null_Fd, pData, Len) < 0)
+        perror("write");
+}
+
+void DEV_SPI_WriteByte(UBYTE Value)
+{
+    DEV_SPI_Write_nByte(&Value, 1);
+}
+
+void DEV_SetBacklight(UWORD Value)
+{
+}
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/******************************************************************************
+function:	Map a zeroed fake register page of the layout's size
+******************************************************************************/
+static int Fake_Page(UBYTE Layout)
+{
+    int fd = open(PAGE, O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+    if(fd < 0 || ftruncate(fd, DEV_GpioMem_Size(Layout)) < 0) {
+        perror(PAGE);
+        return -1;
+    }
+    close(fd);
+    return DEV_GpioMem_Map(PAGE, Layout);
+}
+
+/******************************************************************************
+function:	Words of the page file that are not zero
+parameter:
+    Offset : First one found
+******************************************************************************/
+static UDOUBLE Page_Nonzero(UBYTE Layout, size_t *Offset, UDOUBLE *Value)
+{
+    size_t size = DEV_GpioMem_Size(Layout);
+    UDOUBLE *page = malloc(size);
+    UDOUBLE n = 0;
+    int fd = open(PAGE, O_RDONLY);
+
+    if(page == NULL || fd < 0 || pread(fd, page, size, 0) != (ssize_t)size) {
+        perror(PAGE);
+        exit(1);
+    }
+    close(fd);
+    for(size_t i = 0; i < size / 4; i++) {
+        if(page[i] && n++ == 0) {
+            *Offset = i * 4;
+            *Value = page[i];
+        }
+    }
+    free(page);
+    return n;
+}
+
+/******************************************************************************
+function:	Set and clear each LCD pin, check the file after every store
+******************************************************************************/
+static UBYTE Check_Layout(UBYTE Layout, const char *Name, size_t Set, size_t Clr)
+{
+    static const UWORD pins[] = {LCD_CS, LCD_DC, LCD_RST};
+    UBYTE ok = 1;
+
+    for(UBYTE i = 0; i < 3; i++) {
+        for(UBYTE v = 0; v < 2; v++) {
+            size_t off = 0;
+            UDOUBLE word = 0, n;
+            if(Fake_Page(Layout) != 0)
+                return 0;
+            DEV_GpioMem_Write(pins[i], v);
+            DEV_GpioMem_Close();
+            n = Page_Nonzero(Layout, &off, &word);
+            if(n != 1 || off != (v ? Set : Clr) || word != (1UL << pins[i]))
+                ok = 0;
+        }
+    }
+    printf("%-5s %-14s set 0x%05zX  clear 0x%05zX  %s\r\n", Name, DEV_GpioMem_Path(Layout),
+           Set, Clr, ok ? "ok" : "WRONG");
+    return ok;
+}
+
+/******************************************************************************
+function:	Init, windows/s and tiles/s with the current GPIO path
+******************************************************************************/
+static void Run(const char *Name)
+{
+    static UBYTE tile[16 * 16 * 2];
+    UDOUBLE writes, spi;
+    double t, init_us, win_s, tile_s;
+    int i;
+
+    Pin_Writes = Spi_Calls = Delay_ms = 0;
+    t = Now_s();
+    for(i = 0; i < INITS; i++)
+        LCD_1IN28_Init(HORIZONTAL);
+    init_us = (Now_s() - t) / INITS * 1e6;
+    writes = Pin_Writes / INITS;
+    spi = Spi_Calls / INITS;
+
+    t = Now_s();
+    for(i = 0; i < WINDOWS; i++)
+        LCD_1IN28_SetWindows(i & 127, 16, (i & 127) + 16, 32);
+    win_s = WINDOWS / (Now_s() - t);
+
+    t = Now_s();
+    for(i = 0; i < TILES; i++) {
+        LCD_1IN28_SetWindows(i & 127, 16, (i & 127) + 16, 32);
+        LCD_1IN28_DC_1;
+        DEV_SPI_Write_nByte(tile, sizeof(tile));
+    }
+    tile_s = TILES / (Now_s() - t);
+
+    printf("%-8s %7.1f  %10lu  %8lu  %11.0f  %9.0f\r\n", Name, init_us,
+           (unsigned long)writes, (unsigned long)spi, win_s, tile_s);
+}
+
+int main(void)
+{
+    UBYTE ok;
+
+    Null_Fd = open("/dev/null", O_WRONLY);
+    if(Null_Fd < 0) {
+        perror("/dev/null");
+        return 1;
+    }
+
+    printf("register map (fake page %s)\r\n", PAGE);
+    ok = Check_Layout(GPIOMEM_BCM, "pi0-4", 0x1C, 0x28);
+    ok &= Check_Layout(GPIOMEM_RP1, "pi5", 0x12000, 0x13000);
+
+    printf("\r\nLCD_1IN28, one write(2) per lgpio pin write and per SPI transfer\r\n");
+    printf("gpio     init us  shim writes  spi/init  windows/s  16x16 /s\r\n");
+    Run("lgpio");
+    if(Fake_Page(GPIOMEM_BCM) != 0)
+        return 1;
+    Run("gpiomem");
+    DEV_GpioMem_Close();
+    printf("(init delays: %lu ms, not included; with gpiomem, CS/DC/RST do not reach the shim)\r\n",
+           (unsigned long)(Delay_ms / INITS));
+
+    unlink(PAGE);
+    close(Null_Fd);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+/*****************************************************************************
+* | File      	:   bench_orient.c
+* | Function    :   Controller-side orientation: table check and saved cost
+* | Info        :
+*   1. For every panel in LCD_Orient.c and every rotation and mirror,
+*      walks each canvas pixel through a model of the controller (MV,
+*      then MX/MY on the physical axes) and checks it lands where
+*      Paint_SetPixel()'s software transform would have put it.
+*   2. Checks the table against the MADCTL / offsets the Waveshare drivers
+*      hard-code for HORIZONTAL and VERTICAL (ML is ignored: it only sets
+*      the refresh direction).
+*   3. Times a full 240x240 canvas drawn through Paint_SetPixel() with a
+*      software rotation and with the controller doing it.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_orient
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Paint.h"
+#include "LCD_Orient.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define SIZE    240
+#define ROUNDS  50
+
+static UWORD Canvas[SIZE * SIZE];
+
+/**
+ * Memory address of a window position under a MADCTL value
+**/
+static void Controller(const LCD_PANEL *Panel, UBYTE Madctl, UWORD X, UWORD Y,
+                       UWORD *Col, UWORD *Row)
+{
+    UWORD c = (Madctl & LCD_MADCTL_MV) ? Y : X;
+    UWORD r = (Madctl & LCD_MADCTL_MV) ? X : Y;
+    *Col = (Madctl & LCD_MADCTL_MX) ? Panel->Gram_Width - 1 - c : c;
+    *Row = (Madctl & LCD_MADCTL_MY) ? Panel->Gram_Height - 1 - r : r;
+}
+
+/**
+ * Where Paint_SetPixel() puts canvas (X, Y) on a panel-sized canvas
+**/
+static void Software(const LCD_PANEL *Panel, UWORD Rotate, UBYTE Mirror, UWORD X, UWORD Y,
+                     UWORD *Nx, UWORD *Ny)
+{
+    UWORD W = Panel->Width, H = Panel->Height;
+
+    switch(Rotate) {
+    case 90:  *Nx = W - Y - 1; *Ny = X; break;
+    case 180: *Nx = W - X - 1; *Ny = H - Y - 1; break;
+    case 270: *Nx = Y; *Ny = H - X - 1; break;
+    default:  *Nx = X; *Ny = Y; break;
+    }
+    if(Mirror & LCD_MIRROR_X)
+        *Nx = W - *Nx - 1;
+    if(Mirror & LCD_MIRROR_Y)
+        *Ny = H - *Ny - 1;
+}
+
+static UDOUBLE Check(const LCD_PANEL *Panel, UWORD Rotate, UBYTE Mirror, LCD_ORIENT *o)
+{
+    UDOUBLE Bad = 0;
+    UWORD x, y;
+
+    LCD_Orient_Get(Panel, Rotate, Mirror, o);
+    for(y = 0; y < o->Height; y++) {
+        for(x = 0; x < o->Width; x++) {
+            UWORD Nx, Ny, Col, Row, Want_Col, Want_Row;
+            Software(Panel, Rotate, Mirror, x, y, &Nx, &Ny);
+            Controller(Panel, Panel->Madctl, Nx + Panel->Col_Offset, Ny + Panel->Row_Offset,
+                       &Want_Col, &Want_Row);
+            Controller(Panel, o->Madctl, x + o->X_Offset, y + o->Y_Offset, &Col, &Row);
+            if(Col != Want_Col || Row != Want_Row)
+                Bad++;
+        }
+    }
+    return Bad;
+}
+
+static const struct {
+    const char *Name;
+    UWORD Rotate;
+    UBYTE Madctl;
+    UWORD X_Offset, Y_Offset;
+} Legacy[] = {
+    {"1in14", 90, 0x70, 40, 53},    // HORIZONTAL
+    {"1in14",  0, 0x00, 52, 40},    // VERTICAL
+    {"1in69", 90, 0x70, 20,  0},
+    {"1in69",  0, 0x00,  0, 20},
+    {"1in3",  90, 0x70,  0,  0},
+    {"1in3",   0, 0x00,  0,  0},
+    {"1in54", 90, 0x70,  0,  0},
+    {"1in54",  0, 0x00,  0,  0},
+    {"1in47",  0, 0x00, 34,  0},    // HORIZONTAL is portrait here
+    {"1in47", 90, 0x70,  0, 34},
+    {"1in28",  0, 0x08,  0,  0},    // InitReg, whatever Scan_dir
+    {"2in",    0, 0x00,  0,  0},    // Init(void)
+    {"2in4",   0, 0x08,  0,  0},
+};
+
+static double Time_Canvas(UWORD Rotate)
+{
+    clock_t t0;
+    UWORD x, y, r;
+
+    Paint_NewImage(Canvas, SIZE, SIZE, Rotate, WHITE, 16);
+    t0 = clock();
+    for(r = 0; r < ROUNDS; r++)
+        for(y = 0; y < SIZE; y++)
+            for(x = 0; x < SIZE; x++)
+                Paint_SetPixel(x, y, x ^ y ^ r);
+    return (double)(clock() - t0) / CLOCKS_PER_SEC * 1e6 / ROUNDS;
+}
+
+int main(void)
+{
+    static const UWORD Rotations[] = {0, 90, 180, 270};
+    UDOUBLE Bad_Total = 0;
+    UBYTE i, r, m, Legacy_Bad = 0;
+    LCD_ORIENT o;
+
+    printf("panel  rotate  mirror  madctl  canvas    x_off  y_off  wrong px\n");
+    for(i = 0; LCD_Panels[i]; i++) {
+        for(r = 0; r < 4; r++) {
+            for(m = 0; m < 4; m++) {
+                UDOUBLE Bad = Check(LCD_Panels[i], Rotations[r], m, &o);
+                Bad_Total += Bad;
+                printf("%-6s %6d  %6d    0x%02X  %3dx%-3d  %5d  %5d  %8lu\n", LCD_Panels[i]->Name,
+                       Rotations[r], m, o.Madctl, o.Width, o.Height, o.X_Offset, o.Y_Offset,
+                       (unsigned long)Bad);
+            }
+        }
+    }
+
+    for(i = 0; i < sizeof(Legacy) / sizeof(Legacy[0]); i++) {
+        LCD_Orient_Get(LCD_Panel_Find(Legacy[i].Name), Legacy[i].Rotate, LCD_MIRROR_NONE, &o);
+        if(((o.Madctl ^ Legacy[i].Madctl) & ~LCD_MADCTL_ML) ||
+           o.X_Offset != Legacy[i].X_Offset || o.Y_Offset != Legacy[i].Y_Offset) {
+            printf("legacy %s %d: driver 0x%02X %d,%d, table 0x%02X %d,%d\n", Legacy[i].Name,
+                   Legacy[i].Rotate, Legacy[i].Madctl, Legacy[i].X_Offset, Legacy[i].Y_Offset,
+                   o.Madctl, o.X_Offset, o.Y_Offset);
+            Legacy_Bad++;
+        }
+    }
+
+    printf("\n%dx%d canvas through Paint_SetPixel(), us per frame\n", SIZE, SIZE);
+    printf("  ROTATE_90 in software      %8.0f\n", Time_Canvas(ROTATE_90));
+    printf("  ROTATE_0, MADCTL rotates   %8.0f\n", Time_Canvas(ROTATE_0));
+
+    printf("\nall orientations match the software transform: %s\n", Bad_Total ? "NO" : "yes");
+    printf("table matches the legacy drivers: %s\n", Legacy_Bad ? "NO" : "yes");
+    return Bad_Total || Legacy_Bad;
+}
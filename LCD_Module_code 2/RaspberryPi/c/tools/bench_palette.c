@@ -0,0 +1,155 @@
+/*****************************************************************************
+* | File      	:   bench_palette.c
+* | Function    :   Indexed canvases: memory saved, expansion cost
+* | Info        :
+*   1. Canvas memory at 16, 8, 4 and 2 bpp.
+*   2. A UI scene (fills, circles, lines, text) drawn with the Paint
+*      primitives on a 16-bit canvas and, with indices, on 8/4/2 bpp
+*      canvases; every indexed canvas expanded through its palette must
+*      equal the 16-bit one, also for windows not on a byte boundary.
+*   3. Time to expand a full frame: per byte (the LUT in GUI_Palette.c)
+*      and per pixel (shift, mask, lookup), next to the time the frame
+*      takes on a 25 MHz SPI bus (DEV_Config.c).
+*   4. Time to draw the scene and to switch the palette (theme change).
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_palette
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Palette.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define SIZE    240
+#define ROUNDS  200
+#define SPI_HZ  25000000
+
+static UWORD Canvas16[SIZE * SIZE];
+static UBYTE Canvas[SIZE * SIZE];       // Big enough for 8 bpp
+static UWORD Line[SIZE];
+
+static const UWORD Day[4] = {WHITE, BLACK, BLUE, RED};
+static const UWORD Night[4] = {BLACK, GRAY, CYAN, YELLOW};
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Colours are Day[] entries on a 16-bit canvas, indices otherwise
+**/
+static void Scene(UBYTE Indexed)
+{
+    UWORD c[4] = {0, 1, 2, 3};
+    UWORD i;
+
+    if(!Indexed)
+        memcpy(c, Day, sizeof(c));
+    Paint_Clear(c[0]);
+    Paint_DrawCircle(120, 120, 110, c[2], DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawCircle(120, 120, 20, c[3], DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    for(i = 0; i < 12; i++)
+        Paint_DrawLine(120, 120, 30 + i * 15, 30 + (i * 37) % 180, c[1], DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    Paint_DrawRectangle(37, 150, 203, 190, c[2], DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_EN(41, 160, "88.3 km/h", &Font20, c[1], c[2]);
+    Paint_DrawString_EN(61, 60, "READY", &Font24, FONT_BACKGROUND, c[3]);   // Transparent
+}
+
+static void Expand_PerPixel(UWORD *Out, const UBYTE *Row, UWORD Width, const PAINT_PALETTE *Palette)
+{
+    UBYTE Depth = Palette->Depth, Mask = (1 << Depth) - 1;
+    UWORD x;
+
+    for(x = 0; x < Width; x++) {
+        UDOUBLE Bit = (UDOUBLE)x * Depth;
+        Out[x] = Palette->Pixel[(Row[Bit >> 3] >> (8 - Depth - (Bit & 7))) & Mask];
+    }
+}
+
+static UDOUBLE Compare(PAINT_PALETTE *Palette, UWORD Xstart, UWORD Width)
+{
+    UDOUBLE Bad = 0;
+    UWORD y, x;
+
+    for(y = 0; y < SIZE; y++) {
+        Paint_PaletteRow(y, Xstart, Width, Line, Palette);
+        for(x = 0; x < Width; x++)
+            if(Line[x] != Canvas16[y * SIZE + Xstart + x])
+                Bad++;
+    }
+    return Bad;
+}
+
+int main(void)
+{
+    static const UBYTE Depths[] = {8, 4, 2};
+    PAINT_PALETTE Palette;
+    UDOUBLE Bad_Total = 0;
+    double t0, t_byte, t_pixel, t_draw16, t_draw, t_swap;
+    UWORD i, r, y;
+
+    printf("canvas bytes    16 bpp    8 bpp    4 bpp    2 bpp\n");
+    printf("240x240       %7lu  %7lu  %7lu  %7lu\n",
+           (unsigned long)Paint_ImageSize(240, 240, 16),
+           (unsigned long)Paint_ImageSize(240, 240, 8), (unsigned long)Paint_ImageSize(240, 240, 4),
+           (unsigned long)Paint_ImageSize(240, 240, 2));
+    printf("320x240       %7lu  %7lu  %7lu  %7lu\n",
+           (unsigned long)Paint_ImageSize(320, 240, 16), (unsigned long)Paint_ImageSize(320, 240, 8),
+           (unsigned long)Paint_ImageSize(320, 240, 4), (unsigned long)Paint_ImageSize(320, 240, 2));
+    printf("palette       %7s  %7lu  (tables rebuilt on every palette change)\n\n", "-",
+           (unsigned long)sizeof(PAINT_PALETTE));
+
+    Paint_NewImage(Canvas16, SIZE, SIZE, ROTATE_0, WHITE, 16);
+    t0 = Now_s();
+    for(r = 0; r < ROUNDS; r++)
+        Scene(0);
+    t_draw16 = (Now_s() - t0) / ROUNDS * 1e6;
+
+    printf("SPI %d MHz: a full frame is %.0f us on the bus; 16 bpp scene drawn in %.0f us\n",
+           SPI_HZ / 1000000, SIZE * SIZE * 2 * 8.0 / SPI_HZ * 1e6, t_draw16);
+    printf("depth  draw us  expand us/frame: per byte  per pixel  palette swap us  wrong px\n");
+    for(i = 0; i < sizeof(Depths); i++) {
+        UDOUBLE Bad;
+
+        Paint_NewPalette(&Palette, Depths[i], Day, 4);
+        Paint_NewImage((UWORD *)Canvas, SIZE, SIZE, ROTATE_0, 0, Depths[i]);
+        t0 = Now_s();
+        for(r = 0; r < ROUNDS; r++)
+            Scene(1);
+        t_draw = (Now_s() - t0) / ROUNDS * 1e6;
+
+        Bad = Compare(&Palette, 0, SIZE) + Compare(&Palette, 3, 101) + Compare(&Palette, 117, 122);
+        Bad_Total += Bad;
+
+        t0 = Now_s();
+        for(r = 0; r < ROUNDS; r++)
+            for(y = 0; y < SIZE; y++)
+                Paint_PaletteRow(y, 0, SIZE, Line, &Palette);
+        t_byte = (Now_s() - t0) / ROUNDS * 1e6;
+
+        t0 = Now_s();
+        for(r = 0; r < ROUNDS; r++)
+            for(y = 0; y < SIZE; y++)
+                Expand_PerPixel(Line, Canvas + y * Paint.WidthByte, SIZE, &Palette);
+        t_pixel = (Now_s() - t0) / ROUNDS * 1e6;
+
+        t0 = Now_s();
+        for(r = 0; r < ROUNDS; r++)
+            Paint_SetPaletteColors(&Palette, 0, (r & 1) ? Day : Night, 4);
+        t_swap = (Now_s() - t0) / ROUNDS * 1e6;
+
+        printf("%5d  %7.0f  %25.0f  %9.0f  %15.1f  %8lu\n", Depths[i], t_draw, t_byte, t_pixel,
+               t_swap, (unsigned long)Bad);
+    }
+
+    printf("\nindexed canvases match the 16-bit canvas: %s\n", Bad_Total ? "NO" : "yes");
+    return Bad_Total != 0;
+}
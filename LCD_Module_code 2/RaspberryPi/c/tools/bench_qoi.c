@@ -0,0 +1,229 @@
+/*****************************************************************************
+* | File      	:   bench_qoi.c
+* | Function    :   Q565 against BMP and the image.c arrays: size and decode speed
+* | Info        :
+*   For every BMP in pic/ (or the files given) and the two arrays in
+*   examples/image.c, prints the stored size as BMP, raw RGB565 array and
+*   Q565, and the decode rate into a 16-bit canvas:
+*     - bmp:    GUI_ReadBmp() from the file (page cache warm)
+*     - array:  Paint_DrawImage() of the raw array
+*     - q565:   Paint_DrawQoi() from memory
+*     - band:   GFX_Qoi_DecodeRow() into a BAND-row buffer, no canvas,
+*               as a band renderer or the Pico would run it
+*   Every Q565 decode is compared with the source pixels.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_qoi [file.bmp ...]
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_BMP.h"
+#include "GUI_Qoi.h"
+#include "image.h"
+
+#include <glob.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define BAND        16
+#define MIN_TIME    0.05        // Seconds spent on each decoder per asset
+
+typedef struct {
+    const char *Name;
+    const char *Path;           // BMP file, or NULL
+    const UBYTE *Array;         // image.c array (little-endian RGB565), or NULL
+    UWORD Width, Height;
+} ASSET;
+
+typedef enum { DEC_BMP = 0, DEC_ARRAY, DEC_Q565, DEC_BAND } DECODER;
+
+static UWORD *Canvas;
+static UBYTE *Data;
+static UDOUBLE Size;
+static const ASSET *Current;
+static int Quiet = -1;
+static UWORD Band[BAND * 0x10000 / 64];
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/******************************************************************************
+function: GUI_ReadBmp reports every file on stdout; send it to /dev/null
+******************************************************************************/
+static void Bmp_Read(const char *Path)
+{
+    int Saved;
+
+    fflush(stdout);
+    Saved = dup(1);
+    if(Quiet < 0)
+        Quiet = open("/dev/null", O_WRONLY);
+    dup2(Quiet, 1);
+    GUI_ReadBmp(Path);
+    fflush(stdout);
+    dup2(Saved, 1);
+    close(Saved);
+}
+
+static void Decode(DECODER Decoder)
+{
+    GFX_Qoi Qoi;
+
+    switch(Decoder) {
+    case DEC_BMP:
+        Bmp_Read(Current->Path);
+        break;
+    case DEC_ARRAY:
+        Paint_DrawImage(Current->Array, 0, 0, Current->Width, Current->Height);
+        break;
+    case DEC_Q565:
+        Paint_DrawQoi(Data, Size, 0, 0);
+        break;
+    case DEC_BAND:
+        GFX_Qoi_Open(&Qoi, Data, Size);
+        for(UWORD y = 0; y < Qoi.height; y++)
+            GFX_Qoi_DecodeRow(&Qoi, Band + (y % BAND) * Qoi.width, GFX_ORDER_NATIVE);
+        break;
+    }
+}
+
+/******************************************************************************
+function: Megapixels per second of one decoder, 0 if it does not apply
+******************************************************************************/
+static double Rate(DECODER Decoder)
+{
+    UDOUBLE Runs = 0;
+    double t0 = Now_s(), t;
+
+    if((Decoder == DEC_BMP && !Current->Path) || (Decoder == DEC_ARRAY && !Current->Array))
+        return 0;
+    do {
+        Decode(Decoder);
+        Runs++;
+    } while((t = Now_s() - t0) < MIN_TIME);
+    return (double)Runs * Current->Width * Current->Height / t / 1e6;
+}
+
+static void Print_Rate(double Mpx)
+{
+    if(Mpx > 0)
+        printf("  %7.1f", Mpx);
+    else
+        printf("  %7s", "-");
+}
+
+/******************************************************************************
+function: One table row; returns the number of wrong pixels
+******************************************************************************/
+static UDOUBLE Run_Asset(const ASSET *Asset, UDOUBLE Total[3])
+{
+    UDOUBLE Count = (UDOUBLE)Asset->Width * Asset->Height, Wrong = 0, Raw = Count * 2;
+    UWORD *Source = malloc(Count * sizeof(UWORD));
+    struct stat st;
+    GFX_Qoi Qoi;
+
+    Current = Asset;
+    Canvas = calloc(Count, sizeof(UWORD));
+    Data = malloc(GFX_QOI_MAX_SIZE(Asset->Width, Asset->Height));
+    if(Source == NULL || Canvas == NULL || Data == NULL) {
+        printf("%-20s out of memory\n", Asset->Name);
+        exit(1);
+    }
+    Paint_NewImage(Canvas, Asset->Width, Asset->Height, ROTATE_0, BLACK, 16);
+    Paint_SelectImage(Canvas);
+
+    // Source pixels as the existing loaders produce them
+    Decode(Asset->Path ? DEC_BMP : DEC_ARRAY);
+    for(UDOUBLE i = 0; i < Count; i++)
+        Source[i] = GFX_Swap565(Canvas[i]);
+    Size = GFX_Qoi_Encode(Source, Asset->Width, Asset->Height, Data,
+                          GFX_QOI_MAX_SIZE(Asset->Width, Asset->Height));
+
+    // Canvas and band decodes must give the source back
+    Paint_Clear(BLACK);
+    if(!Paint_DrawQoi(Data, Size, 0, 0))
+        Wrong += Count;
+    for(UDOUBLE i = 0; i < Count; i++)
+        Wrong += GFX_Swap565(Canvas[i]) != Source[i];
+    GFX_Qoi_Open(&Qoi, Data, Size);
+    for(UWORD y = 0; y < Asset->Height; y++) {
+        GFX_Qoi_DecodeRow(&Qoi, Band, GFX_ORDER_NATIVE);
+        Wrong += memcmp(Band, Source + y * Asset->Width, Asset->Width * 2) != 0;
+    }
+
+    printf("%-20s %4ux%-4u", Asset->Name, Asset->Width, Asset->Height);
+    if(Asset->Path && stat(Asset->Path, &st) == 0)
+        printf(" %8lu", (unsigned long)st.st_size);
+    else
+        printf(" %8s", "-");
+    printf(" %8lu %8lu %5.1f%%", (unsigned long)Raw, (unsigned long)Size, 100.0 * Size / Raw);
+    for(DECODER d = DEC_BMP; d <= DEC_BAND; d++)
+        Print_Rate(Rate(d));
+    printf("\n");
+
+    Total[0] += Asset->Path && stat(Asset->Path, &st) == 0 ? st.st_size : 0;
+    Total[1] += Raw;
+    Total[2] += Size;
+    free(Source);
+    free(Canvas);
+    free(Data);
+    return Wrong;
+}
+
+int main(int argc, char *argv[])
+{
+    static const ASSET Arrays[] = {
+        {"image.c gImage_1", NULL, gImage_1, 60, 60},
+        {"image.c gImage_70X70", NULL, gImage_70X70, 70, 70},
+    };
+    UDOUBLE Total[3] = {0, 0, 0}, Wrong = 0;
+    glob_t Files;
+    char **Paths = argv + 1;
+    int Count = argc - 1;
+
+    if(Count == 0) {
+        if(glob("pic/*.bmp", 0, NULL, &Files) == 0) {
+            Paths = Files.gl_pathv;
+            Count = Files.gl_pathc;
+        }
+    }
+
+    printf("Decode rate in Mpx/s into a 16-bit canvas; band = %d-row buffer, no canvas\n", BAND);
+    printf("%-20s %9s %8s %8s %8s %6s  %7s  %7s  %7s  %7s\n", "asset", "size", "bmp B",
+           "array B", "q565 B", "q/arr", "bmp", "array", "q565", "band");
+    for(int i = 0; i < Count; i++) {
+        BMPFILEHEADER FileHeader;
+        BMPINF Info;
+        FILE *fp = fopen(Paths[i], "rb");
+        ASSET Asset = {strrchr(Paths[i], '/') ? strrchr(Paths[i], '/') + 1 : Paths[i], Paths[i], NULL};
+
+        if(fp == NULL || fread(&FileHeader, sizeof(FileHeader), 1, fp) != 1 ||
+           fread(&Info, sizeof(Info), 1, fp) != 1 || FileHeader.bType != 0x4D42 ||
+           Info.bWidth == 0 || Info.bWidth > 0xFFFF || Info.bHeight == 0 || Info.bHeight > 0xFFFF) {
+            printf("%-20s not a bottom-up BMP\n", Asset.Name);
+            if(fp)
+                fclose(fp);
+            continue;
+        }
+        fclose(fp);
+        Asset.Width = Info.bWidth;
+        Asset.Height = Info.bHeight;
+        Wrong += Run_Asset(&Asset, Total);
+    }
+    for(UBYTE i = 0; i < sizeof(Arrays) / sizeof(Arrays[0]); i++)
+        Wrong += Run_Asset(&Arrays[i], Total);
+
+    printf("total: BMP files %lu B, RGB565 %lu B, Q565 %lu B (%.1f%% of RGB565)\n",
+           (unsigned long)Total[0], (unsigned long)Total[1], (unsigned long)Total[2],
+           100.0 * Total[2] / Total[1]);
+    printf("Q565 decodes == source: %s\n", Wrong ? "NO" : "yes");
+    return Wrong != 0;
+}
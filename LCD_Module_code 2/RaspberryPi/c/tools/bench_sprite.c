@@ -0,0 +1,153 @@
+/*****************************************************************************
+* | File      	:   bench_sprite.c
+* | Function    :   Sprite throughput at a fixed SPI budget
+* | Info        :
+*   N colour-keyed sprites bounce over an anti-aliased gauge. The flush
+*   callback counts the bytes a windowed write would put on the bus
+*   (CASET + RASET + RAMWR = 11 bytes, then 2 bytes per pixel) instead
+*   of talking to the panel. Every frame is checked against a brute-force
+*   redraw (background + sprites in Z order).
+*
+*   Budget: 25 MHz SPI (DEV_Config.c) at 60 frames/s = 52083 bytes/frame.
+*   A full-screen LCD_1IN28_Display() is 115211 bytes.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_sprite
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Sprite.h"
+#include "GUI_AA.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIZE        240
+#define FRAMES      300
+#define SPI_HZ      25000000
+#define FPS         60
+#define BUDGET      (SPI_HZ / 8 / FPS)
+#define WINDOW_COST 11
+
+static UWORD Canvas[SIZE * SIZE];
+static UWORD Background[SIZE * SIZE];
+static UWORD Check[SIZE * SIZE];
+static UWORD Image[SPRITE_MAX][64 * 64];
+static UWORD Save[SPRITE_MAX][64 * 64];
+static UDOUBLE Bytes;
+
+static void Count_Flush(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Img)
+{
+    Bytes += WINDOW_COST + 2 * (Xend - Xstart) * (Yend - Ystart);
+}
+
+static double Now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void Build_Background(void)
+{
+    Paint_NewImage(Canvas, SIZE, SIZE, ROTATE_0, BLACK, 16);
+    Paint_Clear(BLACK);
+    Paint_DrawArcAA(120, 120, 110, 8, 225, 135, BLUE);
+    for(int i = 0; i <= 10; i++) {
+        double a = (-135 + 27 * i) * M_PI / 180;
+        Paint_DrawLineAA(120 + sin(a) * 92, 120 - cos(a) * 92, 120 + sin(a) * 102, 120 - cos(a) * 102, 2, WHITE);
+    }
+    memcpy(Background, Canvas, sizeof(Canvas));
+}
+
+// A disc in a keyed (magenta) square
+static void Build_Image(UWORD *Img, int Size, UWORD Color)
+{
+    for(int y = 0; y < Size; y++)
+        for(int x = 0; x < Size; x++) {
+            double d = hypot(x - (Size - 1) / 2.0, y - (Size - 1) / 2.0);
+            Img[x + y * Size] = d < Size / 2.0 ? (d < Size / 4.0 ? WHITE : Color) : MAGENTA;
+        }
+}
+
+// Background plus every visible sprite in Z order, the slow way
+static int Verify(SPRITE_LIST *List)
+{
+    memcpy(Check, Background, sizeof(Check));
+    for(int i = 0; i < List->Count; i++) {
+        SPRITE *s = List->Sprite[i];
+        if(!s->Visible)
+            continue;
+        for(int y = 0; y < s->Height; y++)
+            for(int x = 0; x < s->Width; x++) {
+                int X = s->X + x, Y = s->Y + y;
+                UWORD c = s->Image[x + y * s->Width];
+                if(X < 0 || Y < 0 || X >= SIZE || Y >= SIZE || (s->Keyed && c == s->Key))
+                    continue;
+                Check[X + Y * SIZE] = GFX_Swap565(c);
+            }
+    }
+    return memcmp(Check, Canvas, sizeof(Check)) == 0;
+}
+
+static void Run(int Count, int Size)
+{
+    static const UWORD Colors[4] = {RED, GREEN, YELLOW, CYAN};
+    SPRITE Sprite[SPRITE_MAX];
+    int Vx[SPRITE_MAX], Vy[SPRITE_MAX];
+    SPRITE_LIST List;
+    int Ok = 1;
+
+    Build_Background();
+    SpriteList_Init(&List, Count_Flush);
+    srand(Count * 131 + Size);
+    for(int i = 0; i < Count; i++) {
+        Build_Image(Image[i], Size, Colors[i % 4]);
+        Sprite_Init(&Sprite[i], Image[i], Save[i], Size, Size);
+        Sprite_SetColorKey(&Sprite[i], MAGENTA);
+        Sprite_SetZ(&Sprite[i], rand() % 4);
+        Sprite_MoveTo(&Sprite[i], rand() % (SIZE - Size), rand() % (SIZE - Size));
+        Vx[i] = (rand() % 3 + 1) * (rand() & 1 ? 1 : -1);
+        Vy[i] = (rand() % 3 + 1) * (rand() & 1 ? 1 : -1);
+        SpriteList_Add(&List, &Sprite[i]);
+    }
+    SpriteList_Update(&List);
+
+    double Cpu = 0;
+    Bytes = 0;
+    for(int f = 0; f < FRAMES; f++) {
+        for(int i = 0; i < Count; i++) {
+            SPRITE *s = &Sprite[i];
+            if(s->X + Vx[i] < -Size / 2 || s->X + Vx[i] > SIZE - Size / 2) Vx[i] = -Vx[i];
+            if(s->Y + Vy[i] < -Size / 2 || s->Y + Vy[i] > SIZE - Size / 2) Vy[i] = -Vy[i];
+            Sprite_MoveTo(s, s->X + Vx[i], s->Y + Vy[i]);
+            if(f % 50 == i)
+                Sprite_SetZ(s, s->Z + 1);
+        }
+        double t0 = Now_us();
+        SpriteList_Update(&List);
+        Cpu += Now_us() - t0;
+        if(f % 10 == 0)
+            Ok &= Verify(&List);
+    }
+
+    double PerFrame = (double)Bytes / FRAMES;
+    printf("  %2d x %2dpx  %7.0f B/frame  %5.1f%% of budget  bus fps %6.0f  %7.0f sprites/s  cpu %5.1f us  %s\n",
+           Count, Size, PerFrame, 100 * PerFrame / BUDGET, SPI_HZ / 8 / PerFrame,
+           Count * SPI_HZ / 8 / PerFrame, Cpu / FRAMES, Ok ? "ok" : "MISMATCH");
+}
+
+int main(void)
+{
+    printf("Budget %d B/frame (%d Hz SPI, %d fps); full frame %d B (%.1f fps)\n",
+           BUDGET, SPI_HZ, FPS, WINDOW_COST + SIZE * SIZE * 2, SPI_HZ / 8.0 / (WINDOW_COST + SIZE * SIZE * 2));
+    int Sizes[3] = {16, 32, 64};
+    for(int s = 0; s < 3; s++)
+        for(int n = 1; n <= SPRITE_MAX; n *= 2)
+            Run(n, Sizes[s]);
+    return 0;
+}
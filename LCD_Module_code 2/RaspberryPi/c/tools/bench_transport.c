@@ -0,0 +1,206 @@
+/*****************************************************************************
+* | File      	:   bench_transport.c
+* | Function    :   SPI/GPIO backends: frames/s, windows/s, init time, CPU
+* | Info        :
+*   Runs LCD_1in28 over the backend the Makefile selects with USELIB and
+*   sweeps SPI clocks (DEV_SPI_SetSpeed) and transfer sizes:
+*   - init:    DEV_ModuleInit() and LCD_1IN28_Init() (with its 440 ms of
+*              reset and sleep-out delays)
+*   - frames:  full 240x240 frames per second
+*   - windows: small windows (default 16x16) per second at moving places
+*   - cpu:     time this thread spent in user and kernel mode, as a share
+*              of the wall time (the lgpio backlight thread not included)
+*   Chunk "row" is one transfer per row, as LCD_1IN28_Display() and
+*   _DisplayWindows() do; a number sends the window as one stream cut in
+*   transfers of that many bytes. spidev (wiringPi, lgpio) refuses
+*   transfers over its bufsiz, 4096 unless spidev.bufsiz= is set.
+*
+*   One backend per build; on a Pi:
+*     make clean; make bench_transport USELIB=USE_BCM2835_LIB
+*     sudo ./bench_transport
+*   On any host, over the fake backend (SPI time slept, no per-transfer
+*   gaps), to try the harness:
+*     make tools && ./bin/host/bench_transport -f 3
+*
+*   Options: -s Hz,Hz,..  -c row,Bytes,..  -f frames  -w windows  -n size
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#define _GNU_SOURCE
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#define SIZE        240
+#define MAX_SWEEP   16
+
+// Exported by LCD_1in28.c, not declared in its header
+void LCD_1IN28_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+
+static UWORD Frame[SIZE * SIZE];
+static UWORD Pack[SIZE * SIZE];
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double Cpu_s(void)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_THREAD, &ru);
+    return ru.ru_utime.tv_sec + ru.ru_stime.tv_sec +
+           (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) / 1e6;
+}
+
+/******************************************************************************
+function:	Comma-separated numbers; "row" reads as 0
+******************************************************************************/
+static int Parse_List(const char *Arg, UDOUBLE *List)
+{
+    int n = 0;
+    char *end;
+
+    while(*Arg && n < MAX_SWEEP) {
+        if(!strncmp(Arg, "row", 3)) {
+            List[n] = 0;
+            end = (char *)Arg + 3;
+        } else {
+            List[n] = strtoul(Arg, &end, 10);
+            if(end == Arg)
+                break;
+        }
+        n++;
+        Arg = *end == ',' ? end + 1 : end;
+    }
+    return n;
+}
+
+/******************************************************************************
+function:	Send a window of Frame
+parameter:
+    Chunk : 0 = one transfer per row, else transfers of Chunk bytes
+Info:		A window narrower than the frame is packed first, as a
+            canvas of its own would be.
+******************************************************************************/
+static void Send(UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UDOUBLE Chunk)
+{
+    UDOUBLE w = X1 - X0, len = w * (Y1 - Y0) * 2;
+    uint8_t *p;
+    UWORD y;
+
+    LCD_1IN28_SetWindows(X0, Y0, X1, Y1);
+    LCD_1IN28_DC_1;
+    if(Chunk == 0) {
+        for(y = Y0; y < Y1; y++)
+            DEV_SPI_Write_nByte((uint8_t *)&Frame[y * SIZE + X0], w * 2);
+        return;
+    }
+    if(w == SIZE) {
+        p = (uint8_t *)&Frame[Y0 * SIZE];
+    } else {
+        for(y = Y0; y < Y1; y++)
+            memcpy(&Pack[(y - Y0) * w], &Frame[y * SIZE + X0], w * 2);
+        p = (uint8_t *)Pack;
+    }
+    for(; len > Chunk; len -= Chunk, p += Chunk)
+        DEV_SPI_Write_nByte(p, Chunk);
+    DEV_SPI_Write_nByte(p, len);
+}
+
+int main(int argc, char *argv[])
+{
+    UDOUBLE clocks[MAX_SWEEP] = {7812500, 15625000, 25000000, 31250000, 62500000};
+    UDOUBLE chunks[MAX_SWEEP] = {0, 1024, 4096};
+    int n_clocks = 5, n_chunks = 3;
+    int frames = 10, windows = 500, size = 16;
+    double t, c, module_s, init_s, init_cpu;
+    int i, k, j;
+
+    for(i = 1; i + 1 < argc; i += 2) {
+        if(!strcmp(argv[i], "-s"))
+            n_clocks = Parse_List(argv[i + 1], clocks);
+        else if(!strcmp(argv[i], "-c"))
+            n_chunks = Parse_List(argv[i + 1], chunks);
+        else if(!strcmp(argv[i], "-f"))
+            frames = atoi(argv[i + 1]);
+        else if(!strcmp(argv[i], "-w"))
+            windows = atoi(argv[i + 1]);
+        else if(!strcmp(argv[i], "-n"))
+            size = atoi(argv[i + 1]);
+        else
+            break;
+    }
+    if(i < argc || n_clocks == 0 || n_chunks == 0 || frames < 1 || windows < 1 ||
+       size < 1 || size >= SIZE) {
+        fprintf(stderr, "usage: %s [-s Hz,Hz,..] [-c row,Bytes,..] [-f frames] [-w windows] [-n size]\n",
+                argv[0]);
+        return 1;
+    }
+    for(i = 0; i < SIZE * SIZE; i++)
+        Frame[i] = (UWORD)(i * 2654435761u >> 16);
+
+    t = Now_s();
+    if(DEV_ModuleInit() != 0)
+        return 1;
+    module_s = Now_s() - t;
+    t = Now_s();
+    c = Cpu_s();
+    LCD_1IN28_Init(HORIZONTAL);
+    init_s = Now_s() - t;
+    init_cpu = Cpu_s() - c;
+
+    printf("backend %s: DEV_ModuleInit %.1f ms, LCD_1IN28_Init %.1f ms (cpu %.2f ms)\r\n",
+           DEV_BACKEND, module_s * 1e3, init_s * 1e3, init_cpu * 1e3);
+    printf("%d frames of %dx%d (%d bytes), %d windows of %dx%d (%d bytes)\r\n",
+           frames, SIZE, SIZE, SIZE * SIZE * 2, windows, size, size, size * size * 2);
+    printf("   clock Hz  chunk  bound fps  frames/s  cpu%%  windows/s  cpu%%\r\n");
+
+    for(k = 0; k < n_clocks; k++) {
+        UDOUBLE hz = DEV_SPI_SetSpeed(clocks[k]);
+        if(hz == 0) {
+            printf("%11lu  not set (spidev reopen failed), skipped\r\n", (unsigned long)clocks[k]);
+            continue;
+        }
+        for(j = 0; j < n_chunks; j++) {
+            double fps, fps_cpu, wps, wps_cpu;
+            char name[12];
+
+            t = Now_s();
+            c = Cpu_s();
+            for(i = 0; i < frames; i++)
+                Send(0, 0, SIZE, SIZE, chunks[j]);
+            t = Now_s() - t;
+            fps = frames / t;
+            fps_cpu = (Cpu_s() - c) / t * 100;
+
+            t = Now_s();
+            c = Cpu_s();
+            for(i = 0; i < windows; i++) {
+                UWORD x = i * 37 % (SIZE - size), y = i * 53 % (SIZE - size);
+                Send(x, y, x + size, y + size, chunks[j]);
+            }
+            t = Now_s() - t;
+            wps = windows / t;
+            wps_cpu = (Cpu_s() - c) / t * 100;
+
+            if(chunks[j])
+                snprintf(name, sizeof(name), "%lu", (unsigned long)chunks[j]);
+            else
+                snprintf(name, sizeof(name), "row");
+            printf("%11lu  %5s  %9.1f  %8.1f  %4.0f  %9.0f  %4.0f\r\n", (unsigned long)hz, name,
+                   hz / (8.0 * SIZE * SIZE * 2), fps, fps_cpu, wps, wps_cpu);
+        }
+    }
+
+    DEV_ModuleExit();
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*****************************************************************************
+* | File      	:   bench_widget.c
+* | Function    :   Dashboard ticks: immediate mode vs retained widgets
+* | Info        :
+*   A 240x240 dashboard (title, clock, gauge, two readouts, bar, chart,
+*   blinking icon, status label) driven by the same signals for TICKS
+*   ticks, two ways:
+*     - immediate: Paint_Clear(), every widget repainted, full-screen push
+*     - retained:  setters + WidgetList_Update(), one window per widget
+*                  that changed, covering only its invalid part
+*   CPU is measured on this host; bus time is modelled at SPI_HZ with
+*   WINDOW_COST bytes of commands per window. After every tick the
+*   retained canvas must equal the immediate one.
+*
+*   Build and run on any host:  make tools && ./bin/host/bench_widget
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Widget.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define SIZE        240
+#define TICKS       2000        // 10 ticks per second of signal time
+#define SPI_HZ      25000000
+#define WINDOW_COST 11
+#define ICON        16
+
+typedef struct {
+    WIDGET_LIST List;
+    WIDGET Title, Clock, Status, Speed, Temp, Load, Dial, Trend, Alarm;
+    GFX_Gauge Gauge;
+    UBYTE Level[120];
+} DASHBOARD;
+
+typedef struct {
+    UDOUBLE Bytes, Windows, Pixels;
+    double Cpu;
+} COST;
+
+static UWORD Immediate[SIZE * SIZE];
+static UWORD Retained[SIZE * SIZE];
+static UWORD Icon[ICON * ICON];
+static COST *Counting;
+
+static void Count_Flush(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
+{
+    Counting->Bytes += WINDOW_COST + 2 * (Xend - Xstart) * (Yend - Ystart);
+    Counting->Windows++;
+    Counting->Pixels += (Xend - Xstart) * (Yend - Ystart);
+}
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/******************************************************************************
+function: Warning triangle, magenta (the colour key) outside it
+******************************************************************************/
+static void Icon_Make(void)
+{
+    for(int y = 0; y < ICON; y++)
+        for(int x = 0; x < ICON; x++) {
+            int Half = (y + 1) / 2;
+            int In = y >= 1 && x >= ICON / 2 - Half && x < ICON / 2 + Half;
+            int Mark = x >= 7 && x < 9 && ((y >= 5 && y < 11) || y >= 13);
+            Icon[y * ICON + x] = !In ? MAGENTA : Mark ? BLACK : YELLOW;
+        }
+}
+
+static void Dashboard_Init(DASHBOARD *Dash, UWORD *Canvas, WIDGET_FLUSH Flush)
+{
+    Paint_NewImage(Canvas, SIZE, SIZE, ROTATE_0, BLACK, 16);
+    Paint_Clear(BLACK);
+    WidgetList_Init(&Dash->List, Flush);
+
+    Widget_Label(&Dash->Title, 87, 10, 6, &Font16, WHITE, BLACK);
+    Widget_SetText(&Dash->Title, "ENGINE");
+    Widget_Label(&Dash->Clock, 92, 28, 8, &Font12, GRAY, BLACK);
+    Widget_Label(&Dash->Status, 186, 110, 4, &Font12, GREEN, BLACK);
+    GFX_Gauge_Init(&Dash->Gauge, 120, 104, 62);
+    Widget_Gauge(&Dash->Dial, &Dash->Gauge, BLACK);
+    Widget_Icon(&Dash->Alarm, 30, 108, Icon, ICON, ICON, BLACK);
+    Widget_SetColorKey(&Dash->Alarm, MAGENTA);
+    Widget_Readout(&Dash->Temp, 40, 172, 5, 1, &Font20, CYAN, BLACK);
+    Widget_Readout(&Dash->Speed, 130, 172, 5, 0, &Font20, WHITE, BLACK);
+    Widget_Bar(&Dash->Load, 50, 196, 140, 8, 0, 1000, GREEN, GRAY);
+    Widget_Chart(&Dash->Trend, 60, 208, 120, 20, Dash->Level, 0, 1000, YELLOW, BLACK);
+
+    WIDGET *All[] = {&Dash->Title, &Dash->Clock, &Dash->Status, &Dash->Dial, &Dash->Alarm,
+                     &Dash->Temp, &Dash->Speed, &Dash->Load, &Dash->Trend};
+    for(UBYTE i = 0; i < sizeof(All) / sizeof(All[0]); i++)
+        WidgetList_Add(&Dash->List, All[i]);
+}
+
+/******************************************************************************
+function: Signals at tick T: needle and speed move every tick, load and
+          trend every tick, temperature every second, clock every second
+******************************************************************************/
+static void Dashboard_Set(DASHBOARD *Dash, int T)
+{
+    static const signed char Walk[16] = {3, -2, 5, 1, -4, 2, 0, -1, 6, -3, 1, -5, 2, 4, -2, -6};
+    int Phase = T % 240, Needle = Phase < 120 ? Phase * 100 / 120 : (240 - Phase) * 100 / 120;
+    int Load = 500 + (T * 37 % 400) / 2 + Walk[T % 16] * 20;
+    int Seconds = T / 10, Temp = 850 + (Seconds % 120 < 60 ? Seconds % 60 : 60 - Seconds % 60);
+    char Clock[12];
+
+    snprintf(Clock, sizeof(Clock), "%02d:%02d:%02d", 12 + Seconds / 3600, Seconds / 60 % 60, Seconds % 60);
+    Widget_SetText(&Dash->Clock, Clock);
+    Widget_SetValue(&Dash->Dial, Needle);
+    Widget_SetValue(&Dash->Speed, Needle * 65);
+    Widget_SetValue(&Dash->Temp, Temp);
+    Widget_SetValue(&Dash->Load, Load);
+    Widget_SetValue(&Dash->Trend, Load);
+    Widget_SetText(&Dash->Status, Temp >= 900 ? "WARN" : "OK");
+    Widget_SetColor(&Dash->Status, Temp >= 900 ? RED : GREEN, BLACK);
+    Widget_SetVisible(&Dash->Alarm, Temp >= 900 && T / 5 % 2);
+}
+
+static void Report(const char *Name, const COST *Cost)
+{
+    double Bytes = (double)Cost->Bytes / TICKS;
+    double Bus = Bytes * 8 / SPI_HZ * 1e6, Cpu = Cost->Cpu / TICKS * 1e6;
+    printf("  %-9s %8.1f  %8.1f  %7.2f  %8.0f  %8.1f  %7.1f\n", Name, Cpu, Bus,
+           (double)Cost->Windows / TICKS, Bytes, Cpu + Bus, 1e6 / (Cpu + Bus));
+}
+
+int main(void)
+{
+    static DASHBOARD Full, Inc;
+    COST Cost[2];
+    UDOUBLE Mismatch = 0;
+
+    memset(Cost, 0, sizeof(Cost));
+    Icon_Make();
+    Dashboard_Init(&Full, Immediate, NULL);
+    Dashboard_Init(&Inc, Retained, Count_Flush);
+
+    // First paint of the retained screen is a full one, as in immediate mode
+    Counting = &Cost[1];
+    WidgetList_Update(&Inc.List);
+    memset(Cost, 0, sizeof(Cost));
+
+    for(int T = 1; T <= TICKS; T++) {
+        double t0 = Now_s();
+        Paint_SelectImage(Immediate);
+        Paint_Clear(BLACK);
+        Dashboard_Set(&Full, T);
+        WidgetList_Invalidate(&Full.List);
+        WidgetList_Update(&Full.List);
+        Counting = &Cost[0];
+        Count_Flush(0, 0, SIZE, SIZE, Immediate);
+        Cost[0].Cpu += Now_s() - t0;
+
+        t0 = Now_s();
+        Paint_SelectImage(Retained);
+        Dashboard_Set(&Inc, T);
+        Counting = &Cost[1];
+        WidgetList_Update(&Inc.List);
+        Cost[1].Cpu += Now_s() - t0;
+
+        if(memcmp(Immediate, Retained, sizeof(Retained)))
+            Mismatch++;
+    }
+
+    printf("%dx%d dashboard, 9 widgets, %d ticks; bus modelled at %d MHz, %d B per window\n",
+           SIZE, SIZE, TICKS, SPI_HZ / 1000000, WINDOW_COST);
+    printf("  mode      cpu us    bus us  windows   B/tick   tick us  max fps\n");
+    Report("immediate", &Cost[0]);
+    Report("retained", &Cost[1]);
+    printf("  retained: %.0f px pushed per tick (%.1f%% of the screen)\n",
+           (double)Cost[1].Pixels / TICKS, 100.0 * Cost[1].Pixels / TICKS / (SIZE * SIZE));
+    printf("  retained == immediate after every tick: %s", Mismatch ? "NO" : "yes");
+    if(Mismatch)
+        printf(" (%lu ticks differ)", (unsigned long)Mismatch);
+    printf("\n");
+    return Mismatch != 0;
+}
@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+"""Compile a font into the compressed format of lib/gfx/gfx_font.h.
+
+Sources:
+  *.ttf / *.otf   rendered with Pillow at --size pixels
+  *.bdf           bitmap font
+  *.c             an sFONT table from lib/Fonts (ASCII from 0x20, 1 bit)
+
+Glyphs are cropped to their ink box, quantised to --bpp bits of coverage
+and run-length coded. --scale N renders or reads the source N times larger
+and averages N x N blocks, which turns a big 1-bit font into a smaller
+anti-aliased one (e.g. font48.c --scale 2 --bpp 4 gives a smooth 24 px
+font). --chars keeps only the characters an application draws.
+
+Examples:
+  tools/fontc.py lib/Fonts/font24.c --bpp 1 --name Font24R --sfont
+  tools/fontc.py lib/Fonts/font48.c --scale 2 --bpp 4 --name Font24AA --sfont
+  tools/fontc.py DejaVuSans.ttf --size 32 --bpp 4 --chars "0123456789.:-" --name Digits32
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+RUN_MAX = 64
+TOKEN_SKIP, TOKEN_SOLID, TOKEN_LITERAL = 0x00, 0x40, 0x80
+
+
+class Glyph:
+    def __init__(self, code, width, height, x_off, y_off, advance, cover):
+        self.code = code
+        self.width = width
+        self.height = height
+        self.x_off = x_off
+        self.y_off = y_off
+        self.advance = advance
+        self.cover = cover          # row-major floats 0..1, width * height
+
+
+# --- Loaders ----------------------------------------------------------------
+
+def load_sfont(path):
+    text = open(path, encoding='latin-1').read()
+    width = int(re.search(r'(\d+)\s*,\s*/\*\s*Width', text).group(1))
+    height = int(re.search(r'(\d+)\s*,\s*/\*\s*Height', text).group(1))
+    body = re.search(r'\[\]\s*=\s*\{(.*?)\};', text, re.S).group(1)
+    body = re.sub(r'//[^\n]*|/\*.*?\*/', '', body, flags=re.S)
+    data = [int(v, 0) for v in re.findall(r'0[xX][0-9a-fA-F]+|\d+', body)]
+
+    pitch = (width + 7) // 8
+    size = pitch * height
+    glyphs = []
+    for i in range(len(data) // size):
+        bits = data[i * size:(i + 1) * size]
+        cover = [float((bits[y * pitch + x // 8] >> (7 - x % 8)) & 1)
+                 for y in range(height) for x in range(width)]
+        glyphs.append(Glyph(0x20 + i, width, height, 0, 0, width, cover))
+
+    # Baseline: bottom of the ink of 'H' when the table has it
+    ascent = height
+    if len(glyphs) > ord('H') - 0x20:
+        h = glyphs[ord('H') - 0x20]
+        rows = [y for y in range(height) if any(h.cover[y * width:(y + 1) * width])]
+        if rows:
+            ascent = rows[-1] + 1
+    return glyphs, height, ascent
+
+
+def load_bdf(path):
+    glyphs = []
+    ascent = descent = 0
+    lines = iter(open(path, encoding='latin-1').read().splitlines())
+    for line in lines:
+        key, _, rest = line.partition(' ')
+        if key == 'FONT_ASCENT':
+            ascent = int(rest)
+        elif key == 'FONT_DESCENT':
+            descent = int(rest)
+        elif key == 'STARTCHAR':
+            code = advance = None
+            w = h = xo = yo = 0
+            for line in lines:
+                key, _, rest = line.partition(' ')
+                if key == 'ENCODING':
+                    code = int(rest.split()[0])
+                elif key == 'DWIDTH':
+                    advance = int(rest.split()[0])
+                elif key == 'BBX':
+                    w, h, xo, yo = (int(v) for v in rest.split())
+                elif key == 'BITMAP':
+                    rows = [int(next(lines), 16) for _ in range(h)]
+                    bits = ((w + 7) // 8) * 8
+                    cover = [float((r >> (bits - 1 - x)) & 1) for r in rows for x in range(w)]
+                elif key == 'ENDCHAR':
+                    break
+            if code is not None and code >= 0:
+                # BBX offsets are from the baseline up; the pen is at the top of the line
+                glyphs.append(Glyph(code, w, h, xo, ascent - yo - h,
+                                    advance if advance is not None else w, cover))
+    return glyphs, ascent + descent, ascent
+
+
+def load_ttf(path, size, codes):
+    try:
+        from PIL import ImageFont
+    except ImportError:
+        sys.exit('fontc: TrueType sources need Pillow (pip install pillow)')
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = []
+    for code in codes:
+        ch = chr(code)
+        left, top, right, bottom = font.getbbox(ch, anchor='la')
+        w, h = max(right - left, 0), max(bottom - top, 0)
+        cover = [0.0] * (w * h)
+        if w and h:
+            mask = font.getmask(ch, mode='L', anchor='la')
+            mw, mh = mask.size
+            for y in range(min(h, mh)):
+                for x in range(min(w, mw)):
+                    cover[y * w + x] = mask.getpixel((x, y)) / 255.0
+        glyphs.append(Glyph(code, w, h, left, top, int(round(font.getlength(ch))), cover))
+    return glyphs, ascent + descent, ascent
+
+
+# --- Processing -------------------------------------------------------------
+
+def downsample(g, n):
+    """Average n x n blocks, keeping the block grid aligned to the pen."""
+    x0, y0 = g.x_off // n, g.y_off // n
+    x1 = -(-(g.x_off + g.width) // n)
+    y1 = -(-(g.y_off + g.height) // n)
+    w, h = x1 - x0, y1 - y0
+    acc = [0.0] * (w * h)
+    for y in range(g.height):
+        ry = (g.y_off + y) // n - y0
+        for x in range(g.width):
+            c = g.cover[y * g.width + x]
+            if c:
+                acc[ry * w + (g.x_off + x) // n - x0] += c
+    return Glyph(g.code, w, h, x0, y0, int(round(g.advance / n)), [a / (n * n) for a in acc])
+
+
+def quantise_and_crop(g, bpp):
+    top = (1 << bpp) - 1
+    lv = [min(top, int(c * top + 0.5)) for c in g.cover]
+    rows = [y for y in range(g.height) if any(lv[y * g.width:(y + 1) * g.width])]
+    cols = [x for x in range(g.width) if any(lv[y * g.width + x] for y in range(g.height))]
+    if not rows:
+        return g.code, 0, 0, 0, 0, g.advance, []
+    ya, yb, xa, xb = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    levels = [lv[y * g.width + x] for y in range(ya, yb) for x in range(xa, xb)]
+    return g.code, xb - xa, yb - ya, g.x_off + xa, g.y_off + ya, g.advance, levels
+
+
+def encode(levels, bpp):
+    """Smallest token stream for the levels (dynamic programming)."""
+    top = (1 << bpp) - 1
+    n = len(levels)
+    cost = [0] * (n + 1)
+    step = [None] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        best, choice = None, None
+        v = levels[i]
+        if v in (0, top):
+            k = 1
+            while k < RUN_MAX and i + k < n and levels[i + k] == v:
+                k += 1
+            best, choice = 1 + cost[i + k], ('run', k)
+        for k in range(1, min(RUN_MAX, n - i) + 1):
+            c = 1 + (k * bpp + 7) // 8 + cost[i + k]
+            if best is None or c < best:
+                best, choice = c, ('lit', k)
+        cost[i], step[i] = best, choice
+
+    out = bytearray()
+    i = 0
+    while i < n:
+        kind, k = step[i]
+        if kind == 'run':
+            out.append((TOKEN_SOLID if levels[i] else TOKEN_SKIP) | (k - 1))
+        else:
+            out.append(TOKEN_LITERAL | (k - 1))
+            acc = bits = 0
+            for v in levels[i:i + k]:
+                acc = (acc << bpp) | v
+                bits += bpp
+                if bits == 8:
+                    out.append(acc)
+                    acc = bits = 0
+            if bits:
+                out.append(acc << (8 - bits))
+        i += k
+    return bytes(out)
+
+
+def parse_codes(spec):
+    """'A-Z0-9.:' style character list; '\\-' is a literal dash."""
+    codes = set()
+    i = 0
+    while i < len(spec):
+        c = spec[i]
+        if c == '\\' and i + 1 < len(spec):
+            codes.add(ord(spec[i + 1]))
+            i += 2
+        elif i + 2 < len(spec) and spec[i + 1] == '-':
+            codes.update(range(ord(c), ord(spec[i + 2]) + 1))
+            i += 3
+        else:
+            codes.add(ord(c))
+            i += 1
+    return sorted(codes)
+
+
+# --- Output -----------------------------------------------------------------
+
+def c_char(code):
+    ch = chr(code)
+    if ch == '\\':
+        return "'\\\\'"
+    if ch == "'":
+        return "'\\''"
+    return "'%s'" % ch if 0x20 <= code < 0x7F else 'U+%04X' % code
+
+
+def write_c(out, args, src_name, glyphs, bitmap, offsets, line_height, ascent):
+    ranges = []
+    for i, g in enumerate(glyphs):
+        if ranges and ranges[-1][0] + ranges[-1][1] == g[0]:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([g[0], 1, i])
+
+    name = args.name
+    font = name + '_Font' if args.sfont else name
+    flash = len(bitmap) + 8 * len(glyphs) + 6 * len(ranges) + 16
+    scale = ', scale 1/%d' % args.scale if args.scale > 1 else ''
+
+    w = out.write
+    w('/**\n')
+    w(' * @file %s\n' % os.path.basename(args.output or name.lower() + '.c'))
+    w(' * @brief %s: generated by tools/fontc.py, do not edit\n' % name)
+    w(' *\n')
+    w(' * Source %s, %d bpp%s, %d glyphs, line %d px, ascent %d px\n'
+      % (src_name, args.bpp, scale, len(glyphs), line_height, ascent))
+    w(' * Flash %d bytes (bitmap %d)\n' % (flash, len(bitmap)))
+    w(' */\n\n')
+    w('#include "gfx_font.h"\n')
+    if args.sfont:
+        w('#include "fonts.h"\n')
+    w('\nstatic const uint8_t %s_Bitmap[] = {\n' % name)
+    for i in range(0, len(bitmap), 16):
+        w('    ' + ' '.join('0x%02X,' % b for b in bitmap[i:i + 16]) + '\n')
+    if not bitmap:
+        w('    0x00\n')
+    w('};\n\n')
+    w('static const GFX_Glyph %s_Glyphs[] = {\n' % name)
+    for g, off in zip(glyphs, offsets):
+        code, gw, gh, xo, yo, adv, _ = g
+        w('    {%5d, %3d, %3d, %3d, %3d, %3d}, // %s\n' % (off, gw, gh, xo, yo, adv, c_char(code)))
+    w('};\n\n')
+    w('static const GFX_FontRange %s_Ranges[] = {\n' % name)
+    for first, count, index in ranges:
+        w('    {0x%04X, %d, %d},\n' % (first, count, index))
+    w('};\n\n')
+    w('const GFX_Font %s = {\n' % font)
+    w('    %s_Bitmap, %s_Glyphs, %s_Ranges, %d,\n' % (name, name, name, len(ranges)))
+    w('    %d, %d, %d\n' % (args.bpp, line_height, ascent))
+    w('};\n')
+    if args.sfont:
+        cell = max(g[5] for g in glyphs)
+        w('\n// Fixed-pitch adapter for Paint_DrawChar() / Paint_DrawString_EN()\n')
+        w('sFONT %s = {\n  0,\n  %d, /* Width */\n  %d, /* Height */\n  &%s,\n};\n'
+          % (name, cell, line_height, font))
+    return flash
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('source')
+    ap.add_argument('--name', required=True, help='C symbol')
+    ap.add_argument('--bpp', type=int, default=4, choices=(1, 2, 4))
+    ap.add_argument('--size', type=int, default=24, help='pixel size for TrueType sources')
+    ap.add_argument('--scale', type=int, default=1, help='downsample factor (supersampling)')
+    ap.add_argument('--chars', default=' -~', help="characters to keep (default ' -~', printable ASCII)")
+    ap.add_argument('--sfont', action='store_true', help='also emit an sFONT adapter (Raspberry Pi Paint)')
+    ap.add_argument('-o', '--output', help='C file (default stdout)')
+    args = ap.parse_args()
+
+    codes = parse_codes(args.chars)
+    ext = os.path.splitext(args.source)[1].lower()
+    if ext in ('.ttf', '.otf'):
+        glyphs, line_height, ascent = load_ttf(args.source, args.size * args.scale, codes)
+    elif ext == '.bdf':
+        glyphs, line_height, ascent = load_bdf(args.source)
+    elif ext == '.c':
+        glyphs, line_height, ascent = load_sfont(args.source)
+    else:
+        sys.exit('fontc: unknown source type %s' % ext)
+
+    keep = set(codes)
+    glyphs = sorted((g for g in glyphs if g.code in keep), key=lambda g: g.code)
+    if not glyphs:
+        sys.exit('fontc: none of the requested characters are in the source')
+    if args.scale > 1:
+        glyphs = [downsample(g, args.scale) for g in glyphs]
+        line_height = -(-line_height // args.scale)
+        ascent = int(round(ascent / args.scale))
+
+    packed = [quantise_and_crop(g, args.bpp) for g in glyphs]
+    bitmap = bytearray()
+    offsets = []
+    for g in packed:
+        offsets.append(len(bitmap))
+        bitmap += encode(g[6], args.bpp)
+    if len(bitmap) > 0xFFFF:
+        sys.exit('fontc: bitmap exceeds 64 KiB, split the font')
+    for g in packed:
+        if not (0 <= g[1] < 256 and 0 <= g[2] < 256 and -128 <= g[3] < 128
+                and -128 <= g[4] < 128 and 0 <= g[5] < 256):
+            sys.exit('fontc: glyph %s does not fit the metrics fields' % c_char(g[0]))
+
+    out = open(args.output, 'w', newline='') if args.output else sys.stdout
+    flash = write_c(out, args, os.path.basename(args.source), packed, bitmap, offsets,
+                    line_height, ascent)
+    if args.output:
+        out.close()
+
+    missing = len(codes) - len(packed)
+    sys.stderr.write('%s: %d glyphs%s, %d bpp, %d bytes of flash\n'
+                     % (args.name, len(packed), ' (%d missing)' % missing if missing else '',
+                        args.bpp, flash))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,392 @@
+/*****************************************************************************
+* | File      	:   lcd_console.c
+* | Function    :   Text console on the 2inch panel, from a pty or stdin
+* | Info        :
+*   Shows terminal output on the 2inch LCD (ST7789, 240x320) through
+*   GUI_Console: only changed cells are sent, in merged windows, and
+*   scrolling uses the controller's vertical scroll registers.
+*
+*     dmesg | sudo ./lcd_console             (stdin)
+*     sudo ./lcd_console -- top -d 1         (command in a pty, TERM=vt100)
+*     -f 8|12|16|20|24   font (default 12: 34 x 26 cells)
+*     -s                 scroll by resending, for comparison
+*   On exit (end of input, or Ctrl-C) it prints characters/second.
+*
+*   -b runs a bench without a panel: yes-, dmesg- and top-style output
+*   through a model of the controller's memory and scroll registers,
+*   checked pixel for pixel against Paint_DrawChar() of the same text.
+*   chars/s there is measured CPU time plus the modelled bus time at
+*   25 MHz, against a full Paint_DrawChar() frame per update.
+*
+*   On a Pi:  make lcd_console
+*   On any host (fake backend):  make tools && ./bin/host/lcd_console -b
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_Console.h"
+#include "GUI_Paint.h"
+#include "LCD_2inch.h"
+
+#include <pty.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#define SPI_HZ      25000000
+#define SPI_CHUNK   4096        // spidev's default bufsiz
+#define WINDOW_COST 11          // Command and address bytes of a window
+
+static volatile sig_atomic_t Stop = 0;
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double Cpu_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/******************************************************************************
+function:	Output to the panel
+******************************************************************************/
+static void Lcd_Window(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, void *Ctx)
+{
+    LCD_2IN_SetWindow(Xstart, Ystart, Xend, Yend);
+    DEV_Digital_Write(LCD_DC, 1);
+}
+
+static void Lcd_Write(const UWORD *Pixels, UDOUBLE Count, void *Ctx)
+{
+    uint8_t *p = (uint8_t *)Pixels;
+    UDOUBLE Len = Count * 2;
+
+    for(; Len > SPI_CHUNK; Len -= SPI_CHUNK, p += SPI_CHUNK)
+        DEV_SPI_Write_nByte(p, SPI_CHUNK);
+    DEV_SPI_Write_nByte(p, Len);
+}
+
+static void Lcd_Scroll(UWORD Line, void *Ctx)
+{
+    LCD_2IN_SetScrollStart(Line);
+}
+
+/******************************************************************************
+function:	Output to a model of the controller: frame memory, window
+            address counter, vertical scroll start; counts bus bytes
+******************************************************************************/
+static UWORD Gram[LCD_2IN_HEIGHT][LCD_2IN_WIDTH];
+static UWORD Gram_X0, Gram_X1, Gram_X, Gram_Y, Gram_Vsp, Gram_Area;
+static UDOUBLE Gram_Bytes;
+
+static void Model_Window(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, void *Ctx)
+{
+    Gram_X0 = Gram_X = Xstart;
+    Gram_X1 = Xend;
+    Gram_Y = Ystart;
+    Gram_Bytes += WINDOW_COST;
+}
+
+static void Model_Write(const UWORD *Pixels, UDOUBLE Count, void *Ctx)
+{
+    Gram_Bytes += Count * 2;
+    while(Count--) {
+        Gram[Gram_Y][Gram_X] = *Pixels++;
+        if(++Gram_X == Gram_X1) {
+            Gram_X = Gram_X0;
+            Gram_Y++;
+        }
+    }
+}
+
+static void Model_Scroll(UWORD Line, void *Ctx)
+{
+    Gram_Vsp = Line;
+    Gram_Bytes += 3;
+}
+
+/******************************************************************************
+function:	Pixels that differ between the modelled screen and the
+            console's text drawn with Paint_DrawChar()
+******************************************************************************/
+static UDOUBLE Check(CONSOLE *Con, UWORD *Canvas)
+{
+    UWORD W = Con->Font->Width, H = Con->Font->Height;
+    UWORD Col, Row, X, Y;
+    UDOUBLE Wrong = 0;
+
+    Paint_SelectImage(Canvas);
+    Paint_Clear(BLACK);
+    for(Row = 0; Row < Con->Rows; Row++) {
+        for(Col = 0; Col < Con->Cols; Col++) {
+            UWORD Cell = Console_GetCell(Con, Col, Row);
+            Paint_DrawChar(Col * W, Row * H, Cell & 0xFF, Con->Font,
+                           Con->Palette[(Cell >> 8) & 15], Con->Palette[Cell >> 12]);
+        }
+    }
+    for(Y = 0; Y < LCD_2IN_HEIGHT; Y++) {
+        UWORD Line = Y < Gram_Area ? (Y + Gram_Vsp) % Gram_Area : Y;
+        for(X = 0; X < LCD_2IN_WIDTH; X++)
+            Wrong += Gram[Line][X] != Canvas[Y * LCD_2IN_WIDTH + X];
+    }
+    return Wrong;
+}
+
+/******************************************************************************
+function:	Synthetic terminal output
+******************************************************************************/
+static UDOUBLE Feed_Yes(char *Buf, UDOUBLE Size)
+{
+    UDOUBLE n = 0;
+
+    while(n + 2 <= Size) {
+        Buf[n++] = 'y';
+        Buf[n++] = '\n';
+    }
+    return n;
+}
+
+static UDOUBLE Feed_Dmesg(char *Buf, UDOUBLE Size)
+{
+    static const char *Msg[] = {
+        "usb 1-1.3: new high-speed USB device number %u using xhci_hcd",
+        "EXT4-fs (mmcblk0p2): mounted filesystem with ordered data mode",
+        "brcmfmac: brcmf_cfg80211_set_power_mgmt: power save enabled",
+        "spi-bcm2835 fe204000.spi: chipselect %u already in use",
+        "Under-voltage detected! (0x%05x)",
+        "IPv6: ADDRCONF(NETDEV_CHANGE): wlan0: link becomes ready",
+        "systemd[1]: Started Journal Service.",
+        "v3d fec00000.v3d: MMU error from client L2T (%u) at 0x4ac1000",
+    };
+    UDOUBLE n = 0, i = 0;
+    char Line[160];
+
+    for(;; i++) {
+        int Len = snprintf(Line, sizeof(Line), "\x1b[32m[%5lu.%06lu]\x1b[0m ",
+                           (unsigned long)(i / 7), (unsigned long)(i * 104729 % 1000000));
+        Len += snprintf(Line + Len, sizeof(Line) - Len, Msg[i * 5 % 8], (unsigned)(i % 97));
+        Line[Len++] = '\n';
+        if(n + Len > Size)
+            return n;
+        memcpy(Buf + n, Line, Len);
+        n += Len;
+    }
+}
+
+static UDOUBLE Feed_Top(char *Buf, UDOUBLE Size)
+{
+    UDOUBLE n = 0, i = 0, Row;
+    char Line[160];
+
+    for(;; i++) {
+        int Len = snprintf(Line, sizeof(Line), "\x1b[H\x1b[7mtop - up %lu min, load %lu.%02lu \x1b[0m\x1b[K\r\n",
+                           (unsigned long)(i / 60), (unsigned long)(i % 3), (unsigned long)(i * 37 % 100));
+        if(n + Len > Size)
+            return n;
+        memcpy(Buf + n, Line, Len);
+        n += Len;
+        for(Row = 0; Row < 20; Row++) {
+            Len = snprintf(Line, sizeof(Line), "%5lu pi   %2lu.%lu %4lu.%lu proc%lu\x1b[K\r\n",
+                           (unsigned long)(700 + Row * 13), (unsigned long)((i + Row) * 7 % 30),
+                           (unsigned long)((i * Row) % 10), (unsigned long)(Row * 91 % 2000),
+                           (unsigned long)(Row % 10), (unsigned long)Row);
+            if(n + Len > Size)
+                return n;
+            memcpy(Buf + n, Line, Len);
+            n += Len;
+        }
+    }
+}
+
+/******************************************************************************
+function:	One bench run
+parameter:
+    Mode  : 0 = full Paint frame per update, 1 = console resending on
+            scroll, 2 = console with the scroll registers
+    Lines : Update after every line, else after every 4 KB (pipe reads)
+******************************************************************************/
+static UDOUBLE Bench_Run(sFONT *Font, const char *Name, const char *Data, UDOUBLE Len,
+                         UBYTE Mode, UBYTE Lines, UWORD *Canvas)
+{
+    static const char *Mode_Name[] = {"frame", "resend", "vscroll"};
+    CONSOLE Con;
+    UDOUBLE i = 0, End, Updates = 0, Wrong;
+    double Cpu, Bus;
+
+    memset(Gram, 0, sizeof(Gram));
+    Gram_Vsp = Gram_Bytes = 0;
+    if(Console_Init(&Con, Font, 0, 0, LCD_2IN_WIDTH, LCD_2IN_HEIGHT) != 0)
+        exit(1);
+    Gram_Area = Con.Rows * Font->Height;
+    Console_SetOutput(&Con, Model_Window, Model_Write, Mode == 2 ? Model_Scroll : NULL, NULL);
+
+    Cpu = Cpu_s();
+    while(i < Len) {
+        if(Lines) {
+            for(End = i; End < Len && Data[End] != '\n'; End++);
+            End = End < Len ? End + 1 : Len;
+        } else {
+            End = i + 4096 < Len ? i + 4096 : Len;
+        }
+        Console_Write(&Con, Data + i, End - i);
+        if(Mode == 0) {
+            UWORD Row, Col;
+            Paint_SelectImage(Canvas);
+            Paint_Clear(BLACK);
+            for(Row = 0; Row < Con.Rows; Row++)
+                for(Col = 0; Col < Con.Cols; Col++) {
+                    UWORD Cell = Console_GetCell(&Con, Col, Row);
+                    Paint_DrawChar(Col * Font->Width, Row * Font->Height, Cell & 0xFF, Font,
+                                   Con.Palette[(Cell >> 8) & 15], Con.Palette[Cell >> 12]);
+                }
+            Model_Window(0, 0, LCD_2IN_WIDTH, LCD_2IN_HEIGHT, NULL);
+            Model_Write(Canvas, LCD_2IN_WIDTH * LCD_2IN_HEIGHT, NULL);
+            Con.Stats.Windows++;
+        } else {
+            Console_Flush(&Con);
+        }
+        Updates++;
+        i = End;
+    }
+    Cpu = Cpu_s() - Cpu;
+    Bus = Gram_Bytes * 8.0 / SPI_HZ;
+
+    Wrong = Mode ? Check(&Con, Canvas) : 0;
+    printf("%-6s %-5s %-7s %7lu  %9.0f  %8.1f  %7.0f  %6lu  %8lu\r\n", Name, Lines ? "line" : "4 KB",
+           Mode_Name[Mode], (unsigned long)Updates, Len / (Cpu + Bus), (double)Gram_Bytes / Len,
+           Cpu / (Cpu + Bus) * 100, (unsigned long)Con.Stats.Misses, (unsigned long)Wrong);
+    Console_Exit(&Con);
+    return Wrong;
+}
+
+static int Bench(sFONT *Font)
+{
+    static UWORD Canvas[LCD_2IN_WIDTH * LCD_2IN_HEIGHT];
+    static char Data[3][16384];
+    static const char *Name[3] = {"yes", "dmesg", "top"};
+    UDOUBLE Len[3], Wrong = 0;
+    UBYTE f, k, Mode;
+
+    Paint_NewImage(Canvas, LCD_2IN_WIDTH, LCD_2IN_HEIGHT, ROTATE_0, BLACK, 16);
+    Len[0] = Feed_Yes(Data[0], sizeof(Data[0]));
+    Len[1] = Feed_Dmesg(Data[1], sizeof(Data[1]));
+    Len[2] = Feed_Top(Data[2], sizeof(Data[2]));
+
+    printf("%ux%u font, %u x %u cells; bus modelled at %u Hz, %u bytes per window\r\n",
+           Font->Width, Font->Height, LCD_2IN_WIDTH / Font->Width, LCD_2IN_HEIGHT / Font->Height,
+           SPI_HZ, WINDOW_COST);
+    printf("feed   flush mode    updates    chars/s  bus B/ch  cpu %%  glyphs  wrong px\r\n");
+    for(f = 0; f < 3; f++)
+        for(k = 0; k < 2; k++)
+            for(Mode = 0; Mode < 3; Mode++)
+                Wrong += Bench_Run(Font, Name[f], Data[f], Len[f], Mode, k == 0, Canvas);
+    printf("screen matches Paint_DrawChar: %s\r\n", Wrong ? "NO" : "yes");
+    return Wrong != 0;
+}
+
+static void Handler(int signo)
+{
+    Stop = 1;
+}
+
+int main(int argc, char *argv[])
+{
+    sFONT *Fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+    sFONT *Font = &Font12;
+    UBYTE Soft = 0, Bench_Mode = 0;
+    CONSOLE Con;
+    char Buf[4096];
+    struct sigaction sa;
+    double t0 = 0, t1 = 0;
+    pid_t Child = -1;
+    int i, Fd = 0;
+    ssize_t n;
+
+    for(i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-f") && i + 1 < argc) {
+            int Size = atoi(argv[++i]), k;
+            for(k = 0; k < 5 && Fonts[k]->Height != Size; k++);
+            if(k == 5) {
+                fprintf(stderr, "no %d px font (8, 12, 16, 20, 24)\n", Size);
+                return 1;
+            }
+            Font = Fonts[k];
+        } else if(!strcmp(argv[i], "-s")) {
+            Soft = 1;
+        } else if(!strcmp(argv[i], "-b")) {
+            Bench_Mode = 1;
+        } else if(!strcmp(argv[i], "--")) {
+            i++;
+            break;
+        } else {
+            fprintf(stderr, "usage: %s [-f size] [-s] [-b] [-- command ...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if(Bench_Mode)
+        return Bench(Font);
+
+    if(Console_Init(&Con, Font, 0, 0, LCD_2IN_WIDTH, LCD_2IN_HEIGHT) != 0)
+        return 1;
+    if(i < argc) {
+        struct winsize ws = {Con.Rows, Con.Cols, 0, 0};
+        Child = forkpty(&Fd, NULL, NULL, &ws);
+        if(Child < 0) {
+            perror("forkpty");
+            return 1;
+        }
+        if(Child == 0) {
+            setenv("TERM", "vt100", 1);
+            execvp(argv[i], &argv[i]);
+            perror(argv[i]);
+            _exit(127);
+        }
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = Handler;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    if(DEV_ModuleInit() != 0)
+        return 1;
+    LCD_2IN_Init();
+    LCD_2IN_Clear(BLACK);
+    LCD_SetBacklight(1023);
+    if(!Soft) {
+        LCD_2IN_SetScrollArea(0, Con.Rows * Font->Height);
+        LCD_2IN_SetScrollStart(0);
+    }
+    Console_SetOutput(&Con, Lcd_Window, Lcd_Write, Soft ? NULL : Lcd_Scroll, NULL);
+
+    while(!Stop && (n = read(Fd, Buf, sizeof(Buf))) > 0) {
+        if(t0 == 0)
+            t0 = Now_s();
+        Console_Write(&Con, Buf, n);
+        Console_Flush(&Con);
+        t1 = Now_s();
+    }
+    if(Child > 0) {
+        kill(Child, SIGHUP);
+        waitpid(Child, NULL, 0);
+    }
+
+    fprintf(stderr, "%lu chars in %.2f s: %.0f chars/s (%s), %lu scrolls, %lu windows, "
+            "%lu cells sent, %lu glyphs expanded\n",
+            (unsigned long)Con.Stats.Chars, t1 - t0,
+            t1 > t0 ? Con.Stats.Chars / (t1 - t0) : 0.0, Soft ? "resend" : "vscroll",
+            (unsigned long)Con.Stats.Scrolls, (unsigned long)Con.Stats.Windows,
+            (unsigned long)Con.Stats.Cells, (unsigned long)Con.Stats.Misses);
+    Console_Exit(&Con);
+    DEV_ModuleExit();
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*****************************************************************************
+* | File      	:   qoi565.c
+* | Function    :   Encode images as Q565 (lossless RGB565, see gfx_qoi.h)
+* | Info        :
+*   Input is a BMP (any depth GUI_ReadBmp reads, converted to RGB565 with
+*   the chosen dither) or raw little-endian RGB565 as in examples/image.c.
+*   Output is a .q565 file for GUI_ReadQoi(), or with -c a C array for
+*   Paint_DrawQoi() / GFX_Qoi_Open() on a microcontroller.
+*
+*   Usage: qoi565 [-d none|ordered|fs] [-s WxH] [-c name] in out
+*     -d  dither for 24/32-bit BMPs (default none, as GUI_ReadBmp)
+*     -s  in is raw RGB565 of this size
+*     -c  write out as C source defining name[] and name_size
+*
+*   Build on any host:  make tools && ./bin/host/qoi565 pic/LCD_2inch.bmp lcd.q565
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "GUI_BMP.h"
+#include "gfx_qoi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void Usage(void)
+{
+    fprintf(stderr, "usage: qoi565 [-d none|ordered|fs] [-s WxH] [-c name] in out\n");
+    exit(2);
+}
+
+/******************************************************************************
+function: Read a BMP into native-order RGB565 pixels
+******************************************************************************/
+static UWORD *Load_Bmp(const char *Path, UBYTE Dither, UWORD *Width, UWORD *Height)
+{
+    BMPFILEHEADER FileHeader;
+    BMPINF Info;
+    FILE *fp = fopen(Path, "rb");
+
+    if(fp == NULL || fread(&FileHeader, sizeof(FileHeader), 1, fp) != 1 ||
+       fread(&Info, sizeof(Info), 1, fp) != 1 || FileHeader.bType != 0x4D42 ||
+       Info.bWidth == 0 || Info.bWidth > 0xFFFF || Info.bHeight == 0 || Info.bHeight > 0xFFFF) {
+        fprintf(stderr, "%s: not a bottom-up BMP\n", Path);
+        if(fp)
+            fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+
+    *Width = Info.bWidth;
+    *Height = Info.bHeight;
+    UWORD *Pixels = calloc((size_t)*Width * *Height, sizeof(UWORD));
+    if(Pixels == NULL)
+        return NULL;
+    Paint_NewImage(Pixels, *Width, *Height, ROTATE_0, BLACK, 16);
+    Paint_SelectImage(Pixels);
+
+    GUI_ReadBmp_Dither(Path, Dither);
+
+    // The canvas holds MSB-first pixels
+    for(UDOUBLE i = 0; i < (UDOUBLE)*Width * *Height; i++)
+        Pixels[i] = GFX_Swap565(Pixels[i]);
+    return Pixels;
+}
+
+static UWORD *Load_Raw(const char *Path, UWORD Width, UWORD Height)
+{
+    UDOUBLE Count = (UDOUBLE)Width * Height;
+    UBYTE *Bytes = malloc(Count * 2);
+    UWORD *Pixels = malloc(Count * sizeof(UWORD));
+    FILE *fp = fopen(Path, "rb");
+
+    if(fp == NULL || Bytes == NULL || Pixels == NULL || fread(Bytes, 2, Count, fp) != Count) {
+        fprintf(stderr, "%s: expected %lu bytes of RGB565\n", Path, (unsigned long)Count * 2);
+        if(fp)
+            fclose(fp);
+        free(Bytes);
+        free(Pixels);
+        return NULL;
+    }
+    fclose(fp);
+    for(UDOUBLE i = 0; i < Count; i++)
+        Pixels[i] = Bytes[2 * i] | (Bytes[2 * i + 1] << 8);
+    free(Bytes);
+    return Pixels;
+}
+
+static int Write_C(FILE *fp, const char *Name, const UBYTE *Data, UDOUBLE Size, UWORD Width, UWORD Height)
+{
+    fprintf(fp, "/* %ux%u Q565 image, %lu bytes (RGB565 raw: %lu), made by qoi565 */\n",
+            Width, Height, (unsigned long)Size, (unsigned long)Width * Height * 2);
+    fprintf(fp, "const unsigned long %s_size = %lu;\n", Name, (unsigned long)Size);
+    fprintf(fp, "const unsigned char %s[%lu] = {", Name, (unsigned long)Size);
+    for(UDOUBLE i = 0; i < Size; i++)
+        fprintf(fp, "%s0x%02X,", i % 16 ? "" : "\n", Data[i]);
+    return fprintf(fp, "\n};\n") < 0;
+}
+
+int main(int argc, char *argv[])
+{
+    UBYTE Dither = BMP_DITHER_NONE;
+    const char *Name = NULL;
+    unsigned RawW = 0, RawH = 0;
+    UWORD Width, Height;
+    int Opt;
+
+    while((Opt = getopt(argc, argv, "d:s:c:")) != -1) {
+        switch(Opt) {
+        case 'd':
+            if(!strcmp(optarg, "ordered"))
+                Dither = BMP_DITHER_ORDERED;
+            else if(!strcmp(optarg, "fs"))
+                Dither = BMP_DITHER_FS;
+            else if(strcmp(optarg, "none"))
+                Usage();
+            break;
+        case 's':
+            if(sscanf(optarg, "%ux%u", &RawW, &RawH) != 2 || !RawW || !RawH || RawW > 0xFFFF || RawH > 0xFFFF)
+                Usage();
+            break;
+        case 'c':
+            Name = optarg;
+            break;
+        default:
+            Usage();
+        }
+    }
+    if(argc - optind != 2)
+        Usage();
+
+    UWORD *Pixels;
+    if(RawW) {
+        Width = RawW;
+        Height = RawH;
+        Pixels = Load_Raw(argv[optind], Width, Height);
+    } else {
+        Pixels = Load_Bmp(argv[optind], Dither, &Width, &Height);
+    }
+    if(Pixels == NULL)
+        return 1;
+
+    UDOUBLE Capacity = GFX_QOI_MAX_SIZE(Width, Height);
+    UBYTE *Data = malloc(Capacity);
+    UDOUBLE Size = Data ? GFX_Qoi_Encode(Pixels, Width, Height, Data, Capacity) : 0;
+    if(Size == 0) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    FILE *fp = fopen(argv[optind + 1], Name ? "w" : "wb");
+    if(fp == NULL) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    int Fail = Name ? Write_C(fp, Name, Data, Size, Width, Height) : fwrite(Data, 1, Size, fp) != Size;
+    if(fclose(fp) || Fail) {
+        perror(argv[optind + 1]);
+        return 1;
+    }
+    fprintf(stderr, "%ux%u: %lu bytes RGB565 -> %lu bytes Q565 (%.1f%%)\n", Width, Height,
+            (unsigned long)Width * Height * 2, (unsigned long)Size, 100.0 * Size / (Width * Height * 2.0));
+    free(Data);
+    free(Pixels);
+    return 0;
+}
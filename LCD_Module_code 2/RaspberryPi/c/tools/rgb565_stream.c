@@ -0,0 +1,85 @@
+/*****************************************************************************
+* | File      	:   rgb565_stream.c
+* | Function    :   Raw RGB24 video to RGB565 frames, with dithering
+* | Info        :
+*   Reads width*height*3 byte frames from stdin and writes RGB565 frames
+*   to stdout, e.g. for a 1.28inch panel:
+*
+*     ffmpeg -i clip.mp4 -vf scale=240:240 -f rawvideo -pix_fmt rgb24 - |
+*         ./bin/host/rgb565_stream 240 240 ordered be > clip.565
+*
+*   be: MSB first, what the panel takes over SPI (LCD_xxx_Display())
+*   le: CPU order, what an fbtft framebuffer (/dev/fbN) takes
+*   Ordered dithering is stable from frame to frame; fs looks better on
+*   stills but its noise moves when the picture does.
+*   Frames/s is reported on stderr.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :
+*
+******************************************************************************/
+#include "gfx_dither.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double Now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 3) {
+        fprintf(stderr, "usage: %s width height [none|ordered|fs] [be|le]\n", argv[0]);
+        return 1;
+    }
+    int Width = atoi(argv[1]), Height = atoi(argv[2]);
+    const char *Mode = argc > 3 ? argv[3] : "ordered";
+    GFX_PixelOrder Order = (argc > 4 && !strcmp(argv[4], "le")) ? GFX_ORDER_NATIVE : GFX_ORDER_SWAPPED;
+    if(Width <= 0 || Height <= 0 || Width > 4096) {
+        fprintf(stderr, "bad size %dx%d\n", Width, Height);
+        return 1;
+    }
+
+    uint8_t *Rgb = malloc((size_t)Width * Height * 3);
+    uint16_t *Out = malloc((size_t)Width * Height * 2);
+    int16_t *Err = malloc(GFX_DITHER_FS_ERR_LEN(Width) * sizeof(int16_t));
+    if(Rgb == NULL || Out == NULL || Err == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    unsigned long Frames = 0;
+    double Busy = 0;
+    while(fread(Rgb, (size_t)Width * 3, Height, stdin) == (size_t)Height) {
+        double t0 = Now_s();
+        GFX_DitherFS Fs;
+        GFX_DitherFS_Init(&Fs, Err, Width);
+        for(int y = 0; y < Height; y++) {
+            const uint8_t *Src = Rgb + (size_t)y * Width * 3;
+            uint16_t *Dst = Out + (size_t)y * Width;
+            if(!strcmp(Mode, "fs"))
+                GFX_DitherFS_Row(&Fs, Dst, Src, GFX_RGB888, Order);
+            else if(!strcmp(Mode, "ordered"))
+                GFX_DitherOrdered(Dst, Src, Width, 0, y, GFX_RGB888, Order);
+            else
+                GFX_Convert565(Dst, Src, Width, GFX_RGB888, Order);
+        }
+        Busy += Now_s() - t0;
+        if(fwrite(Out, (size_t)Width * 2, Height, stdout) != (size_t)Height)
+            break;
+        Frames++;
+    }
+    if(Frames)
+        fprintf(stderr, "%lu frames, %.0f frames/s conversion (%s)\n", Frames, Frames / Busy, Mode);
+    free(Rgb);
+    free(Out);
+    free(Err);
+    return 0;
+}
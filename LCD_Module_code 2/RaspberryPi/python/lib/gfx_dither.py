@@ -0,0 +1,100 @@
+# -*- coding:UTF-8 -*-
+# gfx_dither.py
+#
+# RGB888 -> RGB565 with ordered (Bayer) or Floyd-Steinberg dithering,
+# using the C kernels from lib/gfx through ctypes.
+#
+# Build the shared library once:
+#     cd ../../c && make libgfx        (-> c/bin/host/libgfx.so)
+# or point GFX_LIB at another build.
+#
+# In ShowImage(), replace the numpy 5/6/5 truncation with
+#     pix = gfx_dither.from_image(Image)
+# and send pix as before (MSB first, as the panel expects).
+
+import ctypes
+import os
+import sys
+
+NONE = 0
+ORDERED = 1
+FS = 2
+
+_MODES = {'none': NONE, 'ordered': ORDERED, 'fs': FS}
+_FORMATS = {'RGB': 0, 'BGR': 1, 'RGBX': 2, 'RGBA': 2, 'BGRX': 3}
+_BPP = {0: 3, 1: 3, 2: 4, 3: 4}
+
+
+class _DitherFS(ctypes.Structure):
+    _fields_ = [('err', ctypes.POINTER(ctypes.c_int16)),
+                ('width', ctypes.c_uint16),
+                ('reverse', ctypes.c_uint8)]
+
+
+def _load():
+    path = os.environ.get('GFX_LIB')
+    if not path:
+        here = os.path.dirname(os.path.abspath(__file__))
+        path = os.path.join(here, '..', '..', 'c', 'bin', 'host', 'libgfx.so')
+    lib = ctypes.CDLL(path)
+    u16p = ctypes.POINTER(ctypes.c_uint16)
+    u8p = ctypes.POINTER(ctypes.c_uint8)
+    lib.GFX_Convert565.argtypes = [u16p, u8p, ctypes.c_uint16, ctypes.c_int, ctypes.c_int]
+    lib.GFX_DitherOrdered.argtypes = [u16p, u8p, ctypes.c_uint16, ctypes.c_int16,
+                                      ctypes.c_int16, ctypes.c_int, ctypes.c_int]
+    lib.GFX_DitherFS_Init.argtypes = [ctypes.POINTER(_DitherFS), ctypes.POINTER(ctypes.c_int16),
+                                      ctypes.c_uint16]
+    lib.GFX_DitherFS_Row.argtypes = [ctypes.POINTER(_DitherFS), u16p, u8p, ctypes.c_int, ctypes.c_int]
+    for f in (lib.GFX_Convert565, lib.GFX_DitherOrdered, lib.GFX_DitherFS_Init, lib.GFX_DitherFS_Row):
+        f.restype = None
+    return lib
+
+
+_lib = None
+
+
+def rgb565(data, width, height, mode='ordered', fmt='RGB', msb_first=True):
+    """Convert packed pixels (bytes-like, rows top to bottom) to RGB565.
+
+    mode: 'none' (plain truncation), 'ordered' or 'fs'
+    fmt:  'RGB', 'BGR', 'RGBX'/'RGBA' (alpha ignored) or 'BGRX'
+    Returns bytes, 2 per pixel, MSB first unless msb_first is False.
+    """
+    global _lib
+    if _lib is None:
+        _lib = _load()
+    mode = _MODES[mode] if isinstance(mode, str) else mode
+    f = _FORMATS[fmt]
+    stride = width * _BPP[f]
+    if len(data) < stride * height:
+        raise ValueError('need %d bytes, got %d' % (stride * height, len(data)))
+
+    src = (ctypes.c_uint8 * (stride * height)).from_buffer_copy(data)
+    dst = (ctypes.c_uint16 * (width * height))()
+    # Pixel order of the destination: swapped when the CPU is little-endian
+    order = 1 if msb_first == (sys.byteorder == 'little') else 0
+    u16p = ctypes.POINTER(ctypes.c_uint16)
+    u8p = ctypes.POINTER(ctypes.c_uint8)
+
+    fs = None
+    if mode == FS:
+        err = (ctypes.c_int16 * (6 * (width + 2)))()
+        fs = _DitherFS()
+        _lib.GFX_DitherFS_Init(ctypes.byref(fs), err, width)
+    for y in range(height):
+        s = ctypes.cast(ctypes.byref(src, y * stride), u8p)
+        d = ctypes.cast(ctypes.byref(dst, y * width * 2), u16p)
+        if mode == FS:
+            _lib.GFX_DitherFS_Row(ctypes.byref(fs), d, s, f, order)
+        elif mode == ORDERED:
+            _lib.GFX_DitherOrdered(d, s, width, 0, y, f, order)
+        else:
+            _lib.GFX_Convert565(d, s, width, f, order)
+    return bytes(dst)
+
+
+def from_image(image, mode='ordered', msb_first=True):
+    """Convert a PIL image (any mode) to RGB565 bytes."""
+    if image.mode not in ('RGB', 'RGBA', 'RGBX'):
+        image = image.convert('RGB')
+    return rgb565(image.tobytes(), image.width, image.height, mode, image.mode, msb_first)
@@ -32,6 +32,34 @@ typedef uint32_t UDOUBLE;
 #define LCD_CS_PIN    PD2   ///< Chip Select pin (Display label: CS) - active low, managed via GPIO
 #define LCD_BL_PIN    PD3   ///< Backlight pin (Display label: BLK) - optional, can be tied to VCC
 
+// More panels on the same bus: they share SCK, MOSI, DC and BL, each has its
+// own CS and, optionally, RST (panels on a shared RST pin reset together).
+// Panel 0 is LCD_CS_PIN / LCD_RST_PIN; select panels with GC9A01_SelectPanels().
+#ifndef LCD_PANEL_COUNT
+#define LCD_PANEL_COUNT  1    ///< Panels on the bus, 1 to 4
+#endif
+#ifndef LCD_CS1_PIN
+#define LCD_CS1_PIN   PC4   ///< Chip Select of panel 1
+#define LCD_CS2_PIN   PC7   ///< Chip Select of panel 2
+#define LCD_CS3_PIN   PA1   ///< Chip Select of panel 3 (PA1/PA2 are free without a crystal; DEBUG_MODE 16 reads a button on PA2)
+#endif
+#ifndef LCD_RST1_PIN
+#define LCD_RST1_PIN  LCD_RST_PIN   ///< Reset of panel 1
+#define LCD_RST2_PIN  LCD_RST_PIN   ///< Reset of panel 2
+#define LCD_RST3_PIN  LCD_RST_PIN   ///< Reset of panel 3
+#endif
+/// Pins per panel, panel 0 first (only the first LCD_PANEL_COUNT are used)
+#define LCD_PANEL_CS_PINS   { LCD_CS_PIN, LCD_CS1_PIN, LCD_CS2_PIN, LCD_CS3_PIN }
+#define LCD_PANEL_RST_PINS  { LCD_RST_PIN, LCD_RST1_PIN, LCD_RST2_PIN, LCD_RST3_PIN }
+
+// Tearing-effect output (Display label: TE) - only present on some GC9A01 boards
+// Set LCD_TE_ENABLED to 1 once the TE pad is wired to LCD_TE_PIN.
+// PD5/PD6 are left free for USART1, PC1/PC2 for I2C.
+#ifndef LCD_TE_ENABLED
+#define LCD_TE_ENABLED  0     ///< 1 = wait for TE edges in GC9A01_Present(), 0 = no TE line
+#endif
+#define LCD_TE_PIN    PC3   ///< TE input pin (any GPIO, routed to EXTI)
+
 // SPI pins (must be SPI1 compatible pins on CH32v003)
 // PC5 = SPI1_SCK, PC6 = SPI1_MOSI (fixed pins, cannot be changed)
 // Note: Display uses SDA/SCL labels (normally I2C), but this is SPI!
@@ -48,6 +76,13 @@ typedef uint32_t UDOUBLE;
 /// GC9A01 Display height in pixels
 #define LCD_HEIGHT   240
 
+/// Panel refresh period in microseconds (GC9A01 default frame rate is ~60Hz)
+/// Used by GC9A01_Present() to size bands so they finish before the scan wraps.
+#define LCD_FRAME_PERIOD_US  16667
+
+/// Non-visible (porch) lines the panel scans per frame in addition to LCD_HEIGHT
+#define LCD_VBLANK_LINES     8
+
 // ============================================================================
 // GPIO CONFIGURATION
 // ============================================================================
@@ -71,6 +106,41 @@ typedef uint32_t UDOUBLE;
 /// Increase to 3MHz or 6MHz if display works well
 #define LCD_SPI_SPEED_HZ  1500000  // 1.5MHz - slower for level translator compatibility
 
+// ============================================================================
+// UART CONFIGURATION (host frame link, lib/frame_link)
+// ============================================================================
+
+/// USART1 baud rate (TX = PD5, RX = PD6), same as monitor_speed in platformio.ini
+#ifndef LCD_UART_BAUD
+#define LCD_UART_BAUD  115200
+#endif
+
+/// Receive ring buffer size in bytes (power of two); the host may have this
+/// many bytes in flight, see the credit scheme in frame_link.h
+#define LCD_UART_RX_BUFFER  128
+
+// ============================================================================
+// TIME BASE (lib/sched)
+// ============================================================================
+
+/// LCD_HAL_Ticks() counts per microsecond: SysTick runs at HCLK/8 (6 MHz)
+/// unless FUNCONF_SYSTICK_USE_HCLK is set, and DELAY_US_TIME follows that
+#define LCD_HAL_TICKS_PER_US  DELAY_US_TIME
+
+// ============================================================================
+// BUS TRACE (lib/trace)
+// ============================================================================
+
+/// 1 = record CS/DC/RST/BL edges, SPI bytes and delays, and stream them out of
+/// USART1 TX (PD5) for sim/trace_replay. Slows the bus down, but the time spent
+/// sending is left out of the timestamps. Not with DEBUG_MODE 13 (same UART).
+#ifndef LCD_TRACE_ENABLED
+#define LCD_TRACE_ENABLED  0
+#endif
+
+/// Trace record buffer in bytes (at least LCD_TRACE_MAX_RECORD = 262)
+#define LCD_TRACE_BUFFER  300
+
 // ============================================================================
 // FUNCTION PROTOTYPES - Hardware Abstraction Layer
 // ============================================================================
@@ -83,10 +153,29 @@ void LCD_HAL_DigitalWrite(UWORD Pin, UBYTE Value);
 void LCD_HAL_SPI_Init(void);
 void LCD_HAL_SPI_WriteByte(UBYTE Value);
 void LCD_HAL_SPI_WriteBytes(uint8_t *pData, uint32_t Length);
+void LCD_HAL_SPI_WaitIdle(void);
+
+// Tearing-effect (TE) input functions
+void LCD_HAL_TE_Init(void);
+UDOUBLE LCD_HAL_TE_Count(void);
+UBYTE LCD_HAL_TE_Wait(UDOUBLE timeout_ms);
+
+// UART functions (USART1, interrupt-driven receive)
+void LCD_HAL_UART_Init(UDOUBLE baud);
+UBYTE LCD_HAL_UART_Read(UBYTE *value);
+void LCD_HAL_UART_Write(UBYTE value);
 
 // Delay functions
 void LCD_HAL_Delay_ms(UDOUBLE ms);
 void LCD_HAL_Delay_us(UDOUBLE us);
 
+// Time base: free-running SysTick count, wraps every 2^32 ticks (~12 min)
+UDOUBLE LCD_HAL_Ticks(void);
+
+// Bus trace: mark a point (e.g. a finished frame), send what is buffered.
+// No-ops unless LCD_TRACE_ENABLED.
+void LCD_HAL_TraceMark(UDOUBLE id);
+void LCD_HAL_TraceFlush(void);
+
 #endif // _LCD_CONFIG_H_
 
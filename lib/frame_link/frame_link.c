@@ -0,0 +1,384 @@
+/**
+ * @file frame_link.c
+ * @brief UART frame link receiver (protocol in frame_link.h)
+ */
+
+#include "frame_link.h"
+#include "gc9a01_driver.h"
+
+// Packet layer states
+#define ST_SYNC     0
+#define ST_TYPE     1
+#define ST_LEN0     2
+#define ST_LEN1     3
+#define ST_PAYLOAD  4
+#define ST_CRC      5
+
+// Rectangle payload states
+#define RX_HEADER    0
+#define RX_TOKEN     1
+#define RX_HI        2
+#define RX_LO        3
+#define RX_PAL_SIZE  4
+
+// Pixel-producing operations
+#define OP_RAW       0
+#define OP_LITERAL   1
+#define OP_RUN       2
+#define OP_PALETTE   3   // Reading palette entries
+
+// Pixel stream state
+#define OPEN_NONE    0
+#define OPEN_RECT    1   // Window covers the rest of the rectangle
+#define OPEN_ROW     2   // Window covers the rest of the current row
+
+static UBYTE FrameLink_Crc(UBYTE crc, UBYTE value)
+{
+    crc ^= value;
+    for (UBYTE i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? (UBYTE)((crc << 1) ^ 0x07) : (UBYTE)(crc << 1);
+    }
+    return crc;
+}
+
+static void FrameLink_Close(FrameLink *link)
+{
+    if (link->open != OPEN_NONE) {
+        GC9A01_StreamEnd();
+        link->open = OPEN_NONE;
+    }
+}
+
+/**
+ * @brief Step the cursor n pixels through the rectangle
+ */
+static void FrameLink_Advance(FrameLink *link, uint16_t n)
+{
+    link->cx += n;
+    link->left -= n;
+    if (link->cx == link->x1) {
+        link->cx = link->x0;
+        link->cy++;
+        // A row window ends here; the next row needs the full window again
+        if (link->open == OPEN_ROW) FrameLink_Close(link);
+    }
+}
+
+/**
+ * @brief Write n copies of a pixel at the cursor
+ * 
+ * After a skip the cursor is mid-row, where a window starting at the
+ * cursor would wrap to the wrong column, so the rest of that row gets a
+ * window of its own.
+ */
+static void FrameLink_Put(FrameLink *link, UWORD color, uint16_t n)
+{
+    if (n > link->left) {
+        link->failed = 1;
+        return;
+    }
+    while (n) {
+        uint16_t row = link->x1 - link->cx;
+        uint16_t k = n < row ? n : row;
+        
+        if (link->open == OPEN_NONE) {
+            if (link->cx == link->x0) {
+                GC9A01_StreamBegin(link->x0, link->cy, link->x1, link->y1);
+                link->open = OPEN_RECT;
+            } else {
+                GC9A01_StreamBegin(link->cx, link->cy, link->x1, link->cy + 1);
+                link->open = OPEN_ROW;
+            }
+        }
+        if (k == 1) {
+            GC9A01_StreamPixel(color);
+        } else {
+            GC9A01_StreamRepeat(color, k);
+        }
+        link->pixels += k;
+        n -= k;
+        FrameLink_Advance(link, k);
+    }
+}
+
+/**
+ * @brief Leave n pixels as they are on the panel
+ */
+static void FrameLink_Skip(FrameLink *link, uint16_t n)
+{
+    if (n > link->left) {
+        link->failed = 1;
+        return;
+    }
+    FrameLink_Close(link);
+    while (n) {
+        uint16_t row = link->x1 - link->cx;
+        uint16_t k = n < row ? n : row;
+        n -= k;
+        FrameLink_Advance(link, k);
+    }
+}
+
+/**
+ * @brief Validate the x0 y0 w h enc header and set up the cursor
+ */
+static void FrameLink_RectHeader(FrameLink *link)
+{
+    const UBYTE *h = link->header;
+    
+    link->x0 = h[0];
+    link->y0 = h[1];
+    link->x1 = h[0] + h[2];
+    link->y1 = h[1] + h[3];
+    link->enc = h[4];
+    if (h[2] == 0 || h[3] == 0 || link->x1 > LCD_WIDTH || link->y1 > LCD_HEIGHT ||
+        link->enc > FRAME_LINK_ENC_DELTA) {
+        link->failed = 1;
+        return;
+    }
+    link->cx = link->x0;
+    link->cy = link->y0;
+    link->left = (uint32_t)h[2] * h[3];
+    
+    if (link->enc == FRAME_LINK_ENC_RAW) {
+        link->op = OP_RAW;
+        link->rx = RX_HI;
+    } else if (link->enc == FRAME_LINK_ENC_PAL) {
+        link->rx = RX_PAL_SIZE;
+    } else {
+        link->rx = RX_TOKEN;
+    }
+}
+
+static void FrameLink_Token(FrameLink *link, UBYTE t)
+{
+    switch (link->enc) {
+    case FRAME_LINK_ENC_RLE:
+        link->op = (t & 0x80) ? OP_RUN : OP_LITERAL;
+        link->count = (t & 0x7F) + 1;
+        link->rx = RX_HI;
+        break;
+    case FRAME_LINK_ENC_PAL:
+        if ((t & 0x0F) >= link->pal_size) {
+            link->failed = 1;
+            return;
+        }
+        FrameLink_Put(link, link->palette[t & 0x0F], (t >> 4) + 1);
+        break;
+    case FRAME_LINK_ENC_DELTA:
+        if (t & 0x80) {
+            FrameLink_Skip(link, (t & 0x7F) + 1);
+        } else {
+            link->op = (t & 0x40) ? OP_RUN : OP_LITERAL;
+            link->count = (t & 0x3F) + 1;
+            link->rx = RX_HI;
+        }
+        break;
+    }
+}
+
+static void FrameLink_Pixel(FrameLink *link, UWORD color)
+{
+    switch (link->op) {
+    case OP_RAW:
+        FrameLink_Put(link, color, 1);
+        link->rx = RX_HI;
+        break;
+    case OP_LITERAL:
+        FrameLink_Put(link, color, 1);
+        link->rx = (--link->count) ? RX_HI : RX_TOKEN;
+        break;
+    case OP_RUN:
+        FrameLink_Put(link, color, link->count);
+        link->rx = RX_TOKEN;
+        break;
+    case OP_PALETTE:
+        link->palette[link->pal_fill++] = color;
+        link->rx = (link->pal_fill < link->pal_size) ? RX_HI : RX_TOKEN;
+        break;
+    }
+}
+
+/**
+ * @brief One payload byte of a rect packet
+ */
+static void FrameLink_RectByte(FrameLink *link, UBYTE value)
+{
+    if (link->failed) return;
+    
+    switch (link->rx) {
+    case RX_HEADER:
+        link->header[link->pos] = value;
+        if (link->pos == sizeof(link->header) - 1) FrameLink_RectHeader(link);
+        break;
+    case RX_TOKEN:
+        FrameLink_Token(link, value);
+        break;
+    case RX_HI:
+        link->hi = value;
+        link->rx = RX_LO;
+        break;
+    case RX_LO:
+        FrameLink_Pixel(link, ((UWORD)link->hi << 8) | value);
+        break;
+    case RX_PAL_SIZE:
+        if (value == 0 || value > 16) {
+            link->failed = 1;
+            return;
+        }
+        link->pal_size = value;
+        link->pal_fill = 0;
+        link->op = OP_PALETTE;
+        link->rx = RX_HI;
+        break;
+    }
+}
+
+static void FrameLink_SendHello(void)
+{
+    UBYTE reply[] = {FRAME_LINK_SYNC, 'h', 4, 0, FRAME_LINK_VERSION,
+                     (LCD_UART_RX_BUFFER - 1) & 0xFF, (LCD_UART_RX_BUFFER - 1) >> 8,
+                     FRAME_LINK_CREDIT, 0};
+    UBYTE crc = 0;
+    
+    for (UBYTE i = 1; i < sizeof(reply) - 1; i++) crc = FrameLink_Crc(crc, reply[i]);
+    reply[sizeof(reply) - 1] = crc;
+    for (UBYTE i = 0; i < sizeof(reply); i++) LCD_HAL_UART_Write(reply[i]);
+}
+
+/**
+ * @brief Act on a complete packet
+ * 
+ * @param ok CRC matched
+ */
+static void FrameLink_Packet(FrameLink *link, UBYTE ok)
+{
+    switch (link->type) {
+    case FRAME_LINK_RECT:
+        // Every pixel must have arrived and no token may be left half done
+        if (link->failed || link->left != 0 || (link->rx != RX_TOKEN && link->rx != RX_HI) ||
+            (link->rx == RX_HI && link->op != OP_RAW)) {
+            ok = 0;
+        }
+        break;
+    case FRAME_LINK_HELLO:
+        if (ok) {
+            link->taken = 0;
+            link->errors = 0;
+            FrameLink_SendHello();
+        }
+        break;
+    case FRAME_LINK_END:
+        if (ok) {
+            LCD_HAL_UART_Write(link->errors ? FRAME_LINK_NAK : FRAME_LINK_ACK);
+            link->errors = 0;
+            link->frames++;
+        }
+        break;
+    default:
+        ok = 0;
+        break;
+    }
+    
+    if (ok) {
+        link->packets++;
+    } else {
+        link->bad++;
+        if (link->errors < 255) link->errors++;
+    }
+}
+
+/**
+ * @brief Reset the receiver
+ */
+void FrameLink_Init(FrameLink *link)
+{
+    UBYTE *p = (UBYTE *)link;
+    for (uint16_t i = 0; i < sizeof(*link); i++) p[i] = 0;
+    link->state = ST_SYNC;
+}
+
+/**
+ * @brief Process one received byte
+ * 
+ * Rect pixels go to the panel as soon as they are decoded, so a run
+ * token returns only after the run has been clocked out.
+ */
+void FrameLink_Feed(FrameLink *link, UBYTE value)
+{
+    if (++link->taken == FRAME_LINK_CREDIT) {
+        link->taken = 0;
+        LCD_HAL_UART_Write(FRAME_LINK_GRANT);
+    }
+    
+    switch (link->state) {
+    case ST_SYNC:
+        if (value == FRAME_LINK_SYNC) link->state = ST_TYPE;
+        return;
+    case ST_TYPE:
+        link->type = value;
+        link->crc = FrameLink_Crc(0, value);
+        link->state = ST_LEN0;
+        return;
+    case ST_LEN0:
+        link->len = value;
+        link->crc = FrameLink_Crc(link->crc, value);
+        link->state = ST_LEN1;
+        return;
+    case ST_LEN1:
+        link->len |= (uint16_t)value << 8;
+        link->crc = FrameLink_Crc(link->crc, value);
+        link->pos = 0;
+        link->failed = 0;
+        link->left = 0;
+        link->rx = RX_HEADER;
+        if (link->type == FRAME_LINK_RECT && link->len < sizeof(link->header)) link->failed = 1;
+        link->state = link->len ? ST_PAYLOAD : ST_CRC;
+        return;
+    case ST_PAYLOAD:
+        link->crc = FrameLink_Crc(link->crc, value);
+        if (link->type == FRAME_LINK_RECT) FrameLink_RectByte(link, value);
+        if (++link->pos == link->len) {
+            FrameLink_Close(link);
+            link->state = ST_CRC;
+        }
+        return;
+    case ST_CRC:
+        link->state = ST_SYNC;
+        FrameLink_Packet(link, value == link->crc);
+        return;
+    }
+}
+
+/**
+ * @brief Feed everything waiting in the UART receive buffer
+ * 
+ * @return Number of bytes processed
+ */
+uint16_t FrameLink_Poll(FrameLink *link)
+{
+    uint16_t n = 0;
+    UBYTE value;
+    
+    while (LCD_HAL_UART_Read(&value)) {
+        FrameLink_Feed(link, value);
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief The line went quiet: drop any half-received packet
+ * 
+ * Call after a gap of a few tens of milliseconds so a lost byte cannot
+ * keep the parser out of step with the host.
+ */
+void FrameLink_Timeout(FrameLink *link)
+{
+    FrameLink_Close(link);
+    if (link->state != ST_SYNC) {
+        link->bad++;
+        if (link->errors < 255) link->errors++;
+        link->state = ST_SYNC;
+    }
+}
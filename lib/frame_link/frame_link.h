@@ -0,0 +1,101 @@
+/**
+ * @file frame_link.h
+ * @brief Compressed frame updates from a host PC over the UART
+ * 
+ * At 115200 baud a raw 240x240 RGB565 frame takes 10 s. The host
+ * (tools/frame_send.py) sends only the rectangles that changed, each in
+ * whichever encoding is smallest. The receiver decodes byte by byte
+ * straight into the SPI pixel stream, so it needs no frame buffer.
+ * 
+ * Packet:  A5 | type | len (LE16) | payload[len] | crc
+ *          crc = CRC-8 (poly 0x07, init 0) over type, len and payload
+ * 
+ * Host -> device:
+ *   'H' hello    no payload; answered with a hello packet
+ *   'R' rect     x0 y0 w h enc data: pixels of the rectangle, row by row
+ *   'E' end      no payload; answered with ACK if every packet since the
+ *                previous end decoded cleanly, NAK otherwise
+ * 
+ * Device -> host:
+ *   0x11         credit: FRAME_LINK_CREDIT more bytes may be sent
+ *   0x06 / 0x15  ACK / NAK for 'E'
+ *   A5 'h' 04 00 version window_lo window_hi credit crc   hello reply
+ * 
+ * Encodings (pixels are RGB565, MSB first):
+ *   0 RAW    one pixel after another
+ *   1 RLE    0nnnnnnn <n+1 pixels>   literal
+ *            1nnnnnnn <pixel>        n+1 copies
+ *   2 PAL    k (1..16), k pixels, then rrrriiii: r+1 copies of entry i
+ *   3 DELTA  00nnnnnn <n+1 pixels>   literal
+ *            01nnnnnn <pixel>        n+1 copies
+ *            1nnnnnnn                skip n+1 pixels (unchanged on the panel)
+ * 
+ * Flow control: after a hello reply the host may have 'window' bytes in
+ * flight and gains FRAME_LINK_CREDIT bytes for every credit byte. The
+ * device sends a credit whenever it has taken that many bytes out of its
+ * receive buffer, so the buffer can never overflow while a long run is
+ * being clocked out to the panel.
+ */
+
+#ifndef _FRAME_LINK_H_
+#define _FRAME_LINK_H_
+
+#include "../include/lcd_config.h"
+
+#define FRAME_LINK_VERSION  1
+#define FRAME_LINK_SYNC     0xA5
+#define FRAME_LINK_CREDIT   32     ///< Bytes granted per credit byte
+#define FRAME_LINK_ACK      0x06
+#define FRAME_LINK_NAK      0x15
+#define FRAME_LINK_GRANT    0x11   ///< Credit byte
+
+#define FRAME_LINK_HELLO    'H'
+#define FRAME_LINK_RECT     'R'
+#define FRAME_LINK_END      'E'
+
+#define FRAME_LINK_ENC_RAW    0
+#define FRAME_LINK_ENC_RLE    1
+#define FRAME_LINK_ENC_PAL    2
+#define FRAME_LINK_ENC_DELTA  3
+
+/**
+ * @brief Receiver state (about 70 bytes)
+ */
+typedef struct {
+    // Packet layer
+    UBYTE state;
+    UBYTE type;
+    UBYTE crc;
+    uint16_t len;
+    uint16_t pos;
+    UBYTE taken;         ///< Bytes consumed since the last credit
+    
+    // Rectangle decoder
+    UBYTE rx;            ///< What the next payload byte is
+    UBYTE op;            ///< Token being decoded
+    UBYTE count;         ///< Pixels left in a literal / length of a run
+    UBYTE hi;            ///< First byte of a pixel
+    UBYTE enc;
+    UBYTE open;          ///< Pixel stream state, see frame_link.c
+    UBYTE failed;        ///< Current packet is malformed
+    UBYTE header[5];
+    uint16_t x0, y0, x1, y1;
+    uint16_t cx, cy;     ///< Next pixel
+    uint32_t left;       ///< Pixels still owed to the rectangle
+    UWORD palette[16];
+    UBYTE pal_size, pal_fill;
+    
+    // Status
+    UBYTE errors;        ///< Bad packets since the last end
+    UDOUBLE frames;      ///< End packets received
+    UDOUBLE packets;     ///< Good packets
+    UDOUBLE bad;         ///< Bad packets
+    UDOUBLE pixels;      ///< Pixels written to the panel
+} FrameLink;
+
+void FrameLink_Init(FrameLink *link);
+void FrameLink_Feed(FrameLink *link, UBYTE value);
+uint16_t FrameLink_Poll(FrameLink *link);
+void FrameLink_Timeout(FrameLink *link);
+
+#endif // _FRAME_LINK_H_
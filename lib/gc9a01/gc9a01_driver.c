@@ -20,10 +20,98 @@
 #include "gc9a01_driver.h"
 #include "../lcd_hal/lcd_hal.h"
 
+// ============================================================================
+// PRIVATE STATE
+// ============================================================================
+
+/// Current Memory Access Control (0x36) value per panel, needed to know the scan direction
+static UBYTE gc9a01_madctl[GC9A01_MAX_PANELS] = { 0x08, 0x08, 0x08, 0x08 };
+
+/// One row of RGB565 pixels for GC9A01_DrawRows()/GC9A01_Present() (480 bytes)
+static UWORD gc9a01_line[LCD_WIDTH];
+
+/// Current GC9A01_POWER_* flags per panel
+static UBYTE gc9a01_power[GC9A01_MAX_PANELS];
+
+/// Panels the next calls talk to (GC9A01_PANEL() flags)
+static UBYTE gc9a01_panels = GC9A01_PANELS_ALL;
+
+/// CS and RST pin per panel (one panel writes LCD_CS_PIN directly)
+#if LCD_PANEL_COUNT > 1
+static const UWORD gc9a01_cs_pins[GC9A01_MAX_PANELS] = LCD_PANEL_CS_PINS;
+#endif
+static const UWORD gc9a01_rst_pins[GC9A01_MAX_PANELS] = LCD_PANEL_RST_PINS;
+
+/// Rows shown in partial mode (exclusive end)
+static uint16_t gc9a01_partial_y0 = 0;
+static uint16_t gc9a01_partial_y1 = LCD_HEIGHT;
+
+/// Draw calls so far; lets a power policy notice activity without a callback
+static UDOUBLE gc9a01_draws = 0;
+
+/// GC9A01_Present() updates whose TE wait timed out (TE enabled but not wired?)
+static UDOUBLE gc9a01_te_timeouts = 0;
+
 // ============================================================================
 // PRIVATE FUNCTIONS - Communication Layer
 // ============================================================================
 
+/**
+ * @brief Drive the CS line of every selected panel
+ * 
+ * With one panel this is a single pin write, as before multi-panel support.
+ * 
+ * @param level 0 = select, 1 = deselect
+ */
+static void GC9A01_CS(UBYTE level)
+{
+#if LCD_PANEL_COUNT == 1
+    LCD_HAL_DigitalWrite(LCD_CS_PIN, level);
+#else
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if (gc9a01_panels & GC9A01_PANEL(i)) LCD_HAL_DigitalWrite(gc9a01_cs_pins[i], level);
+    }
+#endif
+}
+
+/**
+ * @brief Drive the RST line of every selected panel (shared pins are driven once per panel)
+ */
+static void GC9A01_RST(UBYTE level)
+{
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if (gc9a01_panels & GC9A01_PANEL(i)) LCD_HAL_DigitalWrite(gc9a01_rst_pins[i], level);
+    }
+}
+
+/**
+ * @brief Index of the first selected panel
+ */
+static UBYTE GC9A01_FirstPanel(void)
+{
+    UBYTE i = 0;
+#if LCD_PANEL_COUNT > 1
+    while (i < LCD_PANEL_COUNT - 1 && !(gc9a01_panels & GC9A01_PANEL(i))) i++;
+#endif
+    return i;
+}
+
+/**
+ * @brief Selected panels whose state[] matches that of the first one
+ */
+static UBYTE GC9A01_SameAsFirst(UBYTE todo, const UBYTE *state, UBYTE mask)
+{
+    UBYTE first = 0, group = 0;
+    
+    while (!(todo & GC9A01_PANEL(first))) first++;
+    for (UBYTE i = first; i < LCD_PANEL_COUNT; i++) {
+        if ((todo & GC9A01_PANEL(i)) && (state[i] & mask) == (state[first] & mask)) {
+            group |= GC9A01_PANEL(i);
+        }
+    }
+    return group;
+}
+
 /**
  * @brief Send a command byte to the display
  * 
@@ -35,7 +123,7 @@
  */
 static void GC9A01_SendCommand(UBYTE cmd)
 {
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 0);   // CS low = select display
+    GC9A01_CS(0);   // CS low = select display
     LCD_HAL_Delay_us(1);  // Small delay for CS to stabilize
     LCD_HAL_DigitalWrite(LCD_DC_PIN, 0);   // D/C low = command mode
     LCD_HAL_Delay_us(1);  // Small delay for DC to stabilize
@@ -48,7 +136,7 @@ static void GC9A01_SendCommand(UBYTE cmd)
 /**
  * @brief Send a data byte to the display
  * 
- * Sets DC high (data mode), CS should already be LOW from command,
+ * Sets DC high (data mode), makes sure CS is LOW,
  * sends data, then CS high.
  * Used for sending parameters that follow commands.
  * 
@@ -56,12 +144,14 @@ static void GC9A01_SendCommand(UBYTE cmd)
  */
 static void GC9A01_SendData(UBYTE data)
 {
-    // CS should already be LOW from previous command
+    // CS is LOW after a command, but HIGH after a previous parameter byte -
+    // select again so 2nd and later parameters are not clocked into a deselected panel
+    GC9A01_CS(0);
     LCD_HAL_DigitalWrite(LCD_DC_PIN, 1);  // D/C high = data mode
     LCD_HAL_Delay_us(1);  // Small delay for DC to stabilize
     LCD_HAL_SPI_WriteByte(data);
     LCD_HAL_Delay_us(1);  // Small delay after SPI transmission
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 1);  // CS high = deselect
+    GC9A01_CS(1);  // CS high = deselect
     LCD_HAL_Delay_us(10);  // Small delay between data bytes
 }
 
@@ -78,9 +168,9 @@ static void GC9A01_SendData(UBYTE data)
 static void GC9A01_SendDataBulk(uint8_t *pData, uint32_t len)
 {
     LCD_HAL_DigitalWrite(LCD_DC_PIN, 1);  // D/C high = data mode
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 0);   // CS low = select display
+    GC9A01_CS(0);   // CS low = select display
     LCD_HAL_SPI_WriteBytes(pData, len);
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 1);  // CS high = deselect
+    GC9A01_CS(1);  // CS high = deselect
 }
 
 /**
@@ -95,7 +185,7 @@ static void GC9A01_SendDataBulk(uint8_t *pData, uint32_t len)
  */
 static void GC9A01_SendCommandWithData(UBYTE cmd, uint8_t *pData, uint32_t len)
 {
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 0);   // CS low = select display
+    GC9A01_CS(0);   // CS low = select display
     LCD_HAL_Delay_us(2);  // Small delay for CS to stabilize
     
     // Send command
@@ -113,312 +203,395 @@ static void GC9A01_SendCommandWithData(UBYTE cmd, uint8_t *pData, uint32_t len)
     }
     
     LCD_HAL_Delay_us(2);  // Small delay before releasing CS
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 1);  // CS high = deselect
+    GC9A01_CS(1);  // CS high = deselect
     LCD_HAL_Delay_us(10);  // Small delay between commands
 }
 
-/**
- * @brief Perform hardware reset of the display
- * 
- * According to GC9A01 datasheet:
- * - RESX is pulled low when module is powered on
- * - RESX should usually be set to 1 (high)
- * - Reset sequence: Pull low, then release high
- * 
- * Reset sequence:
- * 1. Ensure RST is high (not resetting)
- * 2. Pull RST low (reset) - hold for at least 10ms
- * 3. Release RST high - wait at least 120ms for display to stabilize
- */
-static void GC9A01_Reset(void)
-{
-    // CRITICAL: Working example (Arduino) sets CS LOW first, then performs reset
-    // STM32 version doesn't manipulate CS during reset - testing Arduino version first
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 0);  // CS low (Arduino example does this)
-    LCD_HAL_Delay_ms(100);
-    
-    // Pull RESX low to reset
-    LCD_HAL_DigitalWrite(LCD_RST_PIN, 0);
-    LCD_HAL_Delay_ms(100);  // Hold reset (working example uses 100ms)
-    
-    // Release RESX high
-    LCD_HAL_DigitalWrite(LCD_RST_PIN, 1);
-    LCD_HAL_Delay_ms(100);  // Wait for display to stabilize (working example uses 100ms)
-    // Note: CS remains LOW - do NOT set CS high here!
-}
-
 // ============================================================================
 // INITIALIZATION
 // ============================================================================
 
+/// Bytes (command and parameters) sent per GC9A01_InitStep() of the register table
+#define GC9A01_INIT_STEP_BYTES  8
+
+/// First step of the register table; the table advances the step once per command
+#define GC9A01_INIT_TABLE_STEP  3
+/// Last step, after the sleep-out delay
+#define GC9A01_INIT_DISPLAY_ON  0xFE
+
 /**
- * @brief Initialize GC9A01 display registers
- * 
- * This function sends the complete initialization sequence to the GC9A01.
- * The sequence includes power settings, memory access control, pixel format,
- * gamma correction, and finally display on commands.
+ * @brief GC9A01 initialisation registers: command, parameter count, parameters
  * 
  * This is the verified GC9A01 initialization sequence based on datasheet
- * and community implementations.
+ * and community implementations: power settings, memory access control,
+ * pixel format and gamma correction. Sent a few commands per step by
+ * GC9A01_InitStep(), so a time-sliced init never holds the bus for the
+ * whole sequence.
  */
-static void GC9A01_InitRegisters(void)
-{
+static const UBYTE gc9a01_init_regs[] = {
     // CRITICAL: Initialization sequence must start with 0xEF, 0xEB, 0x14
     // Then 0xFE, 0xEF, then 0xEB, 0x14 again
     // This is the correct sequence from the working example code
-    
-    GC9A01_SendCommand(0xEF);
-    GC9A01_SendCommand(0xEB);
-    GC9A01_SendData(0x14);
-    
-    GC9A01_SendCommand(0xFE);
-    GC9A01_SendCommand(0xEF);
-    
-    GC9A01_SendCommand(0xEB);
-    GC9A01_SendData(0x14);
-    
+    0xEF, 0,
+    0xEB, 1, 0x14,
+    0xFE, 0,
+    0xEF, 0,
+    0xEB, 1, 0x14,
+
     // VCOM setting
-    GC9A01_SendCommand(0x84);
-    GC9A01_SendData(0x40);
-    
+    0x84, 1, 0x40,
+
     // LUT (Look-Up Table) settings for power optimization
-    GC9A01_SendCommand(0x85);
-    GC9A01_SendData(0xFF);
-    GC9A01_SendCommand(0x86);
-    GC9A01_SendData(0xFF);
-    GC9A01_SendCommand(0x87);
-    GC9A01_SendData(0xFF);
-    GC9A01_SendCommand(0x88);
-    GC9A01_SendData(0x0A);
-    GC9A01_SendCommand(0x89);
-    GC9A01_SendData(0x21);
-    GC9A01_SendCommand(0x8A);
-    GC9A01_SendData(0x00);
-    GC9A01_SendCommand(0x8B);
-    GC9A01_SendData(0x80);
-    GC9A01_SendCommand(0x8C);
-    GC9A01_SendData(0x01);
-    GC9A01_SendCommand(0x8D);
-    GC9A01_SendData(0x01);
-    GC9A01_SendCommand(0x8E);
-    GC9A01_SendData(0xFF);
-    GC9A01_SendCommand(0x8F);
-    GC9A01_SendData(0xFF);
-    
+    0x85, 1, 0xFF,
+    0x86, 1, 0xFF,
+    0x87, 1, 0xFF,
+    0x88, 1, 0x0A,
+    0x89, 1, 0x21,
+    0x8A, 1, 0x00,
+    0x8B, 1, 0x80,
+    0x8C, 1, 0x01,
+    0x8D, 1, 0x01,
+    0x8E, 1, 0xFF,
+    0x8F, 1, 0xFF,
+
     // Internal pump voltage
-    GC9A01_SendCommand(0xB6);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x20);
-    
+    0xB6, 2, 0x00, 0x20,
+
     // Memory access control (orientation and RGB order)
-    // 0x08 = Normal orientation, RGB order
-    GC9A01_SendCommand(0x36);
-    GC9A01_SendData(0x08);
-    
+    // Broadcast init: the parameter is replaced by the first selected panel's MADCTL
+    0x36, 1, 0x08,
+
     // Pixel format: 16-bit/pixel (RGB565)
     // 0x05 = 16-bit color
-    GC9A01_SendCommand(0x3A);
-    GC9A01_SendData(0x05);
-    
+    0x3A, 1, 0x05,
+
     // Display function control
-    GC9A01_SendCommand(0x90);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x08);
-    
+    0x90, 4, 0x08, 0x08, 0x08, 0x08,
+
     // Additional display settings
-    GC9A01_SendCommand(0xBD);
-    GC9A01_SendData(0x06);
-    GC9A01_SendCommand(0xBC);
-    GC9A01_SendData(0x00);
-    GC9A01_SendCommand(0xFF);
-    GC9A01_SendData(0x60);
-    GC9A01_SendData(0x01);
-    GC9A01_SendData(0x04);
-    GC9A01_SendCommand(0xC3);
-    GC9A01_SendData(0x13);
-    GC9A01_SendCommand(0xC4);
-    GC9A01_SendData(0x13);
-    GC9A01_SendCommand(0xC9);
-    GC9A01_SendData(0x22);
-    GC9A01_SendCommand(0xBE);
-    GC9A01_SendData(0x11);
-    
+    0xBD, 1, 0x06,
+    0xBC, 1, 0x00,
+    0xFF, 3, 0x60, 0x01, 0x04,
+    0xC3, 1, 0x13,
+    0xC4, 1, 0x13,
+    0xC9, 1, 0x22,
+    0xBE, 1, 0x11,
+
     // Gamma correction (positive polarity) - only 2 bytes in working example
-    GC9A01_SendCommand(0xE1);
-    GC9A01_SendData(0x10);
-    GC9A01_SendData(0x0E);
-    
+    0xE1, 2, 0x10, 0x0E,
+
     // Additional display settings from working example
-    GC9A01_SendCommand(0xDF);
-    GC9A01_SendData(0x21);
-    GC9A01_SendData(0x0c);
-    GC9A01_SendData(0x02);
-    
-    GC9A01_SendCommand(0xF0);
-    GC9A01_SendData(0x45);
-    GC9A01_SendData(0x09);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x26);
-    GC9A01_SendData(0x2A);
-    
-    GC9A01_SendCommand(0xF1);
-    GC9A01_SendData(0x43);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x72);
-    GC9A01_SendData(0x36);
-    GC9A01_SendData(0x37);
-    GC9A01_SendData(0x6F);
-    
-    GC9A01_SendCommand(0xF2);
-    GC9A01_SendData(0x45);
-    GC9A01_SendData(0x09);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x26);
-    GC9A01_SendData(0x2A);
-    
-    GC9A01_SendCommand(0xF3);
-    GC9A01_SendData(0x43);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x72);
-    GC9A01_SendData(0x36);
-    GC9A01_SendData(0x37);
-    GC9A01_SendData(0x6F);
-    
-    GC9A01_SendCommand(0xED);
-    GC9A01_SendData(0x1B);
-    GC9A01_SendData(0x0B);
-    
-    GC9A01_SendCommand(0xAE);
-    GC9A01_SendData(0x77);
-    
-    GC9A01_SendCommand(0xCD);
-    GC9A01_SendData(0x63);
-    
-    GC9A01_SendCommand(0x70);
-    GC9A01_SendData(0x07);
-    GC9A01_SendData(0x07);
-    GC9A01_SendData(0x04);
-    GC9A01_SendData(0x0E);
-    GC9A01_SendData(0x0F);
-    GC9A01_SendData(0x09);
-    GC9A01_SendData(0x07);
-    GC9A01_SendData(0x08);
-    GC9A01_SendData(0x03);
-    
-    GC9A01_SendCommand(0xE8);
-    GC9A01_SendData(0x34);
-    
-    GC9A01_SendCommand(0x62);
-    GC9A01_SendData(0x18);
-    GC9A01_SendData(0x0D);
-    GC9A01_SendData(0x71);
-    GC9A01_SendData(0xED);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x18);
-    GC9A01_SendData(0x0F);
-    GC9A01_SendData(0x71);
-    GC9A01_SendData(0xEF);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x70);
-    
-    GC9A01_SendCommand(0x63);
-    GC9A01_SendData(0x18);
-    GC9A01_SendData(0x11);
-    GC9A01_SendData(0x71);
-    GC9A01_SendData(0xF1);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x18);
-    GC9A01_SendData(0x13);
-    GC9A01_SendData(0x71);
-    GC9A01_SendData(0xF3);
-    GC9A01_SendData(0x70);
-    GC9A01_SendData(0x70);
-    
-    GC9A01_SendCommand(0x64);
-    GC9A01_SendData(0x28);
-    GC9A01_SendData(0x29);
-    GC9A01_SendData(0xF1);
-    GC9A01_SendData(0x01);
-    GC9A01_SendData(0xF1);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x07);
-    
-    GC9A01_SendCommand(0x66);
-    GC9A01_SendData(0x3C);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0xCD);
-    GC9A01_SendData(0x67);
-    GC9A01_SendData(0x45);
-    GC9A01_SendData(0x45);
-    GC9A01_SendData(0x10);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x00);
-    
-    GC9A01_SendCommand(0x67);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x3C);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x01);
-    GC9A01_SendData(0x54);
-    GC9A01_SendData(0x10);
-    GC9A01_SendData(0x32);
-    GC9A01_SendData(0x98);
-    
-    GC9A01_SendCommand(0x74);
-    GC9A01_SendData(0x10);
-    GC9A01_SendData(0x85);
-    GC9A01_SendData(0x80);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x00);
-    GC9A01_SendData(0x4E);
-    GC9A01_SendData(0x00);
-    
-    GC9A01_SendCommand(0x98);
-    GC9A01_SendData(0x3e);
-    GC9A01_SendData(0x07);
-    
-    GC9A01_SendCommand(0x35);
-    GC9A01_SendCommand(0x21);
-    
-    // Sleep out - exit sleep mode (120ms delay required)
-    GC9A01_SendCommand(0x11);
-    LCD_HAL_Delay_ms(120);
-    
-    // Display on
-    GC9A01_SendCommand(0x29);
-    LCD_HAL_Delay_ms(20);
+    0xDF, 3, 0x21, 0x0C, 0x02,
+    0xF0, 6, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+    0xF1, 6, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+    0xF2, 6, 0x45, 0x09, 0x08, 0x08, 0x26, 0x2A,
+    0xF3, 6, 0x43, 0x70, 0x72, 0x36, 0x37, 0x6F,
+    0xED, 2, 0x1B, 0x0B,
+    0xAE, 1, 0x77,
+    0xCD, 1, 0x63,
+    0x70, 9, 0x07, 0x07, 0x04, 0x0E, 0x0F, 0x09, 0x07, 0x08, 0x03,
+    0xE8, 1, 0x34,
+    0x62, 12, 0x18, 0x0D, 0x71, 0xED, 0x70, 0x70, 0x18, 0x0F, 0x71, 0xEF, 0x70, 0x70,
+    0x63, 12, 0x18, 0x11, 0x71, 0xF1, 0x70, 0x70, 0x18, 0x13, 0x71, 0xF3, 0x70, 0x70,
+    0x64, 7, 0x28, 0x29, 0xF1, 0x01, 0xF1, 0x00, 0x07,
+    0x66, 10, 0x3C, 0x00, 0xCD, 0x67, 0x45, 0x45, 0x10, 0x00, 0x00, 0x00,
+    0x67, 10, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x01, 0x54, 0x10, 0x32, 0x98,
+    0x74, 7, 0x10, 0x85, 0x80, 0x00, 0x00, 0x4E, 0x00,
+    0x98, 2, 0x3E, 0x07,
+
+    // Tearing effect line on, V-blank mode (see GC9A01_Present())
+    0x35, 1, 0x00,
+    0x21, 0,
+};
+
+/**
+ * @brief Send whole commands of the register table, from command index on
+ * 
+ * Stops once GC9A01_INIT_STEP_BYTES have gone out; a longer command is
+ * still sent whole.
+ * 
+ * @return Index of the next command, 0 once the table has been sent
+ */
+static UBYTE GC9A01_InitRegisters(UBYTE index)
+{
+    const UBYTE *p = gc9a01_init_regs;
+    const UBYTE *end = gc9a01_init_regs + sizeof(gc9a01_init_regs);
+    UBYTE sent = 0;
+    
+    for (UBYTE i = 0; i < index && p < end; i++) p += 2 + p[1];
+    while (p < end && sent < GC9A01_INIT_STEP_BYTES) {
+        GC9A01_SendCommand(p[0]);
+        for (UBYTE i = 0; i < p[1]; i++) {
+            GC9A01_SendData(p[0] == 0x36 ? gc9a01_madctl[GC9A01_FirstPanel()] : p[2 + i]);
+        }
+        sent += 1 + p[1];
+        p += 2 + p[1];
+        index++;
+    }
+    return p < end ? index : 0;
 }
 
 /**
- * @brief Initialize the GC9A01 display
+ * @brief One step of the initialisation, without the waits
  * 
- * Main initialization function. Performs hardware reset and then sends
- * the initialization sequence to configure the display.
+ * GC9A01_Init() runs all steps with blocking delays; a scheduler can run
+ * them one at a time and do other work during the waits (see
+ * GC9A01_Job_Init()).
+ * 
+ * Reset, according to the GC9A01 datasheet:
+ * - RESX is pulled low when module is powered on
+ * - RESX should usually be set to 1 (high)
+ * - Reset sequence: Pull low, then release high
  * 
  * Steps:
- * 1. Hardware reset via RST pin
- * 2. Send initialization register sequence
+ * 0. CS low
+ * 1. RST low - hold for at least 10ms
+ * 2. RST high - wait at least 120ms for display to stabilize
+ * 3. Register sequence, GC9A01_INIT_STEP_BYTES per step, then sleep out
+ *    (120ms delay required)
+ * 4. Display on
+ * 
+ * @param step    0 for the first call, then the previous return value
+ * @param wait_ms Set to the time to wait before the next step
+ * @return Next step, 0 once the display is on
+ */
+UBYTE GC9A01_InitStep(UBYTE step, uint16_t *wait_ms)
+{
+    switch (step) {
+    case 0:
+        // CRITICAL: Working example (Arduino) sets CS LOW first, then performs reset
+        // STM32 version doesn't manipulate CS during reset - testing Arduino version first
+        GC9A01_CS(0);  // CS low (Arduino example does this)
+        *wait_ms = 100;
+        return 1;
+    case 1:
+        // Pull RESX low to reset
+        GC9A01_RST(0);
+        *wait_ms = 100;  // Hold reset (working example uses 100ms)
+        return 2;
+    case 2:
+        // Release RESX high
+        GC9A01_RST(1);
+        *wait_ms = 100;  // Wait for display to stabilize (working example uses 100ms)
+        // Note: CS remains LOW - do NOT set CS high here!
+        return GC9A01_INIT_TABLE_STEP;
+    case GC9A01_INIT_DISPLAY_ON:
+        // Display on
+        GC9A01_SendCommand(0x29);
+        *wait_ms = 20;
+        for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+            if (gc9a01_panels & GC9A01_PANEL(i)) {
+                gc9a01_power[i] = GC9A01_POWER_NORMAL;
+                gc9a01_madctl[i] = gc9a01_madctl[GC9A01_FirstPanel()];
+            }
+        }
+        return 0;
+    default: {
+        UBYTE next = GC9A01_InitRegisters(step - GC9A01_INIT_TABLE_STEP);
+        *wait_ms = 0;
+        if (next) return GC9A01_INIT_TABLE_STEP + next;
+        // Sleep out - exit sleep mode
+        GC9A01_SendCommand(0x11);
+        *wait_ms = 120;
+        return GC9A01_INIT_DISPLAY_ON;
+    }
+    }
+}
+
+/**
+ * @brief Initialize the GC9A01 display
+ * 
+ * Main initialization function. Performs hardware reset and then sends
+ * the initialization sequence to configure the display, by running every
+ * GC9A01_InitStep() with blocking delays.
  * 
  * Must be called before using any other display functions.
  * 
- * @note Takes approximately 200ms due to required delays
+ * @note Takes approximately 440ms due to required delays
  */
 void GC9A01_Init(void)
 {
-    // Step 1: Hardware reset
-    GC9A01_Reset();
+    UBYTE step = 0;
+    uint16_t wait_ms;
+    
+    do {
+        step = GC9A01_InitStep(step, &wait_ms);
+        if (wait_ms) LCD_HAL_Delay_ms(wait_ms);
+    } while (step);
+}
+
+// ============================================================================
+// PANEL SELECTION
+// ============================================================================
+
+/**
+ * @brief Choose the panels that the following calls draw on
+ * 
+ * Commands leave CS low (see GC9A01_SendCommand()), so the old panels are
+ * released before the new ones are picked up.
+ * 
+ * @param mask GC9A01_PANEL(n) flags; 0 is ignored
+ * @return Previous mask
+ */
+UBYTE GC9A01_SelectPanels(UBYTE mask)
+{
+    UBYTE old = gc9a01_panels;
     
-    // Step 2: Initialize display registers
-    GC9A01_InitRegisters();
+    mask &= GC9A01_PANELS_ALL;
+    if (mask && mask != old) {
+        GC9A01_CS(1);
+        gc9a01_panels = mask;
+    }
+    return old;
+}
+
+// ============================================================================
+// POWER MODES
+// ============================================================================
+
+/**
+ * @brief Turn the backlight (LCD_BL_PIN) on or off
+ */
+void GC9A01_SetBacklight(UBYTE on)
+{
+    LCD_HAL_DigitalWrite(LCD_BL_PIN, on ? 1 : 0);
+}
+
+/**
+ * @brief Set the rows kept alive in partial mode
+ * 
+ * Takes effect the next time partial mode is entered.
+ * 
+ * @param y0 First row, @param y1 Last row (exclusive)
+ */
+void GC9A01_SetPartialArea(uint16_t y0, uint16_t y1)
+{
+    if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
+    if (y0 >= y1) return;
+    gc9a01_partial_y0 = y0;
+    gc9a01_partial_y1 = y1;
+}
+
+/**
+ * @brief Switch between normal, idle, partial and sleep
+ * 
+ * Only the commands for flags that change are sent. GRAM is kept in all
+ * modes, so leaving one needs no redraw.
+ * - IDLE (0x39/0x38): 8 colours (MSB of each channel), lower drive power
+ * - PARTIAL (0x30 + 0x12/0x13): rows outside the partial area are black
+ *   and not driven
+ * - SLEEP (0x10/0x11): display and oscillator off, backlight off
+ * 
+ * Wake-up cost: idle and partial are a single command. Sleep out needs
+ * 5 ms before the next command; the datasheet's 120 ms applies only
+ * before the next sleep in, which the caller must respect (the policy
+ * in gc9a01_power.c does).
+ * 
+ * @param old  GC9A01_POWER_* flags the selected panels are in
+ * @param mode GC9A01_POWER_* flags
+ */
+static void GC9A01_PowerChange(UBYTE old, UBYTE mode)
+{
+    UBYTE changed = mode ^ old;
+    
+    if (changed == 0) return;
+    
+    if ((changed & GC9A01_POWER_SLEEP) && (mode & GC9A01_POWER_SLEEP)) {
+        GC9A01_SetBacklight(0);                // Nothing to see from here on
+        GC9A01_SendCommandWithData(0x10, NULL, 0);
+        LCD_HAL_Delay_ms(5);
+    } else if (changed & GC9A01_POWER_SLEEP) {
+        GC9A01_SendCommandWithData(0x11, NULL, 0);
+        LCD_HAL_Delay_ms(5);
+    }
+    
+    if (changed & GC9A01_POWER_PARTIAL) {
+        if (mode & GC9A01_POWER_PARTIAL) {
+            uint8_t area[4] = {
+                gc9a01_partial_y0 >> 8, gc9a01_partial_y0 & 0xFF,
+                (gc9a01_partial_y1 - 1) >> 8, (gc9a01_partial_y1 - 1) & 0xFF,
+            };
+            GC9A01_SendCommandWithData(0x30, area, 4);
+            GC9A01_SendCommandWithData(0x12, NULL, 0);
+        } else {
+            GC9A01_SendCommandWithData(0x13, NULL, 0);
+        }
+    }
+    
+    if (changed & GC9A01_POWER_IDLE) {
+        GC9A01_SendCommandWithData((mode & GC9A01_POWER_IDLE) ? 0x39 : 0x38, NULL, 0);
+    }
+    
+    // Light up only once the panel shows the restored state
+    if ((changed & GC9A01_POWER_SLEEP) && !(mode & GC9A01_POWER_SLEEP)) {
+        GC9A01_SetBacklight(1);
+    }
+}
+
+/**
+ * @brief Put the selected panels in a power mode
+ * 
+ * Panels in the same mode change together, one broadcast per group. The
+ * backlight pin is shared: a panel going to sleep turns it off for all.
+ * 
+ * @param mode GC9A01_POWER_* flags
+ */
+void GC9A01_SetPowerMode(UBYTE mode)
+{
+    UBYTE mask = gc9a01_panels;
+    UBYTE todo = mask;
+    
+    while (todo) {
+        UBYTE group = GC9A01_SameAsFirst(todo, gc9a01_power, 0xFF);
+        GC9A01_SelectPanels(group);
+        GC9A01_PowerChange(gc9a01_power[GC9A01_FirstPanel()], mode);
+        for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+            if (group & GC9A01_PANEL(i)) gc9a01_power[i] = mode;
+        }
+        todo &= ~group;
+    }
+    GC9A01_SelectPanels(mask);
+}
+
+/**
+ * @brief Current GC9A01_POWER_* flags of the first selected panel
+ */
+UBYTE GC9A01_GetPowerMode(void)
+{
+    return gc9a01_power[GC9A01_FirstPanel()];
+}
+
+/**
+ * @brief Number of draw calls since start-up (wraps)
+ */
+UDOUBLE GC9A01_DrawCount(void)
+{
+    return gc9a01_draws;
+}
+
+/**
+ * @brief Number of GC9A01_Present() updates whose TE wait timed out (wraps)
+ */
+UDOUBLE GC9A01_TETimeouts(void)
+{
+    return gc9a01_te_timeouts;
+}
+
+/**
+ * @brief Called by every drawing function before it touches GRAM
+ * 
+ * A low-power mode would hide (partial, sleep) or degrade (idle) what is
+ * about to be drawn, so the panel is brought back to normal first.
+ */
+static void GC9A01_BeginDraw(void)
+{
+    gc9a01_draws++;
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if ((gc9a01_panels & GC9A01_PANEL(i)) && gc9a01_power[i] != GC9A01_POWER_NORMAL) {
+            GC9A01_SetPowerMode(GC9A01_POWER_NORMAL);
+            break;
+        }
+    }
 }
 
 // ============================================================================
@@ -499,6 +672,8 @@ void GC9A01_FillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, UWORD c
     if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
     if (x0 >= x1 || y0 >= y1) return;
     
+    GC9A01_BeginDraw();
+    
     // Set the window to fill
     GC9A01_SetWindow(x0, y0, x1, y1);
     
@@ -540,11 +715,10 @@ void GC9A01_FillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, UWORD c
     
     // CRITICAL: Wait for last byte to complete before CS goes HIGH
     // Otherwise transmission may be cut off
-    uint32_t timeout = 100000;
-    while((SPI1->STATR & (1 << 7)) && timeout--) {}  // Wait for BSY to clear
+    LCD_HAL_SPI_WaitIdle();
     
     // Set CS HIGH after all pixels are sent and transmission complete
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 1);  // CS HIGH after entire stream
+    GC9A01_CS(1);  // CS HIGH after entire stream
 }
 
 /**
@@ -584,3 +758,294 @@ void GC9A01_DrawStripes(void)
     }
 }
 
+
+// ============================================================================
+// BAND RENDERING AND TE-SYNCHRONISED PRESENT
+// ============================================================================
+
+/**
+ * @brief Stream one row of pixels (CS LOW, DC HIGH already set)
+ * 
+ * @param pixels RGB565 values in CPU byte order, sent MSB first
+ * @param count  Number of pixels
+ */
+static void GC9A01_StreamPixels(const UWORD *pixels, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        LCD_HAL_SPI_WriteByte(pixels[i] >> 8);
+        LCD_HAL_SPI_WriteByte(pixels[i] & 0xFF);
+    }
+}
+
+/**
+ * @brief Check whether the panel scans logical rows bottom-to-top
+ * 
+ * MADCTL MY (bit 7) mirrors the row address and ML (bit 4) reverses the
+ * refresh order; with exactly one of them set the scan meets the highest
+ * logical row first. MV (bit 5) would turn rows into columns, in which case
+ * the scan runs across logical columns and row order does not matter.
+ * 
+ * @return 1 if logical rows are scanned bottom-up
+ */
+static UBYTE GC9A01_ScanBottomUp(void)
+{
+    UBYTE madctl = gc9a01_madctl[GC9A01_FirstPanel()];
+    UBYTE my = (madctl >> 7) & 1;
+    UBYTE ml = (madctl >> 4) & 1;
+    return my ^ ml;
+}
+
+/**
+ * @brief Render rows y0..y1-1 through the line buffer and send them
+ * 
+ * Always top row first: RAMWR fills the window in ascending logical
+ * rows whatever MADCTL says, the controller does the mapping.
+ */
+static void GC9A01_SendRows(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                            GC9A01_RowFunc row_fn, void *ctx)
+{
+    uint16_t width = x1 - x0;
+    
+    LCD_HAL_DigitalWrite(LCD_DC_PIN, 1);  // Pixel data follows the 0x2C in SetWindow
+    for (uint16_t y = y0; y < y1; y++) {
+        row_fn(y, x0, width, gc9a01_line, ctx);
+        GC9A01_StreamPixels(gc9a01_line, width);
+    }
+    LCD_HAL_SPI_WaitIdle();
+    GC9A01_CS(1);
+}
+
+/**
+ * @brief Rotate and mirror through MADCTL instead of per pixel
+ * 
+ * MV exchanges rows and columns, then MX/MY reverse the physical column
+ * and row address. A quarter turn clockwise takes logical x down the
+ * physical rows and y right-to-left along them (MV|MX); the mirrors then
+ * act on physical axes, so they toggle MX/MY whatever the rotation.
+ * 
+ * | rotation | MADCTL       |
+ * |----------|--------------|
+ * | 0        | -            |
+ * | 90       | MV | MX      |
+ * | 180      | MX | MY      |
+ * | 270      | MV | MY      |
+ * 
+ * @note The panel is square, so LCD_WIDTH/LCD_HEIGHT hold in every
+ *       orientation. With MV set the scan crosses logical columns and
+ *       GC9A01_Present() cannot stay behind it; the partial area stays in
+ *       physical rows.
+ */
+void GC9A01_SetOrientation(UBYTE rotation, UBYTE mirror)
+{
+    UBYTE bits = 0;
+    UBYTE mask = gc9a01_panels;
+    UBYTE todo = mask;
+
+    rotation &= 3;
+    if (rotation & 1) bits |= 0x20;                                     // MV
+    if (((rotation == 1 || rotation == 2) ? 1 : 0) ^ ((mirror & GC9A01_MIRROR_X) ? 1 : 0)) {
+        bits |= 0x40;                                                   // MX
+    }
+    if (((rotation >= 2) ? 1 : 0) ^ ((mirror & GC9A01_MIRROR_Y) ? 1 : 0)) {
+        bits |= 0x80;                                                   // MY
+    }
+
+    // Panels that differ in ML, BGR or MH get their own MADCTL
+    while (todo) {
+        UBYTE group = GC9A01_SameAsFirst(todo, gc9a01_madctl, 0x1F);
+        GC9A01_SelectPanels(group);
+        UBYTE madctl = (gc9a01_madctl[GC9A01_FirstPanel()] & 0x1F) | bits;  // Keep ML, BGR, MH
+        for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+            if (group & GC9A01_PANEL(i)) gc9a01_madctl[i] = madctl;
+        }
+        GC9A01_SendCommand(0x36);
+        GC9A01_SendData(madctl);
+        todo &= ~group;
+    }
+    GC9A01_SelectPanels(mask);
+}
+
+/**
+ * @brief Set the scanline at which the panel raises TE (command 0x44)
+ * 
+ * @param line Physical scanline (0 to LCD_HEIGHT + LCD_VBLANK_LINES - 1)
+ */
+void GC9A01_SetTearScanline(uint16_t line)
+{
+    GC9A01_SendCommand(0x44);
+    GC9A01_SendData(line >> 8);
+    GC9A01_SendData(line & 0xFF);
+}
+
+/**
+ * @brief Render a region row by row through a callback (band renderer)
+ * 
+ * Each row is produced by row_fn into a driver-owned line buffer and
+ * streamed straight to GRAM, so no frame buffer is needed.
+ */
+void GC9A01_DrawRows(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     GC9A01_RowFunc row_fn, void *ctx)
+{
+    if (x0 >= LCD_WIDTH || y0 >= LCD_HEIGHT) return;
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    GC9A01_BeginDraw();
+    GC9A01_SetWindow(x0, y0, x1, y1);
+    GC9A01_SendRows(x0, y0, x1, y1, row_fn, ctx);
+}
+
+/**
+ * @brief Number of rows of a given width that can be written per TE sync
+ * 
+ * With t_row = time to send one row, t_line = scan time per line and
+ * T the frame period (given a 1/8 margin for row rendering time and
+ * command overhead):
+ * - top-down: writing starts as the scan passes the band's first row. The
+ *   scan then runs ahead, wraps, and must not overtake the writer before
+ *   the band is done: rows * t_row <= T + (rows - 1) * t_line
+ * - bottom-up: rows are still written top first, so writing starts once
+ *   the scan has left the band and must end before it comes back:
+ *   rows * t_row <= T - (rows - 1) * t_line
+ */
+static uint16_t GC9A01_RowsPerSync(uint16_t width, UBYTE bottom_up)
+{
+    uint32_t bit_ns  = 1000000000UL / LCD_SPI_SPEED_HZ;
+    uint32_t row_ns  = (uint32_t)width * 16 * bit_ns;
+    uint32_t line_ns = (LCD_FRAME_PERIOD_US * 1000UL) / (LCD_HEIGHT + LCD_VBLANK_LINES);
+    uint32_t budget  = (LCD_FRAME_PERIOD_US * 1000UL / 8) * 7;
+    uint32_t rows;
+    
+    if (bottom_up) {
+        rows = (budget + line_ns) / (row_ns + line_ns);
+        return rows ? rows : 1;
+    }
+    if (row_ns <= line_ns) return LCD_HEIGHT;  // Writer outruns the scan
+    rows = (budget - line_ns) / (row_ns - line_ns);
+    return rows ? rows : 1;
+}
+
+/**
+ * @brief Tear-free region update synchronised to the panel's TE output
+ * 
+ * The region is split into bands small enough to finish before the scan
+ * wraps around onto them. For each band, in the panel's scan order:
+ * 1. Tear scanline (0x44) is set to the line after the band's first row
+ *    (bottom-up scan: after its top row, the last one scanned)
+ * 2. Window is set and RAMWR issued
+ * 3. Wait for TE - the scan has just finished that row
+ * 4. Rows are streamed, top row first as RAMWR fills the window
+ * 
+ * When MADCTL makes the scan run bottom-up (ROTATE_180, MIRROR_Y) only the
+ * band order is reversed; each band then waits until the scan has left it,
+ * so such updates take about one frame per band.
+ * 
+ * Without LCD_TE_ENABLED the bands are still sent in scan order, which
+ * keeps tearing to a single seam per update. If a TE wait times out (TE
+ * enabled but the pad not wired), the rest of the update is sent that way
+ * too, and GC9A01_TETimeouts() counts it.
+ */
+void GC9A01_Present(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                    GC9A01_RowFunc row_fn, void *ctx)
+{
+    if (x0 >= LCD_WIDTH || y0 >= LCD_HEIGHT) return;
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    GC9A01_BeginDraw();
+    UBYTE bottom_up = GC9A01_ScanBottomUp();
+    uint16_t band = GC9A01_RowsPerSync(x1 - x0, bottom_up);
+    uint16_t done = 0;
+    uint16_t height = y1 - y0;
+#if LCD_TE_ENABLED
+    UBYTE te_ok = 1;
+#endif
+    
+    while (done < height) {
+        uint16_t rows = (height - done < band) ? (height - done) : band;
+        uint16_t b0, b1, first_line;
+        
+        if (bottom_up) {
+            // Rows still go out top first, against the scan: wait until the
+            // whole band has been read out (its top row, scanned last)
+            b1 = y1 - done;
+            b0 = b1 - rows;
+            first_line = LCD_HEIGHT - 1 - b0;  // Scan index of logical row b0
+        } else {
+            b0 = y0 + done;
+            b1 = b0 + rows;
+            first_line = b0;
+        }
+        
+#if LCD_TE_ENABLED
+        // TE on the line after the band's first row: that row has been read out
+        if (te_ok) GC9A01_SetTearScanline(first_line + 1);
+#else
+        (void)first_line;
+#endif
+        GC9A01_SetWindow(x0, b0, x1, b1);
+#if LCD_TE_ENABLED
+        // No edge within two frames: do not stall every band on it
+        if (te_ok && !LCD_HAL_TE_Wait(2 * LCD_FRAME_PERIOD_US / 1000 + 1)) {
+            te_ok = 0;
+            gc9a01_te_timeouts++;
+        }
+#endif
+        GC9A01_SendRows(x0, b0, x1, b1, row_fn, ctx);
+        done += rows;
+    }
+}
+
+// ============================================================================
+// PIXEL STREAM
+// ============================================================================
+
+/**
+ * @brief Open a window for pixels produced one at a time
+ * 
+ * For sources that decode on the fly (e.g. the UART frame link), where
+ * neither a row callback nor a buffer fits. Pixels fill the window left
+ * to right, top to bottom, until GC9A01_StreamEnd().
+ * 
+ * @param x1, y1 Exclusive right and bottom edges
+ */
+void GC9A01_StreamBegin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    GC9A01_BeginDraw();
+    GC9A01_SetWindow(x0, y0, x1, y1);
+    LCD_HAL_DigitalWrite(LCD_DC_PIN, 1);  // Pixel data follows the 0x2C
+}
+
+/**
+ * @brief Send one pixel of the open stream
+ */
+void GC9A01_StreamPixel(UWORD color)
+{
+    LCD_HAL_SPI_WriteByte(color >> 8);
+    LCD_HAL_SPI_WriteByte(color & 0xFF);
+}
+
+/**
+ * @brief Send count copies of a pixel to the open stream
+ */
+void GC9A01_StreamRepeat(UWORD color, uint16_t count)
+{
+    uint8_t msb = color >> 8;
+    uint8_t lsb = color & 0xFF;
+    
+    while (count--) {
+        LCD_HAL_SPI_WriteByte(msb);
+        LCD_HAL_SPI_WriteByte(lsb);
+    }
+}
+
+/**
+ * @brief Close the stream once the last byte has been clocked out
+ */
+void GC9A01_StreamEnd(void)
+{
+    LCD_HAL_SPI_WaitIdle();
+    GC9A01_CS(1);
+}
@@ -30,6 +30,54 @@
 #define LCD_COLOR_CYAN     0x07FF  ///< RGB(0, 63, 31)
 #define LCD_COLOR_MAGENTA  0xF81F  ///< RGB(31, 0, 31)
 
+// ============================================================================
+// POWER MODES (flags for GC9A01_SetPowerMode())
+// ============================================================================
+
+#define GC9A01_POWER_NORMAL   0x00  ///< Full colour, all rows
+#define GC9A01_POWER_IDLE     0x01  ///< 8-colour idle mode
+#define GC9A01_POWER_PARTIAL  0x02  ///< Only the partial area is driven
+#define GC9A01_POWER_SLEEP    0x04  ///< Sleep in, backlight off
+
+// ============================================================================
+// ORIENTATION (for GC9A01_SetOrientation())
+// ============================================================================
+
+#define GC9A01_ROTATE_0       0     ///< Native orientation
+#define GC9A01_ROTATE_90      1     ///< Quarter turn clockwise
+#define GC9A01_ROTATE_180     2
+#define GC9A01_ROTATE_270     3
+
+#define GC9A01_MIRROR_NONE    0x00
+#define GC9A01_MIRROR_X       0x01  ///< Left-right, after the rotation
+#define GC9A01_MIRROR_Y       0x02  ///< Top-bottom, after the rotation
+
+// ============================================================================
+// PANELS (masks for GC9A01_SelectPanels())
+// ============================================================================
+
+#define GC9A01_MAX_PANELS     4
+#define GC9A01_PANEL(n)       (1 << (n))                   ///< Panel n alone
+#define GC9A01_PANELS_ALL     ((1 << LCD_PANEL_COUNT) - 1) ///< Broadcast to every panel
+
+// ============================================================================
+// TYPES
+// ============================================================================
+
+/**
+ * @brief Row producer for GC9A01_DrawRows() / GC9A01_Present()
+ * 
+ * Called once per row; must fill line[0..width-1] with RGB565 pixels
+ * (CPU byte order) for columns x0..x0+width-1 of row y.
+ * 
+ * @param y     Row being rendered
+ * @param x0    First column of the row segment
+ * @param width Number of pixels to produce
+ * @param line  Destination line buffer (driver owned, LCD_WIDTH entries)
+ * @param ctx   User pointer passed through from the draw call
+ */
+typedef void (*GC9A01_RowFunc)(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx);
+
 // ============================================================================
 // FUNCTION PROTOTYPES
 // ============================================================================
@@ -40,10 +88,32 @@
  * Performs hardware reset and sends initialization sequence.
  * Must be called before using any other display functions.
  * 
- * @note Takes approximately 200ms due to required delays.
+ * @note Takes approximately 440ms due to required delays.
  */
 void GC9A01_Init(void);
 
+/**
+ * @brief Run one step of GC9A01_Init() and return instead of waiting
+ * 
+ * @param step    0 to start, then the previous return value
+ * @param wait_ms Set to the delay needed before the next step
+ * @return Next step, 0 when done
+ */
+UBYTE GC9A01_InitStep(UBYTE step, uint16_t *wait_ms);
+
+/**
+ * @brief Choose the panels that the following calls draw on
+ * 
+ * With several panels selected every byte goes out once with all their
+ * CS lines low, so identical content (the init sequence, clears, shared
+ * artwork) costs the same bus time as for one panel. Orientation and
+ * power mode are kept per panel. Starts as GC9A01_PANELS_ALL.
+ * 
+ * @param mask GC9A01_PANEL(n) flags; 0 is ignored
+ * @return Previous mask, to restore the selection afterwards
+ */
+UBYTE GC9A01_SelectPanels(UBYTE mask);
+
 /**
  * @brief Set the display window (area to write pixels to)
  * 
@@ -87,5 +157,120 @@ void GC9A01_FillScreen(UWORD color);
  */
 void GC9A01_DrawStripes(void);
 
+/**
+ * @brief Render a region row by row through a line buffer (band renderer)
+ * 
+ * Uses a single LCD_WIDTH line buffer, so arbitrary content can be drawn
+ * without a frame buffer.
+ * 
+ * @param x0 Left edge, @param y0 Top edge
+ * @param x1 Right edge (exclusive), @param y1 Bottom edge (exclusive)
+ * @param row_fn Row producer
+ * @param ctx    Passed through to row_fn
+ */
+void GC9A01_DrawRows(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     GC9A01_RowFunc row_fn, void *ctx);
+
+/**
+ * @brief Tear-free version of GC9A01_DrawRows()
+ * 
+ * Splits the region into bands sized to finish within one panel frame,
+ * sends them in scan order and starts each band on the TE edge for its
+ * first line, so RAMWR stays behind the scanline.
+ * 
+ * @note Requires LCD_TE_ENABLED and the TE pad wired to LCD_TE_PIN to
+ *       actually wait; otherwise only the band ordering is applied. With
+ *       TE enabled but no edges, the first wait times out after two
+ *       frames, the rest of the update goes out without waiting, and
+ *       GC9A01_TETimeouts() counts it.
+ */
+void GC9A01_Present(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                    GC9A01_RowFunc row_fn, void *ctx);
+
+/**
+ * @brief Rotate and mirror the panel in the controller (MADCTL)
+ * 
+ * Only changes how GRAM is addressed: content already on the panel stays
+ * where it is, so redraw afterwards. All drawing calls keep taking logical
+ * coordinates and send the same bytes as in the native orientation.
+ * 
+ * @param rotation GC9A01_ROTATE_*
+ * @param mirror   GC9A01_MIRROR_* flags
+ */
+void GC9A01_SetOrientation(UBYTE rotation, UBYTE mirror);
+
+/**
+ * @brief Set the scanline that triggers the TE output (command 0x44)
+ * 
+ * @param line Physical scanline, 0 = first visible line
+ */
+void GC9A01_SetTearScanline(uint16_t line);
+
+/**
+ * @brief Open a window for pixels sent one at a time
+ * 
+ * Pixels fill the window left to right, top to bottom. Used by decoders
+ * that produce pixels as their input arrives (see lib/frame_link).
+ * 
+ * @param x0 Left edge, @param y0 Top edge
+ * @param x1 Right edge (exclusive), @param y1 Bottom edge (exclusive)
+ */
+void GC9A01_StreamBegin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+/**
+ * @brief Send one RGB565 pixel to the open window
+ */
+void GC9A01_StreamPixel(UWORD color);
+
+/**
+ * @brief Send count copies of an RGB565 pixel to the open window
+ */
+void GC9A01_StreamRepeat(UWORD color, uint16_t count);
+
+/**
+ * @brief Finish the pixel stream (waits for the SPI, releases CS)
+ */
+void GC9A01_StreamEnd(void);
+
+/**
+ * @brief Turn the backlight on or off (LCD_BL_PIN)
+ */
+void GC9A01_SetBacklight(UBYTE on);
+
+/**
+ * @brief Rows that stay visible in partial mode
+ * 
+ * @param y0 First row, @param y1 Last row (exclusive)
+ */
+void GC9A01_SetPartialArea(uint16_t y0, uint16_t y1);
+
+/**
+ * @brief Enter or leave idle, partial and sleep modes
+ * 
+ * Any drawing call returns the panel to GC9A01_POWER_NORMAL first.
+ * Leaving sleep takes 5 ms; after it, wait 120 ms before sleeping again.
+ * 
+ * @param mode GC9A01_POWER_* flags (combine IDLE and PARTIAL freely)
+ */
+void GC9A01_SetPowerMode(UBYTE mode);
+
+/**
+ * @brief Current GC9A01_POWER_* flags (of the first selected panel)
+ */
+UBYTE GC9A01_GetPowerMode(void);
+
+/**
+ * @brief Number of drawing calls so far (wraps); changes mean activity
+ */
+UDOUBLE GC9A01_DrawCount(void);
+
+/**
+ * @brief Number of GC9A01_Present() updates that gave up waiting for TE (wraps)
+ * 
+ * Should stay 0; anything else means LCD_TE_ENABLED is set but no TE edges
+ * arrive (pad not wired, wrong LCD_TE_PIN).
+ */
+UDOUBLE GC9A01_TETimeouts(void);
+
 #endif // _GC9A01_DRIVER_H_
 
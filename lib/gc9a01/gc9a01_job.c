@@ -0,0 +1,128 @@
+/**
+ * @file gc9a01_job.c
+ * @brief Display work in bounded steps, for a cooperative scheduler
+ */
+
+#include "gc9a01_job.h"
+#include "../lcd_hal/lcd_hal.h"
+
+/**
+ * @brief Clip a region and size its steps; the job stays idle if it is empty
+ * 
+ * A step holds budget_us of pixels on the bus: whole rows when one fits,
+ * else a run of one row. Window commands are not counted; they add about
+ * 11 bytes per step. Runs once per job, so the software divide does not
+ * matter.
+ */
+static void Job_Region(GC9A01_Job *job, UBYTE kind, uint16_t x0, uint16_t y0,
+                       uint16_t x1, uint16_t y1, UDOUBLE budget_us)
+{
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y1 > LCD_HEIGHT) y1 = LCD_HEIGHT;
+    job->kind = (x0 < x1 && y0 < y1) ? kind : GC9A01_JOB_IDLE;
+    job->x0 = x0;
+    job->x1 = x1;
+    job->x = x0;
+    job->y = y0;
+    job->y1 = y1;
+    if (job->kind == GC9A01_JOB_IDLE) return;
+    
+    UDOUBLE px = budget_us * (LCD_SPI_SPEED_HZ / 1000) / 16000;
+    uint16_t width = x1 - x0;
+    if (px >= width) {
+        px /= width;
+        job->rows = px < LCD_HEIGHT ? px : LCD_HEIGHT;
+        job->cols = width;
+    } else {
+        job->rows = 1;
+        job->cols = px ? px : 1;
+    }
+}
+
+// Init: every GC9A01_InitStep() has run, only the display-on wait is left
+#define JOB_INIT_DONE  0xFF
+
+/**
+ * @brief Start GC9A01_Init() as a job; no drawing until it is finished
+ */
+void GC9A01_Job_Init(GC9A01_Job *job)
+{
+    job->kind = GC9A01_JOB_INIT;
+    job->step = 0;
+    job->ready = LCD_HAL_Ticks();
+}
+
+/**
+ * @brief Start a fill, budget_us of pixels per step
+ */
+void GC9A01_Job_Fill(GC9A01_Job *job, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     UWORD color, UDOUBLE budget_us)
+{
+    Job_Region(job, GC9A01_JOB_FILL, x0, y0, x1, y1, budget_us);
+    job->color = color;
+}
+
+/**
+ * @brief Start a band render (GC9A01_DrawRows()), budget_us of pixels per step
+ */
+void GC9A01_Job_Rows(GC9A01_Job *job, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     GC9A01_RowFunc row_fn, void *ctx, UDOUBLE budget_us)
+{
+    Job_Region(job, GC9A01_JOB_ROWS, x0, y0, x1, y1, budget_us);
+    job->row_fn = row_fn;
+    job->ctx = ctx;
+}
+
+/**
+ * @brief Do one bounded piece of the job
+ * 
+ * An init step whose delay has not run out returns at once. Init only
+ * finishes once the display-on delay after its last command has passed, so
+ * the next job can draw straight away.
+ * 
+ * @return 1 while work remains, 0 when the job is finished (or idle)
+ */
+UBYTE GC9A01_Job_Step(GC9A01_Job *job)
+{
+    switch (job->kind) {
+    case GC9A01_JOB_INIT: {
+        uint16_t wait_ms;
+        if ((int32_t)(LCD_HAL_Ticks() - job->ready) < 0) return 1;
+        if (job->step == JOB_INIT_DONE) {
+            job->kind = GC9A01_JOB_IDLE;
+            return 0;
+        }
+        job->step = GC9A01_InitStep(job->step, &wait_ms);
+        job->ready = LCD_HAL_Ticks() + (UDOUBLE)wait_ms * 1000 * LCD_HAL_TICKS_PER_US;
+        if (!job->step) job->step = JOB_INIT_DONE;
+        return 1;
+    }
+    case GC9A01_JOB_FILL:
+    case GC9A01_JOB_ROWS: {
+        uint16_t x1 = job->x1, y1 = job->y + 1;
+        if (job->cols < job->x1 - job->x0) {
+            if (job->x1 - job->x > job->cols) x1 = job->x + job->cols;
+        } else if (job->y1 - job->y > job->rows) {
+            y1 = job->y + job->rows;
+        } else {
+            y1 = job->y1;
+        }
+        if (job->kind == GC9A01_JOB_FILL) {
+            GC9A01_FillRect(job->x, job->y, x1, y1, job->color);
+        } else {
+            GC9A01_DrawRows(job->x, job->y, x1, y1, job->row_fn, job->ctx);
+        }
+        if (x1 < job->x1) {
+            job->x = x1;
+            return 1;
+        }
+        job->x = job->x0;
+        job->y = y1;
+        if (job->y < job->y1) return 1;
+        job->kind = GC9A01_JOB_IDLE;
+        return 0;
+    }
+    default:
+        return 0;
+    }
+}
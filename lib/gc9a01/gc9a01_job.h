@@ -0,0 +1,54 @@
+/**
+ * @file gc9a01_job.h
+ * @brief Display work in bounded steps, for a cooperative scheduler
+ * 
+ * A job is started with GC9A01_Job_Init(), GC9A01_Job_Fill() or
+ * GC9A01_Job_Rows() and advanced with GC9A01_Job_Step(). Each step is
+ * one initialisation step or a band of pixels sized to a time budget,
+ * sent in its own window: whole rows when a row fits the budget, else
+ * part of one row. Nothing blocks: the init
+ * delays become "not ready yet" steps, so other tasks (sensors, buttons,
+ * other drawing) run between steps.
+ * 
+ * Usage with lib/sched:
+ * @code
+ * static GC9A01_Job job;
+ * static UBYTE display_step(void *ctx) { return GC9A01_Job_Step(&job); }
+ * ...
+ * GC9A01_Job_Rows(&job, 0, 0, LCD_WIDTH, LCD_HEIGHT, gauge_row, &g, 3000);
+ * Sched_Wake(&tasks[DISPLAY]);
+ * @endcode
+ */
+
+#ifndef _GC9A01_JOB_H_
+#define _GC9A01_JOB_H_
+
+#include "gc9a01_driver.h"
+
+#define GC9A01_JOB_IDLE  0
+#define GC9A01_JOB_INIT  1
+#define GC9A01_JOB_FILL  2
+#define GC9A01_JOB_ROWS  3
+
+typedef struct {
+    UBYTE kind;                 ///< GC9A01_JOB_*
+    UBYTE step;                 ///< Init: next GC9A01_InitStep(), 0xFF when only the last wait is left
+    uint16_t x0, x1;            ///< Columns, x1 exclusive
+    uint16_t x, y;              ///< Next pixel to send
+    uint16_t y1;                ///< End row, exclusive
+    uint16_t rows;              ///< Rows per step
+    uint16_t cols;              ///< Columns per step when rows is 1
+    UWORD color;                ///< Fill colour
+    GC9A01_RowFunc row_fn;      ///< Row producer
+    void *ctx;
+    UDOUBLE ready;              ///< Init: LCD_HAL_Ticks() when the next step may run
+} GC9A01_Job;
+
+void GC9A01_Job_Init(GC9A01_Job *job);
+void GC9A01_Job_Fill(GC9A01_Job *job, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     UWORD color, UDOUBLE budget_us);
+void GC9A01_Job_Rows(GC9A01_Job *job, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                     GC9A01_RowFunc row_fn, void *ctx, UDOUBLE budget_us);
+UBYTE GC9A01_Job_Step(GC9A01_Job *job);
+
+#endif // _GC9A01_JOB_H_
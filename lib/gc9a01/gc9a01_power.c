@@ -0,0 +1,65 @@
+/**
+ * @file gc9a01_power.c
+ * @brief Inactivity-driven power policy for the GC9A01
+ */
+
+#include "gc9a01_power.h"
+
+static GC9A01_PowerPolicy power_policy;
+static UDOUBLE power_last_ms;    ///< Time of the last activity
+static UDOUBLE power_draws;      ///< GC9A01_DrawCount() at the last tick
+
+/**
+ * @brief Start the policy with the panel awake
+ * 
+ * @param policy Thresholds (copied)
+ * @param now_ms Current time in milliseconds (any monotonic clock)
+ */
+void GC9A01_Power_Init(const GC9A01_PowerPolicy *policy, UDOUBLE now_ms)
+{
+    power_policy = *policy;
+    if (power_policy.sleep_ms && power_policy.sleep_ms < GC9A01_POWER_MIN_SLEEP_MS) {
+        power_policy.sleep_ms = GC9A01_POWER_MIN_SLEEP_MS;
+    }
+    GC9A01_SetPartialArea(power_policy.partial_y0, power_policy.partial_y1);
+    power_last_ms = now_ms;
+    power_draws = GC9A01_DrawCount();
+}
+
+/**
+ * @brief Enter the deepest mode the quiet time calls for
+ * 
+ * Call regularly (every 10-100 ms is plenty). Modes only get deeper
+ * here; waking is done by drawing or GC9A01_Power_Activity().
+ */
+void GC9A01_Power_Tick(UDOUBLE now_ms)
+{
+    UDOUBLE draws = GC9A01_DrawCount();
+    
+    if (draws != power_draws) {
+        power_draws = draws;
+        power_last_ms = now_ms;
+        return;
+    }
+    
+    UDOUBLE quiet = now_ms - power_last_ms;
+    UBYTE mode = GC9A01_GetPowerMode();
+    UBYTE want = mode;
+    
+    if (power_policy.idle_ms && quiet >= power_policy.idle_ms) want |= GC9A01_POWER_IDLE;
+    if (power_policy.partial_ms && quiet >= power_policy.partial_ms) want |= GC9A01_POWER_PARTIAL;
+    if (power_policy.sleep_ms && quiet >= power_policy.sleep_ms) want |= GC9A01_POWER_SLEEP;
+    
+    if (want != mode) GC9A01_SetPowerMode(want);
+}
+
+/**
+ * @brief Report activity that does not draw (input, an alarm, ...)
+ * 
+ * Wakes the panel to normal mode and restarts the timers.
+ */
+void GC9A01_Power_Activity(UDOUBLE now_ms)
+{
+    power_last_ms = now_ms;
+    GC9A01_SetPowerMode(GC9A01_POWER_NORMAL);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file gc9a01_power.h
+ * @brief Inactivity-driven power policy for the GC9A01
+ * 
+ * Steps the panel down as it stays unchanged: first idle (8 colours),
+ * then partial (only a band of rows driven), then sleep with the
+ * backlight off. Any drawing call wakes the panel to normal mode on the
+ * spot (see GC9A01_SetPowerMode()); the policy notices it through
+ * GC9A01_DrawCount() and restarts its timers. Non-drawing activity, such
+ * as a button press, is reported with GC9A01_Power_Activity().
+ * 
+ * Usage:
+ * @code
+ * GC9A01_PowerPolicy policy = { 10000, 30000, 120000, 100, 140 };
+ * GC9A01_Power_Init(&policy, millis());
+ * while (1) {
+ *     ...draw when needed...
+ *     GC9A01_Power_Tick(millis());
+ * }
+ * @endcode
+ */
+
+#ifndef _GC9A01_POWER_H_
+#define _GC9A01_POWER_H_
+
+#include "gc9a01_driver.h"
+
+/// Shortest sleep delay: the panel needs 120 ms after sleep out before sleep in
+#define GC9A01_POWER_MIN_SLEEP_MS  120
+
+/**
+ * @brief Inactivity thresholds; 0 disables a stage
+ */
+typedef struct {
+    UDOUBLE idle_ms;             ///< Quiet time before idle (8-colour) mode
+    UDOUBLE partial_ms;          ///< Quiet time before partial mode
+    UDOUBLE sleep_ms;            ///< Quiet time before sleep, backlight off
+    uint16_t partial_y0;         ///< First row kept in partial mode
+    uint16_t partial_y1;         ///< Last row kept in partial mode (exclusive)
+} GC9A01_PowerPolicy;
+
+void GC9A01_Power_Init(const GC9A01_PowerPolicy *policy, UDOUBLE now_ms);
+void GC9A01_Power_Tick(UDOUBLE now_ms);
+void GC9A01_Power_Activity(UDOUBLE now_ms);
+
+#endif // _GC9A01_POWER_H_
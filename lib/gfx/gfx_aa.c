@@ -0,0 +1,446 @@
+/**
+ * @file gfx_aa.c
+ * @brief Anti-aliased primitives rendered one row at a time
+ *
+ * Coverage models (all in GFX_FIX_SHIFT fixed point, 0..GFX_FIX_ONE):
+ * - Wu line: 1 - distance to the line along the minor axis
+ * - Wide line: rectangle, product of (half width + 0.5 - |normal distance|)
+ *   and (half length + 0.5 - |axial distance|); both are linear along a
+ *   row so they are stepped with one add per pixel
+ * - Disc/ring/arc: radial coverage from the centre distance; pixels well
+ *   inside the edges skip the square root. Arcs multiply in the coverage
+ *   of the two boundary half-planes.
+ */
+
+#include "gfx_aa.h"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static int32_t Fix_Floor(int32_t v)
+{
+    return v >> GFX_FIX_SHIFT;  // Arithmetic shift: rounds towards -inf
+}
+
+static int32_t Fix_Ceil(int32_t v)
+{
+    return (v + GFX_FIX_ONE - 1) >> GFX_FIX_SHIFT;
+}
+
+static int32_t Clamp_Cov(int32_t v)
+{
+    if (v <= 0) return 0;
+    if (v >= GFX_FIX_ONE) return GFX_FIX_ONE;
+    return v;
+}
+
+/**
+ * @brief Fixed-point coverage (0..GFX_FIX_ONE) to 8-bit alpha
+ */
+static uint8_t Cov_Alpha(int32_t v)
+{
+    if (v >= GFX_FIX_ONE) return 255;
+    return (uint8_t)((v * 255) >> GFX_FIX_SHIFT);
+}
+
+static int32_t Abs32(int32_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+/**
+ * @brief Intersect [*lo, *hi] with the columns where |a * px + b| < limit
+ *
+ * px is the fixed-point x offset from origin_x. All terms are Q(14+FIX).
+ *
+ * @return 0 if the row has no such columns
+ */
+static uint8_t Row_Band(int32_t a, int64_t b, int64_t limit, int32_t origin_x,
+                        int32_t *lo, int32_t *hi)
+{
+    if (a == 0) return (b < limit && b > -limit);
+
+    int64_t e0 = (-limit - b) / a;
+    int64_t e1 = (limit - b) / a;
+    if (e0 > e1) {
+        int64_t t = e0;
+        e0 = e1;
+        e1 = t;
+    }
+    int32_t c0 = Fix_Floor((int32_t)e0 + origin_x);
+    int32_t c1 = Fix_Ceil((int32_t)e1 + origin_x);
+    if (c0 > *lo) *lo = c0;
+    if (c1 < *hi) *hi = c1;
+    return *lo <= *hi;
+}
+
+static void Set_Bounds(GFX_AAShape *s, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    s->left = Fix_Floor(x0) - 1;
+    s->right = Fix_Ceil(x1) + 1;
+    s->top = Fix_Floor(y0) - 1;
+    s->bottom = Fix_Ceil(y1) + 1;
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+/**
+ * @brief Prepare a line
+ *
+ * @param x0,y0,x1,y1 Endpoints (fixed point)
+ * @param width       Stroke width (fixed point); GFX_FIX_ONE or less uses Wu
+ * @param color       RGB565
+ */
+void GFX_AA_Line(GFX_AAShape *s, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                 int32_t width, uint16_t color)
+{
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    int32_t pad = (width > GFX_FIX_ONE) ? width / 2 : 0;
+
+    s->color = color;
+    Set_Bounds(s, (x0 < x1 ? x0 : x1) - pad, (y0 < y1 ? y0 : y1) - pad,
+               (x0 < x1 ? x1 : x0) + pad, (y0 < y1 ? y1 : y0) + pad);
+
+    if (width <= GFX_FIX_ONE) {
+        s->type = GFX_AA_WU_LINE;
+        s->u.wu.steep = Abs32(dy) > Abs32(dx);
+        // Walk along the major axis in increasing order
+        if ((s->u.wu.steep && dy < 0) || (!s->u.wu.steep && dx < 0)) {
+            int32_t t;
+            t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+            dx = -dx;
+            dy = -dy;
+        }
+        s->u.wu.x0 = x0;
+        s->u.wu.y0 = y0;
+        s->u.wu.x1 = x1;
+        s->u.wu.y1 = y1;
+        if (s->u.wu.steep) {
+            s->u.wu.grad = (int32_t)(((int64_t)dx << 16) / dy);
+        } else {
+            s->u.wu.grad = dx ? (int32_t)(((int64_t)dy << 16) / dx) : 0;
+        }
+        return;
+    }
+
+    uint32_t len = GFX_Isqrt((uint32_t)(dx * dx) + (uint32_t)(dy * dy));
+
+    s->type = GFX_AA_WIDE_LINE;
+    s->u.wide.cx = x0 + dx / 2;
+    s->u.wide.cy = y0 + dy / 2;
+    if (len == 0) {
+        s->u.wide.tx = GFX_TRIG_ONE;
+        s->u.wide.ty = 0;
+    } else {
+        s->u.wide.tx = (dx * GFX_TRIG_ONE) / (int32_t)len;
+        s->u.wide.ty = (dy * GFX_TRIG_ONE) / (int32_t)len;
+    }
+    s->u.wide.half_len = (int32_t)len / 2 + GFX_FIX_HALF;
+    s->u.wide.half_width = width / 2 + GFX_FIX_HALF;
+}
+
+/**
+ * @brief Prepare a ring sector; the other round shapes are special cases
+ *
+ * @param start,end Angles (GFX_ANGLE_360 per turn, clockwise from 12
+ *                  o'clock). Equal angles draw the full ring.
+ */
+void GFX_AA_Arc(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r_out, int32_t r_in,
+                int32_t start, int32_t end, uint16_t color)
+{
+    int32_t sweep = (end - start) & (GFX_ANGLE_360 - 1);
+
+    s->type = GFX_AA_ROUND;
+    s->color = color;
+    s->u.round.cx = cx;
+    s->u.round.cy = cy;
+    s->u.round.r_out = r_out;
+    s->u.round.r_in = (r_in > 0) ? r_in : 0;
+    s->u.round.arc = (sweep != 0);
+    s->u.round.wide_arc = (sweep > GFX_ANGLE_180);
+    // Direction of angle a is (sin a, -cos a) with y pointing down
+    s->u.round.u0x = GFX_Sin(start);
+    s->u.round.u0y = -GFX_Cos(start);
+    s->u.round.u1x = GFX_Sin(end);
+    s->u.round.u1y = -GFX_Cos(end);
+    Set_Bounds(s, cx - r_out, cy - r_out, cx + r_out, cy + r_out);
+}
+
+/**
+ * @brief Prepare a filled circle of radius r
+ */
+void GFX_AA_Circle(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r, uint16_t color)
+{
+    GFX_AA_Arc(s, cx, cy, r, 0, 0, 0, color);
+}
+
+/**
+ * @brief Prepare a ring (circle outline) between r_in and r_out
+ */
+void GFX_AA_Ring(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r_out, int32_t r_in,
+                 uint16_t color)
+{
+    GFX_AA_Arc(s, cx, cy, r_out, r_in, 0, 0, color);
+}
+
+// ============================================================================
+// RASTERISATION
+// ============================================================================
+
+/**
+ * @brief Coverage of major-axis position v by the segment [v0, v1]
+ */
+static int32_t Wu_EndCov(int32_t v, int32_t v0, int32_t v1)
+{
+    int32_t a = Clamp_Cov(v - v0 + GFX_FIX_HALF);
+    int32_t b = Clamp_Cov(v1 + GFX_FIX_HALF - v);
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Narrow [*lo, *hi] to the columns a Wu line can touch on row y
+ */
+static uint8_t Span_Wu(const GFX_AAShape *s, int32_t y, int32_t *lo, int32_t *hi)
+{
+    int32_t Y = GFX_FIX(y);
+    int32_t c0, c1;
+
+    if (s->u.wu.steep) {
+        if (Wu_EndCov(Y, s->u.wu.y0, s->u.wu.y1) == 0) return 0;
+        int32_t xf = s->u.wu.x0 + (int32_t)(((int64_t)(Y - s->u.wu.y0) * s->u.wu.grad) >> 16);
+        c0 = Fix_Floor(xf);
+        c1 = c0 + 1;
+    } else {
+        // Columns whose line height is within 1px of this row
+        c0 = Fix_Floor(s->u.wu.x0 - GFX_FIX_HALF);
+        c1 = Fix_Ceil(s->u.wu.x1 + GFX_FIX_HALF);
+        if (s->u.wu.grad == 0) {
+            if (Abs32(s->u.wu.y0 - Y) >= GFX_FIX_ONE) return 0;
+        } else {
+            int64_t e0 = s->u.wu.x0 + ((int64_t)(Y - GFX_FIX_ONE - s->u.wu.y0) << 16) / s->u.wu.grad;
+            int64_t e1 = s->u.wu.x0 + ((int64_t)(Y + GFX_FIX_ONE - s->u.wu.y0) << 16) / s->u.wu.grad;
+            if (e0 > e1) {
+                int64_t t = e0;
+                e0 = e1;
+                e1 = t;
+            }
+            if (Fix_Floor((int32_t)e0) > c0) c0 = Fix_Floor((int32_t)e0);
+            if (Fix_Ceil((int32_t)e1) < c1) c1 = Fix_Ceil((int32_t)e1);
+        }
+    }
+    if (c0 > *lo) *lo = c0;
+    if (c1 < *hi) *hi = c1;
+    return *lo <= *hi;
+}
+
+static void Row_Wu(const GFX_AAShape *s, int32_t y, int32_t lo, int32_t hi,
+                   uint16_t *row, int16_t x0, GFX_PixelOrder order)
+{
+    int32_t Y = GFX_FIX(y);
+
+    if (!Span_Wu(s, y, &lo, &hi)) return;
+
+    if (s->u.wu.steep) {
+        // Butt ends: fade the first and last half pixel along the line
+        int32_t end = Wu_EndCov(Y, s->u.wu.y0, s->u.wu.y1);
+        int32_t xf = s->u.wu.x0 + (int32_t)(((int64_t)(Y - s->u.wu.y0) * s->u.wu.grad) >> 16);
+        for (int32_t x = lo; x <= hi; x++) {
+            int32_t cov = (Clamp_Cov(GFX_FIX_ONE - Abs32(GFX_FIX(x) - xf)) * end) >> GFX_FIX_SHIFT;
+            if (cov > 0) GFX_BlendPixel(&row[x - x0], s->color, Cov_Alpha(cov), order);
+        }
+        return;
+    }
+
+    int64_t yq = ((int64_t)s->u.wu.y0 << 16) + (int64_t)(GFX_FIX(lo) - s->u.wu.x0) * s->u.wu.grad;
+    int32_t step = s->u.wu.grad * GFX_FIX_ONE;
+    for (int32_t x = lo; x <= hi; x++, yq += step) {
+        int32_t cov = GFX_FIX_ONE - Abs32((int32_t)(yq >> 16) - Y);
+        if (cov <= 0) continue;
+        if (GFX_FIX(x) < s->u.wu.x0 + GFX_FIX_HALF || GFX_FIX(x) > s->u.wu.x1 - GFX_FIX_HALF) {
+            cov = (cov * Wu_EndCov(GFX_FIX(x), s->u.wu.x0, s->u.wu.x1)) >> GFX_FIX_SHIFT;
+        }
+        if (cov > 0) GFX_BlendPixel(&row[x - x0], s->color, Cov_Alpha(cov), order);
+    }
+}
+
+static uint8_t Span_Wide(const GFX_AAShape *s, int32_t y, int32_t *lo, int32_t *hi)
+{
+    int32_t tx = s->u.wide.tx;
+    int32_t ty = s->u.wide.ty;
+    int32_t py = GFX_FIX(y) - s->u.wide.cy;
+    int64_t hw = (int64_t)s->u.wide.half_width << 14;
+    int64_t hl = (int64_t)s->u.wide.half_len << 14;
+
+    // Normal distance = -ty * px + tx * py, axial = tx * px + ty * py (Q20)
+    return Row_Band(-ty, (int64_t)tx * py, hw, s->u.wide.cx, lo, hi) &&
+           Row_Band(tx, (int64_t)ty * py, hl, s->u.wide.cx, lo, hi);
+}
+
+static void Row_Wide(const GFX_AAShape *s, int32_t y, int32_t lo, int32_t hi,
+                     uint16_t *row, int16_t x0, GFX_PixelOrder order)
+{
+    int32_t tx = s->u.wide.tx;
+    int32_t ty = s->u.wide.ty;
+    int32_t py = GFX_FIX(y) - s->u.wide.cy;
+
+    if (!Span_Wide(s, y, &lo, &hi)) return;
+
+    int32_t px = GFX_FIX(lo) - s->u.wide.cx;
+    int32_t pn = -ty * px + tx * py;
+    int32_t pt = tx * px + ty * py;
+    int32_t dn = -ty * GFX_FIX_ONE;
+    int32_t dt = tx * GFX_FIX_ONE;
+
+    for (int32_t x = lo; x <= hi; x++, pn += dn, pt += dt) {
+        int32_t cn = Clamp_Cov(s->u.wide.half_width - Abs32(pn >> 14));
+        int32_t ct = Clamp_Cov(s->u.wide.half_len - Abs32(pt >> 14));
+        int32_t cov = (cn * ct) >> GFX_FIX_SHIFT;
+        if (cov > 0) GFX_BlendPixel(&row[x - x0], s->color, Cov_Alpha(cov), order);
+    }
+}
+
+/**
+ * @brief Outer circle span of row y (arc limits are not applied)
+ */
+static uint8_t Span_Round(const GFX_AAShape *s, int32_t y, int32_t *lo, int32_t *hi)
+{
+    int32_t dy = GFX_FIX(y) - s->u.round.cy;
+    int32_t reach = s->u.round.r_out + GFX_FIX_HALF;
+
+    if (Abs32(dy) >= reach) return 0;
+
+    int32_t hs = (int32_t)GFX_Isqrt((uint32_t)(reach * reach - dy * dy));
+    if (Fix_Floor(s->u.round.cx - hs) > *lo) *lo = Fix_Floor(s->u.round.cx - hs);
+    if (Fix_Ceil(s->u.round.cx + hs) < *hi) *hi = Fix_Ceil(s->u.round.cx + hs);
+    return *lo <= *hi;
+}
+
+static void Row_Round(const GFX_AAShape *s, int32_t y, int32_t lo, int32_t hi,
+                      uint16_t *row, int16_t x0, GFX_PixelOrder order)
+{
+    int32_t dy = GFX_FIX(y) - s->u.round.cy;
+    int32_t r_out = s->u.round.r_out;
+    int32_t r_in = s->u.round.r_in;
+    int32_t reach = r_out + GFX_FIX_HALF;
+
+    if (!Span_Round(s, y, &lo, &hi)) return;
+
+    // Squared distances between which radial coverage is complete
+    uint32_t full_out = (r_out > GFX_FIX_HALF) ? (uint32_t)((r_out - GFX_FIX_HALF) * (r_out - GFX_FIX_HALF)) : 0;
+    uint32_t full_in = r_in ? (uint32_t)((r_in + GFX_FIX_HALF) * (r_in + GFX_FIX_HALF)) : 0;
+    uint32_t dy2 = (uint32_t)(dy * dy);
+
+    // Columns inside the hole of a ring have no coverage; jump over them
+    int32_t hole_lo = 1, hole_hi = 0;
+    if (r_in > GFX_FIX_HALF && Abs32(dy) < r_in - GFX_FIX_HALF) {
+        int32_t edge = r_in - GFX_FIX_HALF;
+        int32_t hh = (int32_t)GFX_Isqrt((uint32_t)(edge * edge) - dy2);
+        hole_lo = Fix_Ceil(s->u.round.cx - hh) + 1;
+        hole_hi = Fix_Floor(s->u.round.cx + hh) - 1;
+    }
+
+    for (int32_t x = lo; x <= hi; x++) {
+        if (x >= hole_lo && x <= hole_hi) {
+            x = hole_hi;
+            continue;
+        }
+        int32_t dx = GFX_FIX(x) - s->u.round.cx;
+        uint32_t d2 = (uint32_t)(dx * dx) + dy2;
+        int32_t cov;
+
+        if (d2 <= full_out && d2 >= full_in) {
+            cov = GFX_FIX_ONE;
+        } else {
+            int32_t d = (int32_t)GFX_Isqrt(d2);
+            cov = Clamp_Cov(reach - d);
+            if (r_in) {
+                int32_t ci = Clamp_Cov(d - r_in + GFX_FIX_HALF);
+                if (ci < cov) cov = ci;
+            }
+        }
+        if (cov == 0) continue;
+
+        if (s->u.round.arc) {
+            // Signed distances to the start and end rays (Q20 -> fixed)
+            int32_t c0 = Clamp_Cov(((s->u.round.u0x * dy - s->u.round.u0y * dx) >> 14) + GFX_FIX_HALF);
+            int32_t c1 = Clamp_Cov(((dx * s->u.round.u1y - dy * s->u.round.u1x) >> 14) + GFX_FIX_HALF);
+            int32_t ca = s->u.round.wide_arc ? (c0 > c1 ? c0 : c1) : (c0 < c1 ? c0 : c1);
+            cov = (cov * ca) >> GFX_FIX_SHIFT;
+            if (cov == 0) continue;
+        }
+        GFX_BlendPixel(&row[x - x0], s->color, Cov_Alpha(cov), order);
+    }
+}
+
+/**
+ * @brief Columns of row y that can have coverage
+ *
+ * Conservative (a pixel or so of slack, arcs report the whole circle),
+ * for deciding which parts of a row need repainting.
+ *
+ * @param x0,x1 Receive the first and last column (inclusive)
+ * @return 0 if the row is untouched
+ */
+uint8_t GFX_AA_RowSpan(const GFX_AAShape *s, int16_t y, int16_t *x0, int16_t *x1)
+{
+    int32_t lo = s->left;
+    int32_t hi = s->right;
+    uint8_t hit = 0;
+
+    if (y < s->top || y > s->bottom) return 0;
+
+    switch (s->type) {
+    case GFX_AA_WU_LINE:
+        hit = Span_Wu(s, y, &lo, &hi);
+        break;
+    case GFX_AA_WIDE_LINE:
+        hit = Span_Wide(s, y, &lo, &hi);
+        break;
+    case GFX_AA_ROUND:
+        hit = Span_Round(s, y, &lo, &hi);
+        break;
+    }
+    if (!hit) return 0;
+    *x0 = (int16_t)lo;
+    *x1 = (int16_t)hi;
+    return 1;
+}
+
+/**
+ * @brief Blend one row of a shape into an RGB565 row
+ *
+ * @param s     Prepared shape
+ * @param y     Row to render
+ * @param x0    Column of row[0]
+ * @param width Number of pixels in row
+ * @param row   Destination pixels, blended in place
+ * @param order Byte order of row
+ */
+void GFX_AA_RenderRow(const GFX_AAShape *s, int16_t y, int16_t x0, uint16_t width,
+                      uint16_t *row, GFX_PixelOrder order)
+{
+    int32_t lo = s->left;
+    int32_t hi = s->right;
+
+    if (y < s->top || y > s->bottom || width == 0) return;
+    if (lo < x0) lo = x0;
+    if (hi > x0 + width - 1) hi = x0 + width - 1;
+    if (lo > hi) return;
+
+    switch (s->type) {
+    case GFX_AA_WU_LINE:
+        Row_Wu(s, y, lo, hi, row, x0, order);
+        break;
+    case GFX_AA_WIDE_LINE:
+        Row_Wide(s, y, lo, hi, row, x0, order);
+        break;
+    case GFX_AA_ROUND:
+        Row_Round(s, y, lo, hi, row, x0, order);
+        break;
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file gfx_aa.h
+ * @brief Anti-aliased primitives rendered one row at a time
+ *
+ * Shapes are set up once (GFX_AA_Line(), GFX_AA_Circle(), ...) and then
+ * rasterised row by row with GFX_AA_RenderRow(), which blends coverage
+ * into an RGB565 row. That fits both targets without a frame buffer:
+ * - CH32v003: call it from a GC9A01_RowFunc for GC9A01_DrawRows()
+ * - Pi/Pico: call it for each canvas row (see GUI_AA.c)
+ *
+ * All coordinates are fixed point with GFX_FIX_SHIFT fractional bits,
+ * integer values being pixel centres. Everything is integer maths.
+ *
+ * Limits: radii and line lengths up to ~500 pixels.
+ */
+
+#ifndef _GFX_AA_H_
+#define _GFX_AA_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+#include "gfx_trig.h"
+
+#define GFX_FIX_SHIFT  6                         ///< 1/64 pixel precision
+#define GFX_FIX_ONE    (1 << GFX_FIX_SHIFT)
+#define GFX_FIX_HALF   (GFX_FIX_ONE / 2)
+#define GFX_FIX(v)     ((int32_t)(v) * GFX_FIX_ONE)  ///< Whole pixels to fixed point
+
+/**
+ * @brief Primitive kind
+ */
+typedef enum {
+    GFX_AA_WU_LINE = 0,   ///< 1 pixel wide line (Wu coverage)
+    GFX_AA_WIDE_LINE,     ///< Line of arbitrary width, butt ends
+    GFX_AA_ROUND,         ///< Disc, ring or arc sector
+} GFX_AAType;
+
+/**
+ * @brief Prepared primitive; fill with one of the setup functions
+ */
+typedef struct {
+    GFX_AAType type;
+    uint16_t color;
+    int16_t top, bottom;     ///< Rows that can have coverage (inclusive)
+    int16_t left, right;     ///< Columns that can have coverage (inclusive)
+    union {
+        struct {
+            int32_t x0, y0, x1, y1;  ///< Endpoints, x0 <= x1 (x-major) or y0 <= y1
+            int32_t grad;            ///< Minor per major axis step, Q16
+            uint8_t steep;           ///< 1 = y-major
+        } wu;
+        struct {
+            int32_t cx, cy;          ///< Centre
+            int32_t tx, ty;          ///< Unit direction, Q14
+            int32_t half_len;        ///< Half length + 0.5 px
+            int32_t half_width;      ///< Half width + 0.5 px
+        } wide;
+        struct {
+            int32_t cx, cy;
+            int32_t r_out, r_in;     ///< Radii; r_in = 0 for a disc
+            int32_t u0x, u0y;        ///< Start direction (Q14), arcs only
+            int32_t u1x, u1y;        ///< End direction (Q14), arcs only
+            uint8_t arc;             ///< 0 = full circle
+            uint8_t wide_arc;        ///< Sweep over 180 degrees
+        } round;
+    } u;
+} GFX_AAShape;
+
+// Setup
+void GFX_AA_Line(GFX_AAShape *s, int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                 int32_t width, uint16_t color);
+void GFX_AA_Circle(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r, uint16_t color);
+void GFX_AA_Ring(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r_out, int32_t r_in,
+                 uint16_t color);
+void GFX_AA_Arc(GFX_AAShape *s, int32_t cx, int32_t cy, int32_t r_out, int32_t r_in,
+                int32_t start, int32_t end, uint16_t color);
+
+// Rasterisation
+void GFX_AA_RenderRow(const GFX_AAShape *s, int16_t y, int16_t x0, uint16_t width,
+                      uint16_t *row, GFX_PixelOrder order);
+uint8_t GFX_AA_RowSpan(const GFX_AAShape *s, int16_t y, int16_t *x0, int16_t *x1);
+
+#endif // _GFX_AA_H_
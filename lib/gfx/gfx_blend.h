@@ -0,0 +1,69 @@
+/**
+ * @file gfx_blend.h
+ * @brief RGB565 blend kernels
+ *
+ * Coverage/alpha blending without unpacking to 8-bit channels: the pixel
+ * is spread over 32 bits as 0b00000GGGGGG00000RRRRR000000BBBBB so all
+ * three channels are blended with one multiply. Alpha is reduced to
+ * 5 bits (0..32), which is what the 5-bit red/blue channels can show.
+ *
+ * Header-only so the kernels inline into the row loops on the CH32v003.
+ */
+
+#ifndef _GFX_BLEND_H_
+#define _GFX_BLEND_H_
+
+#include <stdint.h>
+
+/// Channel mask for the spread RGB565 layout
+#define GFX_BLEND_MASK  0x07E0F81FUL
+
+/**
+ * @brief Pixel byte order of a destination buffer
+ */
+typedef enum {
+    GFX_ORDER_NATIVE = 0,   ///< CPU order (line buffers, GC9A01_DrawRows)
+    GFX_ORDER_SWAPPED,      ///< MSB first in memory (Waveshare Paint canvases)
+} GFX_PixelOrder;
+
+/**
+ * @brief Swap the two bytes of an RGB565 value
+ */
+static inline uint16_t GFX_Swap565(uint16_t c)
+{
+    return (uint16_t)((c << 8) | (c >> 8));
+}
+
+/**
+ * @brief Blend src over dst with 8-bit coverage
+ *
+ * @param dst   Background pixel (RGB565)
+ * @param src   Foreground pixel (RGB565)
+ * @param alpha Coverage 0 (dst) .. 255 (src)
+ * @return Blended RGB565 pixel
+ */
+static inline uint16_t GFX_Blend565(uint16_t dst, uint16_t src, uint8_t alpha)
+{
+    uint32_t a = ((uint32_t)alpha + 4) >> 3;  // 0..32
+    uint32_t d = (dst | ((uint32_t)dst << 16)) & GFX_BLEND_MASK;
+    uint32_t s = (src | ((uint32_t)src << 16)) & GFX_BLEND_MASK;
+
+    d = (d + (((s - d) * a) >> 5)) & GFX_BLEND_MASK;
+    return (uint16_t)(d | (d >> 16));
+}
+
+/**
+ * @brief Blend a colour into a pixel stored in the given byte order
+ */
+static inline void GFX_BlendPixel(uint16_t *px, uint16_t color, uint8_t alpha, GFX_PixelOrder order)
+{
+    if (alpha == 0) return;
+    if (order == GFX_ORDER_SWAPPED) {
+        uint16_t d = GFX_Swap565(*px);
+        *px = GFX_Swap565(alpha == 255 ? color : GFX_Blend565(d, color, alpha));
+    } else {
+        *px = (alpha == 255) ? color : GFX_Blend565(*px, color, alpha);
+    }
+}
+
+#endif // _GFX_BLEND_H_
@@ -0,0 +1,346 @@
+/**
+ * @file gfx_blit.c
+ * @brief Scaled and rotated image blits (SSE2 / scalar bilinear)
+ *
+ * Source coordinates are 16.16 with pixel i covering [i, i + 1). For a
+ * destination row the visible columns are found exactly up front:
+ * u(i) = u0 + i * du must stay in [0, width << 16), likewise v, and the
+ * column must fall inside the mask circle. The inner loops then need
+ * no bounds checks.
+ *
+ * Bilinear filtering samples at the pixel centres (u - 0.5), clamps at
+ * the image edges and blends each channel as a + (((b - a) * f) >> 8)
+ * with 8-bit weights. The vector paths gather 8 samples with scalar
+ * loads and do the blending in 16-bit lanes with the same expression.
+ */
+
+#include "gfx_blit.h"
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+/**
+ * @brief Prepare a blit of a source image (identity transform at 0, 0)
+ *
+ * @param stride Source pixels per row (>= width)
+ * @param order  Byte order of the source pixels
+ */
+void GFX_Blit_Init(GFX_Blit *b, const uint16_t *pixels, uint16_t width, uint16_t height,
+                   uint16_t stride, GFX_PixelOrder order, GFX_Filter filter)
+{
+    b->pixels = pixels;
+    b->width = width;
+    b->height = height;
+    b->stride = stride;
+    b->order = order;
+    b->filter = filter;
+    b->mask_r = 0;
+    GFX_Blit_Transform(b, GFX_FIX(width) / 2 - GFX_FIX_HALF, GFX_FIX(height) / 2 - GFX_FIX_HALF,
+                       GFX_BLIT_ONE, GFX_BLIT_ONE, 0);
+}
+
+/**
+ * @brief Place the image centre at (cx, cy), scaled, then rotated
+ *
+ * @param cx, cy   Destination of the image centre (GFX_FIX units,
+ *                 integers are pixel centres)
+ * @param scale_x  Horizontal scale, 16.16 (GFX_BLIT_ONE = 1:1, negative mirrors)
+ * @param scale_y  Vertical scale, 16.16
+ * @param angle    Clockwise rotation (GFX_ANGLE_360 per turn)
+ */
+void GFX_Blit_Transform(GFX_Blit *b, int32_t cx, int32_t cy, int32_t scale_x, int32_t scale_y,
+                        int32_t angle)
+{
+    int64_t c = GFX_Cos(angle), s = GFX_Sin(angle);
+
+    if (scale_x == 0) scale_x = 1;
+    if (scale_y == 0) scale_y = 1;
+
+    // Inverse of rotate(scale(p)): Q14 trig / Q16 scale -> Q16 steps
+    b->ux = (int32_t)((c << 18) / scale_x);
+    b->vx = (int32_t)((s << 18) / scale_x);
+    b->uy = (int32_t)((-s << 18) / scale_y);
+    b->vy = (int32_t)((c << 18) / scale_y);
+
+    // Destination pixel (0, 0) lies (-cx, -cy) away from the image centre
+    b->ox = (int32_t)(((int64_t)b->width << 15) -
+                      (((int64_t)cx * b->ux + (int64_t)cy * b->vx) >> GFX_FIX_SHIFT));
+    b->oy = (int32_t)(((int64_t)b->height << 15) -
+                      (((int64_t)cx * b->uy + (int64_t)cy * b->vy) >> GFX_FIX_SHIFT));
+}
+
+/**
+ * @brief Scale the image into a w x h box at (x, y), keeping its aspect
+ *
+ * @param cover 1 = fill the box (crop the overflow), 0 = fit inside it
+ */
+void GFX_Blit_Fit(GFX_Blit *b, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t cover,
+                  int32_t angle)
+{
+    int32_t sx = (int32_t)(((int64_t)w << 16) / b->width);
+    int32_t sy = (int32_t)(((int64_t)h << 16) / b->height);
+    int32_t scale = cover ? (sx > sy ? sx : sy) : (sx < sy ? sx : sy);
+
+    GFX_Blit_Transform(b, GFX_FIX(x) + (GFX_FIX(w) - GFX_FIX_ONE) / 2,
+                       GFX_FIX(y) + (GFX_FIX(h) - GFX_FIX_ONE) / 2, scale, scale, angle);
+}
+
+/**
+ * @brief Only draw inside a circle, e.g. the visible area of a round panel
+ *
+ * @param cx, cy Centre in pixel edges (120, 120 for a 240x240 panel)
+ * @param r      Radius; 0 removes the mask
+ */
+void GFX_Blit_SetMask(GFX_Blit *b, int16_t cx, int16_t cy, int16_t r)
+{
+    b->mask_cx = 2 * cx;
+    b->mask_cy = 2 * cy;
+    b->mask_r = 2 * r;
+}
+
+// ============================================================================
+// CLIPPING
+// ============================================================================
+
+static inline int64_t Floor_Div(int64_t a, int64_t d)
+{
+    int64_t q = a / d;
+    return (a % d != 0 && a < 0) ? q - 1 : q;
+}
+
+static inline int64_t Ceil_Div(int64_t a, int64_t d)
+{
+    int64_t q = a / d;
+    return (a % d != 0 && a > 0) ? q + 1 : q;
+}
+
+/**
+ * @brief Narrow [lo, hi] to the i with 0 <= p0 + i * d < limit
+ */
+static void Clip_Axis(int64_t p0, int32_t d, int64_t limit, int32_t *lo, int32_t *hi)
+{
+    int64_t a, z;
+
+    if (d == 0) {
+        if (p0 < 0 || p0 >= limit) *hi = *lo - 1;
+        return;
+    }
+    if (d > 0) {
+        a = Ceil_Div(-p0, d);
+        z = Floor_Div(limit - 1 - p0, d);
+    } else {
+        a = Ceil_Div(p0 - (limit - 1), -(int64_t)d);
+        z = Floor_Div(p0, -(int64_t)d);
+    }
+    if (a > *lo) *lo = (int32_t)(a > *hi + 1 ? *hi + 1 : a);
+    if (z < *hi) *hi = (int32_t)(z < *lo - 1 ? *lo - 1 : z);
+}
+
+/**
+ * @brief Visible row indices [lo, hi]; returns 0 when nothing is visible
+ */
+static uint8_t Row_Clip(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                        int32_t *lo, int32_t *hi, int32_t *u, int32_t *v)
+{
+    *lo = 0;
+    *hi = (int32_t)width - 1;
+
+    if (b->mask_r) {
+        int32_t dy = 2 * y + 1 - b->mask_cy;
+        int32_t r2 = b->mask_r * b->mask_r;
+        if (dy * dy > r2) return 0;
+        int32_t s = (int32_t)GFX_Isqrt((uint32_t)(r2 - dy * dy));
+        // |2x + 1 - cx| <= s
+        int32_t mlo = (int32_t)Ceil_Div(b->mask_cx - 1 - s, 2) - x0;
+        int32_t mhi = (int32_t)Floor_Div(b->mask_cx - 1 + s, 2) - x0;
+        if (mlo > *lo) *lo = mlo;
+        if (mhi < *hi) *hi = mhi;
+    }
+
+    int64_t u0 = b->ox + (int64_t)x0 * b->ux + (int64_t)y * b->vx;
+    int64_t v0 = b->oy + (int64_t)x0 * b->uy + (int64_t)y * b->vy;
+    Clip_Axis(u0, b->ux, (int64_t)b->width << 16, lo, hi);
+    Clip_Axis(v0, b->uy, (int64_t)b->height << 16, lo, hi);
+    if (*lo > *hi) return 0;
+
+    *u = (int32_t)(u0 + (int64_t)*lo * b->ux);
+    *v = (int32_t)(v0 + (int64_t)*lo * b->uy);
+    return 1;
+}
+
+// ============================================================================
+// SAMPLING
+// ============================================================================
+
+static inline uint16_t Load(const GFX_Blit *b, int32_t x, int32_t y)
+{
+    uint16_t c = b->pixels[y * b->stride + x];
+    return (b->order == GFX_ORDER_SWAPPED) ? GFX_Swap565(c) : c;
+}
+
+/**
+ * @brief The four neighbours of (u, v) in CPU order, and the weights
+ */
+static inline void Gather(const GFX_Blit *b, int32_t u, int32_t v, uint16_t q[4],
+                          uint16_t *fx, uint16_t *fy)
+{
+    int32_t su = u - 0x8000, sv = v - 0x8000;
+    int32_t x0 = su >> 16, y0 = sv >> 16;
+    int32_t x1 = x0 + 1, y1 = y0 + 1;
+
+    *fx = (uint16_t)((su >> 8) & 0xFF);
+    *fy = (uint16_t)((sv >> 8) & 0xFF);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > b->width - 1) x1 = b->width - 1;
+    if (y1 > b->height - 1) y1 = b->height - 1;
+    q[0] = Load(b, x0, y0);
+    q[1] = Load(b, x1, y0);
+    q[2] = Load(b, x0, y1);
+    q[3] = Load(b, x1, y1);
+}
+
+static inline int32_t Lerp(int32_t a, int32_t b, int32_t f)
+{
+    return a + (((b - a) * f) >> 8);
+}
+
+static inline uint16_t Bilinear(const uint16_t q[4], int32_t fx, int32_t fy)
+{
+    int32_t r = Lerp(Lerp(q[0] >> 11, q[1] >> 11, fx), Lerp(q[2] >> 11, q[3] >> 11, fx), fy);
+    int32_t g = Lerp(Lerp((q[0] >> 5) & 0x3F, (q[1] >> 5) & 0x3F, fx),
+                     Lerp((q[2] >> 5) & 0x3F, (q[3] >> 5) & 0x3F, fx), fy);
+    int32_t bl = Lerp(Lerp(q[0] & 0x1F, q[1] & 0x1F, fx), Lerp(q[2] & 0x1F, q[3] & 0x1F, fx), fy);
+    return (uint16_t)((r << 11) | (g << 5) | bl);
+}
+
+static inline void Store(uint16_t *p, uint16_t c, GFX_PixelOrder order)
+{
+    *p = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(c) : c;
+}
+
+// ============================================================================
+// VECTOR
+// ============================================================================
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define BLIT_VECTOR 1
+
+static inline __m128i V_Lerp(__m128i a, __m128i b, __m128i f)
+{
+    return _mm_add_epi16(a, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(b, a), f), 8));
+}
+
+static inline __m128i V_Channel(__m128i c, int shift, uint16_t mask)
+{
+    return _mm_and_si128(_mm_srl_epi16(c, _mm_cvtsi32_si128(shift)), _mm_set1_epi16((short)mask));
+}
+
+static void V_Bilinear8(uint16_t *dst, const uint16_t q[4][8], const uint16_t *fx,
+                        const uint16_t *fy, int swap)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)q[0]), b = _mm_loadu_si128((const __m128i *)q[1]);
+    __m128i c = _mm_loadu_si128((const __m128i *)q[2]), d = _mm_loadu_si128((const __m128i *)q[3]);
+    __m128i wx = _mm_loadu_si128((const __m128i *)fx);
+    __m128i wy = _mm_loadu_si128((const __m128i *)fy);
+    static const int shift[3] = {11, 5, 0};
+    static const uint16_t mask[3] = {0x1F, 0x3F, 0x1F};
+    __m128i out = _mm_setzero_si128();
+
+    for (int k = 0; k < 3; k++) {
+        __m128i top = V_Lerp(V_Channel(a, shift[k], mask[k]), V_Channel(b, shift[k], mask[k]), wx);
+        __m128i bot = V_Lerp(V_Channel(c, shift[k], mask[k]), V_Channel(d, shift[k], mask[k]), wx);
+        out = _mm_or_si128(out, _mm_sll_epi16(V_Lerp(top, bot, wy), _mm_cvtsi32_si128(shift[k])));
+    }
+    if (swap) out = _mm_or_si128(_mm_slli_epi16(out, 8), _mm_srli_epi16(out, 8));
+    _mm_storeu_si128((__m128i *)dst, out);
+}
+
+#else
+#define BLIT_VECTOR 0
+#endif
+
+// ============================================================================
+// ROWS
+// ============================================================================
+
+static void Row_Nearest(const GFX_Blit *b, int32_t u, int32_t v, uint16_t *dst, int32_t n,
+                        GFX_PixelOrder order)
+{
+    uint8_t swap = (b->order != order);
+
+    if (b->uy == 0) {
+        // Axis-aligned: one source row for the whole span
+        const uint16_t *line = b->pixels + (v >> 16) * b->stride;
+        for (int32_t i = 0; i < n; i++, u += b->ux) {
+            uint16_t c = line[u >> 16];
+            dst[i] = swap ? GFX_Swap565(c) : c;
+        }
+        return;
+    }
+    for (int32_t i = 0; i < n; i++, u += b->ux, v += b->uy) {
+        uint16_t c = b->pixels[(v >> 16) * b->stride + (u >> 16)];
+        dst[i] = swap ? GFX_Swap565(c) : c;
+    }
+}
+
+static void Row_Bilinear(const GFX_Blit *b, int32_t u, int32_t v, uint16_t *dst, int32_t n,
+                         GFX_PixelOrder order, uint8_t vector)
+{
+    int32_t i = 0;
+
+#if BLIT_VECTOR
+    if (vector) {
+        uint16_t q[4][8], fx[8], fy[8];
+        for (; i + 8 <= n; i += 8) {
+            for (int k = 0; k < 8; k++, u += b->ux, v += b->uy) {
+                uint16_t quad[4];
+                Gather(b, u, v, quad, &fx[k], &fy[k]);
+                q[0][k] = quad[0];
+                q[1][k] = quad[1];
+                q[2][k] = quad[2];
+                q[3][k] = quad[3];
+            }
+            V_Bilinear8(dst + i, (const uint16_t (*)[8])q, fx, fy, order == GFX_ORDER_SWAPPED);
+        }
+    }
+#endif
+    for (; i < n; i++, u += b->ux, v += b->uy) {
+        uint16_t q[4], fx, fy;
+        Gather(b, u, v, q, &fx, &fy);
+        Store(&dst[i], Bilinear(q, fx, fy), order);
+    }
+}
+
+static void Blit_Row(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                     uint16_t *row, GFX_PixelOrder order, uint8_t vector)
+{
+    int32_t lo, hi, u, v;
+
+    if (width == 0 || !Row_Clip(b, y, x0, width, &lo, &hi, &u, &v)) return;
+    if (b->filter == GFX_FILTER_BILINEAR) {
+        Row_Bilinear(b, u, v, row + lo, hi - lo + 1, order, vector);
+    } else {
+        Row_Nearest(b, u, v, row + lo, hi - lo + 1, order);
+    }
+}
+
+/**
+ * @brief Draw the part of the image that falls on columns [x0, x0 + width) of row y
+ *
+ * @param row   Destination pixels; only covered pixels are written
+ * @param order Byte order of row
+ */
+void GFX_Blit_RenderRow(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                        uint16_t *row, GFX_PixelOrder order)
+{
+    Blit_Row(b, y, x0, width, row, order, 1);
+}
+
+void GFX_Blit_RenderRow_Scalar(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                               uint16_t *row, GFX_PixelOrder order)
+{
+    Blit_Row(b, y, x0, width, row, order, 0);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file gfx_blit.h
+ * @brief Scaled and rotated image blits, rendered one row at a time
+ *
+ * An RGB565 source image is mapped into the destination by inverse
+ * transform: each destination pixel centre is stepped through source
+ * space in 16.16 fixed point (two adds per pixel), so any scale and any
+ * angle cost the same. Each row is first clipped exactly to the source
+ * rectangle and to an optional circular mask (the visible area of a
+ * round panel), so hidden pixels are never sampled.
+ *
+ * Like GFX_AA_RenderRow(), GFX_Blit_RenderRow() writes into any row:
+ * a Paint canvas row (GUI_Blit.c) or a GC9A01_RowFunc line buffer.
+ * Pixels outside the image or the mask are left untouched.
+ *
+ * Filters:
+ * - nearest: one load per pixel
+ * - bilinear: 8-bit weights, SSE2 for the blending when the compiler
+ *   targets it; GFX_Blit_RenderRow_Scalar() gives identical results
+ *   without
+ */
+
+#ifndef _GFX_BLIT_H_
+#define _GFX_BLIT_H_
+
+#include <stdint.h>
+#include "gfx_aa.h"
+
+#if defined(__SSE2__)
+#define GFX_BLIT_SIMD  "sse2"
+#else
+#define GFX_BLIT_SIMD  "none"
+#endif
+
+#define GFX_BLIT_ONE  65536      ///< Scale 1.0 (16.16)
+
+typedef enum {
+    GFX_FILTER_NEAREST = 0,
+    GFX_FILTER_BILINEAR,
+} GFX_Filter;
+
+typedef struct {
+    const uint16_t *pixels;     ///< Source RGB565
+    uint16_t width, height;
+    uint16_t stride;            ///< Source pixels per row
+    GFX_PixelOrder order;       ///< Source byte order
+    GFX_Filter filter;
+    int32_t ux, uy;             ///< Source step per destination column (16.16)
+    int32_t vx, vy;             ///< Source step per destination row (16.16)
+    int32_t ox, oy;             ///< Source position of destination pixel (0, 0)
+    int32_t mask_cx, mask_cy;   ///< Mask centre, doubled (half-pixel units)
+    int32_t mask_r;             ///< Mask radius, doubled; 0 = no mask
+} GFX_Blit;
+
+// Setup
+void GFX_Blit_Init(GFX_Blit *b, const uint16_t *pixels, uint16_t width, uint16_t height,
+                   uint16_t stride, GFX_PixelOrder order, GFX_Filter filter);
+void GFX_Blit_Transform(GFX_Blit *b, int32_t cx, int32_t cy, int32_t scale_x, int32_t scale_y,
+                        int32_t angle);
+void GFX_Blit_Fit(GFX_Blit *b, int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t cover,
+                  int32_t angle);
+void GFX_Blit_SetMask(GFX_Blit *b, int16_t cx, int16_t cy, int16_t r);
+
+// Rasterisation
+void GFX_Blit_RenderRow(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                        uint16_t *row, GFX_PixelOrder order);
+void GFX_Blit_RenderRow_Scalar(const GFX_Blit *b, int16_t y, int16_t x0, uint16_t width,
+                               uint16_t *row, GFX_PixelOrder order);
+
+#endif // _GFX_BLIT_H_
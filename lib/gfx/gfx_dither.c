@@ -0,0 +1,275 @@
+/**
+ * @file gfx_dither.c
+ * @brief RGB888 to RGB565 conversion kernels (SSE2 / scalar)
+ *
+ * Ordered dithering adds a per-pixel offset below one output step before
+ * truncating: floor((v + d) / step) with d spread evenly over 0..step-1
+ * averages to v / step. The panel expands 5/6-bit values by bit
+ * replication (31 -> 255), so v is first scaled by 248/255 (252/255 for
+ * green) to keep the displayed average equal to the input; the sum then
+ * never exceeds 255. The offsets come from an 8x8 Bayer matrix, so one
+ * row needs only an 8-entry pattern per channel step size (8 for
+ * red/blue, 4 for green).
+ *
+ * Plain conversion is the same kernel without scaling and offsets, i.e.
+ * the RGB() truncation. The vector paths evaluate the same expressions
+ * and give bit-identical output.
+ */
+
+#include <string.h>
+#include "gfx_dither.h"
+
+/// 8x8 Bayer threshold matrix, 0..63
+static const uint8_t Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+/**
+ * @brief Offsets for 16 pixels starting at column x of row y
+ *
+ * Sixteen entries (two periods) so vector loops stepping by 8 or 16
+ * stay in phase.
+ */
+static void Row_Pattern(int16_t x, int16_t y, uint8_t drb[16], uint8_t dg[16])
+{
+    const uint8_t *m = Bayer8[y & 7];
+    for (uint8_t i = 0; i < 16; i++) {
+        uint8_t t = m[(x + i) & 7];
+        drb[i] = t >> 3;
+        dg[i] = t >> 4;
+    }
+}
+
+// ============================================================================
+// SCALAR
+// ============================================================================
+
+/// Input scale (Q8) ahead of the offsets: 248/255 and 252/255
+#define SCALE_RB  249
+#define SCALE_G   253
+
+static inline uint8_t Dither_Channel(uint8_t v, uint8_t scale, const uint8_t *d, uint16_t i)
+{
+    return d ? (uint8_t)(((v * scale) >> 8) + d[i & 7]) : v;
+}
+
+/**
+ * @brief Convert n pixels; drb/dg = NULL for plain truncation
+ */
+static void Row_Scalar(uint16_t *dst, const uint8_t *src, uint16_t n, GFX_RGBFormat fmt,
+                       GFX_PixelOrder order, const uint8_t *drb, const uint8_t *dg)
+{
+    uint8_t bpp = GFX_RGB_BPP(fmt);
+    uint8_t ri = (fmt == GFX_BGR888 || fmt == GFX_BGRX8888) ? 2 : 0;
+
+    for (uint16_t i = 0; i < n; i++, src += bpp) {
+        uint8_t r = Dither_Channel(src[ri], SCALE_RB, drb, i) >> 3;
+        uint8_t g = Dither_Channel(src[1], SCALE_G, dg, i) >> 2;
+        uint8_t b = Dither_Channel(src[2 - ri], SCALE_RB, drb, i) >> 3;
+        uint16_t c = (uint16_t)((r << 11) | (g << 5) | b);
+        dst[i] = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(c) : c;
+    }
+}
+
+void GFX_Convert565_Scalar(uint16_t *dst, const uint8_t *src, uint16_t n,
+                           GFX_RGBFormat fmt, GFX_PixelOrder order)
+{
+    Row_Scalar(dst, src, n, fmt, order, NULL, NULL);
+}
+
+void GFX_DitherOrdered_Scalar(uint16_t *dst, const uint8_t *src, uint16_t n, int16_t x, int16_t y,
+                              GFX_RGBFormat fmt, GFX_PixelOrder order)
+{
+    uint8_t drb[16], dg[16];
+    Row_Pattern(x, y, drb, dg);
+    Row_Scalar(dst, src, n, fmt, order, drb, dg);
+}
+
+// ============================================================================
+// VECTOR
+// ============================================================================
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+/**
+ * @brief Four 32-bit pixels to RGB565 in 32-bit lanes
+ */
+static inline __m128i V_Pack(__m128i q, int bgr)
+{
+    if (bgr) {
+        return _mm_or_si128(_mm_or_si128(
+                   _mm_and_si128(_mm_srli_epi32(q, 8), _mm_set1_epi32(0xF800)),
+                   _mm_and_si128(_mm_srli_epi32(q, 5), _mm_set1_epi32(0x07E0))),
+                   _mm_and_si128(_mm_srli_epi32(q, 3), _mm_set1_epi32(0x001F)));
+    }
+    return _mm_or_si128(_mm_or_si128(
+               _mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(0xF8)), 8),
+               _mm_and_si128(_mm_srli_epi32(q, 5), _mm_set1_epi32(0x07E0))),
+               _mm_and_si128(_mm_srli_epi32(q, 19), _mm_set1_epi32(0x001F)));
+}
+
+/// Two vectors of 32-bit lanes (each < 0x10000) to eight 16-bit lanes
+static inline __m128i V_Narrow(__m128i a, __m128i b)
+{
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    return _mm_packs_epi32(a, b);
+}
+
+static inline void V_Store(uint16_t *p, __m128i v, int swap)
+{
+    if (swap) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    _mm_storeu_si128((__m128i *)p, v);
+}
+
+/// Scale and offset four 32-bit pixels in 16-bit lanes, two pixels at a time
+static inline __m128i V_Dither(__m128i p, __m128i scale, __m128i d)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), scale), 8);
+    __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), scale), 8);
+    return _mm_add_epi8(_mm_packus_epi16(lo, hi), d);
+}
+
+/**
+ * @brief 8 pixels per step, 32-bit sources only (24-bit stays scalar:
+ * SSE2 has no byte shuffle to deinterleave it cheaply)
+ *
+ * The scaled value of the pad byte is 0 (scale 0), plus a 0 offset.
+ */
+static uint16_t Row_Vector(uint16_t *dst, const uint8_t *src, uint16_t n, GFX_RGBFormat fmt,
+                           GFX_PixelOrder order, const uint8_t *drb, const uint8_t *dg)
+{
+    int bgr = (fmt == GFX_BGRX8888);
+    int swap = (order == GFX_ORDER_SWAPPED);
+    int dither = (drb != NULL);
+    uint8_t lanes[32] = {0};
+    uint16_t i = 0;
+
+    if (GFX_RGB_BPP(fmt) != 4) return 0;
+
+    // Offsets laid out like the source bytes: one period of 8 pixels
+    for (uint8_t k = 0; dither && k < 8; k++) {
+        lanes[4 * k + 0] = drb[k];
+        lanes[4 * k + 1] = dg[k];
+        lanes[4 * k + 2] = drb[k];
+    }
+    __m128i d0 = _mm_loadu_si128((const __m128i *)lanes);
+    __m128i d1 = _mm_loadu_si128((const __m128i *)(lanes + 16));
+    __m128i scale = _mm_setr_epi16(SCALE_RB, SCALE_G, SCALE_RB, 0, SCALE_RB, SCALE_G, SCALE_RB, 0);
+
+    for (; i + 8 <= n; i += 8, src += 32) {
+        __m128i q0 = _mm_loadu_si128((const __m128i *)src);
+        __m128i q1 = _mm_loadu_si128((const __m128i *)(src + 16));
+        if (dither) {
+            q0 = V_Dither(q0, scale, d0);
+            q1 = V_Dither(q1, scale, d1);
+        }
+        V_Store(dst + i, V_Narrow(V_Pack(q0, bgr), V_Pack(q1, bgr)), swap);
+    }
+    return i;
+}
+
+#else
+
+static uint16_t Row_Vector(uint16_t *dst, const uint8_t *src, uint16_t n, GFX_RGBFormat fmt,
+                           GFX_PixelOrder order, const uint8_t *drb, const uint8_t *dg)
+{
+    return 0;
+}
+
+#endif
+
+static void Row_Convert(uint16_t *dst, const uint8_t *src, uint16_t n, GFX_RGBFormat fmt,
+                        GFX_PixelOrder order, const uint8_t *drb, const uint8_t *dg)
+{
+    // Vector steps are multiples of 8, so the scalar tail stays in phase
+    uint16_t done = Row_Vector(dst, src, n, fmt, order, drb, dg);
+    Row_Scalar(dst + done, src + done * GFX_RGB_BPP(fmt), n - done, fmt, order, drb, dg);
+}
+
+void GFX_Convert565(uint16_t *dst, const uint8_t *src, uint16_t n,
+                    GFX_RGBFormat fmt, GFX_PixelOrder order)
+{
+    Row_Convert(dst, src, n, fmt, order, NULL, NULL);
+}
+
+void GFX_DitherOrdered(uint16_t *dst, const uint8_t *src, uint16_t n, int16_t x, int16_t y,
+                       GFX_RGBFormat fmt, GFX_PixelOrder order)
+{
+    uint8_t drb[16], dg[16];
+    Row_Pattern(x, y, drb, dg);
+    Row_Convert(dst, src, n, fmt, order, drb, dg);
+}
+
+// ============================================================================
+// FLOYD-STEINBERG
+// ============================================================================
+
+void GFX_DitherFS_Init(GFX_DitherFS *fs, int16_t *err, uint16_t width)
+{
+    fs->err = err;
+    fs->width = width;
+    fs->reverse = 0;
+    memset(err, 0, GFX_DITHER_FS_ERR_LEN(width) * sizeof(int16_t));
+}
+
+/**
+ * @brief Quantise one channel to bits, returning the error to diffuse
+ */
+static inline int16_t FS_Quantise(int16_t v, uint8_t bits, uint8_t *q)
+{
+    uint8_t max = (1 << bits) - 1;
+    *q = (uint8_t)((v * max + 128) >> 8);
+    return v - ((*q << (8 - bits)) | (*q >> (2 * bits - 8)));
+}
+
+/**
+ * Error is kept in 1/16 units in two rows of (width + 2) pixels (a guard
+ * pixel at each end). The half for the current row was filled while
+ * scanning the previous one; 7/16 goes straight to the next pixel.
+ */
+void GFX_DitherFS_Row(GFX_DitherFS *fs, uint16_t *dst, const uint8_t *src,
+                      GFX_RGBFormat fmt, GFX_PixelOrder order)
+{
+    static const uint8_t bits[3] = {5, 6, 5};
+    uint16_t len = 3 * (fs->width + 2);
+    int16_t *cur = fs->err + (fs->reverse ? len : 0);
+    int16_t *next = fs->err + (fs->reverse ? 0 : len);
+    uint8_t bpp = GFX_RGB_BPP(fmt);
+    uint8_t ri = (fmt == GFX_BGR888 || fmt == GFX_BGRX8888) ? 2 : 0;
+    int16_t step = fs->reverse ? -1 : 1;
+    int16_t carry[3] = {0, 0, 0};
+
+    memset(next, 0, len * sizeof(int16_t));
+    for (uint16_t k = 0; k < fs->width; k++) {
+        int16_t x = fs->reverse ? fs->width - 1 - k : k;
+        const uint8_t *p = src + x * bpp;
+        uint8_t chan[3] = {p[ri], p[1], p[2 - ri]};
+        uint8_t q[3];
+
+        for (uint8_t c = 0; c < 3; c++) {
+            int16_t at = (x + 1) * 3 + c;
+            int16_t v = chan[c] + ((cur[at] + carry[c] + 8) >> 4);
+            if (v < 0) v = 0;
+            if (v > 255) v = 255;
+
+            int16_t e = FS_Quantise(v, bits[c], &q[c]);
+            carry[c] = e * 7;
+            next[at - 3 * step] += e * 3;
+            next[at] += e * 5;
+            next[at + 3 * step] += e;
+        }
+        uint16_t color = (uint16_t)((q[0] << 11) | (q[1] << 5) | q[2]);
+        dst[x] = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(color) : color;
+    }
+    fs->reverse ^= 1;
+}
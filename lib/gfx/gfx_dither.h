@@ -0,0 +1,76 @@
+/**
+ * @file gfx_dither.h
+ * @brief RGB888 to RGB565 conversion with optional dithering
+ *
+ * Plain truncation (what RGB() in GUI_BMP.h does) turns smooth gradients
+ * into visible 8/4-level bands. Two dithers are provided:
+ * - Ordered (8x8 Bayer): stateless per pixel, so rows and tiles can be
+ *   converted in any order and video frames do not shimmer. Vectorised
+ *   with SSE2 (32-bit sources), scalar elsewhere.
+ * - Floyd-Steinberg: error diffusion with a serpentine scan, best for
+ *   stills. Rows must be fed top to bottom (or consistently bottom to
+ *   top) through one GFX_DitherFS state. Scalar only.
+ *
+ * The *_Scalar variants are always scalar and produce identical results.
+ */
+
+#ifndef _GFX_DITHER_H_
+#define _GFX_DITHER_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+
+#if defined(__SSE2__)
+#define GFX_DITHER_SIMD  "sse2"
+#else
+#define GFX_DITHER_SIMD  "none"
+#endif
+
+/**
+ * @brief Source pixel layout (bytes in memory order)
+ */
+typedef enum {
+    GFX_RGB888 = 0,     ///< R, G, B (PIL "RGB", ffmpeg rgb24)
+    GFX_BGR888,         ///< B, G, R (24-bit BMP, ffmpeg bgr24)
+    GFX_RGBX8888,       ///< R, G, B, x (PIL "RGBA"/"RGBX", alpha ignored)
+    GFX_BGRX8888,       ///< B, G, R, x (32-bit BMP)
+} GFX_RGBFormat;
+
+typedef enum {
+    GFX_DITHER_NONE = 0,
+    GFX_DITHER_ORDERED,
+    GFX_DITHER_FS,
+} GFX_DitherMode;
+
+/**
+ * @brief Floyd-Steinberg state; err must hold GFX_DITHER_FS_ERR_LEN(width)
+ */
+typedef struct {
+    int16_t *err;
+    uint16_t width;
+    uint8_t reverse;        ///< Direction of the next row
+} GFX_DitherFS;
+
+#define GFX_DITHER_FS_ERR_LEN(width)  (6 * ((width) + 2))
+
+/// Bytes per source pixel
+#define GFX_RGB_BPP(fmt)  ((fmt) >= GFX_RGBX8888 ? 4 : 3)
+
+// Truncate (no dither)
+void GFX_Convert565(uint16_t *dst, const uint8_t *src, uint16_t n,
+                    GFX_RGBFormat fmt, GFX_PixelOrder order);
+// Ordered dither; (x, y) is the screen position of src[0]
+void GFX_DitherOrdered(uint16_t *dst, const uint8_t *src, uint16_t n, int16_t x, int16_t y,
+                       GFX_RGBFormat fmt, GFX_PixelOrder order);
+
+void GFX_Convert565_Scalar(uint16_t *dst, const uint8_t *src, uint16_t n,
+                           GFX_RGBFormat fmt, GFX_PixelOrder order);
+void GFX_DitherOrdered_Scalar(uint16_t *dst, const uint8_t *src, uint16_t n, int16_t x, int16_t y,
+                              GFX_RGBFormat fmt, GFX_PixelOrder order);
+
+// Error diffusion, one full row of state.width pixels per call
+void GFX_DitherFS_Init(GFX_DitherFS *fs, int16_t *err, uint16_t width);
+void GFX_DitherFS_Row(GFX_DitherFS *fs, uint16_t *dst, const uint8_t *src,
+                      GFX_RGBFormat fmt, GFX_PixelOrder order);
+
+#endif // _GFX_DITHER_H_
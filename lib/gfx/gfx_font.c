@@ -0,0 +1,166 @@
+/**
+ * @file gfx_font.c
+ * @brief Run-length glyph decoders
+ */
+
+#include "gfx_font.h"
+
+#define TOKEN_SKIP     0x00
+#define TOKEN_SOLID    0x40
+#define TOKEN_LITERAL  0x80
+#define TOKEN_KIND     0xC0
+#define TOKEN_COUNT    0x3F
+
+/**
+ * @brief Cursor over one glyph stream
+ */
+typedef struct {
+    const uint8_t *p;
+    uint8_t bpp;
+    uint8_t kind;               ///< Kind of the current token
+    uint8_t left;               ///< Pixels left in the current token
+    uint8_t bits;               ///< Unread bits in 'byte' (literals)
+    uint8_t byte;
+    uint8_t scale;              ///< Level to alpha multiplier
+} Glyph_Reader;
+
+static void Reader_Init(Glyph_Reader *r, const GFX_Font *f, const GFX_Glyph *g)
+{
+    r->p = f->bitmap + g->offset;
+    r->bpp = f->bpp;
+    r->left = 0;
+    r->scale = (uint8_t)(255 / ((1 << f->bpp) - 1));
+}
+
+/**
+ * @brief Next run of up to max equal pixels; returns its length
+ */
+static uint16_t Reader_Next(Glyph_Reader *r, uint16_t max, uint8_t *alpha)
+{
+    if (r->left == 0) {
+        uint8_t t = *r->p++;
+        r->kind = t & TOKEN_KIND;
+        r->left = (t & TOKEN_COUNT) + 1;
+        r->bits = 0;
+    }
+
+    if (r->kind == TOKEN_LITERAL) {
+        if (r->bits == 0) {
+            r->byte = *r->p++;
+            r->bits = 8;
+        }
+        r->bits -= r->bpp;
+        *alpha = (uint8_t)(((r->byte >> r->bits) & ((1 << r->bpp) - 1)) * r->scale);
+        r->left--;
+        return 1;
+    }
+
+    uint16_t n = r->left < max ? r->left : max;
+    *alpha = (r->kind == TOKEN_SOLID) ? 255 : 0;
+    r->left -= n;
+    return n;
+}
+
+/**
+ * @brief Skip n pixels of the stream
+ */
+static void Reader_Skip(Glyph_Reader *r, uint16_t n)
+{
+    uint8_t alpha;
+    while (n) n -= Reader_Next(r, n, &alpha);
+}
+
+/**
+ * @brief Glyph for a character code, or NULL when not in the font
+ */
+const GFX_Glyph *GFX_Font_Glyph(const GFX_Font *f, uint16_t code)
+{
+    for (uint8_t i = 0; i < f->range_count; i++) {
+        const GFX_FontRange *r = &f->ranges[i];
+        if (code >= r->first && code - r->first < r->count) {
+            return &f->glyphs[r->glyph + code - r->first];
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Report the covered spans of a glyph, row by row
+ *
+ * @param x, y Pen position (top of the line)
+ */
+void GFX_Font_DrawGlyph(const GFX_Font *f, const GFX_Glyph *g, int16_t x, int16_t y,
+                        GFX_GlyphSpanFunc fn, void *ctx)
+{
+    Glyph_Reader r;
+
+    Reader_Init(&r, f, g);
+    x += g->x_off;
+    y += g->y_off;
+    for (uint8_t row = 0; row < g->height; row++) {
+        uint16_t col = 0;
+        while (col < g->width) {
+            uint8_t alpha;
+            uint16_t n = Reader_Next(&r, g->width - col, &alpha);
+            if (alpha) fn(x + col, y + row, n, alpha, ctx);
+            col += n;
+        }
+    }
+}
+
+/**
+ * @brief Sum of the advances of the glyphs in the font
+ */
+int16_t GFX_Font_TextWidth(const GFX_Font *f, const char *text)
+{
+    int16_t w = 0;
+    for (; *text; text++) {
+        const GFX_Glyph *g = GFX_Font_Glyph(f, (uint8_t)*text);
+        if (g) w += g->advance;
+    }
+    return w;
+}
+
+/**
+ * @brief Blend the part of a text line that falls on columns [x0, x0 + width) of row y
+ *
+ * Each glyph crossing the row is decoded from its start, so the cost per
+ * row grows with the glyph height; fine for the short labels and
+ * readouts this is meant for.
+ */
+void GFX_Text_RenderRow(const GFX_Text *t, int16_t y, int16_t x0, uint16_t width,
+                        uint16_t *row, GFX_PixelOrder order)
+{
+    const GFX_Font *f = t->font;
+    int16_t pen = t->x;
+    int16_t x1 = x0 + width;
+
+    if (y < t->y || y >= t->y + f->line_height) return;
+
+    for (const char *s = t->text; *s && pen < x1; s++) {
+        const GFX_Glyph *g = GFX_Font_Glyph(f, (uint8_t)*s);
+        if (!g) continue;
+
+        int16_t gx = pen + g->x_off;
+        int16_t gy = t->y + g->y_off;
+        pen += g->advance;
+        if (y < gy || y >= gy + g->height || gx >= x1 || gx + g->width <= x0) continue;
+
+        Glyph_Reader r;
+        Reader_Init(&r, f, g);
+        Reader_Skip(&r, (uint16_t)(y - gy) * g->width);
+
+        uint16_t col = 0;
+        while (col < g->width) {
+            uint8_t alpha;
+            uint16_t n = Reader_Next(&r, g->width - col, &alpha);
+            if (alpha) {
+                for (uint16_t i = 0; i < n; i++) {
+                    int16_t px = gx + col + i;
+                    if (px >= x0 && px < x1) GFX_BlendPixel(&row[px - x0], t->color, alpha, order);
+                }
+            }
+            col += n;
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file gfx_font.h
+ * @brief Compressed anti-aliased fonts
+ *
+ * Fonts are produced on the host by RaspberryPi/c/tools/fontc.py (from TTF,
+ * BDF or the sFONT tables) and compiled in as const data. Each glyph is
+ * cropped to its ink box and stored as a run-length coded stream of
+ * 1, 2 or 4 bit coverage values, row after row:
+ *
+ *   00nnnnnn            n + 1 transparent pixels
+ *   01nnnnnn            n + 1 fully covered pixels
+ *   10nnnnnn <bits>     n + 1 literal pixels, bpp bits each, MSB first,
+ *                       padded to a whole byte
+ *
+ * Runs continue across rows. Decoding needs no buffer:
+ * - GFX_Font_DrawGlyph() hands out spans (x, y, n, alpha), e.g. for
+ *   blending into a canvas
+ * - GFX_Text_RenderRow() blends a string into one RGB565 row, for
+ *   GC9A01_DrawRows() on the CH32v003
+ */
+
+#ifndef _GFX_FONT_H_
+#define _GFX_FONT_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+
+typedef struct {
+    uint16_t offset;            ///< Start of the glyph's stream in the bitmap
+    uint8_t width, height;      ///< Ink box (0 x 0 for blanks)
+    int8_t x_off, y_off;        ///< Ink box relative to the pen (top of the line)
+    uint8_t advance;            ///< Pen step to the next glyph
+} GFX_Glyph;
+
+/**
+ * @brief Run of consecutive character codes
+ */
+typedef struct {
+    uint16_t first;             ///< First code
+    uint16_t count;
+    uint16_t glyph;             ///< Index of the glyph for code 'first'
+} GFX_FontRange;
+
+typedef struct GFX_Font {
+    const uint8_t *bitmap;
+    const GFX_Glyph *glyphs;
+    const GFX_FontRange *ranges;
+    uint8_t range_count;
+    uint8_t bpp;                ///< 1, 2 or 4
+    uint8_t line_height;
+    uint8_t ascent;             ///< Top of the line to the baseline
+} GFX_Font;
+
+/**
+ * @brief Coverage span of a glyph
+ *
+ * @param alpha Coverage 1..255; transparent pixels are never reported
+ */
+typedef void (*GFX_GlyphSpanFunc)(int16_t x, int16_t y, uint16_t n, uint8_t alpha, void *ctx);
+
+/**
+ * @brief A line of text for GFX_Text_RenderRow()
+ */
+typedef struct {
+    const GFX_Font *font;
+    const char *text;           ///< 8-bit codes
+    int16_t x, y;               ///< Pen position at the top of the line
+    uint16_t color;
+} GFX_Text;
+
+/// ' ', '-', '.', '0'-'9', ':' at 24 px, 4 bpp (gfx_font_digits.c, 862 bytes)
+extern const GFX_Font GFX_Font_Digits24;
+
+const GFX_Glyph *GFX_Font_Glyph(const GFX_Font *f, uint16_t code);
+void GFX_Font_DrawGlyph(const GFX_Font *f, const GFX_Glyph *g, int16_t x, int16_t y,
+                        GFX_GlyphSpanFunc fn, void *ctx);
+int16_t GFX_Font_TextWidth(const GFX_Font *f, const char *text);
+
+void GFX_Text_RenderRow(const GFX_Text *t, int16_t y, int16_t x0, uint16_t width,
+                        uint16_t *row, GFX_PixelOrder order);
+
+#endif // _GFX_FONT_H_
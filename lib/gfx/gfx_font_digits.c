@@ -0,0 +1,85 @@
+/**
+ * @file gfx_font_digits.c
+ * @brief GFX_Font_Digits24: generated by tools/fontc.py, do not edit
+ *
+ * Source font48.c, 4 bpp, scale 1/2, 14 glyphs, line 24 px, ascent 20 px
+ * Flash 862 bytes (bitmap 716)
+ */
+
+#include "gfx_font.h"
+
+static const uint8_t GFX_Font_Digits24_Bitmap[] = {
+    0x49, 0x8B, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x85, 0x8F, 0x88, 0xF8, 0x04, 0x80, 0x80, 0x06,
+    0x85, 0x4B, 0xFF, 0xFB, 0x04, 0x41, 0x9F, 0xB8, 0xBF, 0xB0, 0x00, 0xBF, 0xB0, 0x00, 0xBF, 0x40,
+    0x0F, 0xF0, 0x00, 0x04, 0xFB, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x08, 0xF8, 0x04, 0x85, 0xBF, 0x08,
+    0xF8, 0x04, 0x83, 0x8F, 0x08, 0x40, 0x05, 0x83, 0x8F, 0x88, 0x40, 0x05, 0x85, 0x8F, 0x88, 0xF4,
+    0x04, 0x85, 0x8F, 0x08, 0xF8, 0x04, 0x85, 0xBF, 0x08, 0xF8, 0x04, 0x41, 0x01, 0x41, 0x03, 0x97,
+    0x4F, 0xB0, 0x08, 0xFB, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFB, 0x8F, 0xFB, 0x04, 0x84, 0xBF, 0xFF,
+    0xB0, 0x02, 0x03, 0x9B, 0xF8, 0x00, 0x0B, 0xF8, 0x00, 0xBF, 0xF8, 0x4F, 0xFB, 0xF8, 0x8B, 0x48,
+    0xF8, 0x40, 0xBF, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08,
+    0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8, 0x00, 0x08, 0xF8,
+    0x00, 0x08, 0xF8, 0x03, 0x82, 0x48, 0x40, 0x04, 0x80, 0x80, 0x44, 0x8F, 0x40, 0x08, 0xFF, 0xB8,
+    0xBF, 0xF4, 0x4F, 0xF4, 0x02, 0x85, 0x8F, 0xB8, 0xF4, 0x04, 0x41, 0x07, 0x41, 0x06, 0x82, 0x8F,
+    0x80, 0x06, 0x82, 0xBF, 0x40, 0x05, 0x82, 0x8F, 0xB0, 0x05, 0x80, 0x40, 0x41, 0x06, 0x41, 0x80,
+    0x40, 0x05, 0x82, 0xBF, 0x80, 0x05, 0x82, 0xBF, 0xB0, 0x05, 0x82, 0xBF, 0xB0, 0x05, 0x80, 0x80,
+    0x41, 0x06, 0x48, 0x80, 0x80, 0x48, 0x01, 0x81, 0x4B, 0x43, 0x8F, 0x40, 0x04, 0xFF, 0x88, 0xBF,
+    0xF4, 0x0B, 0xF4, 0x02, 0x85, 0x8F, 0xB4, 0xF8, 0x04, 0x41, 0x07, 0x81, 0xFB, 0x06, 0x82, 0x8F,
+    0x80, 0x04, 0x83, 0x4B, 0xFB, 0x04, 0x80, 0x80, 0x42, 0x06, 0x84, 0x8B, 0xFF, 0x40, 0x06, 0x82,
+    0x8F, 0xB0, 0x07, 0x41, 0x81, 0x04, 0x05, 0x41, 0x82, 0x8F, 0x80, 0x04, 0x41, 0x9B, 0x0F, 0xF4,
+    0x00, 0x0B, 0xFB, 0x04, 0xFF, 0xB8, 0xBF, 0xF0, 0x00, 0x4B, 0xFF, 0xFB, 0x01, 0x05, 0x80, 0x40,
+    0x41, 0x07, 0x80, 0xB0, 0x41, 0x06, 0x80, 0x80, 0x42, 0x05, 0x82, 0x4F, 0xB0, 0x41, 0x05, 0x82,
+    0xBF, 0x40, 0x41, 0x04, 0x83, 0x8F, 0x80, 0x41, 0x03, 0xA1, 0x4F, 0xB0, 0x0F, 0xF0, 0x00, 0x0F,
+    0xF4, 0x00, 0xFF, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xF0, 0x04, 0xFB, 0x03, 0x41, 0x01, 0x41, 0x04,
+    0x41, 0x01, 0x4A, 0x8A, 0x88, 0x88, 0x88, 0x8F, 0xF8, 0x80, 0x06, 0x41, 0x08, 0x41, 0x08, 0x41,
+    0x01, 0x01, 0x46, 0x80, 0x80, 0x01, 0x46, 0x84, 0x80, 0x8F, 0x80, 0x06, 0x81, 0x8F, 0x07, 0x41,
+    0x07, 0x41, 0x87, 0x8B, 0xF8, 0x40, 0x04, 0x46, 0x8D, 0xB0, 0x8F, 0xB0, 0x00, 0x4F, 0xF4, 0x08,
+    0x04, 0x82, 0x4F, 0xB0, 0x07, 0x41, 0x07, 0x41, 0x81, 0x04, 0x05, 0x43, 0x04, 0x85, 0x4F, 0xFB,
+    0xF8, 0x03, 0x8F, 0xBF, 0x84, 0xFF, 0xB8, 0x8F, 0xFB, 0x00, 0x4B, 0x43, 0x80, 0x80, 0x01, 0x04,
+    0x82, 0x4F, 0xB0, 0x07, 0x41, 0x80, 0x40, 0x06, 0x82, 0xBF, 0x80, 0x06, 0x82, 0x4F, 0xB0, 0x07,
+    0x41, 0x80, 0x40, 0x06, 0x84, 0x8F, 0xB4, 0x80, 0x04, 0x80, 0x40, 0x45, 0x91, 0xB0, 0x00, 0xBF,
+    0xF8, 0x88, 0xBF, 0xB0, 0x4F, 0xF4, 0x03, 0x85, 0xBF, 0x88, 0xF8, 0x04, 0x85, 0x4F, 0xB8, 0xF8,
+    0x05, 0x41, 0x82, 0x8F, 0x80, 0x05, 0x41, 0x82, 0x8F, 0xB0, 0x04, 0x9B, 0x8F, 0x80, 0xFF, 0x40,
+    0x00, 0x0F, 0xF4, 0x04, 0xFF, 0xB8, 0x8F, 0xFB, 0x00, 0x04, 0x44, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x48, 0x81, 0x88, 0x48, 0x80, 0x80, 0x07, 0x81, 0xBF, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x41, 0x07,
+    0x82, 0x8F, 0x80, 0x07, 0x41, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x81, 0xBF, 0x07, 0x82, 0x4F, 0x80,
+    0x07, 0x82, 0x8F, 0x40, 0x07, 0x41, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x82, 0x8F, 0x80, 0x07, 0x41,
+    0x07, 0x80, 0x40, 0x41, 0x05, 0x01, 0xA1, 0x8F, 0xFF, 0xFB, 0x40, 0x00, 0x8F, 0xB8, 0x8B, 0xFF,
+    0x40, 0x0F, 0xB0, 0x00, 0x08, 0xF8, 0x08, 0xF8, 0x04, 0x41, 0x83, 0x08, 0xF8, 0x04, 0x81, 0xFB,
+    0x01, 0x41, 0x03, 0x91, 0xBF, 0x80, 0x08, 0xFB, 0x88, 0xBF, 0xB0, 0x00, 0x0B, 0x44, 0x03, 0x97,
+    0xBF, 0xF8, 0x8B, 0xFF, 0x40, 0x8F, 0xB0, 0x00, 0x04, 0xFF, 0x0B, 0xF4, 0x04, 0x81, 0xBF, 0x00,
+    0x41, 0x05, 0x85, 0x8F, 0x8B, 0xF4, 0x04, 0x85, 0xBF, 0x08, 0xFB, 0x03, 0x91, 0x4F, 0xF0, 0x0F,
+    0xFF, 0x88, 0xBF, 0xF4, 0x00, 0x4B, 0x44, 0x80, 0x40, 0x01, 0x03, 0x81, 0x48, 0x05, 0xA3, 0x8F,
+    0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0x88, 0xFF, 0xF0, 0x8F, 0xB0, 0x00, 0x0B, 0xFB, 0xBF, 0x40, 0x00,
+    0x04, 0x43, 0x05, 0x43, 0x05, 0x43, 0x80, 0x40, 0x03, 0x99, 0x4F, 0xB8, 0xFB, 0x00, 0x04, 0xFF,
+    0x80, 0xFF, 0xF8, 0x8F, 0xFF, 0x00, 0x08, 0x44, 0x80, 0x80, 0x05, 0x82, 0x8F, 0xB0, 0x06, 0x41,
+    0x80, 0x40, 0x05, 0x82, 0x8F, 0xB0, 0x06, 0x41, 0x80, 0x40, 0x05, 0x82, 0x8F, 0x80, 0x06, 0x41,
+    0x04, 0x88, 0x88, 0x4F, 0xF8, 0x88, 0x40, 0x11, 0x41, 0x83, 0x8F, 0xF8,
+};
+
+static const GFX_Glyph GFX_Font_Digits24_Glyphs[] = {
+    {    0,   0,   0,   0,   0,  14}, // ' '
+    {    0,  11,   2,   1,  11,  14}, // '-'
+    {    8,   3,   2,   2,  18,  14}, // '.'
+    {   12,  11,  17,   1,   3,  14}, // '0'
+    {   98,   6,  16,   2,   4,  14}, // '1'
+    {  147,  10,  17,   1,   3,  14}, // '2'
+    {  214,  10,  16,   1,   4,  14}, // '3'
+    {  285,  11,  16,   1,   4,  14}, // '4'
+    {  353,  10,  16,   1,   4,  14}, // '5'
+    {  415,  11,  16,   1,   4,  14}, // '6'
+    {  494,  11,  16,   1,   4,  14}, // '7'
+    {  549,  11,  16,   1,   4,  14}, // '8'
+    {  634,  10,  17,   1,   3,  14}, // '9'
+    {  705,   3,  11,   5,   9,  14}, // ':'
+};
+
+static const GFX_FontRange GFX_Font_Digits24_Ranges[] = {
+    {0x0020, 1, 0},
+    {0x002D, 2, 1},
+    {0x0030, 11, 3},
+};
+
+const GFX_Font GFX_Font_Digits24 = {
+    GFX_Font_Digits24_Bitmap, GFX_Font_Digits24_Glyphs, GFX_Font_Digits24_Ranges, 3,
+    4, 24, 20
+};
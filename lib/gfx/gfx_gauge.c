@@ -0,0 +1,184 @@
+/**
+ * @file gfx_gauge.c
+ * @brief Analog gauge widget with incremental needle updates
+ */
+
+#include "gfx_gauge.h"
+
+// ============================================================================
+// GEOMETRY
+// ============================================================================
+
+/**
+ * @brief Point at radius r (pixels) and angle a, fixed point
+ */
+static int32_t Polar_X(const GFX_Gauge *g, int32_t a, int32_t r)
+{
+    return GFX_FIX(g->cx) + ((GFX_Sin(a) * r) >> (14 - GFX_FIX_SHIFT));
+}
+
+static int32_t Polar_Y(const GFX_Gauge *g, int32_t a, int32_t r)
+{
+    return GFX_FIX(g->cy) - ((GFX_Cos(a) * r) >> (14 - GFX_FIX_SHIFT));
+}
+
+static int32_t Value_Angle(const GFX_Gauge *g, int16_t value)
+{
+    if (g->max == g->min) return g->start;
+    return g->start + (int32_t)(value - g->min) * g->sweep / (g->max - g->min);
+}
+
+static int32_t Tick_Angle(const GFX_Gauge *g, uint8_t i)
+{
+    if (g->ticks < 2) return g->start;
+    return g->start + (int32_t)g->sweep * i / (g->ticks - 1);
+}
+
+static void Gauge_Needle(GFX_Gauge *g)
+{
+    int32_t a = Value_Angle(g, g->value);
+    int32_t tail = g->needle_len / 6;
+
+    GFX_AA_Line(&g->needle,
+                Polar_X(g, a + GFX_ANGLE_180, tail), Polar_Y(g, a + GFX_ANGLE_180, tail),
+                Polar_X(g, a, g->needle_len), Polar_Y(g, a, g->needle_len),
+                GFX_FIX(g->needle_width), g->needle_color);
+}
+
+// ============================================================================
+// PUBLIC
+// ============================================================================
+
+/**
+ * @brief Default 270 degree, 0..100 gauge scaled to radius
+ */
+void GFX_Gauge_Init(GFX_Gauge *g, int16_t cx, int16_t cy, uint8_t radius)
+{
+    g->cx = cx;
+    g->cy = cy;
+    g->radius = radius;
+    g->scale_width = radius / 14 + 2;
+    g->ticks = 11;
+    g->tick_len = radius / 10 + 2;
+    g->needle_len = radius * 5 / 6;
+    g->needle_width = 3;
+    g->hub_r = radius / 16 + 2;
+    g->start = GFX_DEG(-135);
+    g->sweep = GFX_DEG(270);
+    g->min = 0;
+    g->max = 100;
+    g->value = 0;
+    g->face_color = 0x0000;
+    g->scale_color = 0x03BF;
+    g->tick_color = 0xFFFF;
+    g->needle_color = 0xF800;
+    g->hub_color = 0xC618;
+    GFX_Gauge_Layout(g);
+}
+
+/**
+ * @brief Rebuild the prepared shapes after changing any field
+ */
+void GFX_Gauge_Layout(GFX_Gauge *g)
+{
+    GFX_AA_Arc(&g->scale, GFX_FIX(g->cx), GFX_FIX(g->cy), GFX_FIX(g->radius),
+               GFX_FIX(g->radius - g->scale_width), g->start, g->start + g->sweep, g->scale_color);
+    GFX_AA_Circle(&g->hub, GFX_FIX(g->cx), GFX_FIX(g->cy), GFX_FIX(g->hub_r), g->hub_color);
+    Gauge_Needle(g);
+}
+
+/**
+ * @brief Render columns [x0, x0 + width) of row y of the whole gauge
+ */
+void GFX_Gauge_RenderRow(const GFX_Gauge *g, int16_t y, int16_t x0, uint16_t width,
+                         uint16_t *row, GFX_PixelOrder order)
+{
+    uint16_t face = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(g->face_color) : g->face_color;
+    for (uint16_t i = 0; i < width; i++) row[i] = face;
+
+    GFX_AA_RenderRow(&g->scale, y, x0, width, row, order);
+
+    // Ticks are set up on the fly, only when they cross this row
+    int32_t r1 = g->radius - g->scale_width - 2;
+    int32_t r0 = r1 - g->tick_len;
+    int32_t Y = GFX_FIX(y);
+    for (uint8_t i = 0; i < g->ticks; i++) {
+        int32_t a = Tick_Angle(g, i);
+        int32_t ya = Polar_Y(g, a, r0), yb = Polar_Y(g, a, r1);
+        int32_t top = (ya < yb ? ya : yb) - GFX_FIX(2);
+        int32_t bottom = (ya > yb ? ya : yb) + GFX_FIX(2);
+        if (Y < top || Y > bottom) continue;
+
+        GFX_AAShape tick;
+        GFX_AA_Line(&tick, Polar_X(g, a, r0), ya, Polar_X(g, a, r1), yb, GFX_FIX(2), g->tick_color);
+        GFX_AA_RenderRow(&tick, y, x0, width, row, order);
+    }
+
+    GFX_AA_RenderRow(&g->needle, y, x0, width, row, order);
+    GFX_AA_RenderRow(&g->hub, y, x0, width, row, order);
+}
+
+/**
+ * @brief Move the needle and report the spans that need repainting
+ *
+ * @param emit Called once per span, top to bottom; may be NULL
+ * @return Number of pixels in the spans
+ */
+uint32_t GFX_Gauge_SetValue(GFX_Gauge *g, int16_t value, GFX_GaugeSpanFunc emit, void *ctx)
+{
+    GFX_AAShape old = g->needle;
+    uint32_t pixels = 0;
+
+    if (value < g->min) value = g->min;
+    if (value > g->max) value = g->max;
+    if (Value_Angle(g, value) == Value_Angle(g, g->value)) {
+        g->value = value;
+        return 0;
+    }
+    g->value = value;
+    Gauge_Needle(g);
+
+    int16_t top = old.top < g->needle.top ? old.top : g->needle.top;
+    int16_t bottom = old.bottom > g->needle.bottom ? old.bottom : g->needle.bottom;
+    if (top < 0) top = 0;
+
+    for (int16_t y = top; y <= bottom; y++) {
+        int16_t o0, o1, n0, n1;
+        uint8_t has_old = GFX_AA_RowSpan(&old, y, &o0, &o1);
+        uint8_t has_new = GFX_AA_RowSpan(&g->needle, y, &n0, &n1);
+        int16_t s[4];
+        uint8_t count = 0;
+
+        if (has_old && has_new) {
+            if (o0 > n0) {
+                int16_t t0 = o0, t1 = o1;
+                o0 = n0; o1 = n1;
+                n0 = t0; n1 = t1;
+            }
+            if (n0 - o1 <= GFX_GAUGE_SPAN_GAP) {
+                s[0] = o0;
+                s[1] = (o1 > n1) ? o1 : n1;
+                count = 1;
+            } else {
+                s[0] = o0; s[1] = o1;
+                s[2] = n0; s[3] = n1;
+                count = 2;
+            }
+        } else if (has_old) {
+            s[0] = o0; s[1] = o1;
+            count = 1;
+        } else if (has_new) {
+            s[0] = n0; s[1] = n1;
+            count = 1;
+        }
+
+        for (uint8_t i = 0; i < count; i++) {
+            int16_t x0 = s[2 * i] < 0 ? 0 : s[2 * i];
+            int16_t x1 = s[2 * i + 1] + 1;
+            if (x1 <= x0) continue;
+            pixels += x1 - x0;
+            if (emit) emit(y, x0, x1, ctx);
+        }
+    }
+    return pixels;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file gfx_gauge.h
+ * @brief Analog gauge widget with incremental needle updates
+ *
+ * The gauge has no pixel storage: GFX_Gauge_RenderRow() rasterises any
+ * part of any row procedurally (face, scale ring, ticks, needle, hub),
+ * all in fixed point with the quarter-wave table from gfx_trig.c.
+ *
+ * On a value change GFX_Gauge_SetValue() reports, row by row, only the
+ * columns the old or the new needle can touch. The caller repaints those
+ * spans with GFX_Gauge_RenderRow():
+ * - CH32v003: GC9A01_DrawRows() with a one-row window per span
+ * - Pi: straight into the Paint canvas (see GUI_Gauge.c)
+ */
+
+#ifndef _GFX_GAUGE_H_
+#define _GFX_GAUGE_H_
+
+#include <stdint.h>
+#include "gfx_aa.h"
+
+/// Spans on the same row closer than this are sent as one (a window costs ~11 bytes)
+#define GFX_GAUGE_SPAN_GAP  6
+
+/**
+ * @brief Span to repaint
+ *
+ * @param y      Row
+ * @param x0, x1 Columns, x1 exclusive (x0 >= 0, x1 not clipped to the screen)
+ */
+typedef void (*GFX_GaugeSpanFunc)(int16_t y, int16_t x0, int16_t x1, void *ctx);
+
+typedef struct {
+    int16_t cx, cy;             ///< Centre (pixels)
+    uint8_t radius;             ///< Outer edge of the scale ring
+    uint8_t scale_width;        ///< Scale ring thickness
+    uint8_t ticks;              ///< Major ticks over the sweep (0 = none)
+    uint8_t tick_len;
+    uint8_t needle_len;
+    uint8_t needle_width;       ///< 1 = hairline
+    uint8_t hub_r;
+    int16_t start;              ///< Angle of min (GFX_ANGLE_360 per turn)
+    int16_t sweep;              ///< Clockwise angle from min to max
+    int16_t min, max;
+    int16_t value;
+    uint16_t face_color;
+    uint16_t scale_color;
+    uint16_t tick_color;
+    uint16_t needle_color;
+    uint16_t hub_color;
+    GFX_AAShape scale;          ///< Prepared by GFX_Gauge_Layout()
+    GFX_AAShape needle;
+    GFX_AAShape hub;
+} GFX_Gauge;
+
+void GFX_Gauge_Init(GFX_Gauge *g, int16_t cx, int16_t cy, uint8_t radius);
+void GFX_Gauge_Layout(GFX_Gauge *g);
+void GFX_Gauge_RenderRow(const GFX_Gauge *g, int16_t y, int16_t x0, uint16_t width,
+                         uint16_t *row, GFX_PixelOrder order);
+uint32_t GFX_Gauge_SetValue(GFX_Gauge *g, int16_t value, GFX_GaugeSpanFunc emit, void *ctx);
+
+#endif // _GFX_GAUGE_H_
@@ -0,0 +1,257 @@
+/**
+ * @file gfx_qoi.c
+ * @brief Q565: QOI-style lossless RGB565 image codec with a streaming decoder
+ */
+
+#include <stddef.h>
+#include "gfx_qoi.h"
+
+#define OP_INDEX    0x00
+#define OP_DIFF     0x40
+#define OP_LUMA     0x80
+#define OP_RUN      0xC0
+#define OP_RGB      0xFE
+#define OP_LONG     0xFF
+
+#define RUN_MAX     62
+#define RUN_LONG_MAX    (RUN_MAX + 1 + 0xFFFF)
+
+static inline uint8_t Hash(uint16_t px)
+{
+    return (uint8_t)(((px >> 11) * 3 + ((px >> 5) & 63) * 5 + (px & 31) * 7) & 63);
+}
+
+/// Signed difference of two n-bit channel values, wrapped to -2^(n-1)..2^(n-1)-1
+static inline int8_t Wrap5(int16_t d) { return (int8_t)(((d + 16) & 31) - 16); }
+static inline int8_t Wrap6(int16_t d) { return (int8_t)(((d + 32) & 63) - 32); }
+
+/// floor(dg / 2) without relying on the sign behaviour of >>
+static inline int8_t Half(int8_t dg) { return (int8_t)(((dg + 32) >> 1) - 16); }
+
+// ============================================================================
+// ENCODER
+// ============================================================================
+
+static uint8_t *Put_Run(uint8_t *p, uint32_t run)
+{
+    if (run > RUN_MAX) {
+        run -= RUN_MAX + 1;
+        *p++ = OP_LONG;
+        *p++ = (uint8_t)run;
+        *p++ = (uint8_t)(run >> 8);
+    } else if (run) {
+        *p++ = (uint8_t)(OP_RUN | (run - 1));
+    }
+    return p;
+}
+
+/**
+ * @brief Encode an image
+ *
+ * @param pixels   width * height RGB565 pixels, CPU byte order, rows packed
+ * @param out      Destination; GFX_QOI_MAX_SIZE(width, height) always fits
+ * @param capacity Size of out
+ * @return Encoded size, 0 if it did not fit
+ */
+uint32_t GFX_Qoi_Encode(const uint16_t *pixels, uint16_t width, uint16_t height,
+                        uint8_t *out, uint32_t capacity)
+{
+    uint16_t index[64] = { 0 };
+    uint16_t prev = 0;
+    uint32_t run = 0, count = (uint32_t)width * height;
+    uint8_t *p = out, *end = out + capacity;
+    uint8_t tight = capacity < GFX_QOI_MAX_SIZE(width, height);
+
+    if (capacity < GFX_QOI_HEADER) return 0;
+    *p++ = 'q';
+    *p++ = '5';
+    *p++ = '6';
+    *p++ = '5';
+    *p++ = (uint8_t)width;
+    *p++ = (uint8_t)(width >> 8);
+    *p++ = (uint8_t)height;
+    *p++ = (uint8_t)(height >> 8);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t px = pixels[i];
+
+        // A pending run and the op take at most 3 bytes each; no pixel
+        // takes more than 3 bytes overall, so the worst-case size needs no checks
+        if (tight && end - p < 6) return 0;
+        if (px == prev) {
+            if (++run == RUN_LONG_MAX) {
+                p = Put_Run(p, run);
+                run = 0;
+            }
+            continue;
+        }
+        p = Put_Run(p, run);
+        run = 0;
+
+        uint8_t h = Hash(px);
+        if (index[h] == px) {
+            *p++ = (uint8_t)(OP_INDEX | h);
+        } else {
+            int8_t dr = Wrap5((px >> 11) - (prev >> 11));
+            int8_t dg = Wrap6(((px >> 5) & 63) - ((prev >> 5) & 63));
+            int8_t db = Wrap5((px & 31) - (prev & 31));
+            int8_t dr_dg = Wrap5(dr - Half(dg)), db_dg = Wrap5(db - Half(dg));
+
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                *p++ = (uint8_t)(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2));
+            } else if (dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                *p++ = (uint8_t)(OP_LUMA | (dg + 32));
+                *p++ = (uint8_t)(((dr_dg + 8) << 4) | (db_dg + 8));
+            } else {
+                *p++ = OP_RGB;
+                *p++ = (uint8_t)(px >> 8);
+                *p++ = (uint8_t)px;
+            }
+            index[h] = px;
+        }
+        prev = px;
+    }
+    if (tight && end - p < 3) return 0;
+    p = Put_Run(p, run);
+    return (uint32_t)(p - out);
+}
+
+// ============================================================================
+// DECODER
+// ============================================================================
+
+/**
+ * @brief Check the header and get ready for the first row
+ *
+ * @param data Encoded image; must stay valid while decoding
+ * @return 1 if data starts with a Q565 header
+ */
+uint8_t GFX_Qoi_Open(GFX_Qoi *q, const uint8_t *data, uint32_t size)
+{
+    if (size < GFX_QOI_HEADER || data[0] != 'q' || data[1] != '5' || data[2] != '6' ||
+        data[3] != '5') {
+        return 0;
+    }
+    q->width = (uint16_t)(data[4] | (data[5] << 8));
+    q->height = (uint16_t)(data[6] | (data[7] << 8));
+    q->src = data + GFX_QOI_HEADER;
+    q->end = data + size;
+    q->y = 0;
+    q->px = 0;
+    q->run = 0;
+    q->error = 0;
+    for (uint8_t i = 0; i < 64; i++) q->index[i] = 0;
+    return 1;
+}
+
+/**
+ * @brief Next count pixels; row may be NULL to skip them
+ */
+static void Decode(GFX_Qoi *q, uint16_t *row, uint16_t count, GFX_PixelOrder order)
+{
+    const uint8_t *src = q->src, *end = q->end;
+    uint16_t px = q->px;
+    uint32_t run = q->run;
+    uint16_t out = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(px) : px;
+    uint16_t x = 0;
+
+    while (x < count) {
+        if (run) {
+            uint16_t n = (run < (uint32_t)(count - x)) ? (uint16_t)run : count - x;
+            run -= n;
+            if (row) {
+                for (uint16_t i = 0; i < n; i++) row[x + i] = out;
+            }
+            x += n;
+            continue;
+        }
+        if (src >= end) {
+            // Truncated: the rest of the image repeats the last pixel
+            q->error = 1;
+            run = 0xFFFFFFFFUL;
+            continue;
+        }
+
+        uint8_t b = *src++;
+        if (b < OP_DIFF) {
+            px = q->index[b];
+        } else if (b < OP_LUMA) {
+            uint16_t r = ((px >> 11) + ((b >> 4) & 3) - 2) & 31;
+            uint16_t g = (((px >> 5) & 63) + ((b >> 2) & 3) - 2) & 63;
+            uint16_t bl = ((px & 31) + (b & 3) - 2) & 31;
+            px = (uint16_t)((r << 11) | (g << 5) | bl);
+        } else if (b < OP_RUN) {
+            if (src >= end) {
+                src = end;
+                continue;
+            }
+            int8_t dg = (int8_t)((b & 63) - 32);
+            int8_t h = Half(dg);
+            uint8_t c = *src++;
+            uint16_t r = ((px >> 11) + h + (c >> 4) - 8) & 31;
+            uint16_t g = (((px >> 5) & 63) + dg) & 63;
+            uint16_t bl = ((px & 31) + h + (c & 15) - 8) & 31;
+            px = (uint16_t)((r << 11) | (g << 5) | bl);
+        } else if (b < OP_RGB) {
+            run = (b & 63) + 1;
+            continue;
+        } else {
+            if (end - src < 2) {
+                src = end;
+                continue;
+            }
+            if (b == OP_LONG) {
+                run = (uint32_t)(src[0] | (src[1] << 8)) + RUN_MAX + 1;
+                src += 2;
+                continue;
+            }
+            px = (uint16_t)((src[0] << 8) | src[1]);
+            src += 2;
+        }
+        q->index[Hash(px)] = px;
+        out = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(px) : px;
+        if (row) row[x] = out;
+        x++;
+    }
+    q->src = src;
+    q->px = px;
+    q->run = run;
+}
+
+/**
+ * @brief Decode the next row
+ *
+ * @param row   q->width pixels
+ * @param order Byte order of row
+ * @return 0 once all rows have been decoded (row is left untouched)
+ */
+uint8_t GFX_Qoi_DecodeRow(GFX_Qoi *q, uint16_t *row, GFX_PixelOrder order)
+{
+    if (q->y >= q->height) return 0;
+    Decode(q, row, q->width, order);
+    q->y++;
+    return 1;
+}
+
+/**
+ * @brief GC9A01_RowFunc-shaped decoder: the next row, CPU byte order
+ *
+ * y and x0 are ignored; rows must be asked for in order. A line wider than
+ * the image is padded with black, a narrower one gets the left part.
+ *
+ * @param ctx GFX_Qoi opened with GFX_Qoi_Open()
+ */
+void GFX_Qoi_Row(uint16_t y, uint16_t x0, uint16_t width, uint16_t *line, void *ctx)
+{
+    GFX_Qoi *q = (GFX_Qoi *)ctx;
+    uint16_t n = (width < q->width) ? width : q->width;
+
+    if (q->y < q->height) {
+        Decode(q, line, n, GFX_ORDER_NATIVE);
+        Decode(q, NULL, q->width - n, GFX_ORDER_NATIVE);
+        q->y++;
+    } else {
+        n = 0;
+    }
+    for (uint16_t i = n; i < width; i++) line[i] = 0;
+}
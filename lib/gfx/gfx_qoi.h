@@ -0,0 +1,61 @@
+/**
+ * @file gfx_qoi.h
+ * @brief Q565: QOI-style lossless RGB565 image codec with a streaming decoder
+ *
+ * The QOI scheme (one pass, a 64-entry table of recently seen colours,
+ * small deltas from the previous pixel, runs) applied to RGB565 itself,
+ * so nothing is converted on either side and a decoded pixel is exactly
+ * the encoded one. Ops, one tag byte each:
+ * - 00iiiiii           INDEX: colour table entry i
+ * - 01rrggbb           DIFF:  each channel -2..1 from the previous pixel
+ * - 10gggggg rrrrbbbb  LUMA:  green -32..31 (6-bit units), red and blue
+ *                      -8..7 from half the green change
+ * - 11nnnnnn           RUN:   previous pixel 1..62 times (n < 62)
+ * - 0xFE hi lo         RGB:   the pixel (MSB first)
+ * - 0xFF lo hi         LONG RUN: previous pixel 63..65598 times
+ * Channel deltas wrap (5/6 bits). Runs may cross rows. The table slot of
+ * a pixel is (3r + 5g + 7b) mod 64; it is written after every op but a
+ * run. The first "previous pixel" is black.
+ *
+ * File: "q565", width and height (16-bit little endian), then the ops.
+ *
+ * The decoder only keeps its state (~150 bytes) and reads the data in
+ * place, e.g. from flash: GFX_Qoi_DecodeRow() produces one row at a time
+ * into a band or line buffer, in scan order. GFX_Qoi_Row() has the shape
+ * of GC9A01_RowFunc, so GC9A01_DrawRows(x, y, x + w, y + h, GFX_Qoi_Row,
+ * &q) sends an image without a frame buffer. Multiplies and divides are
+ * by constants only.
+ */
+
+#ifndef _GFX_QOI_H_
+#define _GFX_QOI_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+
+#define GFX_QOI_HEADER  8       ///< Bytes before the first op
+
+/// Worst-case encoded size (every pixel an RGB op)
+#define GFX_QOI_MAX_SIZE(w, h)  (GFX_QOI_HEADER + 3UL * (uint32_t)(w) * (uint32_t)(h))
+
+typedef struct {
+    const uint8_t *src;         ///< Next op
+    const uint8_t *end;
+    uint16_t width, height;
+    uint16_t y;                 ///< Rows decoded
+    uint16_t px;                ///< Previous pixel
+    uint32_t run;               ///< Repeats of px still to output
+    uint8_t error;              ///< Data ended early; the rest decodes as px
+    uint16_t index[64];
+} GFX_Qoi;
+
+// Encoder
+uint32_t GFX_Qoi_Encode(const uint16_t *pixels, uint16_t width, uint16_t height,
+                        uint8_t *out, uint32_t capacity);
+
+// Decoder
+uint8_t GFX_Qoi_Open(GFX_Qoi *q, const uint8_t *data, uint32_t size);
+uint8_t GFX_Qoi_DecodeRow(GFX_Qoi *q, uint16_t *row, GFX_PixelOrder order);
+void GFX_Qoi_Row(uint16_t y, uint16_t x0, uint16_t width, uint16_t *line, void *ctx);
+
+#endif // _GFX_QOI_H_
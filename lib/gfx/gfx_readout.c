@@ -0,0 +1,194 @@
+/**
+ * @file gfx_readout.c
+ * @brief Numeric and clock readouts that repaint only changed characters
+ */
+
+#include "gfx_readout.h"
+
+// ============================================================================
+// FORMATTING
+// ============================================================================
+
+static const uint32_t Pow10[10] = {
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+    10000UL, 1000UL, 100UL, 10UL, 1UL,
+};
+
+/**
+ * @brief Fixed-point number as text: value / 10^decimals
+ *
+ * GFX_FormatFixed(buf, -1234, 2) gives "-12.34", (buf, 5, 3) "0.005".
+ *
+ * @param buf      At least 13 bytes
+ * @param decimals Digits after the point, 0..9
+ * @return Length without the terminator
+ */
+uint8_t GFX_FormatFixed(char *buf, int32_t value, uint8_t decimals)
+{
+    char *p = buf;
+    uint32_t u = (uint32_t)value;
+    uint8_t started = 0;
+
+    if (decimals > 9) decimals = 9;
+    if (value < 0) {
+        *p++ = '-';
+        u = 0UL - u;
+    }
+
+    for (uint8_t i = 0; i < 10; i++) {
+        uint8_t place = 9 - i;          // Power of ten of this digit
+        char d = '0';
+        while (u >= Pow10[i]) {
+            u -= Pow10[i];
+            d++;
+        }
+        if (!started && d == '0' && place > decimals) continue;
+        started = 1;
+        if (decimals && place + 1 == decimals) *p++ = '.';
+        *p++ = d;
+    }
+    *p = 0;
+    return (uint8_t)(p - buf);
+}
+
+static char *Two_Digits(char *p, uint8_t v)
+{
+    char tens = '0';
+    while (v >= 10) {
+        v -= 10;
+        tens++;
+    }
+    *p++ = tens;
+    *p++ = '0' + v;
+    return p;
+}
+
+/**
+ * @brief "HH:MM:SS"
+ *
+ * @param buf At least 9 bytes
+ * @return 8
+ */
+uint8_t GFX_FormatClock(char *buf, uint8_t h, uint8_t m, uint8_t s)
+{
+    char *p = Two_Digits(buf, h);
+    *p++ = ':';
+    p = Two_Digits(p, m);
+    *p++ = ':';
+    p = Two_Digits(p, s);
+    *p = 0;
+    return 8;
+}
+
+// ============================================================================
+// READOUT
+// ============================================================================
+
+/**
+ * @brief White on black, cells as wide as the widest digit, nothing shown yet
+ */
+void GFX_Readout_Init(GFX_Readout *r, const GFX_Font *font, int16_t x, int16_t y, uint8_t cells)
+{
+    r->font = font;
+    r->x = x;
+    r->y = y;
+    r->cells = cells < GFX_READOUT_CELLS ? cells : GFX_READOUT_CELLS;
+    r->pitch = 0;
+    for (char c = '0'; c <= '9'; c++) {
+        const GFX_Glyph *g = GFX_Font_Glyph(font, (uint8_t)c);
+        if (g && g->advance > r->pitch) r->pitch = g->advance;
+    }
+    r->color = 0xFFFF;
+    r->bg = 0x0000;
+    GFX_Readout_Invalidate(r);
+}
+
+/**
+ * @brief Forget what the panel shows; the next Set repaints every cell
+ */
+void GFX_Readout_Invalidate(GFX_Readout *r)
+{
+    for (uint8_t i = 0; i < GFX_READOUT_CELLS; i++) r->shown[i] = 0;
+}
+
+/**
+ * @brief Show text, right-aligned; report the cells that change
+ *
+ * Text longer than the readout shows as all '-'.
+ *
+ * @param emit Called once per changed cell, after shown[] is updated
+ * @return Number of changed cells
+ */
+uint8_t GFX_Readout_Set(GFX_Readout *r, const char *text, GFX_ReadoutCellFunc emit, void *ctx)
+{
+    uint8_t len = 0;
+    uint8_t changed = 0;
+    int16_t cx = r->x;
+
+    while (text[len] && len <= r->cells) len++;
+    uint8_t pad = len <= r->cells ? r->cells - len : 0;
+
+    for (uint8_t i = 0; i < r->cells; i++, cx += r->pitch) {
+        char c = len > r->cells ? '-' : (i < pad ? ' ' : text[i - pad]);
+        if (c == r->shown[i]) continue;
+        r->shown[i] = c;
+        changed++;
+        if (emit) emit(cx, r->y, cx + r->pitch, r->y + r->font->line_height, ctx);
+    }
+    return changed;
+}
+
+/**
+ * @brief Show value / 10^decimals, see GFX_FormatFixed()
+ */
+uint8_t GFX_Readout_SetFixed(GFX_Readout *r, int32_t value, uint8_t decimals,
+                             GFX_ReadoutCellFunc emit, void *ctx)
+{
+    char buf[13];
+    GFX_FormatFixed(buf, value, decimals);
+    return GFX_Readout_Set(r, buf, emit, ctx);
+}
+
+/**
+ * @brief Show "HH:MM:SS"; once a second usually changes one or two cells
+ */
+uint8_t GFX_Readout_SetClock(GFX_Readout *r, uint8_t h, uint8_t m, uint8_t s,
+                             GFX_ReadoutCellFunc emit, void *ctx)
+{
+    char buf[9];
+    GFX_FormatClock(buf, h, m, s);
+    return GFX_Readout_Set(r, buf, emit, ctx);
+}
+
+/**
+ * @brief Render columns [x0, x0 + width) of row y
+ *
+ * Cells get the background and their glyph, centred and clipped to the
+ * cell. Columns outside the cells and rows outside the line are left
+ * untouched.
+ */
+void GFX_Readout_RenderRow(const GFX_Readout *r, int16_t y, int16_t x0, uint16_t width,
+                           uint16_t *row, GFX_PixelOrder order)
+{
+    int16_t x1 = x0 + width;
+    int16_t cx = r->x;
+    uint16_t bg = order == GFX_ORDER_SWAPPED ? GFX_Swap565(r->bg) : r->bg;
+    char str[2] = {0, 0};
+
+    if (y < r->y || y >= r->y + r->font->line_height) return;
+
+    for (uint8_t i = 0; i < r->cells; i++, cx += r->pitch) {
+        int16_t a = cx > x0 ? cx : x0;
+        int16_t b = cx + r->pitch < x1 ? cx + r->pitch : x1;
+        if (a >= b) continue;
+
+        for (int16_t x = a; x < b; x++) row[x - x0] = bg;
+
+        const GFX_Glyph *g = r->shown[i] ? GFX_Font_Glyph(r->font, (uint8_t)r->shown[i]) : 0;
+        if (!g || !g->width) continue;
+
+        GFX_Text t = { r->font, str, (int16_t)(cx + ((r->pitch - g->advance) >> 1)), r->y, r->color };
+        str[0] = r->shown[i];
+        GFX_Text_RenderRow(&t, y, a, b - a, row + (a - x0), order);
+    }
+}
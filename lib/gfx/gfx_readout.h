@@ -0,0 +1,53 @@
+/**
+ * @file gfx_readout.h
+ * @brief Numeric and clock readouts that repaint only changed characters
+ *
+ * A readout is a row of fixed-pitch character cells drawn in a GFX_Font.
+ * It remembers what each cell shows; GFX_Readout_Set() reports only the
+ * cells whose character changed, and the caller repaints each one with
+ * GFX_Readout_RenderRow():
+ * - CH32v003: GC9A01_DrawRows() with one window per cell
+ * - Pi: straight into the Paint canvas (see GUI_Readout.c)
+ *
+ * Formatting uses neither floating point nor division: the CH32v003's
+ * RV32EC core has no FPU and no divide instruction, so digits are taken
+ * off by subtracting powers of ten (at most 9 subtractions per digit).
+ */
+
+#ifndef _GFX_READOUT_H_
+#define _GFX_READOUT_H_
+
+#include <stdint.h>
+#include "gfx_font.h"
+
+/// Most cells per readout ("-2147483.648" fits)
+#define GFX_READOUT_CELLS  12
+
+/**
+ * @brief Changed cell to repaint, x1/y1 exclusive
+ */
+typedef void (*GFX_ReadoutCellFunc)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx);
+
+typedef struct {
+    const GFX_Font *font;
+    int16_t x, y;               ///< Top left of the first cell
+    uint8_t cells;              ///< Cells in use, text is right-aligned
+    uint8_t pitch;              ///< Cell width (GFX_Readout_Init: widest digit)
+    uint16_t color, bg;
+    char shown[GFX_READOUT_CELLS];  ///< Characters on the panel, 0 = unknown
+} GFX_Readout;
+
+void GFX_Readout_Init(GFX_Readout *r, const GFX_Font *font, int16_t x, int16_t y, uint8_t cells);
+void GFX_Readout_Invalidate(GFX_Readout *r);
+uint8_t GFX_Readout_Set(GFX_Readout *r, const char *text, GFX_ReadoutCellFunc emit, void *ctx);
+uint8_t GFX_Readout_SetFixed(GFX_Readout *r, int32_t value, uint8_t decimals,
+                             GFX_ReadoutCellFunc emit, void *ctx);
+uint8_t GFX_Readout_SetClock(GFX_Readout *r, uint8_t h, uint8_t m, uint8_t s,
+                             GFX_ReadoutCellFunc emit, void *ctx);
+void GFX_Readout_RenderRow(const GFX_Readout *r, int16_t y, int16_t x0, uint16_t width,
+                           uint16_t *row, GFX_PixelOrder order);
+
+uint8_t GFX_FormatFixed(char *buf, int32_t value, uint8_t decimals);
+uint8_t GFX_FormatClock(char *buf, uint8_t h, uint8_t m, uint8_t s);
+
+#endif // _GFX_READOUT_H_
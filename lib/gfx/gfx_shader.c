@@ -0,0 +1,573 @@
+/**
+ * @file gfx_shader.c
+ * @brief Procedural fills: gradients, sweeps, patterns and tick rings
+ */
+
+#include "gfx_shader.h"
+#include "gfx_trig.h"
+
+#define RAMP_ONE  65536         ///< Linear ramp position 1.0 (16.16)
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static inline int32_t Floor_Div(int32_t a, int32_t d)
+{
+    int32_t q = a / d;
+    return (a % d != 0 && a < 0) ? q - 1 : q;
+}
+
+/// Channel of an RGB565 colour as 16.16, plus one half for rounding
+static inline int32_t Channel(uint16_t c, uint8_t shift, uint8_t mask)
+{
+    return ((int32_t)((c >> shift) & mask) << 16) + 0x8000;
+}
+
+static inline int32_t Channel_Diff(uint16_t c0, uint16_t c1, uint8_t shift, uint8_t mask)
+{
+    return (int32_t)((c1 >> shift) & mask) - (int32_t)((c0 >> shift) & mask);
+}
+
+static inline uint16_t Pack(int32_t r, int32_t g, int32_t b)
+{
+    return (uint16_t)(((r >> 16) << 11) | ((g >> 16) << 5) | (b >> 16));
+}
+
+/**
+ * @brief c0 + (c1 - c0) * w / 4096 per channel
+ */
+static uint16_t Mix(uint16_t c0, uint16_t c1, int32_t w)
+{
+    int32_t r = (c0 >> 11) + ((Channel_Diff(c0, c1, 11, 31) * w + 2048) >> 12);
+    int32_t g = ((c0 >> 5) & 63) + ((Channel_Diff(c0, c1, 5, 63) * w + 2048) >> 12);
+    int32_t b = (c0 & 31) + ((Channel_Diff(c0, c1, 0, 31) * w + 2048) >> 12);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void Shader_Clear(GFX_Shader *s, uint8_t kind, uint16_t c0, uint16_t c1)
+{
+    uint8_t *p = (uint8_t *)s;
+    for (uint16_t i = 0; i < sizeof(*s); i++) p[i] = 0;
+    s->kind = kind;
+    s->c0 = c0;
+    s->c1 = c1;
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+
+/**
+ * @brief One colour everywhere (reference for the others)
+ */
+void GFX_Shader_Solid(GFX_Shader *s, uint16_t color)
+{
+    Shader_Clear(s, GFX_SHADER_SOLID, color, color);
+}
+
+/**
+ * @brief c0 at (x0, y0) to c1 at (x1, y1), constant across
+ *
+ * Beyond the ends the end colours continue. The points should be at
+ * least 4 pixels apart.
+ */
+void GFX_Shader_Linear(GFX_Shader *s, int16_t x0, int16_t y0, uint16_t c0,
+                       int16_t x1, int16_t y1, uint16_t c1)
+{
+    int32_t dx = x1 - x0;
+    int32_t dy = y1 - y0;
+    int32_t len2 = dx * dx + dy * dy;
+
+    Shader_Clear(s, GFX_SHADER_LINEAR, c0, c1);
+    if (len2 < 16) len2 = 16;
+    s->cx = 2 * x0;
+    s->cy = 2 * y0;
+    s->ux = dx * RAMP_ONE / len2;
+    s->uy = dy * RAMP_ONE / len2;
+    s->dr = Channel_Diff(c0, c1, 11, 31) * s->ux;
+    s->dg = Channel_Diff(c0, c1, 5, 63) * s->ux;
+    s->db = Channel_Diff(c0, c1, 0, 31) * s->ux;
+}
+
+/**
+ * @brief c0 at the centre to c1 at radius and beyond
+ */
+void GFX_Shader_Radial(GFX_Shader *s, int16_t cx, int16_t cy, uint16_t radius,
+                       uint16_t c0, uint16_t c1)
+{
+    Shader_Clear(s, GFX_SHADER_RADIAL, c0, c1);
+    if (!radius) radius = 1;
+    s->cx = 2 * cx;
+    s->cy = 2 * cy;
+    s->hi = 4 * (int32_t)radius;
+    s->dr = Channel_Diff(c0, c1, 11, 31) * RAMP_ONE / s->hi;
+    s->dg = Channel_Diff(c0, c1, 5, 63) * RAMP_ONE / s->hi;
+    s->db = Channel_Diff(c0, c1, 0, 31) * RAMP_ONE / s->hi;
+}
+
+/**
+ * @brief Clockwise sweep from c0 at angle to c1 just before it
+ *
+ * @param angle Binary angle (GFX_ANGLE_360 per turn), 0 = 12 o'clock
+ */
+void GFX_Shader_Conic(GFX_Shader *s, int16_t cx, int16_t cy, int32_t angle,
+                      uint16_t c0, uint16_t c1)
+{
+    Shader_Clear(s, GFX_SHADER_CONIC, c0, c1);
+    s->cx = 2 * cx;
+    s->cy = 2 * cy;
+    s->angle = (angle & (GFX_ANGLE_360 - 1)) << 8;
+    s->sectors = GFX_SHADER_SECTORS;
+}
+
+/**
+ * @brief Square cells, c0 in the cell whose top left corner is (x, y)
+ */
+void GFX_Shader_Checker(GFX_Shader *s, int16_t x, int16_t y, uint8_t cell,
+                        uint16_t c0, uint16_t c1)
+{
+    Shader_Clear(s, GFX_SHADER_CHECKER, c0, c1);
+    s->cx = 2 * x;
+    s->cy = 2 * y;
+    s->hi = cell ? cell : 1;
+}
+
+/**
+ * @brief Stripes of c1, width pixels wide every period pixels, on c0
+ *
+ * @param x, y  A point on the leading edge of a stripe
+ * @param angle Direction across the stripes: 0 gives horizontal ones
+ */
+void GFX_Shader_Stripes(GFX_Shader *s, int16_t x, int16_t y, int32_t angle,
+                        uint8_t period, uint8_t width, uint16_t c0, uint16_t c1)
+{
+    Shader_Clear(s, GFX_SHADER_STRIPES, c0, c1);
+    if (!period) period = 1;
+    s->cx = 2 * x;
+    s->cy = 2 * y;
+    s->ux = GFX_Sin(angle);
+    s->uy = -GFX_Cos(angle);
+    s->lo = (int32_t)width << 14;
+    s->hi = (int32_t)period << 14;
+}
+
+/**
+ * @brief Ring of count evenly spaced ticks in c1 on c0
+ *
+ * Only the ring r_in < r <= r_out is covered, so ticks go over a face
+ * drawn with another shader.
+ *
+ * @param count Ticks per turn, at least 2
+ * @param width Tick width (binary angle)
+ * @param angle Centre of the first tick
+ */
+void GFX_Shader_Ticks(GFX_Shader *s, int16_t cx, int16_t cy, uint16_t r_in, uint16_t r_out,
+                      uint8_t count, int32_t width, int32_t angle, uint16_t c0, uint16_t c1)
+{
+    Shader_Clear(s, GFX_SHADER_TICKS, c0, c1);
+    if (count < 2) count = 2;
+    s->cx = 2 * cx;
+    s->cy = 2 * cy;
+    s->lo = 2 * (int32_t)r_in;
+    s->hi = 2 * (int32_t)r_out;
+    s->sectors = 2 * count;
+    s->pitch = (uint16_t)(((uint32_t)GFX_ANGLE_360 << 8) / count);
+    if (width < 1) width = 1;
+    if (width >= (int32_t)(s->pitch >> 8)) width = (s->pitch >> 8) - 1;
+    s->tick = (uint32_t)width << 8;
+    s->angle = ((angle << 8) - (width << 7)) & ((GFX_ANGLE_360 << 8) - 1);
+}
+
+/**
+ * @brief Only cover a circle, e.g. the visible area of a round panel
+ *
+ * @param cx, cy Centre in pixel edges (120, 120 for a 240x240 panel)
+ * @param r      Radius; 0 removes the mask
+ */
+void GFX_Shader_SetMask(GFX_Shader *s, int16_t cx, int16_t cy, int16_t r)
+{
+    s->mask_cx = 2 * cx;
+    s->mask_cy = 2 * cy;
+    s->mask_r = 2 * r;
+}
+
+// ============================================================================
+// SECTORS (conic, ticks)
+// ============================================================================
+
+/**
+ * @brief Angle (24.8) of sector edge j; sector j runs clockwise from it
+ */
+static int32_t Edge(const GFX_Shader *s, uint16_t j)
+{
+    if (s->kind == GFX_SHADER_CONIC) {
+        return s->angle + ((int32_t)j << 8) * (GFX_ANGLE_360 / GFX_SHADER_SECTORS);
+    }
+    return s->angle + (int32_t)((j >> 1) * s->pitch) + ((j & 1) ? (int32_t)s->tick : 0);
+}
+
+/**
+ * @brief Sector holding binary angle a
+ */
+static uint16_t Sector_At(const GFX_Shader *s, int32_t a)
+{
+    uint32_t rel = (uint32_t)((a << 8) - s->angle) & ((GFX_ANGLE_360 << 8) - 1);
+
+    if (s->kind == GFX_SHADER_CONIC) {
+        return (uint16_t)(rel / ((GFX_ANGLE_360 / GFX_SHADER_SECTORS) << 8));
+    }
+
+    uint16_t i = (uint16_t)(rel / s->pitch);
+    if (i >= (s->sectors >> 1)) i = (s->sectors >> 1) - 1;
+    return 2 * i + (rel - i * s->pitch >= s->tick);
+}
+
+/**
+ * @brief sin of a 24.8 binary angle, interpolated between table steps
+ */
+static int32_t Sin_Fine(int32_t a)
+{
+    int32_t s0 = GFX_Sin(a >> 8);
+    int32_t s1 = GFX_Sin((a >> 8) + 1);
+    return s0 + (((s1 - s0) * (a & 255)) >> 8);
+}
+
+static uint16_t Sector_Color(const GFX_Shader *s, uint16_t k)
+{
+    if (s->kind == GFX_SHADER_TICKS) return (k & 1) ? s->c0 : s->c1;
+    return Mix(s->c0, s->c1, (int32_t)k * 65);     // k / 63 in 1/4096
+}
+
+/**
+ * @brief Watch edge j: e >= 0 once the pixel is clockwise of it
+ *
+ * The edge points along (sin, -cos); e is its cross product with the
+ * pixel position, and moving right by one pixel adds de.
+ */
+static void Watch(const GFX_Shader *s, GFX_ShaderCursor *c, uint16_t j)
+{
+    int32_t a = Edge(s, j);
+    int32_t cs = Sin_Fine(a + (GFX_ANGLE_90 << 8));
+
+    c->e = Sin_Fine(a) * c->q + cs * c->p;
+    c->de = 2 * cs;
+}
+
+static inline uint16_t Sector_Inc(const GFX_Shader *s, uint16_t k)
+{
+    return k + 1 == s->sectors ? 0 : k + 1;
+}
+
+static void Sector_Start(const GFX_Shader *s, GFX_ShaderCursor *c)
+{
+    // Quadrant from the signs (p and q are odd, never 0), then step forward
+    int32_t a = c->p > 0 ? (c->q < 0 ? 0 : GFX_ANGLE_90)
+                         : (c->q > 0 ? GFX_ANGLE_180 : GFX_ANGLE_180 + GFX_ANGLE_90);
+
+    c->k = Sector_At(s, a);
+    Watch(s, c, Sector_Inc(s, c->k));
+    while (c->e >= 0) {
+        c->k = Sector_Inc(s, c->k);
+        Watch(s, c, Sector_Inc(s, c->k));
+    }
+    // Below the centre the angle falls going right: watch the near edge
+    if (c->q > 0) Watch(s, c, c->k);
+    c->color = Sector_Color(s, c->k);
+}
+
+static void Sector_Step(const GFX_Shader *s, GFX_ShaderCursor *c)
+{
+    c->p += 2;
+    c->e += c->de;
+    if (c->q < 0) {
+        if (c->e < 0) return;
+        do {
+            c->k = Sector_Inc(s, c->k);
+            Watch(s, c, Sector_Inc(s, c->k));
+        } while (c->e >= 0);
+    } else {
+        if (c->e >= 0) return;
+        do {
+            c->k = c->k ? c->k - 1 : s->sectors - 1;
+            Watch(s, c, c->k);
+        } while (c->e < 0);
+    }
+    c->color = Sector_Color(s, c->k);
+}
+
+// ============================================================================
+// PIXELS
+// ============================================================================
+
+/**
+ * @brief Set the cursor on pixel (x, y); GFX_Shader_Next() then walks right
+ */
+void GFX_Shader_Start(const GFX_Shader *s, GFX_ShaderCursor *c, int16_t x, int16_t y)
+{
+    c->p = 2 * x + 1 - s->cx;
+    c->q = 2 * y + 1 - s->cy;
+    c->color = s->c0;
+
+    switch (s->kind) {
+    case GFX_SHADER_LINEAR:
+        c->t = (c->p * s->ux + c->q * s->uy) >> 1;
+        c->r = Channel(s->c0, 11, 31) + Channel_Diff(s->c0, s->c1, 11, 31) * c->t;
+        c->g = Channel(s->c0, 5, 63) + Channel_Diff(s->c0, s->c1, 5, 63) * c->t;
+        c->b = Channel(s->c0, 0, 31) + Channel_Diff(s->c0, s->c1, 0, 31) * c->t;
+        break;
+
+    case GFX_SHADER_RADIAL: {
+        c->t = 4 * (c->p * c->p + c->q * c->q);
+        c->dt = 16 * c->p + 16;
+        c->d = (int32_t)GFX_Isqrt((uint32_t)c->t);
+        c->d2 = c->d * c->d;
+        int32_t n = c->d < s->hi ? c->d : s->hi;
+        c->r = Channel(s->c0, 11, 31) + n * s->dr;
+        c->g = Channel(s->c0, 5, 63) + n * s->dg;
+        c->b = Channel(s->c0, 0, 31) + n * s->db;
+        break;
+    }
+
+    case GFX_SHADER_CONIC:
+    case GFX_SHADER_TICKS:
+        Sector_Start(s, c);
+        break;
+
+    case GFX_SHADER_CHECKER: {
+        int32_t rx = (c->p - 1) >> 1;
+        int32_t ix = Floor_Div(rx, s->hi);
+        int32_t iy = Floor_Div((c->q - 1) >> 1, s->hi);
+        c->k = (uint16_t)(s->hi - (rx - ix * s->hi));
+        c->color = ((ix ^ iy) & 1) ? s->c1 : s->c0;
+        break;
+    }
+
+    case GFX_SHADER_STRIPES:
+        c->t = ((c->p * s->ux + c->q * s->uy) >> 1) % s->hi;
+        if (c->t < 0) c->t += s->hi;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Colour (native order) of the cursor pixel, then step right
+ */
+uint16_t GFX_Shader_Next(const GFX_Shader *s, GFX_ShaderCursor *c)
+{
+    uint16_t color = c->color;
+
+    switch (s->kind) {
+    case GFX_SHADER_LINEAR:
+        color = c->t < 0 ? s->c0 : c->t >= RAMP_ONE ? s->c1 : Pack(c->r, c->g, c->b);
+        c->t += s->ux;
+        c->r += s->dr;
+        c->g += s->dg;
+        c->b += s->db;
+        break;
+
+    case GFX_SHADER_RADIAL:
+        color = c->d >= s->hi ? s->c1 : Pack(c->r, c->g, c->b);
+        c->t += c->dt;
+        c->dt += 32;
+        // Keep d = floor(sqrt(t)); the channels follow d up to the end radius
+        while (c->d2 + 2 * c->d + 1 <= c->t) {
+            c->d2 += 2 * c->d + 1;
+            if (c->d < s->hi) {
+                c->r += s->dr;
+                c->g += s->dg;
+                c->b += s->db;
+            }
+            c->d++;
+        }
+        while (c->d2 > c->t) {
+            c->d--;
+            c->d2 -= 2 * c->d + 1;
+            if (c->d < s->hi) {
+                c->r -= s->dr;
+                c->g -= s->dg;
+                c->b -= s->db;
+            }
+        }
+        break;
+
+    case GFX_SHADER_CONIC:
+    case GFX_SHADER_TICKS:
+        Sector_Step(s, c);
+        break;
+
+    case GFX_SHADER_CHECKER:
+        if (--c->k == 0) {
+            c->k = (uint16_t)s->hi;
+            c->color ^= s->c0 ^ s->c1;
+        }
+        break;
+
+    case GFX_SHADER_STRIPES:
+        color = c->t < s->lo ? s->c1 : s->c0;
+        c->t += s->ux;
+        if (c->t >= s->hi) c->t -= s->hi;
+        else if (c->t < 0) c->t += s->hi;
+        break;
+
+    default:
+        break;
+    }
+    return color;
+}
+
+// ============================================================================
+// COVERAGE
+// ============================================================================
+
+/**
+ * @brief Columns [a, b) of row y inside a circle (doubled units)
+ */
+static uint8_t Circle_Span(int32_t cx, int32_t cy, int32_t r, int16_t y, int32_t *a, int32_t *b)
+{
+    int32_t dy = 2 * y + 1 - cy;
+
+    if (dy * dy > r * r) return 0;
+    int32_t w = (int32_t)GFX_Isqrt((uint32_t)(r * r - dy * dy));
+    // |2x + 1 - cx| <= w
+    *a = (cx - w) >> 1;
+    *b = ((cx - 1 + w) >> 1) + 1;
+    return 1;
+}
+
+/**
+ * @brief Covered columns of row y within [x0, x1)
+ *
+ * @param span Filled with up to two [a, b) pairs
+ * @return Number of spans
+ */
+uint8_t GFX_Shader_Spans(const GFX_Shader *s, int16_t y, int16_t x0, int16_t x1, int16_t span[4])
+{
+    int32_t a = x0, b = x1, ca, cb;
+
+    if (s->mask_r) {
+        if (!Circle_Span(s->mask_cx, s->mask_cy, s->mask_r, y, &ca, &cb)) return 0;
+        if (ca > a) a = ca;
+        if (cb < b) b = cb;
+    }
+    if (s->kind == GFX_SHADER_TICKS) {
+        if (!Circle_Span(s->cx, s->cy, s->hi, y, &ca, &cb)) return 0;
+        if (ca > a) a = ca;
+        if (cb < b) b = cb;
+        if (a >= b) return 0;
+        // Inner circle (edge excluded) cuts a hole in the row
+        if (Circle_Span(s->cx, s->cy, s->lo, y, &ca, &cb)) {
+            uint8_t n = 0;
+            int32_t l = ca < b ? ca : b;
+            int32_t r = cb > a ? cb : a;
+            if (a < l) {
+                span[n++] = (int16_t)a;
+                span[n++] = (int16_t)l;
+            }
+            if (r < b) {
+                span[n++] = (int16_t)r;
+                span[n++] = (int16_t)b;
+            }
+            return n >> 1;
+        }
+    }
+    if (a >= b) return 0;
+    span[0] = (int16_t)a;
+    span[1] = (int16_t)b;
+    return 1;
+}
+
+// ============================================================================
+// OUTPUT
+// ============================================================================
+
+typedef struct {
+    GFX_ShaderRunFunc run;
+    void *ctx;
+    uint16_t color;
+    uint16_t count;
+} Run_State;
+
+static void Run_Span(const GFX_Shader *s, Run_State *rs, int16_t y, int16_t a, int16_t b)
+{
+    GFX_ShaderCursor c;
+
+    GFX_Shader_Start(s, &c, a, y);
+    for (int16_t x = a; x < b; x++) {
+        uint16_t px = GFX_Shader_Next(s, &c);
+        if (px == rs->color && rs->count < 0xFFFF) {
+            rs->count++;
+            continue;
+        }
+        if (rs->count) rs->run(rs->color, rs->count, rs->ctx);
+        rs->color = px;
+        rs->count = 1;
+    }
+}
+
+static void Run_Flush(Run_State *rs)
+{
+    if (rs->count) rs->run(rs->color, rs->count, rs->ctx);
+    rs->count = 0;
+}
+
+/**
+ * @brief Stream the covered part of [x0, x1) x [y0, y1) as windows and runs
+ *
+ * Without a mask (and for all but ticks) that is one window for the
+ * whole rectangle, otherwise one window per covered span, so pixels
+ * outside the circle never go on the bus. Runs never cross a window.
+ */
+void GFX_Shader_Fill(const GFX_Shader *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     GFX_ShaderWindowFunc window, GFX_ShaderRunFunc run, void *ctx)
+{
+    Run_State rs = { run, ctx, 0, 0 };
+    int16_t span[4];
+
+    if (x0 >= x1 || y0 >= y1) return;
+
+    if (!s->mask_r && s->kind != GFX_SHADER_TICKS) {
+        window(x0, y0, x1, y1, ctx);
+        for (int16_t y = y0; y < y1; y++) Run_Span(s, &rs, y, x0, x1);
+        Run_Flush(&rs);
+        return;
+    }
+
+    for (int16_t y = y0; y < y1; y++) {
+        uint8_t n = GFX_Shader_Spans(s, y, x0, x1, span);
+        for (uint8_t i = 0; i < n; i++) {
+            window(span[2 * i], y, span[2 * i + 1], y + 1, ctx);
+            Run_Span(s, &rs, y, span[2 * i], span[2 * i + 1]);
+            Run_Flush(&rs);
+        }
+    }
+}
+
+/**
+ * @brief Render columns [x0, x0 + width) of row y
+ *
+ * Pixels outside the coverage are left untouched.
+ */
+void GFX_Shader_RenderRow(const GFX_Shader *s, int16_t y, int16_t x0, uint16_t width,
+                          uint16_t *row, GFX_PixelOrder order)
+{
+    GFX_ShaderCursor c;
+    int16_t span[4];
+    uint8_t n = GFX_Shader_Spans(s, y, x0, x0 + width, span);
+
+    for (uint8_t i = 0; i < n; i++) {
+        int16_t a = span[2 * i];
+        int16_t b = span[2 * i + 1];
+        uint16_t *px = row + (a - x0);
+
+        GFX_Shader_Start(s, &c, a, y);
+        if (order == GFX_ORDER_SWAPPED) {
+            for (int16_t x = a; x < b; x++) *px++ = GFX_Swap565(GFX_Shader_Next(s, &c));
+        } else {
+            for (int16_t x = a; x < b; x++) *px++ = GFX_Shader_Next(s, &c);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file gfx_shader.h
+ * @brief Procedural fills: gradients, sweeps, patterns and tick rings
+ *
+ * A shader computes every pixel from its position, so a full-screen
+ * background needs no bitmap and no frame buffer. Pixels are produced
+ * left to right by a cursor that only adds per pixel; multiplies and
+ * divides happen once per shader, row or colour boundary (the CH32v003's
+ * RV32EC core has neither instruction):
+ * - linear:  ramp position and the three channels, 16.16
+ * - radial:  squared distance stepped exactly, distance (1/4 px) kept
+ *            by square-root tracking with at most a few steps per pixel
+ * - conic:   64 sectors per turn; the cursor only watches the sign of
+ *            the cross product with the next sector edge
+ * - checker: cell countdown; stripes: phase step (Q14 pixels)
+ * - ticks:   sector edges as for conic, on an annulus
+ *
+ * Two ways out:
+ * - GFX_Shader_Fill() reports windows and runs of equal pixels, which
+ *   go straight into the SPI stream (GC9A01_StreamBegin/StreamRepeat),
+ *   no line buffer
+ * - GFX_Shader_RenderRow() writes into any row, like the other
+ *   renderers: a Paint canvas row or a GC9A01_RowFunc line buffer
+ *
+ * Coverage is the rectangle, cut to the optional circular mask (the
+ * visible area of a round panel) and, for ticks, to the ring. Rows
+ * outside get no window at all; RenderRow leaves them untouched.
+ */
+
+#ifndef _GFX_SHADER_H_
+#define _GFX_SHADER_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+
+#define GFX_SHADER_SECTORS  64      ///< Conic sweep steps per turn
+
+typedef enum {
+    GFX_SHADER_SOLID = 0,
+    GFX_SHADER_LINEAR,
+    GFX_SHADER_RADIAL,
+    GFX_SHADER_CONIC,
+    GFX_SHADER_CHECKER,
+    GFX_SHADER_STRIPES,
+    GFX_SHADER_TICKS,
+} GFX_ShaderKind;
+
+/**
+ * @brief Coverage window, x1/y1 exclusive; runs fill it in raster order
+ */
+typedef void (*GFX_ShaderWindowFunc)(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx);
+
+/**
+ * @brief count pixels of one colour (native order)
+ */
+typedef void (*GFX_ShaderRunFunc)(uint16_t color, uint16_t count, void *ctx);
+
+typedef struct {
+    uint8_t kind;               ///< GFX_ShaderKind
+    uint16_t sectors;           ///< conic, ticks: sector edges per turn
+    uint16_t c0, c1;            ///< Ramp ends or pattern colours, native order
+    int32_t cx, cy;             ///< Origin or centre, doubled (half-pixel units)
+    int32_t ux, uy;             ///< linear: ramp step per pixel (16.16); stripes: phase step (Q14)
+    int32_t dr, dg, db;         ///< Channel step per ux (linear), per 1/4 px (radial), 16.16
+    int32_t lo, hi;             ///< radial: -, end radius (1/4 px); stripes: width, period (Q14);
+                                ///< checker: -, cell; ticks: ring radii, doubled
+    int32_t angle;              ///< conic: sweep start; ticks: first edge (binary angle, 24.8)
+    uint32_t pitch;             ///< ticks: angle between ticks (24.8)
+    uint32_t tick;              ///< ticks: tick width (24.8)
+    int32_t mask_cx, mask_cy;   ///< Mask centre, doubled
+    int32_t mask_r;             ///< Mask radius, doubled; 0 = no mask
+} GFX_Shader;
+
+/**
+ * @brief Pixel generator for one span, see GFX_Shader_Start()
+ */
+typedef struct {
+    int32_t p, q;               ///< Pixel centre relative to the origin, doubled
+    int32_t t;                  ///< linear: ramp position; radial: 16 x distance^2; stripes: phase
+    int32_t dt;                 ///< radial: next change of t
+    int32_t r, g, b;            ///< Ramp channels, 16.16
+    int32_t d, d2;              ///< radial: distance (1/4 px) and its square
+    int32_t e, de;              ///< conic, ticks: cross product with the watched edge, its step
+    uint16_t k;                 ///< conic, ticks: sector; checker: pixels left in the cell
+    uint16_t color;
+} GFX_ShaderCursor;
+
+// Setup (points and radii in pixel edges: 120, 120 is the centre of a 240x240 panel)
+void GFX_Shader_Solid(GFX_Shader *s, uint16_t color);
+void GFX_Shader_Linear(GFX_Shader *s, int16_t x0, int16_t y0, uint16_t c0,
+                       int16_t x1, int16_t y1, uint16_t c1);
+void GFX_Shader_Radial(GFX_Shader *s, int16_t cx, int16_t cy, uint16_t radius,
+                       uint16_t c0, uint16_t c1);
+void GFX_Shader_Conic(GFX_Shader *s, int16_t cx, int16_t cy, int32_t angle,
+                      uint16_t c0, uint16_t c1);
+void GFX_Shader_Checker(GFX_Shader *s, int16_t x, int16_t y, uint8_t cell,
+                        uint16_t c0, uint16_t c1);
+void GFX_Shader_Stripes(GFX_Shader *s, int16_t x, int16_t y, int32_t angle,
+                        uint8_t period, uint8_t width, uint16_t c0, uint16_t c1);
+void GFX_Shader_Ticks(GFX_Shader *s, int16_t cx, int16_t cy, uint16_t r_in, uint16_t r_out,
+                      uint8_t count, int32_t width, int32_t angle, uint16_t c0, uint16_t c1);
+void GFX_Shader_SetMask(GFX_Shader *s, int16_t cx, int16_t cy, int16_t r);
+
+// Pixels
+void GFX_Shader_Start(const GFX_Shader *s, GFX_ShaderCursor *c, int16_t x, int16_t y);
+uint16_t GFX_Shader_Next(const GFX_Shader *s, GFX_ShaderCursor *c);
+uint8_t GFX_Shader_Spans(const GFX_Shader *s, int16_t y, int16_t x0, int16_t x1, int16_t span[4]);
+
+// Output
+void GFX_Shader_Fill(const GFX_Shader *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                     GFX_ShaderWindowFunc window, GFX_ShaderRunFunc run, void *ctx);
+void GFX_Shader_RenderRow(const GFX_Shader *s, int16_t y, int16_t x0, uint16_t width,
+                          uint16_t *row, GFX_PixelOrder order);
+
+#endif // _GFX_SHADER_H_
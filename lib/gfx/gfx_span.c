@@ -0,0 +1,237 @@
+/**
+ * @file gfx_span.c
+ * @brief Span compositing kernels (SSE2 / scalar)
+ *
+ * Every kernel works per channel:
+ *   straight:       d + ((s - d) * a) >> 5   (arithmetic shift)
+ *   premultiplied:  min(max, (s * o) >> 5 + (d * (32 - a)) >> 5)
+ * with a = 5-bit alpha after opacity and o = 5-bit opacity. The vector
+ * paths evaluate exactly the same expressions in 16-bit lanes, 8 pixels
+ * at a time; leftovers go through the scalar code.
+ */
+
+#include <string.h>
+#include "gfx_span.h"
+
+// ============================================================================
+// SCALAR
+// ============================================================================
+
+static inline int32_t Span_Alpha5(uint8_t alpha, uint32_t op1)
+{
+    return (int32_t)(((((uint32_t)alpha * op1) >> 8) + 4) >> 3);
+}
+
+static inline uint16_t Span_Load(const uint16_t *p, GFX_PixelOrder order)
+{
+    return (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(*p) : *p;
+}
+
+static inline void Span_Store(uint16_t *p, uint16_t v, GFX_PixelOrder order)
+{
+    *p = (order == GFX_ORDER_SWAPPED) ? GFX_Swap565(v) : v;
+}
+
+static inline uint16_t Span_Mix(uint16_t d, uint16_t s, int32_t a)
+{
+    int32_t dr = d >> 11, dg = (d >> 5) & 0x3F, db = d & 0x1F;
+    int32_t sr = s >> 11, sg = (s >> 5) & 0x3F, sb = s & 0x1F;
+
+    dr += ((sr - dr) * a) >> 5;
+    dg += ((sg - dg) * a) >> 5;
+    db += ((sb - db) * a) >> 5;
+    return (uint16_t)((dr << 11) | (dg << 5) | db);
+}
+
+static inline uint16_t Span_Premul(uint16_t d, uint16_t s, int32_t o, int32_t a)
+{
+    int32_t r = (((s >> 11) * o) >> 5) + (((d >> 11) * (32 - a)) >> 5);
+    int32_t g = ((((s >> 5) & 0x3F) * o) >> 5) + ((((d >> 5) & 0x3F) * (32 - a)) >> 5);
+    int32_t b = (((s & 0x1F) * o) >> 5) + (((d & 0x1F) * (32 - a)) >> 5);
+
+    if (r > 0x1F) r = 0x1F;
+    if (g > 0x3F) g = 0x3F;
+    if (b > 0x1F) b = 0x1F;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+void GFX_SpanBlendA8_Scalar(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                            uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint32_t op1 = (uint32_t)opacity + 1;
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t a = Span_Alpha5(alpha[i], op1);
+        if (a == 0) continue;
+        Span_Store(&dst[i], Span_Mix(Span_Load(&dst[i], order), src[i], a), order);
+    }
+}
+
+void GFX_SpanBlendColorA8_Scalar(uint16_t *dst, uint16_t color, const uint8_t *alpha,
+                                 uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint32_t op1 = (uint32_t)opacity + 1;
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t a = Span_Alpha5(alpha[i], op1);
+        if (a == 0) continue;
+        Span_Store(&dst[i], Span_Mix(Span_Load(&dst[i], order), color, a), order);
+    }
+}
+
+void GFX_SpanBlendPremul_Scalar(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                                uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint32_t op1 = (uint32_t)opacity + 1;
+    int32_t o = Span_Alpha5(255, op1);
+    for (uint16_t i = 0; i < n; i++) {
+        int32_t a = Span_Alpha5(alpha[i], op1);
+        if (a == 0 && src[i] == 0) continue;
+        Span_Store(&dst[i], Span_Premul(Span_Load(&dst[i], order), src[i], o, a), order);
+    }
+}
+
+void GFX_SpanExpandA4(uint8_t *a8, const uint8_t *a4, uint16_t first, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++) {
+        uint16_t p = first + i;
+        uint8_t v = (p & 1) ? (a4[p >> 1] & 0x0F) : (a4[p >> 1] >> 4);
+        a8[i] = v * 17;
+    }
+}
+
+// ============================================================================
+// VECTOR PRIMITIVES
+// ============================================================================
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SPAN_VECTOR 1
+
+typedef __m128i span_vec_t;
+
+static inline span_vec_t V_Splat(uint16_t v)
+{
+    return _mm_set1_epi16((short)v);
+}
+
+static inline span_vec_t V_Swap(span_vec_t v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static inline span_vec_t V_Load(const uint16_t *p, int swap)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    return swap ? V_Swap(v) : v;
+}
+
+static inline void V_Store(uint16_t *p, span_vec_t v, int swap)
+{
+    _mm_storeu_si128((__m128i *)p, swap ? V_Swap(v) : v);
+}
+
+static inline span_vec_t V_Alpha5(const uint8_t *alpha, span_vec_t op1)
+{
+    __m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)alpha), _mm_setzero_si128());
+    a = _mm_srli_epi16(_mm_mullo_epi16(a, op1), 8);
+    return _mm_srli_epi16(_mm_add_epi16(a, _mm_set1_epi16(4)), 3);
+}
+
+static inline __m128i V_MixChannel(__m128i d, __m128i s, __m128i a)
+{
+    return _mm_add_epi16(d, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(s, d), a), 5));
+}
+
+static inline span_vec_t V_Mix(span_vec_t d, span_vec_t s, span_vec_t a)
+{
+    __m128i m5 = _mm_set1_epi16(0x1F), m6 = _mm_set1_epi16(0x3F);
+    __m128i r = V_MixChannel(_mm_srli_epi16(d, 11), _mm_srli_epi16(s, 11), a);
+    __m128i g = V_MixChannel(_mm_and_si128(_mm_srli_epi16(d, 5), m6), _mm_and_si128(_mm_srli_epi16(s, 5), m6), a);
+    __m128i b = V_MixChannel(_mm_and_si128(d, m5), _mm_and_si128(s, m5), a);
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+static inline __m128i V_PremulChannel(__m128i d, __m128i s, __m128i o, __m128i inv, short max)
+{
+    __m128i v = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(s, o), 5),
+                              _mm_srli_epi16(_mm_mullo_epi16(d, inv), 5));
+    return _mm_min_epi16(v, _mm_set1_epi16(max));
+}
+
+static inline span_vec_t V_Premul(span_vec_t d, span_vec_t s, span_vec_t o, span_vec_t a)
+{
+    __m128i m5 = _mm_set1_epi16(0x1F), m6 = _mm_set1_epi16(0x3F);
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(32), a);
+    __m128i r = V_PremulChannel(_mm_srli_epi16(d, 11), _mm_srli_epi16(s, 11), o, inv, 0x1F);
+    __m128i g = V_PremulChannel(_mm_and_si128(_mm_srli_epi16(d, 5), m6), _mm_and_si128(_mm_srli_epi16(s, 5), m6), o, inv, 0x3F);
+    __m128i b = V_PremulChannel(_mm_and_si128(d, m5), _mm_and_si128(s, m5), o, inv, 0x1F);
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+#else
+#define SPAN_VECTOR 0
+#endif
+
+#if SPAN_VECTOR
+/**
+ * @brief True if the next 8 alpha values are all zero
+ */
+static inline int V_AlphaClear(const uint8_t *alpha)
+{
+    uint64_t v;
+    memcpy(&v, alpha, sizeof(v));
+    return v == 0;
+}
+#endif
+
+// ============================================================================
+// DISPATCH
+// ============================================================================
+
+void GFX_SpanBlendA8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                     uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint16_t i = 0;
+#if SPAN_VECTOR
+    span_vec_t op1 = V_Splat((uint16_t)(opacity + 1));
+    int swap = (order == GFX_ORDER_SWAPPED);
+    for (; i + 8 <= n; i += 8) {
+        if (V_AlphaClear(alpha + i)) continue;
+        span_vec_t a = V_Alpha5(alpha + i, op1);
+        V_Store(dst + i, V_Mix(V_Load(dst + i, swap), V_Load(src + i, 0), a), swap);
+    }
+#endif
+    GFX_SpanBlendA8_Scalar(dst + i, src + i, alpha + i, n - i, opacity, order);
+}
+
+void GFX_SpanBlendColorA8(uint16_t *dst, uint16_t color, const uint8_t *alpha,
+                          uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint16_t i = 0;
+#if SPAN_VECTOR
+    span_vec_t op1 = V_Splat((uint16_t)(opacity + 1));
+    span_vec_t s = V_Splat(color);
+    int swap = (order == GFX_ORDER_SWAPPED);
+    for (; i + 8 <= n; i += 8) {
+        if (V_AlphaClear(alpha + i)) continue;
+        span_vec_t a = V_Alpha5(alpha + i, op1);
+        V_Store(dst + i, V_Mix(V_Load(dst + i, swap), s, a), swap);
+    }
+#endif
+    GFX_SpanBlendColorA8_Scalar(dst + i, color, alpha + i, n - i, opacity, order);
+}
+
+void GFX_SpanBlendPremul(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                         uint16_t n, uint8_t opacity, GFX_PixelOrder order)
+{
+    uint16_t i = 0;
+#if SPAN_VECTOR
+    span_vec_t op1 = V_Splat((uint16_t)(opacity + 1));
+    span_vec_t o = V_Splat((uint16_t)Span_Alpha5(255, (uint32_t)opacity + 1));
+    int swap = (order == GFX_ORDER_SWAPPED);
+    for (; i + 8 <= n; i += 8) {
+        span_vec_t a = V_Alpha5(alpha + i, op1);
+        V_Store(dst + i, V_Premul(V_Load(dst + i, swap), V_Load(src + i, 0), o, a), swap);
+    }
+#endif
+    GFX_SpanBlendPremul_Scalar(dst + i, src + i, alpha + i, n - i, opacity, order);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file gfx_span.h
+ * @brief Span (row segment) compositing kernels
+ *
+ * Blend a run of RGB565 pixels with per-pixel alpha into a destination
+ * row. Used by the Pi layer compositor (GUI_Layer.c) and usable from a
+ * GC9A01_RowFunc on the CH32v003.
+ *
+ * Alpha formats:
+ * - A8: one byte per pixel, straight (non-premultiplied) colour
+ * - A4: two pixels per byte, high nibble first; expand with
+ *   GFX_SpanExpandA4() and use the A8 kernels
+ * - Premultiplied: colour already scaled by its alpha
+ *
+ * A global opacity (0..255) is folded into every kernel. Alpha is
+ * resolved to 5 bits like GFX_Blend565().
+ *
+ * The default kernels use SSE2 (x86) when the compiler targets it,
+ * 8 pixels per step, and fall back to scalar code (ARM, RISC-V). The
+ * *_Scalar variants are always scalar and produce identical results.
+ */
+
+#ifndef _GFX_SPAN_H_
+#define _GFX_SPAN_H_
+
+#include <stdint.h>
+#include "gfx_blend.h"
+
+#if defined(__SSE2__)
+#define GFX_SPAN_SIMD  "sse2"
+#else
+#define GFX_SPAN_SIMD  "none"
+#endif
+
+// src: straight RGB565, alpha: A8
+void GFX_SpanBlendA8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                     uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+// Solid colour through an A8 mask (icons, glyphs, shapes)
+void GFX_SpanBlendColorA8(uint16_t *dst, uint16_t color, const uint8_t *alpha,
+                          uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+// src: premultiplied RGB565, alpha: A8
+void GFX_SpanBlendPremul(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                         uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+
+void GFX_SpanBlendA8_Scalar(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                            uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+void GFX_SpanBlendColorA8_Scalar(uint16_t *dst, uint16_t color, const uint8_t *alpha,
+                                 uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+void GFX_SpanBlendPremul_Scalar(uint16_t *dst, const uint16_t *src, const uint8_t *alpha,
+                                uint16_t n, uint8_t opacity, GFX_PixelOrder order);
+
+// A4 pixels [first, first + n) of a row to A8
+void GFX_SpanExpandA4(uint8_t *a8, const uint8_t *a4, uint16_t first, uint16_t n);
+
+#endif // _GFX_SPAN_H_
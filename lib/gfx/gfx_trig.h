@@ -0,0 +1,29 @@
+/**
+ * @file gfx_trig.h
+ * @brief Fixed-point sine/cosine for FPU-less targets
+ *
+ * Angles are binary: GFX_ANGLE_360 units per turn, measured clockwise
+ * from 12 o'clock (screen y grows downwards), which is the natural frame
+ * for gauges. Results are Q14 (16384 = 1.0).
+ *
+ * Backed by a quarter-wave table in flash (257 entries, 514 bytes).
+ */
+
+#ifndef _GFX_TRIG_H_
+#define _GFX_TRIG_H_
+
+#include <stdint.h>
+
+#define GFX_ANGLE_360   1024            ///< One full turn
+#define GFX_ANGLE_180   (GFX_ANGLE_360 / 2)
+#define GFX_ANGLE_90    (GFX_ANGLE_360 / 4)
+#define GFX_TRIG_ONE    16384           ///< 1.0 in Q14
+
+/// Convert whole degrees to binary angle units
+#define GFX_DEG(d)  ((int32_t)(d) * GFX_ANGLE_360 / 360)
+
+int16_t GFX_Sin(int32_t angle);
+int16_t GFX_Cos(int32_t angle);
+uint32_t GFX_Isqrt(uint32_t value);
+
+#endif // _GFX_TRIG_H_
@@ -15,11 +15,47 @@
 
 #include "lcd_hal.h"
 #include "../include/lcd_config.h"
+#if LCD_TRACE_ENABLED
+#include "../trace/lcd_trace.h"
+#endif
+
+/// CS and RST pin per panel
+static const UWORD hal_cs_pins[] = LCD_PANEL_CS_PINS;
+static const UWORD hal_rst_pins[] = LCD_PANEL_RST_PINS;
+
+#if LCD_TRACE_ENABLED
+static LCD_Trace hal_trace;
+static uint8_t hal_trace_buf[LCD_TRACE_BUFFER];
+
+static void HAL_TraceWrite(const uint8_t *data, uint16_t len, void *ctx)
+{
+    while (len--) LCD_HAL_UART_Write(*data++);
+}
+
+/**
+ * @brief Record a write to a panel pin (a shared RST pin once per panel)
+ */
+static void HAL_TracePin(UWORD Pin, UBYTE Value)
+{
+    if (!hal_trace.buf) return;     // Not started yet
+    if (Pin == LCD_DC_PIN) LCD_Trace_Pin(&hal_trace, 0, LCD_TRACE_DC, Value);
+    if (Pin == LCD_BL_PIN) LCD_Trace_Pin(&hal_trace, 0, LCD_TRACE_BL, Value);
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if (Pin == hal_cs_pins[i]) LCD_Trace_Pin(&hal_trace, i, LCD_TRACE_CS, Value);
+        if (Pin == hal_rst_pins[i]) LCD_Trace_Pin(&hal_trace, i, LCD_TRACE_RST, Value);
+    }
+}
+#endif
+
+#if LCD_TE_ENABLED
+/// Number of TE edges seen since LCD_HAL_TE_Init() (written from EXTI ISR)
+static volatile UDOUBLE lcd_hal_te_count = 0;
+#endif
 
 /**
  * @brief Initialize GPIO pins for LCD
  * 
- * Configures RST, DC, CS, and BL pins as outputs.
+ * Configures RST, DC, CS, and BL pins as outputs (CS and RST of every panel).
  * SPI pins (SCK, MOSI) are configured in LCD_HAL_SPI_Init().
  */
 void LCD_HAL_GPIO_Init(void)
@@ -28,15 +64,19 @@ void LCD_HAL_GPIO_Init(void)
     funGpioInitAll();
     
     // Configure control pins as push-pull outputs, 10MHz speed
-    funPinMode(LCD_RST_PIN, GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
     funPinMode(LCD_DC_PIN,  GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
-    funPinMode(LCD_CS_PIN,  GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
     funPinMode(LCD_BL_PIN,  GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        funPinMode(hal_rst_pins[i], GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
+        funPinMode(hal_cs_pins[i],  GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
+    }
     
     // Set initial states
-    LCD_HAL_DigitalWrite(LCD_CS_PIN, 1);  // CS high (inactive)
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        LCD_HAL_DigitalWrite(hal_cs_pins[i], 1);  // CS high (inactive)
+        LCD_HAL_DigitalWrite(hal_rst_pins[i], 1); // Reset high (not resetting)
+    }
     LCD_HAL_DigitalWrite(LCD_DC_PIN, 0);  // DC low (command mode)
-    LCD_HAL_DigitalWrite(LCD_RST_PIN, 1); // Reset high (not resetting)
     LCD_HAL_DigitalWrite(LCD_BL_PIN, 1);  // Backlight on
 }
 
@@ -57,6 +97,9 @@ void LCD_HAL_DigitalWrite(UWORD Pin, UBYTE Value)
     // Normal (non-inverted) GPIO operation
     funDigitalWrite(Pin, Value ? FUN_HIGH : FUN_LOW);
 #endif
+#if LCD_TRACE_ENABLED
+    HAL_TracePin(Pin, Value);
+#endif
 }
 
 /**
@@ -171,6 +214,9 @@ void LCD_HAL_SPI_WriteByte(UBYTE Value)
     // This ensures byte is fully transmitted before continuing
     timeout = 100000;
     while((SPI1->STATR & (1 << 7)) && timeout--) {}  // Check BSY bit
+#if LCD_TRACE_ENABLED
+    if (hal_trace.buf) LCD_Trace_Byte(&hal_trace, Value);
+#endif
 }
 
 /**
@@ -188,6 +234,177 @@ void LCD_HAL_SPI_WriteBytes(uint8_t *pData, uint32_t Length)
     }
 }
 
+/**
+ * @brief Wait until the last SPI byte has left the shift register
+ * 
+ * Must be called before CS goes high at the end of a streamed transfer,
+ * otherwise the final byte can be cut off.
+ */
+void LCD_HAL_SPI_WaitIdle(void)
+{
+    uint32_t timeout = 100000;
+    while((SPI1->STATR & (1 << 7)) && timeout--) {}  // Wait for BSY to clear
+}
+
+// ============================================================================
+// TEARING EFFECT (TE) INPUT
+// ============================================================================
+
+#if LCD_TE_ENABLED
+/**
+ * @brief EXTI interrupt for lines 0-7 (TE pin lives on one of them)
+ * 
+ * The GC9A01 raises TE when its scan reaches the tear scanline (0x44),
+ * or at the start of vertical blanking by default. We only count edges;
+ * the driver compares counts to detect a new one.
+ */
+void EXTI7_0_IRQHandler(void) __attribute__((interrupt));
+void EXTI7_0_IRQHandler(void)
+{
+    uint32_t mask = 1 << (LCD_TE_PIN & 0xF);
+    if (EXTI->INTFR & mask) {
+        EXTI->INTFR = mask;  // Write 1 to clear pending flag
+        lcd_hal_te_count++;
+    }
+}
+#endif
+
+/**
+ * @brief Configure the TE pin as an EXTI rising-edge interrupt
+ * 
+ * The port of LCD_TE_PIN is routed to its EXTI line through AFIO->EXTICR
+ * (2 bits per line: 0=PA, 2=PC, 3=PD). Does nothing if LCD_TE_ENABLED is 0.
+ */
+void LCD_HAL_TE_Init(void)
+{
+#if LCD_TE_ENABLED
+    uint32_t line = LCD_TE_PIN & 0xF;
+    uint32_t port = LCD_TE_PIN >> 4;
+    
+    RCC->APB2PCENR |= RCC_APB2Periph_AFIO;
+    funPinMode(LCD_TE_PIN, GPIO_CNF_IN_FLOATING);
+    
+    AFIO->EXTICR = (AFIO->EXTICR & ~(3 << (2 * line))) | (port << (2 * line));
+    EXTI->RTENR |= (1 << line);   // Rising edge = TE pulse start
+    EXTI->FTENR &= ~(1 << line);
+    EXTI->INTFR = (1 << line);    // Drop anything pending from before
+    EXTI->INTENR |= (1 << line);
+    
+    NVIC_EnableIRQ(EXTI7_0_IRQn);
+#endif
+}
+
+/**
+ * @brief Number of TE edges received since LCD_HAL_TE_Init()
+ * 
+ * @return Edge count (wraps), always 0 if LCD_TE_ENABLED is 0
+ */
+UDOUBLE LCD_HAL_TE_Count(void)
+{
+#if LCD_TE_ENABLED
+    return lcd_hal_te_count;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Block until the next TE edge
+ * 
+ * @param timeout_ms Give up after this many milliseconds
+ * @return 1 if an edge arrived, 0 on timeout or if TE is not wired
+ */
+UBYTE LCD_HAL_TE_Wait(UDOUBLE timeout_ms)
+{
+#if LCD_TE_ENABLED
+    UDOUBLE start = lcd_hal_te_count;
+    UDOUBLE ticks = timeout_ms * 1000;
+    
+    while (lcd_hal_te_count == start) {
+        if (ticks-- == 0) return 0;
+        Delay_Us(1);
+    }
+    return 1;
+#else
+    (void)timeout_ms;
+    return 0;
+#endif
+}
+
+// ============================================================================
+// UART (USART1: TX = PD5, RX = PD6)
+// ============================================================================
+
+/// Received bytes, filled by the USART1 ISR
+static volatile UBYTE lcd_hal_uart_rx[LCD_UART_RX_BUFFER];
+static volatile UBYTE lcd_hal_uart_head = 0;  ///< Written by the ISR
+static UBYTE lcd_hal_uart_tail = 0;           ///< Read by LCD_HAL_UART_Read()
+
+/**
+ * @brief USART1 receive interrupt: move the byte into the ring buffer
+ * 
+ * A full buffer drops the byte; the frame link's credits keep the host
+ * from sending more than LCD_UART_RX_BUFFER bytes ahead.
+ */
+void USART1_IRQHandler(void) __attribute__((interrupt));
+void USART1_IRQHandler(void)
+{
+    if (USART1->STATR & USART_FLAG_RXNE) {
+        UBYTE value = USART1->DATAR;
+        UBYTE next = (lcd_hal_uart_head + 1) & (LCD_UART_RX_BUFFER - 1);
+        if (next != lcd_hal_uart_tail) {
+            lcd_hal_uart_rx[lcd_hal_uart_head] = value;
+            lcd_hal_uart_head = next;
+        }
+    }
+}
+
+/**
+ * @brief Initialize USART1 8N1 with interrupt-driven receive
+ * 
+ * @param baud Baud rate, e.g. LCD_UART_BAUD
+ */
+void LCD_HAL_UART_Init(UDOUBLE baud)
+{
+    RCC->APB2PCENR |= RCC_APB2Periph_USART1 | RCC_APB2Periph_GPIOD;
+    
+    funPinMode(PD5, GPIO_Speed_10MHz | GPIO_CNF_OUT_PP_AF);  // TX
+    funPinMode(PD6, GPIO_CNF_IN_FLOATING);                   // RX
+    
+    USART1->CTLR1 = USART_WordLength_8b | USART_Parity_No | USART_Mode_Tx | USART_Mode_Rx;
+    USART1->CTLR2 = USART_StopBits_1;
+    USART1->CTLR3 = 0;
+    USART1->BRR = (FUNCONF_SYSTEM_CORE_CLOCK + baud / 2) / baud;
+    
+    lcd_hal_uart_head = lcd_hal_uart_tail = 0;
+    USART1->CTLR1 |= USART_CTLR1_RXNEIE | USART_CTLR1_UE;
+    NVIC_EnableIRQ(USART1_IRQn);
+}
+
+/**
+ * @brief Take one received byte
+ * 
+ * @param value Receives the byte
+ * @return 1 if a byte was available, 0 if the buffer is empty
+ */
+UBYTE LCD_HAL_UART_Read(UBYTE *value)
+{
+    if (lcd_hal_uart_tail == lcd_hal_uart_head) return 0;
+    *value = lcd_hal_uart_rx[lcd_hal_uart_tail];
+    lcd_hal_uart_tail = (lcd_hal_uart_tail + 1) & (LCD_UART_RX_BUFFER - 1);
+    return 1;
+}
+
+/**
+ * @brief Send one byte (blocks until the transmit register is free)
+ */
+void LCD_HAL_UART_Write(UBYTE value)
+{
+    uint32_t timeout = 100000;
+    while (!(USART1->STATR & USART_FLAG_TXE) && timeout--) {}
+    USART1->DATAR = value;
+}
+
 /**
  * @brief Delay in milliseconds
  * 
@@ -195,6 +412,9 @@ void LCD_HAL_SPI_WriteBytes(uint8_t *pData, uint32_t Length)
  */
 void LCD_HAL_Delay_ms(UDOUBLE ms)
 {
+#if LCD_TRACE_ENABLED
+    if (hal_trace.buf) LCD_Trace_Delay(&hal_trace, ms * 1000);
+#endif
     Delay_Ms(ms);
 }
 
@@ -205,9 +425,25 @@ void LCD_HAL_Delay_ms(UDOUBLE ms)
  */
 void LCD_HAL_Delay_us(UDOUBLE us)
 {
+#if LCD_TRACE_ENABLED
+    if (hal_trace.buf) LCD_Trace_Delay(&hal_trace, us);
+#endif
     Delay_Us(us);
 }
 
+/**
+ * @brief Free-running SysTick count
+ * 
+ * ch32fun's SystemInit() starts SysTick for Delay_Us(); it counts up and
+ * wraps, so compare times by signed difference.
+ * 
+ * @return LCD_HAL_TICKS_PER_US ticks per microsecond
+ */
+UDOUBLE LCD_HAL_Ticks(void)
+{
+    return SysTick->CNT;
+}
+
 /**
  * @brief Initialize all hardware (GPIO + SPI)
  * 
@@ -216,7 +452,36 @@ void LCD_HAL_Delay_us(UDOUBLE us)
  */
 void LCD_HAL_Init(void)
 {
+#if LCD_TRACE_ENABLED
+    LCD_HAL_UART_Init(LCD_UART_BAUD);
+    LCD_Trace_Init(&hal_trace, hal_trace_buf, sizeof(hal_trace_buf), LCD_HAL_Ticks,
+                   HAL_TraceWrite, NULL, LCD_HAL_TICKS_PER_US * 1000000UL, LCD_SPI_SPEED_HZ);
+#endif
     LCD_HAL_GPIO_Init();
     LCD_HAL_SPI_Init();
+    LCD_HAL_TE_Init();
+}
+
+/**
+ * @brief Mark a point in the bus trace (e.g. the end of a frame)
+ * 
+ * sim/trace_replay saves the panel image at each mark.
+ */
+void LCD_HAL_TraceMark(UDOUBLE id)
+{
+#if LCD_TRACE_ENABLED
+    LCD_Trace_Mark(&hal_trace, id);
+#else
+    (void)id;
+#endif
 }
 
+/**
+ * @brief Send the buffered trace records now (e.g. before going idle)
+ */
+void LCD_HAL_TraceFlush(void)
+{
+#if LCD_TRACE_ENABLED
+    LCD_Trace_Flush(&hal_trace);
+#endif
+}
@@ -18,6 +18,7 @@
  * This function initializes:
  * - GPIO pins for RST, DC, CS, and BL
  * - SPI1 peripheral for communication
+ * - TE input interrupt (if LCD_TE_ENABLED)
  * 
  * Must be called before using any other HAL functions.
  */
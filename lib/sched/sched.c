@@ -0,0 +1,106 @@
+/**
+ * @file sched.c
+ * @brief Cooperative task scheduler on the SysTick time base
+ */
+
+#include "sched.h"
+#include "../lcd_hal/lcd_hal.h"
+
+static Sched_Task *sched_tasks;
+static UBYTE sched_count;
+static UBYTE sched_next_job;    // Round-robin position among jobs
+
+/// Tick comparison that survives the 32-bit counter wrapping
+#define SCHED_BEFORE(a, b)  ((int32_t)((a) - (b)) < 0)
+
+/**
+ * @brief Take over a task table; periodic tasks first run one period from now
+ */
+void Sched_Init(Sched_Task *tasks, UBYTE count)
+{
+    UDOUBLE now = LCD_HAL_Ticks();
+    
+    sched_tasks = tasks;
+    sched_count = count;
+    sched_next_job = 0;
+    for (UBYTE i = 0; i < count; i++) {
+        tasks[i].due = now + tasks[i].period;
+    }
+    Sched_ResetStats();
+}
+
+/**
+ * @brief Give a job work to do; it runs from the next Sched_RunOnce()
+ */
+void Sched_Wake(Sched_Task *task)
+{
+    task->active = 1;
+}
+
+void Sched_ResetStats(void)
+{
+    for (UBYTE i = 0; i < sched_count; i++) {
+        sched_tasks[i].max_late = 0;
+        sched_tasks[i].max_run = 0;
+    }
+}
+
+static void Sched_Call(Sched_Task *t, UDOUBLE start)
+{
+    UBYTE more = t->fn(t->ctx);
+    UDOUBLE run = LCD_HAL_Ticks() - start;
+    
+    if (run > t->max_run) t->max_run = run;
+    if (!t->period) t->active = more;
+}
+
+/**
+ * @brief Run at most one task step
+ * 
+ * A due periodic task wins, the most overdue first. Its next run is one
+ * period after the missed one; a task more than a period behind skips
+ * ahead instead of running back to back. With nothing due, the next
+ * active job gets one step.
+ * 
+ * @return 1 if something ran
+ */
+UBYTE Sched_RunOnce(void)
+{
+    UDOUBLE now = LCD_HAL_Ticks();
+    Sched_Task *pick = 0;
+    
+    for (UBYTE i = 0; i < sched_count; i++) {
+        Sched_Task *t = &sched_tasks[i];
+        if (!t->active || !t->period || SCHED_BEFORE(now, t->due)) continue;
+        if (!pick || SCHED_BEFORE(t->due, pick->due)) pick = t;
+    }
+    
+    if (pick) {
+        UDOUBLE late = now - pick->due;
+        if (late > pick->max_late) pick->max_late = late;
+        pick->due += pick->period;
+        if (SCHED_BEFORE(pick->due, now)) pick->due = now + pick->period;
+        Sched_Call(pick, now);
+        return 1;
+    }
+    
+    for (UBYTE n = 0; n < sched_count; n++) {
+        Sched_Task *t = &sched_tasks[sched_next_job];
+        if (++sched_next_job >= sched_count) sched_next_job = 0;
+        if (t->active && !t->period) {
+            Sched_Call(t, now);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Run tasks forever
+ */
+void Sched_Run(void)
+{
+    while (1) {
+        Sched_RunOnce();
+    }
+}
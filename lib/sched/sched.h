@@ -0,0 +1,63 @@
+/**
+ * @file sched.h
+ * @brief Cooperative task scheduler on the SysTick time base
+ * 
+ * The task table is a static array owned by the caller; nothing is
+ * allocated. Two kinds of task:
+ * - periodic: runs every period ticks (sensor sampling, button debounce)
+ * - job: runs whenever no periodic task is due, one bounded step per
+ *   call, until it returns 0 (display work, see gc9a01_job.h)
+ * 
+ * Nothing is pre-empted: a task's step is the latency every other task
+ * sees, so display work must be cut into steps shorter than the tightest
+ * period. Due periodic tasks go first, earliest deadline first; jobs
+ * take turns. Each task keeps its worst lateness and longest run.
+ * 
+ * Usage:
+ * @code
+ * static Sched_Task tasks[] = {
+ *     SCHED_PERIODIC(sample_sensor, NULL, SCHED_MS(1)),
+ *     SCHED_PERIODIC(debounce, NULL, SCHED_MS(5)),
+ *     SCHED_JOB(display_step, NULL),
+ * };
+ * Sched_Init(tasks, 3);
+ * Sched_Run();
+ * @endcode
+ */
+
+#ifndef _SCHED_H_
+#define _SCHED_H_
+
+#include "../include/lcd_config.h"
+
+/// Ticks in a time span (LCD_HAL_Ticks() units)
+#define SCHED_US(us)  ((UDOUBLE)(us) * LCD_HAL_TICKS_PER_US)
+#define SCHED_MS(ms)  SCHED_US((UDOUBLE)(ms) * 1000)
+
+/**
+ * @brief Task body
+ * @return Jobs: 1 while more work remains, 0 when done (the job sleeps
+ *         until Sched_Wake()). Ignored for periodic tasks.
+ */
+typedef UBYTE (*Sched_Func)(void *ctx);
+
+typedef struct {
+    Sched_Func fn;
+    void *ctx;
+    UDOUBLE period;             ///< Ticks between runs, 0 = job
+    UDOUBLE due;                ///< Periodic: tick of the next run
+    UDOUBLE max_late;           ///< Worst start after due, ticks
+    UDOUBLE max_run;            ///< Longest single run, ticks
+    UBYTE active;               ///< Runs at all (jobs: has work)
+} Sched_Task;
+
+#define SCHED_PERIODIC(fn, ctx, period)  { (fn), (ctx), (period), 0, 0, 0, 1 }
+#define SCHED_JOB(fn, ctx)               { (fn), (ctx), 0, 0, 0, 0, 0 }
+
+void Sched_Init(Sched_Task *tasks, UBYTE count);
+UBYTE Sched_RunOnce(void);
+void Sched_Run(void);
+void Sched_Wake(Sched_Task *task);
+void Sched_ResetStats(void);
+
+#endif // _SCHED_H_
@@ -0,0 +1,149 @@
+/**
+ * @file lcd_trace.c
+ * @brief Compact binary trace of an LCD bus: pin edges, bytes, delays
+ */
+
+#include "lcd_trace.h"
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    p[2] = (v >> 16) & 0xFF;
+    p[3] = v >> 24;
+}
+
+static void Put_Varint(LCD_Trace *t, uint32_t v)
+{
+    while (v >= 0x80) {
+        t->buf[t->len++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    t->buf[t->len++] = (uint8_t)v;
+}
+
+static uint32_t Now(LCD_Trace *t)
+{
+    return t->clock() - t->skew;
+}
+
+/**
+ * @brief Hand the buffer to the sink; its time is not bus time
+ */
+void LCD_Trace_Flush(LCD_Trace *t)
+{
+    if (!t->len) return;
+    uint32_t t0 = t->clock();
+    t->write(t->buf, t->len, t->ctx);
+    t->len = 0;
+    t->run = 0;
+    t->skew += t->clock() - t0;
+}
+
+/**
+ * @brief Start a record: make room, close any open BYTES run, write tag and time
+ *
+ * @return Time of the record
+ */
+static uint32_t Begin(LCD_Trace *t, uint8_t tag, uint16_t payload)
+{
+    t->run = 0;
+    if (t->len + 6 + payload > t->size) LCD_Trace_Flush(t);
+    uint32_t now = Now(t);
+    t->buf[t->len++] = tag;
+    Put_Varint(t, now - t->last);
+    t->last = now;
+    return now;
+}
+
+/**
+ * @brief Start a trace: writes the header straight to the sink
+ *
+ * @param buf  Record buffer, at least LCD_TRACE_MAX_RECORD bytes
+ */
+void LCD_Trace_Init(LCD_Trace *t, uint8_t *buf, uint16_t size, LCD_TraceClock clock,
+                    LCD_TraceWrite write, void *ctx, uint32_t ticks_per_sec, uint32_t spi_hz)
+{
+    uint8_t header[LCD_TRACE_HEADER] = { 'L', 'C', 'D', 'T', LCD_TRACE_VERSION };
+
+    Put32(header + 8, ticks_per_sec);
+    Put32(header + 12, spi_hz);
+    t->buf = buf;
+    t->size = size;
+    t->len = 0;
+    t->run = 0;
+    t->clock = clock;
+    t->write = write;
+    t->ctx = ctx;
+    t->skew = 0;
+    // Rounded up, so bytes sent back to back always join the open record
+    t->byte_ticks = (uint32_t)(((uint64_t)ticks_per_sec * 8 + spi_hz - 1) / spi_hz);
+    write(header, LCD_TRACE_HEADER, ctx);
+    t->last = Now(t);
+}
+
+void LCD_Trace_Pin(LCD_Trace *t, uint8_t panel, uint8_t pin, uint8_t level)
+{
+    Begin(t, LCD_TRACE_PIN, 1);
+    t->buf[t->len++] = (uint8_t)((panel << 3) | (pin << 1) | (level ? 1 : 0));
+}
+
+/**
+ * @brief One byte on the bus, joined to the open BYTES record when on time
+ */
+void LCD_Trace_Byte(LCD_Trace *t, uint8_t value)
+{
+    uint32_t now = Now(t);
+
+    if (t->run && t->buf[t->run] < 255 && t->len < t->size &&
+        (int32_t)(now - t->run_next) <= (int32_t)t->byte_ticks) {
+        t->buf[t->run]++;
+        t->buf[t->len++] = value;
+        t->run_next += t->byte_ticks;
+        return;
+    }
+    uint32_t start = Begin(t, LCD_TRACE_BYTES, 1 + 255);
+    t->run = t->len;
+    t->buf[t->len++] = 1;
+    t->buf[t->len++] = value;
+    t->run_next = start + t->byte_ticks;
+}
+
+void LCD_Trace_Bytes(LCD_Trace *t, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) LCD_Trace_Byte(t, data[i]);
+}
+
+/**
+ * @brief A requested delay starts now (replay tells it apart from idle time)
+ */
+void LCD_Trace_Delay(LCD_Trace *t, uint32_t us)
+{
+    Begin(t, LCD_TRACE_DELAY, 5);
+    Put_Varint(t, us);
+}
+
+void LCD_Trace_Mark(LCD_Trace *t, uint32_t id)
+{
+    Begin(t, LCD_TRACE_MARK, 5);
+    Put_Varint(t, id);
+}
+
+/**
+ * @brief Read a varint
+ *
+ * @return Bytes used, 0 if it runs past avail
+ */
+uint8_t LCD_Trace_Varint(const uint8_t *p, uint32_t avail, uint32_t *value)
+{
+    uint32_t v = 0;
+
+    for (uint8_t i = 0; i < 5 && i < avail; i++) {
+        v |= (uint32_t)(p[i] & 0x7F) << (7 * i);
+        if (!(p[i] & 0x80)) {
+            *value = v;
+            return i + 1;
+        }
+    }
+    return 0;
+}
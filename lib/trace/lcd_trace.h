@@ -0,0 +1,81 @@
+/**
+ * @file lcd_trace.h
+ * @brief Compact binary trace of an LCD bus: pin edges, bytes, delays
+ *
+ * Emitted by the tracing builds of the transports (lib/lcd_hal with
+ * LCD_TRACE_ENABLED, the simulator HAL, the Pi's DEV_Config with
+ * LCD_TRACE) and replayed by sim/trace_replay. Portable C, no allocation:
+ * records go into a caller-owned buffer, handed to a write callback when
+ * it fills.
+ *
+ * File layout, little-endian:
+ * - header, 16 bytes: "LCDT", version, 3 reserved, ticks per second
+ *   (uint32), SPI clock in Hz (uint32)
+ * - records: tag byte, time since the previous record in ticks (varint),
+ *   then the payload:
+ *   | tag   | payload                                         |
+ *   |-------|-------------------------------------------------|
+ *   | PIN   | 1 byte: panel << 3 | pin << 1 | level            |
+ *   | BYTES | count (1 byte, 1..255), then the bytes          |
+ *   | DELAY | requested delay in us (varint)                  |
+ *   | MARK  | caller's id (varint), e.g. a frame boundary     |
+ *
+ * Varints are LEB128: 7 bits per byte, low first, top bit = more.
+ * A BYTES record is bytes clocked back to back from its time; a byte
+ * that follows within one byte time of the expected slot joins the open
+ * record, so streams of pixels cost about one byte per byte. Time spent
+ * handing the buffer to the write callback is taken out of the
+ * timestamps, so a slow sink (a UART) does not show up as idle bus time.
+ */
+
+#ifndef _LCD_TRACE_H_
+#define _LCD_TRACE_H_
+
+#include <stdint.h>
+
+#define LCD_TRACE_MAGIC    "LCDT"
+#define LCD_TRACE_VERSION  1
+#define LCD_TRACE_HEADER   16
+
+#define LCD_TRACE_PIN      0x01
+#define LCD_TRACE_BYTES    0x02
+#define LCD_TRACE_DELAY    0x03
+#define LCD_TRACE_MARK     0x04
+
+/// Pins in a PIN record
+#define LCD_TRACE_CS       0
+#define LCD_TRACE_DC       1
+#define LCD_TRACE_RST      2
+#define LCD_TRACE_BL       3
+
+/// Longest record: tag, 5-byte varint, count, 255 bytes
+#define LCD_TRACE_MAX_RECORD  262
+
+typedef uint32_t (*LCD_TraceClock)(void);
+typedef void (*LCD_TraceWrite)(const uint8_t *data, uint16_t len, void *ctx);
+
+typedef struct {
+    uint8_t *buf;
+    uint16_t size, len;         ///< Buffer size (>= LCD_TRACE_MAX_RECORD), bytes in it
+    uint16_t run;               ///< Offset of the open BYTES record's count, 0 = none
+    LCD_TraceClock clock;
+    LCD_TraceWrite write;
+    void *ctx;
+    uint32_t last;              ///< Time of the last record
+    uint32_t run_next;          ///< Time the open record's next byte is due
+    uint32_t byte_ticks;        ///< Ticks to clock one byte
+    uint32_t skew;              ///< Ticks spent in write(), left out of the times
+} LCD_Trace;
+
+void LCD_Trace_Init(LCD_Trace *t, uint8_t *buf, uint16_t size, LCD_TraceClock clock,
+                    LCD_TraceWrite write, void *ctx, uint32_t ticks_per_sec, uint32_t spi_hz);
+void LCD_Trace_Pin(LCD_Trace *t, uint8_t panel, uint8_t pin, uint8_t level);
+void LCD_Trace_Byte(LCD_Trace *t, uint8_t value);
+void LCD_Trace_Bytes(LCD_Trace *t, const uint8_t *data, uint32_t len);
+void LCD_Trace_Delay(LCD_Trace *t, uint32_t us);
+void LCD_Trace_Mark(LCD_Trace *t, uint32_t id);
+void LCD_Trace_Flush(LCD_Trace *t);
+
+uint8_t LCD_Trace_Varint(const uint8_t *p, uint32_t avail, uint32_t *value);
+
+#endif // _LCD_TRACE_H_
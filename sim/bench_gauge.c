@@ -0,0 +1,114 @@
+/**
+ * @file bench_gauge.c
+ * @brief Gauge ticks per second on the CH32v003 bus: full vs incremental
+ *
+ * Sweeps the needle of a full-screen gauge and measures simulated bus
+ * time per tick for:
+ * - screen:  repaint all 240x240 pixels
+ * - box:     repaint the bounding box of the old and new needle
+ * - spans:   repaint only the GFX_Gauge_SetValue() spans, one window each
+ *
+ * CPU time for rendering is not modelled; at 1.5 MHz SPI the CH32v003
+ * is bus bound, so these are upper bounds. The panel contents after the
+ * span sweep are checked against a full render.
+ *
+ * Usage: ./bin/bench_gauge [ticks]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+#include "gfx_gauge.h"
+
+static void Gauge_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Gauge_RenderRow((const GFX_Gauge *)ctx, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void Gauge_Span(int16_t y, int16_t x0, int16_t x1, void *ctx)
+{
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y < 0 || y >= LCD_HEIGHT || x0 >= x1) return;
+    GC9A01_DrawRows(x0, y, x1, y + 1, Gauge_Row, ctx);
+}
+
+static int16_t Next_Value(int tick)
+{
+    int v = tick % 200;
+    return (int16_t)(v <= 100 ? v : 200 - v);
+}
+
+static void Clip_Box(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+    if (*x0 < 0) *x0 = 0;
+    if (*y0 < 0) *y0 = 0;
+    if (*x1 > LCD_WIDTH) *x1 = LCD_WIDTH;
+    if (*y1 > LCD_HEIGHT) *y1 = LCD_HEIGHT;
+}
+
+static void Run(const char *name, GFX_Gauge *g, int ticks, int mode)
+{
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+    uint32_t pixels = 0;
+
+    GC9A01_Sim_ResetStats();
+    for (int t = 1; t <= ticks; t++) {
+        GFX_AAShape old = g->needle;
+
+        if (mode == 2) {
+            GFX_Gauge_SetValue(g, Next_Value(t), Gauge_Span, g);
+        } else {
+            GFX_Gauge_SetValue(g, Next_Value(t), NULL, NULL);
+            int16_t x0 = 0, y0 = 0, x1 = LCD_WIDTH, y1 = LCD_HEIGHT;
+            if (mode == 1) {
+                x0 = old.left < g->needle.left ? old.left : g->needle.left;
+                y0 = old.top < g->needle.top ? old.top : g->needle.top;
+                x1 = (old.right > g->needle.right ? old.right : g->needle.right) + 1;
+                y1 = (old.bottom > g->needle.bottom ? old.bottom : g->needle.bottom) + 1;
+                Clip_Box(&x0, &y0, &x1, &y1);
+            }
+            GC9A01_DrawRows(x0, y0, x1, y1, Gauge_Row, g);
+        }
+    }
+    pixels = GC9A01_Sim_Stats()->pixels;
+
+    double s = (GC9A01_Sim_TimeNs() - t0) / 1e9;
+    printf("%-7s %6.1f ticks/s  %7lu B/tick  %6lu px/tick\n", name, ticks / s,
+           (unsigned long)(GC9A01_Sim_Stats()->bytes / ticks),
+           (unsigned long)(pixels / ticks));
+}
+
+int main(int argc, char *argv[])
+{
+    int ticks = (argc > 1) ? atoi(argv[1]) : 200;
+    GFX_Gauge g;
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+
+    GFX_Gauge_Init(&g, LCD_WIDTH / 2, LCD_HEIGHT / 2, LCD_WIDTH / 2 - 4);
+    GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Gauge_Row, &g);
+
+    printf("SPI %lu Hz, gauge r=%d, %d ticks\n",
+           (unsigned long)LCD_SPI_SPEED_HZ, g.radius, ticks);
+    Run("screen", &g, ticks, 0);
+    Run("box", &g, ticks, 1);
+    Run("spans", &g, ticks, 2);
+
+    // Spans must leave the panel as a full render would
+    static UWORD line[LCD_WIDTH];
+    uint32_t diff = 0;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        Gauge_Row(y, 0, LCD_WIDTH, line, &g);
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (GC9A01_Sim_GetPixel(x, y) != line[x]) diff++;
+        }
+    }
+    printf("panel == full render: %s (%lu px differ)\n", diff ? "NO" : "yes",
+           (unsigned long)diff);
+    return diff != 0;
+}
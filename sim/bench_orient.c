@@ -0,0 +1,106 @@
+/**
+ * @file bench_orient.c
+ * @brief Rotation and mirroring in MADCTL: mapping check and cost
+ *
+ * For every rotation and mirror, draws an asymmetric pattern through
+ * GC9A01_DrawRows() in logical coordinates and checks the simulated GRAM
+ * against the software transform the Pi's Paint_SetPixel() applies
+ * (rotate, then mirror). Bus bytes and time are printed per orientation:
+ * the controller does the transform, so they match the native ones.
+ *
+ * The same pattern then goes through GC9A01_Present(), whose bands follow
+ * the scan (bottom-up for ROTATE_180 and MIRROR_Y), and the GRAM must be
+ * the same as after DrawRows.
+ *
+ * Usage: ./bin/bench_orient
+ */
+
+#include <stdio.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+
+/// No symmetry: every orientation gives a different image
+static UWORD Pattern(uint16_t x, uint16_t y)
+{
+    return (UWORD)(((x * 7) ^ (y * 3)) + (x < 40 && y < 20 ? 0xF800 : 0));
+}
+
+static void Pattern_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    for (uint16_t i = 0; i < width; i++) line[i] = Pattern(x0 + i, y);
+}
+
+/**
+ * @brief Native (GRAM) position of logical (x, y), as Paint_SetPixel()
+ */
+static void Expected(uint8_t rotation, uint8_t mirror, uint16_t x, uint16_t y,
+                     uint16_t *nx, uint16_t *ny)
+{
+    switch (rotation) {
+    case GC9A01_ROTATE_90:  *nx = LCD_WIDTH - 1 - y; *ny = x; break;
+    case GC9A01_ROTATE_180: *nx = LCD_WIDTH - 1 - x; *ny = LCD_HEIGHT - 1 - y; break;
+    case GC9A01_ROTATE_270: *nx = y; *ny = LCD_HEIGHT - 1 - x; break;
+    default:                *nx = x; *ny = y; break;
+    }
+    if (mirror & GC9A01_MIRROR_X) *nx = LCD_WIDTH - 1 - *nx;
+    if (mirror & GC9A01_MIRROR_Y) *ny = LCD_HEIGHT - 1 - *ny;
+}
+
+/**
+ * @brief Pixels of the GRAM that differ from the transformed pattern
+ */
+static uint32_t Wrong(uint8_t rotation, uint8_t mirror)
+{
+    uint32_t bad = 0;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            uint16_t nx, ny;
+            Expected(rotation, mirror, x, y, &nx, &ny);
+            if (GC9A01_Sim_GetPixel(nx, ny) != Pattern(x, y)) bad++;
+        }
+    }
+    return bad;
+}
+
+int main(void)
+{
+    static const char *mirror_name[] = { "none", "x", "y", "x+y" };
+    uint32_t bad_total = 0;
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+
+    printf("SPI %lu Hz, full-screen pattern per orientation\n", (unsigned long)LCD_SPI_SPEED_HZ);
+    printf("rotate  mirror  madctl     bytes  trans      us  wrong px  present wrong px\n");
+    for (uint8_t rot = 0; rot < 4; rot++) {
+        for (uint8_t mir = 0; mir < 4; mir++) {
+            GC9A01_SetOrientation(rot, mir);
+            GC9A01_Sim_ResetStats();
+            uint64_t t0 = GC9A01_Sim_TimeNs();
+            GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL);
+            const GC9A01_SimStats *st = GC9A01_Sim_Stats();
+            double us = (GC9A01_Sim_TimeNs() - t0) / 1e3;
+
+            uint32_t bad = Wrong(rot, mir);
+            uint32_t bytes = st->bytes, trans = st->transactions;
+
+            GC9A01_FillScreen(LCD_COLOR_BLACK);
+            GC9A01_Present(0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL);
+            uint32_t bad_present = Wrong(rot, mir);
+
+            bad_total += bad + bad_present;
+            printf("%6d  %-6s    0x%02X  %8lu  %5lu  %6.0f  %8lu  %16lu\n", rot * 90,
+                   mirror_name[mir], GC9A01_Sim_Madctl(), (unsigned long)bytes,
+                   (unsigned long)trans, us, (unsigned long)bad, (unsigned long)bad_present);
+        }
+    }
+    GC9A01_SetOrientation(GC9A01_ROTATE_0, GC9A01_MIRROR_NONE);
+
+    printf("all orientations match the software transform, DrawRows and Present: %s\n",
+           bad_total ? "NO" : "yes");
+    return bad_total != 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file bench_panels.c
+ * @brief Several panels on one bus: separate writes vs CS broadcast
+ *
+ * Three simulated panels (the sim build sets LCD_PANEL_COUNT=3) show the
+ * same background with a different tile on each:
+ * - separate:  init, background and tile sent to each panel in turn
+ * - broadcast: init and background sent once with every CS low, then
+ *              one tile per panel
+ * Then panels 0 and 2 get a shared overlay in one broadcast, and panel 1
+ * is put to sleep and woken by a broadcast draw (power mode is per panel).
+ * Every GRAM is checked against the picture it should hold. The sim
+ * build gives each panel its own RST: with a shared one, initialising a
+ * panel resets the others, so they must be initialised together.
+ *
+ * Usage: ./bin/bench_panels
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+
+#define TILE_X0  80
+#define TILE_Y0  80
+#define TILE_X1  160
+#define TILE_Y1  160
+
+static const UWORD tile_color[LCD_PANEL_COUNT] = { LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE };
+
+static UWORD expected[LCD_PANEL_COUNT][LCD_HEIGHT][LCD_WIDTH];
+
+static UWORD Background(uint16_t x, uint16_t y)
+{
+    return (UWORD)(((x >> 3) ^ (y >> 3)) & 1 ? 0x39E7 : 0x18C3) + (UWORD)(y >> 4);
+}
+
+static void Background_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    for (uint16_t i = 0; i < width; i++) line[i] = Background(x0 + i, y);
+}
+
+static void Expect_Rect(UBYTE mask, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, UWORD c)
+{
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        if (!(mask & GC9A01_PANEL(p))) continue;
+        for (uint16_t y = y0; y < y1; y++) {
+            for (uint16_t x = x0; x < x1; x++) expected[p][y][x] = c;
+        }
+    }
+}
+
+/**
+ * @brief Wrong pixels over all panels; a panel not in normal mode counts
+ *        as entirely wrong (e.g. reset by another panel's init)
+ */
+static uint32_t Check(void)
+{
+    uint32_t bad = 0;
+
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        GC9A01_Sim_SelectPanel(p);
+        if (GC9A01_Sim_PowerMode() != GC9A01_SIM_NORMAL) {
+            bad += LCD_WIDTH * LCD_HEIGHT;
+            continue;
+        }
+        for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+            for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+                if (GC9A01_Sim_GetPixel(x, y) != expected[p][y][x]) bad++;
+            }
+        }
+    }
+    GC9A01_Sim_SelectPanel(0);
+    return bad;
+}
+
+static void Report(const char *name, uint64_t t0)
+{
+    const GC9A01_SimStats *st = GC9A01_Sim_Stats();
+    printf("%-10s %9lu %7lu %9.1f\n", name, (unsigned long)st->bytes,
+           (unsigned long)st->transactions, (GC9A01_Sim_TimeNs() - t0) / 1e6);
+}
+
+static uint32_t Run(UBYTE broadcast)
+{
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_SelectPanels(GC9A01_PANELS_ALL);
+    GC9A01_Sim_ResetStats();
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+
+    if (broadcast) {
+        GC9A01_Init();
+        GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Background_Row, NULL);
+    }
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        GC9A01_SelectPanels(GC9A01_PANEL(p));
+        if (!broadcast) {
+            GC9A01_Init();
+            GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Background_Row, NULL);
+        }
+        GC9A01_FillRect(TILE_X0, TILE_Y0, TILE_X1, TILE_Y1, tile_color[p]);
+    }
+    GC9A01_SelectPanels(GC9A01_PANELS_ALL);
+    Report(broadcast ? "broadcast" : "separate", t0);
+
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+            for (uint16_t x = 0; x < LCD_WIDTH; x++) expected[p][y][x] = Background(x, y);
+        }
+    }
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        Expect_Rect(GC9A01_PANEL(p), TILE_X0, TILE_Y0, TILE_X1, TILE_Y1, tile_color[p]);
+    }
+    return Check();
+}
+
+int main(void)
+{
+    uint32_t bad = 0;
+
+    printf("SPI %lu Hz, %d panels: init + full-screen background + one tile each\n",
+           (unsigned long)LCD_SPI_SPEED_HZ, LCD_PANEL_COUNT);
+    printf("mode           bytes  trans        ms\n");
+    bad += Run(0);
+    bad += Run(1);
+
+    // Shared overlay on panels 0 and 2 only
+    UBYTE overlay = GC9A01_PANEL(0) | GC9A01_PANEL(2);
+    GC9A01_SelectPanels(overlay);
+    GC9A01_FillRect(0, 200, LCD_WIDTH, 220, LCD_COLOR_YELLOW);
+    Expect_Rect(overlay, 0, 200, LCD_WIDTH, 220, LCD_COLOR_YELLOW);
+    uint32_t overlay_bad = Check();
+    bad += overlay_bad;
+
+    // Power is per panel: sleep panel 1, then a broadcast draw wakes it alone
+    GC9A01_SelectPanels(GC9A01_PANEL(1));
+    GC9A01_SetPowerMode(GC9A01_POWER_SLEEP);
+    LCD_HAL_Delay_ms(150);
+    GC9A01_SelectPanels(GC9A01_PANEL(0));
+    GC9A01_SetPowerMode(GC9A01_POWER_IDLE);
+    GC9A01_SelectPanels(GC9A01_PANELS_ALL);
+    GC9A01_Sim_ResetStats();
+    GC9A01_FillRect(0, 20, LCD_WIDTH, 40, LCD_COLOR_CYAN);
+    Expect_Rect(GC9A01_PANELS_ALL, 0, 20, LCD_WIDTH, 40, LCD_COLOR_CYAN);
+    const GC9A01_SimStats *st = GC9A01_Sim_Stats();
+    UBYTE awake = 1;
+    for (UBYTE p = 0; p < LCD_PANEL_COUNT; p++) {
+        GC9A01_Sim_SelectPanel(p);
+        if (GC9A01_Sim_PowerMode() != GC9A01_SIM_NORMAL) awake = 0;
+    }
+    uint32_t wake_bad = Check();
+    bad += wake_bad;
+
+    printf("overlay on panels 0+2: %lu px wrong\n", (unsigned long)overlay_bad);
+    printf("wake from sleep (1) and idle (0) by one draw: SLPOUT %lu, IDMOFF %lu, all normal: %s, %lu px wrong\n",
+           (unsigned long)st->commands[0x11], (unsigned long)st->commands[0x38],
+           awake ? "yes" : "NO", (unsigned long)wake_bad);
+    printf("every panel matches: %s\n", bad || !awake ? "NO" : "yes");
+    return bad != 0 || !awake;
+}
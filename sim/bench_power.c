@@ -0,0 +1,152 @@
+/**
+ * @file bench_power.c
+ * @brief Time in each panel power mode for a slowly updating readout
+ *
+ * Simulates a readout that redraws a 120x40 value every minute, with a
+ * button press every seven minutes, and runs GC9A01_Power_Tick() every
+ * 100 ms under four policies:
+ * - none:     always normal
+ * - idle:     8-colour idle after 5 s
+ * - partial:  + only the value rows driven after 15 s
+ * - sleep:    + sleep with the backlight off after 45 s
+ *
+ * For each policy it reports the share of time per mode, backlight-on
+ * time, wake latency (first wake command to the next RAMWR) and any
+ * breach of the 5 ms / 120 ms sleep timing rules, all as observed by the
+ * simulated panel. The average current uses the assumed figures below;
+ * replace them with measurements for a real board.
+ *
+ * Usage: ./bin/bench_power [minutes] [-v]   (-v logs power commands)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_power.h"
+#include "gc9a01_sim.h"
+
+// Assumed supply currents in mA (panel logic + drivers, and backlight)
+#define MA_NORMAL        4.0
+#define MA_IDLE          2.5
+#define MA_PARTIAL       2.0
+#define MA_PARTIAL_IDLE  1.2
+#define MA_SLEEP         0.02
+#define MA_BACKLIGHT     20.0
+
+#define TICK_MS          100
+#define UPDATE_MS        60000
+#define BUTTON_MS        420000
+
+// Value box; partial mode keeps exactly these rows
+#define VALUE_X0   60
+#define VALUE_Y0   100
+#define VALUE_X1   180
+#define VALUE_Y1   140
+
+static void Log_Command(uint64_t ns, UBYTE cmd)
+{
+    static const struct { UBYTE cmd; const char *name; } names[] = {
+        { 0x10, "SLPIN" }, { 0x11, "SLPOUT" }, { 0x12, "PTLON" }, { 0x13, "NORON" },
+        { 0x30, "PTLAR" }, { 0x38, "IDMOFF" }, { 0x39, "IDMON" },
+    };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (names[i].cmd == cmd) {
+            printf("  %10.3f s  %02X %s\n", ns / 1e9, cmd, names[i].name);
+            return;
+        }
+    }
+}
+
+static UDOUBLE Now_ms(void)
+{
+    return (UDOUBLE)(GC9A01_Sim_TimeNs() / 1000000ULL);
+}
+
+static void Run(const char *name, const GC9A01_PowerPolicy *policy, UDOUBLE minutes, int verbose)
+{
+    UDOUBLE start = Now_ms();
+    UDOUBLE end = start + minutes * 60000UL;
+    UDOUBLE next_update = start, next_button = start + BUTTON_MS;
+    uint16_t value = 0;
+
+    GC9A01_SetPowerMode(GC9A01_POWER_NORMAL);
+    GC9A01_Power_Init(policy, start);
+    GC9A01_Sim_ResetPower();
+    GC9A01_Sim_SetCommandHook(verbose ? Log_Command : NULL);
+    if (verbose) printf("%s:\n", name);
+
+    while (Now_ms() < end) {
+        UDOUBLE now = Now_ms();
+        if (now >= next_update) {
+            // Stand-in for redrawing the value: a colour that changes every minute
+            GC9A01_FillRect(VALUE_X0, VALUE_Y0, VALUE_X1, VALUE_Y1, (UWORD)(value++ * 0x0841));
+            next_update += UPDATE_MS;
+        }
+        if (now >= next_button) {
+            GC9A01_Power_Activity(now);
+            next_button += BUTTON_MS;
+        }
+        GC9A01_Power_Tick(Now_ms());
+        LCD_HAL_Delay_ms(TICK_MS);
+    }
+    GC9A01_Sim_SetCommandHook(NULL);
+
+    const GC9A01_SimPower *p = GC9A01_Sim_Power();
+    double total = 0;
+    for (int m = 0; m < GC9A01_SIM_MODES; m++) total += p->mode_ns[m];
+    double share[GC9A01_SIM_MODES];
+    for (int m = 0; m < GC9A01_SIM_MODES; m++) share[m] = 100.0 * p->mode_ns[m] / total;
+    double bl = 100.0 * p->backlight_ns / total;
+    double ma = (share[GC9A01_SIM_NORMAL] * MA_NORMAL + share[GC9A01_SIM_IDLE] * MA_IDLE +
+                 share[GC9A01_SIM_PARTIAL] * MA_PARTIAL +
+                 share[GC9A01_SIM_PARTIAL | GC9A01_SIM_IDLE] * MA_PARTIAL_IDLE +
+                 share[GC9A01_SIM_SLEEP] * MA_SLEEP + bl * MA_BACKLIGHT) / 100.0;
+
+    printf("%-8s %5.1f %5.1f %5.1f %5.1f %5.1f  %5.1f  %5lu %7.3f %7.3f  %4lu  %6.2f\n", name,
+           share[GC9A01_SIM_NORMAL], share[GC9A01_SIM_IDLE], share[GC9A01_SIM_PARTIAL],
+           share[GC9A01_SIM_PARTIAL | GC9A01_SIM_IDLE], share[GC9A01_SIM_SLEEP], bl,
+           (unsigned long)p->wakes, p->wakes ? p->wake_ns_total / 1e6 / p->wakes : 0.0,
+           p->wake_ns_max / 1e6, (unsigned long)p->violations, ma);
+}
+
+int main(int argc, char *argv[])
+{
+    UDOUBLE minutes = 60;
+    int verbose = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) verbose = 1;
+        else minutes = (UDOUBLE)atoi(argv[i]);
+    }
+
+    static const struct {
+        const char *name;
+        GC9A01_PowerPolicy policy;
+    } runs[] = {
+        { "none",    { 0,    0,     0,     VALUE_Y0, VALUE_Y1 } },
+        { "idle",    { 5000, 0,     0,     VALUE_Y0, VALUE_Y1 } },
+        { "partial", { 5000, 15000, 0,     VALUE_Y0, VALUE_Y1 } },
+        { "sleep",   { 5000, 15000, 45000, VALUE_Y0, VALUE_Y1 } },
+    };
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillRect(0, 0, LCD_WIDTH, LCD_HEIGHT, LCD_COLOR_BLACK);
+
+    printf("%lu min, update every %d s, button every %d s\n", (unsigned long)minutes,
+           UPDATE_MS / 1000, BUTTON_MS / 1000);
+    printf("policy   %% time:                       backlt  wakes  wake ms         viol  mA\n");
+    printf("         norm  idle  ptl  ptl+i sleep  %%             avg     max          avg\n");
+    for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); i++) {
+        Run(runs[i].name, &runs[i].policy, minutes, verbose);
+    }
+    printf("currents assumed: normal %.1f, idle %.1f, partial %.1f, partial+idle %.1f, "
+           "sleep %.2f, backlight %.1f mA\n", MA_NORMAL, MA_IDLE, MA_PARTIAL,
+           MA_PARTIAL_IDLE, MA_SLEEP, MA_BACKLIGHT);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file bench_readout.c
+ * @brief Bus bytes and CPU per readout update: all cells vs changed cells
+ *
+ * Three readouts in GFX_Font_Digits24, each updated many times:
+ * - counter: 6 cells counting up by one
+ * - fixed:   "-20.0" .. "40.0" in 0.1 steps
+ * - clock:   "HH:MM:SS" once a second
+ *
+ * "all" repaints every cell on each update (what Paint_DrawNum /
+ * Paint_DrawTime do); "changed" repaints only the cells whose character
+ * changed, one window each. Bus bytes come from the simulated panel. CPU
+ * is formatting plus rendering the repainted rows, without the bus, in
+ * host cycles (TSC on x86, else ns): it only compares the two modes, the
+ * CH32v003 figure is higher. The panel is checked against a full render
+ * at the end.
+ *
+ * Usage: ./bin/bench_readout [updates]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+#include "gfx_readout.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CPU_UNIT "cyc"
+static uint64_t Cpu_Now(void) { return __rdtsc(); }
+#else
+#define CPU_UNIT "ns"
+static uint64_t Cpu_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+enum { COUNTER, FIXED, CLOCK };
+
+static UWORD scratch[LCD_WIDTH];
+
+static void Readout_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Readout_RenderRow((const GFX_Readout *)ctx, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void Cell_Draw(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    GC9A01_DrawRows(x0, y0, x1, y1, Readout_Row, ctx);
+}
+
+static void Cell_Render(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    for (int16_t y = y0; y < y1; y++) {
+        GFX_Readout_RenderRow((const GFX_Readout *)ctx, y, x0, x1 - x0, scratch, GFX_ORDER_NATIVE);
+    }
+}
+
+static void Update(GFX_Readout *r, int kind, int i, GFX_ReadoutCellFunc emit)
+{
+    switch (kind) {
+    case COUNTER: GFX_Readout_SetFixed(r, 1000 + i, 0, emit, r); break;
+    case FIXED:   GFX_Readout_SetFixed(r, -200 + i % 601, 1, emit, r); break;
+    default: {
+        int t = 12 * 3600 + 59 * 60 + i;
+        GFX_Readout_SetClock(r, (t / 3600) % 24, (t / 60) % 60, t % 60, emit, r);
+        break;
+    }
+    }
+}
+
+static void Run(const char *name, GFX_Readout *r, int kind, int updates, int all)
+{
+    // CPU: format + render the repainted rows
+    GFX_Readout_Invalidate(r);
+    Update(r, kind, 0, NULL);
+    uint64_t c0 = Cpu_Now();
+    for (int i = 1; i <= updates; i++) {
+        if (all) GFX_Readout_Invalidate(r);
+        Update(r, kind, i, Cell_Render);
+    }
+    uint64_t cpu = Cpu_Now() - c0;
+
+    // Bus: the same updates through the driver
+    GFX_Readout_Invalidate(r);
+    Update(r, kind, 0, Cell_Draw);
+    GC9A01_Sim_ResetStats();
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+    for (int i = 1; i <= updates; i++) {
+        if (all) GFX_Readout_Invalidate(r);
+        Update(r, kind, i, Cell_Draw);
+    }
+    const GC9A01_SimStats *st = GC9A01_Sim_Stats();
+    double us = (GC9A01_Sim_TimeNs() - t0) / 1e3 / updates;
+
+    printf("%-8s %-8s %8lu %8lu %9.0f %10lu\n", name, all ? "all" : "changed",
+           (unsigned long)(st->bytes / updates), (unsigned long)(st->transactions / updates),
+           us, (unsigned long)(cpu / updates));
+}
+
+int main(int argc, char *argv[])
+{
+    int updates = (argc > 1) ? atoi(argv[1]) : 600;
+    static const struct { const char *name; int kind; uint8_t cells; int16_t y; } runs[] = {
+        { "counter", COUNTER, 6, 60 },
+        { "fixed",   FIXED,   5, 108 },
+        { "clock",   CLOCK,   8, 156 },
+    };
+    GFX_Readout r[3];
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillRect(0, 0, LCD_WIDTH, LCD_HEIGHT, LCD_COLOR_BLACK);
+
+    printf("SPI %lu Hz, %s, %d updates\n", (unsigned long)LCD_SPI_SPEED_HZ,
+           "GFX_Font_Digits24", updates);
+    printf("readout  repaint  bytes/up  trans/up  bus us/up  cpu %s/up\n", CPU_UNIT);
+    for (int k = 0; k < 3; k++) {
+        GFX_Readout_Init(&r[k], &GFX_Font_Digits24, 0, runs[k].y, runs[k].cells);
+        r[k].x = (LCD_WIDTH - r[k].pitch * r[k].cells) / 2;
+        Run(runs[k].name, &r[k], runs[k].kind, updates, 1);
+        Run(runs[k].name, &r[k], runs[k].kind, updates, 0);
+    }
+
+    // Incremental updates must leave the panel as a full render would
+    uint32_t diff = 0;
+    for (int k = 0; k < 3; k++) {
+        int16_t x1 = r[k].x + r[k].pitch * r[k].cells;
+        for (int16_t y = r[k].y; y < r[k].y + r[k].font->line_height; y++) {
+            Readout_Row(y, r[k].x, x1 - r[k].x, scratch, &r[k]);
+            for (int16_t x = r[k].x; x < x1; x++) {
+                if (GC9A01_Sim_GetPixel(x, y) != scratch[x - r[k].x]) diff++;
+            }
+        }
+    }
+    printf("panel == full render: %s (%lu px differ)\n", diff ? "NO" : "yes",
+           (unsigned long)diff);
+    return diff != 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file bench_sched.c
+ * @brief Task latency during a full-screen redraw: blocking vs time-sliced
+ *
+ * Three tasks on lib/sched, in simulated time:
+ * - sensor:  every 1 ms, 40 us of work
+ * - button:  every 5 ms, 10 us of work
+ * - display: panel init, then a full-screen render through GC9A01_DrawRows()
+ *
+ * "blocking" runs the display as one step (GC9A01_Init() and one full
+ * DrawRows, what the other DEBUG_MODEs do); the others are gc9a01_job.h
+ * jobs with a per-step budget. Each pass of the main loop costs 1 us.
+ * Reported per budget, for the init and the render separately: worst
+ * lateness of the periodic tasks and the longest display step; then time
+ * to a finished screen and bus bytes (the extra windows). The init's
+ * register step is one piece (~2.7 ms), so it bounds the init lateness
+ * whatever the budget. The panel is checked against the pattern after every run.
+ *
+ * Usage: ./bin/bench_sched
+ */
+
+#include <stdio.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_job.h"
+#include "gc9a01_sim.h"
+#include "sched.h"
+
+enum { SENSOR, BUTTON, DISPLAY, TASKS };
+
+static Sched_Task tasks[TASKS];
+static GC9A01_Job job;
+static UDOUBLE budget_us;       // 0 = blocking
+static uint8_t drawing;         // Init done, render started
+static UDOUBLE init_late, init_run;    // Worst sensor lateness / step during init
+
+static UWORD Pattern(uint16_t x, uint16_t y)
+{
+    return (UWORD)((x * 3) ^ (y * 5) ^ (x * y));
+}
+
+static void Pattern_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    for (uint16_t i = 0; i < width; i++) line[i] = Pattern(x0 + i, y);
+}
+
+static UBYTE Sensor(void *ctx)
+{
+    LCD_HAL_Delay_us(40);
+    return 0;
+}
+
+static UBYTE Button(void *ctx)
+{
+    LCD_HAL_Delay_us(10);
+    return 0;
+}
+
+static UBYTE Display(void *ctx)
+{
+    if (!budget_us) {
+        GC9A01_Init();
+        GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL);
+        return 0;
+    }
+    if (GC9A01_Job_Step(&job)) return 1;
+    if (drawing) return 0;
+    drawing = 1;
+    init_late = tasks[SENSOR].max_late;
+    init_run = tasks[DISPLAY].max_run;
+    Sched_ResetStats();
+    GC9A01_Job_Rows(&job, 0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL, budget_us);
+    return 1;
+}
+
+static Sched_Task tasks[TASKS] = {
+    SCHED_PERIODIC(Sensor, NULL, SCHED_MS(1)),
+    SCHED_PERIODIC(Button, NULL, SCHED_MS(5)),
+    SCHED_JOB(Display, NULL),
+};
+
+static uint32_t Run(const char *name, UDOUBLE budget)
+{
+    budget_us = budget;
+    drawing = 0;
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Job_Init(&job);
+    Sched_Init(tasks, TASKS);
+    Sched_Wake(&tasks[DISPLAY]);
+
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+    while (tasks[DISPLAY].active) {
+        Sched_RunOnce();
+        LCD_HAL_Delay_us(1);
+    }
+    double ms = (GC9A01_Sim_TimeNs() - t0) / 1e6;
+    if (!budget_us) {
+        // One step did everything: charge it all to the render
+        init_late = init_run = 0;
+    }
+    // Let the periodic tasks catch up, so a blocked one reports its lateness
+    while (GC9A01_Sim_TimeNs() - t0 < (uint64_t)(ms + 10) * 1000000) {
+        Sched_RunOnce();
+        LCD_HAL_Delay_us(1);
+    }
+
+    uint32_t bad = 0;
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            if (GC9A01_Sim_GetPixel(x, y) != Pattern(x, y)) bad++;
+        }
+    }
+
+    printf("%-9s %7lu %7lu  %8lu %7lu %8lu %7.1f %8lu %6lu\n", name,
+           (unsigned long)(init_late / LCD_HAL_TICKS_PER_US),
+           (unsigned long)(init_run / LCD_HAL_TICKS_PER_US),
+           (unsigned long)(tasks[SENSOR].max_late / LCD_HAL_TICKS_PER_US),
+           (unsigned long)(tasks[BUTTON].max_late / LCD_HAL_TICKS_PER_US),
+           (unsigned long)(tasks[DISPLAY].max_run / LCD_HAL_TICKS_PER_US), ms,
+           (unsigned long)GC9A01_Sim_Stats()->bytes, (unsigned long)bad);
+    return bad;
+}
+
+int main(void)
+{
+    static const struct { const char *name; UDOUBLE budget_us; } runs[] = {
+        { "blocking", 0 },
+        { "24 rows", 24 * 2560 },
+        { "1 row", 2560 },
+        { "1000 us", 1000 },
+        { "500 us", 500 },
+        { "250 us", 250 },
+    };
+    uint32_t bad = 0;
+
+    printf("SPI %lu Hz; sensor 40 us / 1 ms, button 10 us / 5 ms; init + full-screen render\n",
+           (unsigned long)LCD_SPI_SPEED_HZ);
+    printf("          ---- init ----  ------------ render ------------\n");
+    printf("budget    sensor  longest   sensor  button  longest  screen      bus  wrong\n");
+    printf("          late us step us  late us late us  step us      ms    bytes     px\n");
+    for (unsigned i = 0; i < sizeof(runs) / sizeof(runs[0]); i++) {
+        bad += Run(runs[i].name, runs[i].budget_us);
+    }
+    printf("screens match the pattern: %s\n", bad ? "NO" : "yes");
+    return bad != 0;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file bench_shader.c
+ * @brief Procedural fills streamed to the panel: throughput against a solid fill
+ *
+ * Every shader fills the whole screen twice through GFX_Shader_Fill()
+ * straight into the pixel stream (GC9A01_StreamBegin/StreamRepeat, no
+ * line buffer): once as a rectangle and once masked to the visible
+ * circle, which sends one window per row but only the pixels that show.
+ * Bus time is compared with GC9A01_FillRect() of one colour over the
+ * whole screen ("x solid" > 1 is faster).
+ *
+ * CPU is the pixel generation alone, in host cycles per pixel (TSC on
+ * x86, else ns per 1000 px): it ranks the shaders, the CH32v003 figure
+ * is higher. At 1.5 MHz SPI the CH32v003 has ~512 cycles per pixel
+ * before generation, not the bus, sets the pace.
+ *
+ * The panel is checked against a floating-point reference: "off px"
+ * counts pixels with a channel more than 1 LSB away. A pixel centre
+ * within 1/32 px of a pattern edge may go either way.
+ *
+ * Usage: ./bin/bench_shader [-o dir]   (-o saves each masked fill as PPM)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+#include "gfx_shader.h"
+#include "gfx_trig.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CPU_UNIT "cyc/px"
+#define CPU_SCALE 1.0
+static uint64_t Cpu_Now(void) { return __rdtsc(); }
+#else
+#define CPU_UNIT "ns/kpx"
+#define CPU_SCALE 1000.0
+static uint64_t Cpu_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+#define C   (LCD_WIDTH / 2)
+
+// ============================================================================
+// STREAM GLUE
+// ============================================================================
+
+static uint8_t stream_open;
+
+static void Stream_Window(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    if (stream_open) GC9A01_StreamEnd();
+    GC9A01_StreamBegin(x0, y0, x1, y1);
+    stream_open = 1;
+}
+
+static void Stream_Run(uint16_t color, uint16_t count, void *ctx)
+{
+    GC9A01_StreamRepeat(color, count);
+}
+
+static void Shader_Draw(const GFX_Shader *s)
+{
+    stream_open = 0;
+    GFX_Shader_Fill(s, 0, 0, LCD_WIDTH, LCD_HEIGHT, Stream_Window, Stream_Run, NULL);
+    if (stream_open) GC9A01_StreamEnd();
+}
+
+static uint32_t sink;
+
+static void Null_Window(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx) {}
+static void Null_Run(uint16_t color, uint16_t count, void *ctx) { sink += color + count; }
+
+// ============================================================================
+// REFERENCE
+// ============================================================================
+
+typedef struct {
+    const char *name;
+    GFX_Shader s;
+    double a, b, c, d, e;       ///< Setup in pixels / degrees, see Reference()
+} Case;
+
+static uint16_t Mix(uint16_t c0, uint16_t c1, double t)
+{
+    if (t < 0) t = 0;
+    if (t > 1) t = 1;
+    int r = (int)floor((c0 >> 11) + ((c1 >> 11) - (c0 >> 11)) * t + 0.5);
+    int g = (int)floor(((c0 >> 5) & 63) + (((c1 >> 5) & 63) - ((c0 >> 5) & 63)) * t + 0.5);
+    int b = (int)floor((c0 & 31) + ((c1 & 31) - (c0 & 31)) * t + 0.5);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/// Clockwise from 12 o'clock, degrees in [0, 360)
+static double Angle(double dx, double dy)
+{
+    double a = atan2(dx, -dy) * 180.0 / M_PI;
+    return a < 0 ? a + 360.0 : a;
+}
+
+static uint16_t Reference(const Case *k, double px, double py)
+{
+    const GFX_Shader *s = &k->s;
+
+    switch (s->kind) {
+    case GFX_SHADER_LINEAR: {
+        double dx = k->c - k->a, dy = k->d - k->b;
+        return Mix(s->c0, s->c1, ((px - k->a) * dx + (py - k->b) * dy) / (dx * dx + dy * dy));
+    }
+    case GFX_SHADER_RADIAL:
+        return Mix(s->c0, s->c1, hypot(px - k->a, py - k->b) / k->c);
+    case GFX_SHADER_CONIC: {
+        double rel = fmod(Angle(px - k->a, py - k->b) - k->c + 720.0, 360.0);
+        return Mix(s->c0, s->c1, floor(rel * GFX_SHADER_SECTORS / 360.0) / (GFX_SHADER_SECTORS - 1));
+    }
+    case GFX_SHADER_CHECKER:
+        return (((int)floor((px - k->a) / k->c) ^ (int)floor((py - k->b) / k->c)) & 1) ? s->c1 : s->c0;
+    case GFX_SHADER_STRIPES: {
+        double ph = (px - k->a) * sin(k->c * M_PI / 180) - (py - k->b) * cos(k->c * M_PI / 180);
+        return fmod(fmod(ph, k->d) + k->d, k->d) < k->e ? s->c1 : s->c0;
+    }
+    case GFX_SHADER_TICKS: {
+        double pitch = 360.0 / (s->sectors / 2);
+        double rel = fmod(Angle(px - k->a, py - k->b) + k->e / 2 + 720.0, pitch);
+        return rel < k->e ? s->c1 : s->c0;
+    }
+    default:
+        return s->c0;
+    }
+}
+
+static uint8_t Close(uint16_t a, uint16_t b)
+{
+    return abs((a >> 11) - (b >> 11)) <= 1 && abs(((a >> 5) & 63) - ((b >> 5) & 63)) <= 1 &&
+           abs((a & 31) - (b & 31)) <= 1;
+}
+
+static uint8_t Matches(const Case *k, int x, int y, uint16_t got)
+{
+    static const double nudge[5][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+    for (int i = 0; i < 5; i++) {
+        double px = x + 0.5 + nudge[i][0] / 32, py = y + 0.5 + nudge[i][1] / 32;
+        if (Close(got, Reference(k, px, py))) return 1;
+    }
+    return 0;
+}
+
+// ============================================================================
+// BENCH
+// ============================================================================
+
+int main(int argc, char *argv[])
+{
+    const char *dir = (argc > 2 && !strcmp(argv[1], "-o")) ? argv[2] : NULL;
+    static Case cases[7];
+    Case *k = cases;
+    int n;
+
+    k->name = "solid";
+    GFX_Shader_Solid(&k->s, LCD_COLOR_BLUE);
+    k++;
+    k->name = "linear";
+    k->a = 0, k->b = 20, k->c = 0, k->d = 220;
+    GFX_Shader_Linear(&k->s, 0, 20, 0x001F, 0, 220, 0xF800);
+    k++;
+    k->name = "radial";
+    k->a = C, k->b = C, k->c = 120;
+    GFX_Shader_Radial(&k->s, C, C, 120, 0x4A69, 0x0841);
+    k++;
+    k->name = "conic";
+    k->a = C, k->b = C, k->c = 45;
+    GFX_Shader_Conic(&k->s, C, C, GFX_DEG(45), 0x07E0, 0x001F);
+    k++;
+    k->name = "checker";
+    k->a = 8, k->b = 8, k->c = 16;
+    GFX_Shader_Checker(&k->s, 8, 8, 16, 0x0000, 0xFFFF);
+    k++;
+    k->name = "stripes";
+    k->a = 0, k->b = 0, k->c = GFX_DEG(30) * 360.0 / GFX_ANGLE_360, k->d = 12, k->e = 4;
+    GFX_Shader_Stripes(&k->s, 0, 0, GFX_DEG(30), 12, 4, 0x18E3, 0xFFE0);
+    k++;
+    k->name = "ticks";
+    k->a = C, k->b = C, k->e = 8 * 360.0 / GFX_ANGLE_360;
+    GFX_Shader_Ticks(&k->s, C, C, 100, 118, 60, 8, 0, 0x2104, 0xFFFF);
+    k++;
+    n = k - cases;
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+
+    // Reference: one colour over the whole screen
+    GC9A01_Sim_ResetStats();
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+    GC9A01_FillRect(0, 0, LCD_WIDTH, LCD_HEIGHT, LCD_COLOR_BLUE);
+    double solid_us = (GC9A01_Sim_TimeNs() - t0) / 1e3;
+    printf("SPI %lu Hz, full screen, GC9A01_FillRect solid: %lu bytes, %.0f us\n",
+           (unsigned long)LCD_SPI_SPEED_HZ, (unsigned long)GC9A01_Sim_Stats()->bytes, solid_us);
+    printf("shader   mask       px     bytes  trans       us  x solid  Mpx/s  %s  off px\n",
+           CPU_UNIT);
+
+    uint32_t off_total = 0;
+    for (int i = 0; i < n; i++) {
+        for (int masked = 0; masked < 2; masked++) {
+            GFX_Shader *s = &cases[i].s;
+            GFX_Shader_SetMask(s, C, C, masked ? C : 0);
+
+            // Generation alone
+            uint32_t px = 0;
+            int16_t span[4];
+            for (int16_t y = 0; y < LCD_HEIGHT; y++) {
+                uint8_t m = GFX_Shader_Spans(s, y, 0, LCD_WIDTH, span);
+                for (uint8_t j = 0; j < m; j++) px += span[2 * j + 1] - span[2 * j];
+            }
+            uint64_t c0 = Cpu_Now();
+            for (int r = 0; r < 10; r++) {
+                GFX_Shader_Fill(s, 0, 0, LCD_WIDTH, LCD_HEIGHT, Null_Window, Null_Run, NULL);
+            }
+            double cpu = (Cpu_Now() - c0) / 10.0 / px * CPU_SCALE;
+
+            // Through the bus
+            GC9A01_FillRect(0, 0, LCD_WIDTH, LCD_HEIGHT, LCD_COLOR_BLACK);
+            GC9A01_Sim_ResetStats();
+            t0 = GC9A01_Sim_TimeNs();
+            Shader_Draw(s);
+            double us = (GC9A01_Sim_TimeNs() - t0) / 1e3;
+            const GC9A01_SimStats *st = GC9A01_Sim_Stats();
+
+            // Against the reference, and the rest must be untouched
+            uint32_t off = 0;
+            for (int16_t y = 0; y < LCD_HEIGHT; y++) {
+                uint8_t m = GFX_Shader_Spans(s, y, 0, LCD_WIDTH, span);
+                for (int16_t x = 0; x < LCD_WIDTH; x++) {
+                    uint8_t in = 0;
+                    for (uint8_t j = 0; j < m; j++) in |= x >= span[2 * j] && x < span[2 * j + 1];
+                    UWORD got = GC9A01_Sim_GetPixel(x, y);
+                    if (in ? !Matches(&cases[i], x, y, got) : got != LCD_COLOR_BLACK) off++;
+                }
+            }
+            off_total += off;
+
+            printf("%-8s %-6s %6lu  %8lu  %5lu  %7.0f  %7.2f  %5.3f  %6.1f  %6lu\n",
+                   cases[i].name, masked ? "circle" : "none", (unsigned long)px,
+                   (unsigned long)st->bytes, (unsigned long)st->transactions, us, solid_us / us,
+                   px / us, cpu, (unsigned long)off);
+
+            if (dir && masked) {
+                char path[256];
+                snprintf(path, sizeof(path), "%s/shader_%s.ppm", dir, cases[i].name);
+                GC9A01_Sim_SavePPM(path);
+            }
+        }
+    }
+
+    printf("all fills within 1 LSB of the reference: %s (%lu px off)\n", off_total ? "NO" : "yes",
+           (unsigned long)off_total);
+    return off_total != 0;
+}
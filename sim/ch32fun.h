@@ -0,0 +1,39 @@
+/**
+ * @file ch32fun.h
+ * @brief Host stand-in for the ch32fun header
+ * 
+ * include/lcd_config.h pulls in ch32fun.h for the pin names. When the
+ * driver is built for the simulator this file is found first (-I sim)
+ * and provides just the pin numbering, using the same encoding as
+ * ch32fun: pin = port * 16 + index (PA=0, PC=2, PD=3).
+ */
+
+#ifndef _SIM_CH32FUN_H_
+#define _SIM_CH32FUN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PA1  0x01
+#define PA2  0x02
+#define PC0  0x20
+#define PC1  0x21
+#define PC2  0x22
+#define PC3  0x23
+#define PC4  0x24
+#define PC5  0x25
+#define PC6  0x26
+#define PC7  0x27
+#define PD0  0x30
+#define PD1  0x31
+#define PD2  0x32
+#define PD3  0x33
+#define PD4  0x34
+#define PD5  0x35
+#define PD6  0x36
+#define PD7  0x37
+
+#define FUNCONF_SYSTEM_CORE_CLOCK  48000000
+#define DELAY_US_TIME  (FUNCONF_SYSTEM_CORE_CLOCK / 8000000)   // SysTick at HCLK/8
+
+#endif // _SIM_CH32FUN_H_
@@ -0,0 +1,71 @@
+/**
+ * @file dev_config_sim.c
+ * @brief The Pi's DEV_Config on the panel simulator, for scene_check
+ *
+ * Drop-in replacement for RaspberryPi/c/lib/Config/DEV_Config.c: pin
+ * writes go to the GC9A01 model (panel 0) and every SPI transfer is one
+ * transaction, as the hardware CE0 line the Pi examples rely on makes
+ * it. Bytes advance simulated time at the Pi's 25 MHz SPI clock.
+ */
+
+#include "DEV_Config.h"
+#include "gc9a01_sim.h"
+
+/// Time to clock one byte at 25 MHz
+#define PI_BYTE_NS  320
+
+UBYTE DEV_ModuleInit(void)
+{
+    GC9A01_Sim_SetCS(0, 1);
+    GC9A01_Sim_SetRST(0, 1);
+    GC9A01_Sim_SetBL(1);
+    return 0;
+}
+
+void DEV_ModuleExit(void)
+{
+}
+
+void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
+{
+}
+
+void DEV_Digital_Write(UWORD Pin, UBYTE Value)
+{
+    if (Pin == LCD_DC) GC9A01_Sim_SetDC(Value);
+    else if (Pin == LCD_RST) GC9A01_Sim_SetRST(0, Value);
+    else if (Pin == LCD_BL) GC9A01_Sim_SetBL(Value);
+}
+
+/**
+ * @brief Keys read as released
+ */
+UBYTE DEV_Digital_Read(UWORD Pin)
+{
+    return 1;
+}
+
+void DEV_Delay_ms(UDOUBLE xms)
+{
+    GC9A01_Sim_Advance((uint64_t)xms * 1000000ULL);
+}
+
+void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
+{
+    GC9A01_Sim_SetCS(0, 0);
+    for (uint32_t i = 0; i < Len; i++) {
+        GC9A01_Sim_Advance(PI_BYTE_NS);
+        GC9A01_Sim_Byte(pData[i]);
+    }
+    GC9A01_Sim_SetCS(0, 1);
+}
+
+void DEV_SPI_WriteByte(UBYTE Value)
+{
+    DEV_SPI_Write_nByte(&Value, 1);
+}
+
+void DEV_SetBacklight(UWORD Value)
+{
+    GC9A01_Sim_SetBL(Value != 0);
+}
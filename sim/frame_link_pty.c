@@ -0,0 +1,123 @@
+/**
+ * @file frame_link_pty.c
+ * @brief UART frame link receiver on a pseudo-terminal, for end-to-end tests
+ *
+ * Runs lib/frame_link against the panel simulator with a pty standing in
+ * for USART1, so tools/frame_send.py can drive it exactly like the board:
+ *
+ *   ./bin/frame_link_pty -o panel.ppm &        prints the pty path
+ *   ../tools/frame_send.py /dev/pts/N a.ppm b.ppm
+ *
+ * After every end packet it prints the packets, pixels and simulated SPI
+ * time of the frame and, with -o, saves the panel contents. The line
+ * rate is not modelled: frame_send.py reports the UART time.
+ *
+ * Usage: ./bin/frame_link_pty [-o panel.ppm] [-n frames]
+ */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+#include "frame_link.h"
+
+/// Silence after which a half-received packet is dropped
+#define IDLE_TIMEOUT_MS  50
+
+static int Open_Pty(int *slave)
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    struct termios tio;
+
+    if (master < 0 || grantpt(master) || unlockpt(master)) return -1;
+
+    // Keep a slave descriptor open so the master survives senders that
+    // open and close the port, and make the line raw like a UART
+    *slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (*slave < 0 || tcgetattr(*slave, &tio)) return -1;
+    cfmakeraw(&tio);
+    tcsetattr(*slave, TCSANOW, &tio);
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+    return master;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out = NULL;
+    long frames = 0;
+    int opt, slave;
+
+    while ((opt = getopt(argc, argv, "o:n:")) != -1) {
+        if (opt == 'o') out = optarg;
+        else if (opt == 'n') frames = strtol(optarg, NULL, 0);
+        else {
+            fprintf(stderr, "usage: %s [-o panel.ppm] [-n frames]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int master = Open_Pty(&slave);
+    if (master < 0) {
+        perror("pty");
+        return 1;
+    }
+
+    GC9A01_Sim_Reset();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+    GC9A01_Sim_SetUART(master);
+    LCD_HAL_UART_Init(LCD_UART_BAUD);
+
+    FrameLink link;
+    FrameLink_Init(&link);
+
+    printf("%s\n", ptsname(master));
+    fflush(stdout);
+
+    UDOUBLE packets = 0, pixels = 0;
+    uint64_t t0 = GC9A01_Sim_TimeNs();
+    GC9A01_Sim_ResetStats();
+
+    while (frames == 0 || (long)link.frames < frames) {
+        struct pollfd pfd = {master, POLLIN, 0};
+        if (poll(&pfd, 1, IDLE_TIMEOUT_MS) == 0) {
+            FrameLink_Timeout(&link);
+            continue;
+        }
+
+        UDOUBLE done = link.frames;
+        FrameLink_Poll(&link);
+        if (link.frames == done) continue;
+
+        const GC9A01_SimStats *s = GC9A01_Sim_Stats();
+        printf("frame %lu: %lu packets (%lu bad), %lu pixels, %lu SPI bytes, %.1f ms SPI\n",
+               (unsigned long)link.frames, (unsigned long)(link.packets - packets),
+               (unsigned long)link.bad, (unsigned long)(link.pixels - pixels),
+               (unsigned long)s->bytes, (GC9A01_Sim_TimeNs() - t0) / 1e6);
+        fflush(stdout);
+        if (out && GC9A01_Sim_SavePPM(out)) {
+            perror(out);
+        }
+        packets = link.packets;
+        pixels = link.pixels;
+        t0 = GC9A01_Sim_TimeNs();
+        GC9A01_Sim_ResetStats();
+    }
+
+    // Let the last replies drain before the pty goes away
+    tcdrain(slave);
+    usleep(100000);
+    return link.bad ? 1 : 0;
+}
@@ -0,0 +1,588 @@
+/**
+ * @file gc9a01_sim.c
+ * @brief Host-side GC9A01 panel model implementation
+ *
+ * GRAM is kept in physical panel order (row 0 = first line the panel
+ * scans with ML=0), so MADCTL only affects how CASET/RASET/RAMWR map
+ * onto it, exactly like the real controller.
+ *
+ * Up to GC9A01_SIM_PANELS controllers share the bus: each has its own CS
+ * and RST, and a byte clocked while several CS lines are low reaches all
+ * of them (broadcast).
+ *
+ * Tearing model:
+ * - Every RAMWR opens a "window" with a sequence number
+ * - Each GRAM row remembers the sequence of the last write that touched it
+ * - As the scan passes a row, the sequence it shows is latched
+ * - At the end of a frame, a window whose rows were shown partly old and
+ *   partly new counts the frame as torn
+ */
+
+#include "gc9a01_sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIM_WINDOWS  8   ///< RAMWR windows tracked for tearing
+
+typedef struct {
+    uint32_t seq;        ///< Sequence number of the RAMWR
+    uint16_t y0, y1;     ///< Physical rows covered (y1 exclusive)
+    UBYTE used;
+} SimWindow;
+
+/// One controller: GRAM, interface state, registers, scan and power
+typedef struct {
+    UWORD gram[LCD_HEIGHT][LCD_WIDTH];
+    uint32_t row_seq[LCD_HEIGHT];    ///< Last RAMWR that wrote the row
+    uint32_t shown_seq[LCD_HEIGHT];  ///< RAMWR visible when the row was scanned
+    SimWindow windows[SIM_WINDOWS];
+    uint32_t seq;
+    UBYTE next_window;
+
+    // Interface state
+    UBYTE cs, rst;
+    UBYTE cmd;
+    UBYTE params[16];
+    UBYTE nparams;
+    UBYTE pixel_hi;
+    UBYTE have_hi;
+    UBYTE in_ramwr;
+
+    // Controller registers
+    uint16_t xs, xe, ys, ye;         ///< Logical window (inclusive)
+    uint16_t wx, wy;                 ///< Write pointer
+    UBYTE madctl;
+    UBYTE colmod;
+    UBYTE sleeping;
+    UBYTE idle;
+    UBYTE partial;
+    uint16_t ptl_start, ptl_end;     ///< Partial area rows (inclusive)
+    UBYTE display_on;
+    UBYTE te_on;
+    UBYTE te_mode;
+    uint16_t te_line;
+
+    // Scan-out
+    uint64_t scanned;                ///< Absolute scanlines processed
+    uint32_t frames;
+    uint32_t torn;
+
+    // Power
+    uint64_t slp_cmd_ns;             ///< Last SLPIN/SLPOUT (valid if slp_seen)
+    uint64_t slpout_ns;              ///< Last SLPOUT (valid if slpout_seen)
+    UBYTE slp_seen, slpout_seen;
+    UBYTE wake_pending;
+    uint64_t wake_start_ns;
+    GC9A01_SimPower power;
+} SimPanel;
+
+/// Panels and the bus they share (SCK, MOSI, DC, backlight)
+static struct {
+    SimPanel panel[GC9A01_SIM_PANELS];
+    SimPanel *view;                  ///< Panel the inspection functions read
+    UBYTE dc;
+    UBYTE backlight;
+    uint64_t now;
+    GC9A01_SimCommandHook hook;
+    GC9A01_SimStats stats;
+} sim;
+
+// ============================================================================
+// SCAN-OUT
+// ============================================================================
+
+/**
+ * @brief Latch what was visible in each window and count torn frames
+ */
+static void Sim_EndFrame(SimPanel *p)
+{
+    UBYTE torn = 0;
+
+    p->frames++;
+    for (UBYTE i = 0; i < SIM_WINDOWS; i++) {
+        SimWindow *w = &p->windows[i];
+        UBYTE has_new = 0, has_old = 0;
+
+        if (!w->used) continue;
+        for (uint16_t y = w->y0; y < w->y1; y++) {
+            if (p->shown_seq[y] >= w->seq) has_new = 1;
+            else has_old = 1;
+        }
+        if (has_new && has_old) torn = 1;
+        if (!has_old) w->used = 0;  // Fully shown - done with it
+    }
+    if (torn) p->torn++;
+}
+
+/**
+ * @brief Run a panel's scan up to the current time
+ */
+static void Sim_Scan(SimPanel *p)
+{
+    uint64_t target = sim.now / GC9A01_SIM_LINE_NS;
+
+    while (p->scanned < target) {
+        uint16_t idx = p->scanned % GC9A01_SIM_SCAN_LINES;
+
+        if (idx < LCD_HEIGHT) {
+            // ML reverses the refresh order
+            uint16_t row = (p->madctl & 0x10) ? (LCD_HEIGHT - 1 - idx) : idx;
+            p->shown_seq[row] = p->row_seq[row];
+            if (idx == LCD_HEIGHT - 1) Sim_EndFrame(p);
+        }
+        p->scanned++;
+    }
+}
+
+// ============================================================================
+// ADDRESSING
+// ============================================================================
+
+/**
+ * @brief Map a logical (column, row) to GRAM through MADCTL MX/MY/MV
+ *
+ * MV exchanges the two first; MX and MY then reverse the physical column
+ * and row. (This ordering is what makes the panel offsets of the ST7789
+ * modules in the Pi drivers come out right.)
+ *
+ * @return 0 if the address falls outside the panel
+ */
+static UBYTE Sim_Map(const SimPanel *p, uint16_t col, uint16_t row, uint16_t *px, uint16_t *py)
+{
+    if (col >= LCD_WIDTH || row >= LCD_HEIGHT) return 0;
+    uint16_t c = (p->madctl & 0x20) ? row : col;                       // MV
+    uint16_t r = (p->madctl & 0x20) ? col : row;
+    *px = (p->madctl & 0x40) ? (LCD_WIDTH - 1 - c) : c;               // MX
+    *py = (p->madctl & 0x80) ? (LCD_HEIGHT - 1 - r) : r;              // MY
+    return 1;
+}
+
+/**
+ * @brief Start a RAMWR: reset the pointer and open a tearing window
+ */
+static void Sim_BeginWrite(SimPanel *p)
+{
+    uint16_t ax, ay, bx, by;
+
+    p->wx = p->xs;
+    p->wy = p->ys;
+    p->in_ramwr = 1;
+    p->have_hi = 0;
+    p->seq++;
+
+    if (Sim_Map(p, p->xs, p->ys, &ax, &ay) && Sim_Map(p, p->xe, p->ye, &bx, &by)) {
+        SimWindow *w = &p->windows[p->next_window];
+        w->seq = p->seq;
+        w->y0 = (ay < by) ? ay : by;
+        w->y1 = ((ay < by) ? by : ay) + 1;
+        w->used = 1;
+        p->next_window = (p->next_window + 1) % SIM_WINDOWS;
+    }
+}
+
+/**
+ * @brief Store one pixel at the write pointer and advance it
+ */
+static void Sim_WritePixel(SimPanel *p, UWORD color)
+{
+    uint16_t px, py;
+
+    if (Sim_Map(p, p->wx, p->wy, &px, &py)) {
+        p->gram[py][px] = color;
+        p->row_seq[py] = p->seq;
+    }
+
+    if (++p->wx > p->xe) {
+        p->wx = p->xs;
+        if (++p->wy > p->ye) p->wy = p->ys;  // Wraps like the controller
+    }
+}
+
+// ============================================================================
+// COMMAND DECODER
+// ============================================================================
+
+/**
+ * @brief Reset controller registers to their power-on values
+ */
+static void Sim_ResetRegisters(SimPanel *p)
+{
+    p->xs = 0;
+    p->xe = LCD_WIDTH - 1;
+    p->ys = 0;
+    p->ye = LCD_HEIGHT - 1;
+    p->madctl = 0;
+    p->colmod = 0x66;
+    p->sleeping = 1;
+    p->idle = 0;
+    p->partial = 0;
+    p->ptl_start = 0;
+    p->ptl_end = LCD_HEIGHT - 1;
+    p->display_on = 0;
+    p->te_on = 0;
+    p->te_mode = 0;
+    p->te_line = LCD_HEIGHT;  // Default TE = start of vertical blanking
+    p->in_ramwr = 0;
+    p->nparams = 0;
+    p->have_hi = 0;
+}
+
+/**
+ * @brief Power mode as a GC9A01_SIM_* index
+ */
+static UBYTE Sim_PowerMode(const SimPanel *p)
+{
+    if (p->sleeping) return GC9A01_SIM_SLEEP;
+    return (p->idle ? GC9A01_SIM_IDLE : 0) | (p->partial ? GC9A01_SIM_PARTIAL : 0);
+}
+
+/**
+ * @brief Check sleep timing and track wake-ups
+ *
+ * Datasheet: no command within 5 ms of SLPIN or SLPOUT, and no SLPIN
+ * within 120 ms of SLPOUT. A wake-up runs from the first command that
+ * leaves a low-power mode to the next RAMWR.
+ */
+static void Sim_PowerCommand(SimPanel *p, UBYTE cmd)
+{
+    if (p->slp_seen && sim.now - p->slp_cmd_ns < 5000000ULL) p->power.violations++;
+    if (cmd == 0x10 && p->slpout_seen && sim.now - p->slpout_ns < 120000000ULL) {
+        p->power.violations++;
+    }
+
+    UBYTE wakes = (cmd == 0x11 && p->sleeping) || (cmd == 0x38 && p->idle) ||
+                  (cmd == 0x13 && p->partial);
+    if (wakes && !p->wake_pending) {
+        p->wake_pending = 1;
+        p->wake_start_ns = sim.now;
+    }
+    if (cmd == 0x2C && p->wake_pending) {
+        uint64_t ns = sim.now - p->wake_start_ns;
+        p->wake_pending = 0;
+        p->power.wakes++;
+        p->power.wake_ns_total += ns;
+        if (ns > p->power.wake_ns_max) p->power.wake_ns_max = ns;
+    }
+
+    if (cmd == 0x10 || cmd == 0x11) {
+        p->slp_cmd_ns = sim.now;
+        p->slp_seen = 1;
+    }
+    if (cmd == 0x11) {
+        p->slpout_ns = sim.now;
+        p->slpout_seen = 1;
+    }
+}
+
+/**
+ * @brief Handle a command byte (DC low)
+ */
+static void Sim_Command(SimPanel *p, UBYTE cmd)
+{
+    p->cmd = cmd;
+    p->nparams = 0;
+    p->in_ramwr = 0;
+    Sim_PowerCommand(p, cmd);
+
+    switch (cmd) {
+    case 0x01: Sim_ResetRegisters(p); break;       // SWRESET
+    case 0x10: p->sleeping = 1; break;           // SLPIN
+    case 0x11: p->sleeping = 0; break;           // SLPOUT
+    case 0x12: p->partial = 1; break;            // PTLON
+    case 0x13: p->partial = 0; break;            // NORON
+    case 0x28: p->display_on = 0; break;         // DISPOFF
+    case 0x29: p->display_on = 1; break;         // DISPON
+    case 0x38: p->idle = 0; break;               // IDMOFF
+    case 0x39: p->idle = 1; break;               // IDMON
+    case 0x2C: Sim_BeginWrite(p); break;           // RAMWR
+    case 0x3C: p->in_ramwr = 1; break;           // RAMWR continue
+    case 0x34: p->te_on = 0; break;              // TEOFF
+    case 0x35: p->te_on = 1; break;              // TEON (mode in parameter)
+    default: break;
+    }
+}
+
+/**
+ * @brief Handle a parameter byte of the current command
+ */
+static void Sim_Param(SimPanel *p, UBYTE value)
+{
+    if (p->nparams < sizeof(p->params)) p->params[p->nparams++] = value;
+    const UBYTE *v = p->params;
+
+    switch (p->cmd) {
+    case 0x2A:  // CASET
+        if (p->nparams == 4) {
+            p->xs = (v[0] << 8) | v[1];
+            p->xe = (v[2] << 8) | v[3];
+        }
+        break;
+    case 0x2B:  // RASET
+        if (p->nparams == 4) {
+            p->ys = (v[0] << 8) | v[1];
+            p->ye = (v[2] << 8) | v[3];
+        }
+        break;
+    case 0x30:  // PTLAR
+        if (p->nparams == 4) {
+            p->ptl_start = (v[0] << 8) | v[1];
+            p->ptl_end = (v[2] << 8) | v[3];
+        }
+        break;
+    case 0x36:  // MADCTL
+        p->madctl = v[0];
+        break;
+    case 0x3A:  // COLMOD
+        p->colmod = v[0];
+        break;
+    case 0x35:  // TEON mode
+        p->te_mode = v[0] & 1;
+        break;
+    case 0x44:  // Set tear scanline
+        if (p->nparams == 2) p->te_line = ((v[0] << 8) | v[1]) % GC9A01_SIM_SCAN_LINES;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Handle a data byte (DC high): pixel half or parameter
+ *
+ * @return 1 if it completed a pixel
+ */
+static UBYTE Sim_Data(SimPanel *p, UBYTE value)
+{
+    if (!p->in_ramwr) {
+        Sim_Param(p, value);
+        return 0;
+    }
+    if (!p->have_hi) {
+        p->pixel_hi = value;
+        p->have_hi = 1;
+        return 0;
+    }
+    Sim_WritePixel(p, (p->pixel_hi << 8) | value);
+    p->have_hi = 0;
+    return 1;
+}
+
+/**
+ * @brief Panel listening to the bus: CS low and out of reset
+ */
+static UBYTE Sim_Listening(const SimPanel *p)
+{
+    return !p->cs && p->rst;
+}
+
+// ============================================================================
+// PUBLIC INTERFACE
+// ============================================================================
+
+void GC9A01_Sim_Reset(void)
+{
+    memset(&sim, 0, sizeof(sim));
+    sim.view = &sim.panel[0];
+    sim.backlight = 1;
+    sim.dc = 1;
+    for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+        sim.panel[i].cs = 1;
+        sim.panel[i].rst = 1;
+        Sim_ResetRegisters(&sim.panel[i]);
+    }
+}
+
+/**
+ * @brief CS of one panel; a transaction ends when the last CS goes high
+ */
+void GC9A01_Sim_SetCS(UBYTE panel, UBYTE level)
+{
+    if (panel >= GC9A01_SIM_PANELS) return;
+    SimPanel *p = &sim.panel[panel];
+    
+    if (level && !p->cs) {
+        p->have_hi = 0;
+        p->cs = 1;
+        for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+            if (!sim.panel[i].cs) return;
+        }
+        sim.stats.transactions++;
+    }
+    p->cs = level ? 1 : 0;
+}
+
+void GC9A01_Sim_SetDC(UBYTE level)
+{
+    sim.dc = level ? 1 : 0;
+}
+
+void GC9A01_Sim_SetRST(UBYTE panel, UBYTE level)
+{
+    if (panel >= GC9A01_SIM_PANELS) return;
+    SimPanel *p = &sim.panel[panel];
+    
+    if (!level && p->rst) Sim_ResetRegisters(p);
+    p->rst = level ? 1 : 0;
+}
+
+/**
+ * @brief A byte on the bus, taken by every listening panel at once
+ *
+ * Bus counters count it once however many panels take it.
+ */
+void GC9A01_Sim_Byte(UBYTE value)
+{
+    UBYTE listeners = 0, pixel = 0;
+    
+    for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+        if (Sim_Listening(&sim.panel[i])) listeners++;
+    }
+    if (!listeners) {
+        sim.stats.dropped_bytes++;
+        return;
+    }
+    sim.stats.bytes++;
+
+    if (!sim.dc) {
+        sim.stats.cmd_bytes++;
+        sim.stats.commands[value]++;
+        if (sim.hook) sim.hook(sim.now, value);
+        for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+            if (Sim_Listening(&sim.panel[i])) Sim_Command(&sim.panel[i], value);
+        }
+        return;
+    }
+    sim.stats.data_bytes++;
+
+    for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+        if (Sim_Listening(&sim.panel[i])) pixel |= Sim_Data(&sim.panel[i], value);
+    }
+    if (pixel) sim.stats.pixels++;
+}
+
+void GC9A01_Sim_SetBL(UBYTE level)
+{
+    sim.backlight = level ? 1 : 0;
+}
+
+void GC9A01_Sim_Advance(uint64_t ns)
+{
+    sim.now += ns;
+    for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+        SimPanel *p = &sim.panel[i];
+        p->power.mode_ns[Sim_PowerMode(p)] += ns;
+        if (sim.backlight) p->power.backlight_ns += ns;
+        Sim_Scan(p);
+    }
+}
+
+uint64_t GC9A01_Sim_TimeNs(void)
+{
+    return sim.now;
+}
+
+/**
+ * @brief Time of the next TE rising edge (the TE pad of panel 0)
+ *
+ * @return Absolute time in ns, or UINT64_MAX if TE is off
+ */
+uint64_t GC9A01_Sim_NextTE(void)
+{
+    const SimPanel *p = &sim.panel[0];
+    if (!p->te_on) return UINT64_MAX;
+
+    uint64_t line = sim.now / GC9A01_SIM_LINE_NS + 1;
+    uint64_t frame = line / GC9A01_SIM_SCAN_LINES;
+    uint64_t edge = frame * GC9A01_SIM_SCAN_LINES + p->te_line;
+    if (edge < line) edge += GC9A01_SIM_SCAN_LINES;
+    return edge * GC9A01_SIM_LINE_NS;
+}
+
+/**
+ * @brief Panel read by the inspection functions below (0 after a reset)
+ */
+void GC9A01_Sim_SelectPanel(UBYTE panel)
+{
+    if (panel < GC9A01_SIM_PANELS) sim.view = &sim.panel[panel];
+}
+
+uint32_t GC9A01_Sim_Frames(void)
+{
+    return sim.view->frames;
+}
+
+uint32_t GC9A01_Sim_TornFrames(void)
+{
+    return sim.view->torn;
+}
+
+UWORD GC9A01_Sim_GetPixel(uint16_t x, uint16_t y)
+{
+    if (x >= LCD_WIDTH || y >= LCD_HEIGHT) return 0;
+    return sim.view->gram[y][x];
+}
+
+UBYTE GC9A01_Sim_Madctl(void)
+{
+    return sim.view->madctl;
+}
+
+const GC9A01_SimStats *GC9A01_Sim_Stats(void)
+{
+    return &sim.stats;
+}
+
+void GC9A01_Sim_ResetStats(void)
+{
+    memset(&sim.stats, 0, sizeof(sim.stats));
+}
+
+const GC9A01_SimPower *GC9A01_Sim_Power(void)
+{
+    return &sim.view->power;
+}
+
+void GC9A01_Sim_ResetPower(void)
+{
+    for (UBYTE i = 0; i < GC9A01_SIM_PANELS; i++) {
+        memset(&sim.panel[i].power, 0, sizeof(sim.panel[i].power));
+        sim.panel[i].wake_pending = 0;
+    }
+}
+
+UBYTE GC9A01_Sim_PowerMode(void)
+{
+    return Sim_PowerMode(sim.view);
+}
+
+void GC9A01_Sim_SetCommandHook(GC9A01_SimCommandHook hook)
+{
+    sim.hook = hook;
+}
+
+/**
+ * @brief Write GRAM as a binary PPM (RGB565 expanded to 8 bits per channel)
+ *
+ * @return 0 on success, -1 if the file cannot be written
+ */
+int GC9A01_Sim_SavePPM(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) return -1;
+
+    fprintf(fp, "P6\n%d %d\n255\n", LCD_WIDTH, LCD_HEIGHT);
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            UWORD c = sim.view->gram[y][x];
+            UBYTE rgb[3] = {
+                (UBYTE)(((c >> 11) & 0x1F) * 255 / 31),
+                (UBYTE)(((c >> 5) & 0x3F) * 255 / 63),
+                (UBYTE)((c & 0x1F) * 255 / 31),
+            };
+            fwrite(rgb, 1, 3, fp);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
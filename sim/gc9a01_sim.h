@@ -0,0 +1,100 @@
+/**
+ * @file gc9a01_sim.h
+ * @brief Host-side GC9A01 panel model
+ *
+ * Decodes the byte stream the driver clocks out (CS/DC/SPI) the way the
+ * controller would: command parsing, CASET/RASET/RAMWR addressing with
+ * MADCTL, TE generation and a scan-out model. Bus statistics and a
+ * tearing counter make driver changes measurable without hardware.
+ * Several panels can share the bus, each with its own CS and RST; the
+ * inspection functions read the one picked with GC9A01_Sim_SelectPanel().
+ *
+ * Time is simulated: the HAL stand-in (lcd_hal_sim.c) advances the clock
+ * for every byte at LCD_SPI_SPEED_HZ and for every delay.
+ */
+
+#ifndef _GC9A01_SIM_H_
+#define _GC9A01_SIM_H_
+
+#include "lcd_config.h"
+
+/// Panels on the simulated bus (the driver uses LCD_PANEL_COUNT of them)
+#define GC9A01_SIM_PANELS  4
+
+/// Scanlines per frame, visible plus porch
+#define GC9A01_SIM_SCAN_LINES  (LCD_HEIGHT + LCD_VBLANK_LINES)
+
+/// Time for the panel to scan one line
+#define GC9A01_SIM_LINE_NS  ((uint64_t)LCD_FRAME_PERIOD_US * 1000 / GC9A01_SIM_SCAN_LINES)
+
+/**
+ * @brief Bus counters, reset with GC9A01_Sim_ResetStats()
+ */
+typedef struct {
+    uint32_t bytes;          ///< Bytes clocked with a CS low (once per broadcast)
+    uint32_t cmd_bytes;      ///< ...of which commands (DC low)
+    uint32_t data_bytes;     ///< ...of which data (DC high)
+    uint32_t pixels;         ///< Pixels sent to GRAM (once per broadcast)
+    uint32_t dropped_bytes;  ///< Bytes clocked with every CS high (ignored)
+    uint32_t transactions;   ///< Times the last low CS went high
+    uint32_t commands[256];  ///< Count per command byte
+} GC9A01_SimStats;
+
+/// Power modes for GC9A01_SimPower::mode_ns (IDLE/PARTIAL combine)
+#define GC9A01_SIM_NORMAL   0
+#define GC9A01_SIM_IDLE     1
+#define GC9A01_SIM_PARTIAL  2
+#define GC9A01_SIM_SLEEP    4
+#define GC9A01_SIM_MODES    5
+
+/**
+ * @brief Power accounting, reset with GC9A01_Sim_ResetPower()
+ */
+typedef struct {
+    uint64_t mode_ns[GC9A01_SIM_MODES];  ///< Time per mode (index 3 = partial + idle)
+    uint64_t backlight_ns;               ///< Time with the backlight pin high
+    uint32_t wakes;                      ///< Completed wake-ups
+    uint64_t wake_ns_total;              ///< Sum of wake latencies
+    uint64_t wake_ns_max;                ///< Longest wake latency
+    uint32_t violations;                 ///< Sleep in/out timing rules broken
+} GC9A01_SimPower;
+
+/// Called for every command byte with the simulated time
+typedef void (*GC9A01_SimCommandHook)(uint64_t ns, UBYTE cmd);
+
+// Reset and pin inputs
+void GC9A01_Sim_Reset(void);
+void GC9A01_Sim_SetCS(UBYTE panel, UBYTE level);
+void GC9A01_Sim_SetDC(UBYTE level);
+void GC9A01_Sim_SetRST(UBYTE panel, UBYTE level);
+void GC9A01_Sim_SetBL(UBYTE level);
+void GC9A01_Sim_Byte(UBYTE value);
+
+// Simulated time and scan-out
+void GC9A01_Sim_Advance(uint64_t ns);
+uint64_t GC9A01_Sim_TimeNs(void);
+uint64_t GC9A01_Sim_NextTE(void);
+uint32_t GC9A01_Sim_Frames(void);
+uint32_t GC9A01_Sim_TornFrames(void);
+
+// Inspection, of the selected panel (bus statistics cover all)
+void GC9A01_Sim_SelectPanel(UBYTE panel);
+UWORD GC9A01_Sim_GetPixel(uint16_t x, uint16_t y);
+UBYTE GC9A01_Sim_Madctl(void);
+const GC9A01_SimStats *GC9A01_Sim_Stats(void);
+void GC9A01_Sim_ResetStats(void);
+int GC9A01_Sim_SavePPM(const char *path);
+
+// Power modes: time in mode, wake latency (first wake command to the next
+// RAMWR) and a per-command hook for logging
+const GC9A01_SimPower *GC9A01_Sim_Power(void);
+void GC9A01_Sim_ResetPower(void);
+UBYTE GC9A01_Sim_PowerMode(void);
+void GC9A01_Sim_SetCommandHook(GC9A01_SimCommandHook hook);
+
+// HAL stand-in: descriptor used for LCD_HAL_UART_Read()/Write()
+void GC9A01_Sim_SetUART(int fd);
+// HAL stand-in: 0 = TE pad not wired, LCD_HAL_TE_Wait() always times out
+void GC9A01_Sim_SetTEWired(UBYTE wired);
+
+#endif // _GC9A01_SIM_H_
@@ -0,0 +1,226 @@
+/**
+ * @file lcd_hal_sim.c
+ * @brief LCD HAL implementation for the host simulator
+ *
+ * Drop-in replacement for lib/lcd_hal/lcd_hal.c: instead of touching
+ * CH32v003 registers, pin writes and SPI bytes are forwarded to the
+ * GC9A01 model, and every byte and delay advances simulated time.
+ *
+ * With LCD_TRACE=<file> in the environment the bus is also recorded as a
+ * lib/trace file, the same records lib/lcd_hal writes with
+ * LCD_TRACE_ENABLED, in simulated time.
+ */
+
+#include "lcd_hal.h"
+#include "gc9a01_sim.h"
+#include "lcd_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/// Time to clock one byte at LCD_SPI_SPEED_HZ
+#define SIM_BYTE_NS  (8ULL * 1000000000ULL / LCD_SPI_SPEED_HZ)
+
+static UDOUBLE sim_te_count = 0;
+
+/// 0 = TE pad left unconnected (see GC9A01_Sim_SetTEWired())
+static UBYTE sim_te_wired = 1;
+
+/// File descriptor standing in for USART1 (e.g. a pty master), -1 = none
+static int sim_uart_fd = -1;
+
+static const UWORD sim_cs_pins[] = LCD_PANEL_CS_PINS;
+static const UWORD sim_rst_pins[] = LCD_PANEL_RST_PINS;
+
+static LCD_Trace sim_trace;
+static uint8_t sim_trace_buf[4096];
+static FILE *sim_trace_fp;
+
+static void Sim_TraceWrite(const uint8_t *data, uint16_t len, void *ctx)
+{
+    fwrite(data, 1, len, (FILE *)ctx);
+}
+
+/**
+ * @brief LCD_HAL_Ticks() that keeps counting across GC9A01_Sim_Reset()
+ */
+static uint32_t Sim_TraceClock(void)
+{
+    static uint64_t last_ns, base_ns;
+    uint64_t ns = GC9A01_Sim_TimeNs();
+
+    if (ns < last_ns) base_ns += last_ns - ns;
+    last_ns = ns;
+    return (uint32_t)((base_ns + ns) * LCD_HAL_TICKS_PER_US / 1000);
+}
+
+static void Sim_TraceClose(void)
+{
+    LCD_Trace_Flush(&sim_trace);
+    fclose(sim_trace_fp);
+}
+
+/**
+ * @brief Start the trace on the first LCD_HAL_Init() if LCD_TRACE names a file
+ */
+static void Sim_TraceOpen(void)
+{
+    const char *path = getenv("LCD_TRACE");
+
+    if (sim_trace_fp || !path || !*path) return;
+    sim_trace_fp = fopen(path, "wb");
+    if (!sim_trace_fp) {
+        perror(path);
+        return;
+    }
+    LCD_Trace_Init(&sim_trace, sim_trace_buf, sizeof(sim_trace_buf), Sim_TraceClock,
+                   Sim_TraceWrite, sim_trace_fp, LCD_HAL_TICKS_PER_US * 1000000UL,
+                   LCD_SPI_SPEED_HZ);
+    atexit(Sim_TraceClose);
+}
+
+void LCD_HAL_TraceMark(UDOUBLE id)
+{
+    if (sim_trace_fp) LCD_Trace_Mark(&sim_trace, id);
+}
+
+void LCD_HAL_TraceFlush(void)
+{
+    if (sim_trace_fp) LCD_Trace_Flush(&sim_trace);
+}
+
+void LCD_HAL_GPIO_Init(void)
+{
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        LCD_HAL_DigitalWrite(sim_cs_pins[i], 1);
+        LCD_HAL_DigitalWrite(sim_rst_pins[i], 1);
+    }
+    LCD_HAL_DigitalWrite(LCD_DC_PIN, 0);
+    LCD_HAL_DigitalWrite(LCD_BL_PIN, 1);
+}
+
+/**
+ * @brief Route a pin to the panels wired to it (an RST pin may be shared)
+ */
+void LCD_HAL_DigitalWrite(UWORD Pin, UBYTE Value)
+{
+    if (Pin == LCD_DC_PIN) GC9A01_Sim_SetDC(Value);
+    else if (Pin == LCD_BL_PIN) GC9A01_Sim_SetBL(Value);
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if (Pin == sim_cs_pins[i]) GC9A01_Sim_SetCS(i, Value);
+        if (Pin == sim_rst_pins[i]) GC9A01_Sim_SetRST(i, Value);
+    }
+    if (!sim_trace_fp) return;
+    if (Pin == LCD_DC_PIN) LCD_Trace_Pin(&sim_trace, 0, LCD_TRACE_DC, Value);
+    if (Pin == LCD_BL_PIN) LCD_Trace_Pin(&sim_trace, 0, LCD_TRACE_BL, Value);
+    for (UBYTE i = 0; i < LCD_PANEL_COUNT; i++) {
+        if (Pin == sim_cs_pins[i]) LCD_Trace_Pin(&sim_trace, i, LCD_TRACE_CS, Value);
+        if (Pin == sim_rst_pins[i]) LCD_Trace_Pin(&sim_trace, i, LCD_TRACE_RST, Value);
+    }
+}
+
+void LCD_HAL_SPI_Init(void)
+{
+}
+
+void LCD_HAL_SPI_WriteByte(UBYTE Value)
+{
+    GC9A01_Sim_Advance(SIM_BYTE_NS);
+    GC9A01_Sim_Byte(Value);
+    if (sim_trace_fp) LCD_Trace_Byte(&sim_trace, Value);
+}
+
+void LCD_HAL_SPI_WriteBytes(uint8_t *pData, uint32_t Length)
+{
+    for (uint32_t i = 0; i < Length; i++) {
+        LCD_HAL_SPI_WriteByte(pData[i]);
+    }
+}
+
+void LCD_HAL_SPI_WaitIdle(void)
+{
+}
+
+void LCD_HAL_TE_Init(void)
+{
+    sim_te_count = 0;
+}
+
+UDOUBLE LCD_HAL_TE_Count(void)
+{
+    return sim_te_count;
+}
+
+/**
+ * @brief Jump simulated time to the next TE edge, or to the timeout
+ */
+UBYTE LCD_HAL_TE_Wait(UDOUBLE timeout_ms)
+{
+    uint64_t now = GC9A01_Sim_TimeNs();
+    uint64_t edge = sim_te_wired ? GC9A01_Sim_NextTE() : UINT64_MAX;
+    uint64_t limit = now + (uint64_t)timeout_ms * 1000000ULL;
+
+    if (edge > limit) {
+        GC9A01_Sim_Advance(limit - now);
+        return 0;
+    }
+    GC9A01_Sim_Advance(edge - now);
+    sim_te_count++;
+    return 1;
+}
+
+void GC9A01_Sim_SetUART(int fd)
+{
+    sim_uart_fd = fd;
+}
+
+void GC9A01_Sim_SetTEWired(UBYTE wired)
+{
+    sim_te_wired = wired;
+}
+
+void LCD_HAL_UART_Init(UDOUBLE baud)
+{
+    (void)baud;
+}
+
+/**
+ * @brief Non-blocking read from the UART descriptor (must be O_NONBLOCK)
+ */
+UBYTE LCD_HAL_UART_Read(UBYTE *value)
+{
+    return sim_uart_fd >= 0 && read(sim_uart_fd, value, 1) == 1;
+}
+
+void LCD_HAL_UART_Write(UBYTE value)
+{
+    if (sim_uart_fd >= 0 && write(sim_uart_fd, &value, 1) != 1) {
+        sim_uart_fd = -1;
+    }
+}
+
+void LCD_HAL_Delay_ms(UDOUBLE ms)
+{
+    if (sim_trace_fp) LCD_Trace_Delay(&sim_trace, ms * 1000);
+    GC9A01_Sim_Advance((uint64_t)ms * 1000000ULL);
+}
+
+void LCD_HAL_Delay_us(UDOUBLE us)
+{
+    if (sim_trace_fp) LCD_Trace_Delay(&sim_trace, us);
+    GC9A01_Sim_Advance((uint64_t)us * 1000ULL);
+}
+
+UDOUBLE LCD_HAL_Ticks(void)
+{
+    return (UDOUBLE)(GC9A01_Sim_TimeNs() * LCD_HAL_TICKS_PER_US / 1000);
+}
+
+void LCD_HAL_Init(void)
+{
+    Sim_TraceOpen();
+    LCD_HAL_GPIO_Init();
+    LCD_HAL_SPI_Init();
+    LCD_HAL_TE_Init();
+}
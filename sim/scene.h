@@ -0,0 +1,24 @@
+/**
+ * @file scene.h
+ * @brief Canonical scenes for scene_check, one table per port
+ */
+
+#ifndef _SCENE_H_
+#define _SCENE_H_
+
+typedef struct {
+    const char *port;
+    const char *name;
+    void (*setup)(void);        ///< Bring the panel up, not counted (NULL = none)
+    void (*draw)(void);         ///< The scene; its bus bytes are counted
+} Scene;
+
+/// CH32v003 driver (lib/gc9a01) through the simulator HAL
+extern const Scene Scenes_CH32[];
+extern const unsigned Scenes_CH32_Count;
+
+/// Pi driver (lib/LCD/LCD_1in28.c, lib/GUI) through dev_config_sim.c
+extern const Scene Scenes_Pi[];
+extern const unsigned Scenes_Pi_Count;
+
+#endif // _SCENE_H_
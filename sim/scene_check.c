@@ -0,0 +1,172 @@
+/**
+ * @file scene_check.c
+ * @brief Golden-image and bus-budget check of every port's drawing path
+ *
+ * Runs the canonical scenes of each port (scenes_ch32.c, scenes_pi.c)
+ * against a freshly reset panel simulator and compares them with the
+ * checked-in baseline (scenes.golden; scenes_default.golden for the
+ * shipped one-panel build in bin/default):
+ * - image: CRC-32 of the GRAM must match bit for bit
+ * - bus:   bytes and transactions of the scene must not exceed the
+ *          baseline (less is reported, so the budget can be tightened)
+ *
+ * Exits 1 if any scene fails or has no baseline. After an intended
+ * change, look at the new images (-o) and record them with -u.
+ *
+ * Usage: ./bin/scene_check [-u] [-o dir] [-g scenes.golden]
+ *   -u  rewrite the baseline from this run
+ *   -o  save every scene as <dir>/<port>-<scene>.ppm
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gc9a01_sim.h"
+#include "scene.h"
+
+#define MAX_SCENES  64
+
+typedef struct {
+    char port[16], name[32];
+    uint32_t crc, bytes, transactions;
+} Result;
+
+static Result baseline[MAX_SCENES];
+static unsigned baseline_count;
+
+/**
+ * @brief CRC-32 (IEEE) of the GRAM, pixels low byte first
+ */
+static uint32_t Gram_Crc(void)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint16_t y = 0; y < LCD_HEIGHT; y++) {
+        for (uint16_t x = 0; x < LCD_WIDTH; x++) {
+            UWORD px = GC9A01_Sim_GetPixel(x, y);
+            crc ^= px & 0xFF;
+            for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+            crc ^= px >> 8;
+            for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static int Load_Baseline(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    char line[256];
+
+    if (!fp) return -1;
+    while (fgets(line, sizeof(line), fp) && baseline_count < MAX_SCENES) {
+        Result *r = &baseline[baseline_count];
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%15s %31s %x %u %u", r->port, r->name, &r->crc, &r->bytes,
+                   &r->transactions) == 5) {
+            baseline_count++;
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+static const Result *Find_Baseline(const Scene *s)
+{
+    for (unsigned i = 0; i < baseline_count; i++) {
+        if (!strcmp(baseline[i].port, s->port) && !strcmp(baseline[i].name, s->name)) {
+            return &baseline[i];
+        }
+    }
+    return NULL;
+}
+
+static void Run(const Scene *s, Result *r, const char *dir)
+{
+    GC9A01_Sim_Reset();
+    if (s->setup) s->setup();
+    GC9A01_Sim_ResetStats();
+    s->draw();
+
+    snprintf(r->port, sizeof(r->port), "%s", s->port);
+    snprintf(r->name, sizeof(r->name), "%s", s->name);
+    r->crc = Gram_Crc();
+    r->bytes = GC9A01_Sim_Stats()->bytes;
+    r->transactions = GC9A01_Sim_Stats()->transactions;
+
+    if (dir) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s-%s.ppm", dir, s->port, s->name);
+        if (GC9A01_Sim_SavePPM(path)) perror(path);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *golden = "scenes.golden";
+    const char *dir = NULL;
+    int update = 0, opt;
+    static const struct { const Scene *scenes; const unsigned *count; } ports[] = {
+        { Scenes_CH32, &Scenes_CH32_Count },
+        { Scenes_Pi,   &Scenes_Pi_Count },
+    };
+    static Result results[MAX_SCENES];
+    unsigned n = 0, failed = 0;
+
+    for (opt = 1; opt < argc; opt++) {
+        if (!strcmp(argv[opt], "-u")) update = 1;
+        else if (!strcmp(argv[opt], "-o") && opt + 1 < argc) dir = argv[++opt];
+        else if (!strcmp(argv[opt], "-g") && opt + 1 < argc) golden = argv[++opt];
+        else {
+            fprintf(stderr, "usage: %s [-u] [-o dir] [-g scenes.golden]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (Load_Baseline(golden) && !update) {
+        fprintf(stderr, "%s: no baseline (record one with -u)\n", golden);
+        return 2;
+    }
+
+    printf("port  scene     gram crc    bytes  (budget)  trans  (budget)  result\n");
+    for (unsigned p = 0; p < sizeof(ports) / sizeof(ports[0]); p++) {
+        for (unsigned i = 0; i < *ports[p].count && n < MAX_SCENES; i++) {
+            const Scene *s = &ports[p].scenes[i];
+            Result *r = &results[n++];
+            const Result *b = Find_Baseline(s);
+            const char *verdict = "ok";
+
+            Run(s, r, dir);
+            if (!b) verdict = "NEW";
+            else if (r->crc != b->crc) verdict = "IMAGE";
+            else if (r->bytes > b->bytes || r->transactions > b->transactions) verdict = "BUS";
+            else if (r->bytes < b->bytes || r->transactions < b->transactions) verdict = "ok (under budget)";
+            if (verdict[0] != 'o') failed++;
+
+            printf("%-5s %-8s  0x%08lX %8lu (%8lu) %6lu (%6lu)  %s\n", r->port, r->name,
+                   (unsigned long)r->crc, (unsigned long)r->bytes,
+                   (unsigned long)(b ? b->bytes : 0), (unsigned long)r->transactions,
+                   (unsigned long)(b ? b->transactions : 0), verdict);
+        }
+    }
+
+    if (update) {
+        FILE *fp = fopen(golden, "w");
+        if (!fp) {
+            perror(golden);
+            return 2;
+        }
+        fprintf(fp, "# scene_check baseline: port, scene, GRAM CRC-32, bus bytes, transactions\n");
+        fprintf(fp, "# Rewritten by ./bin/scene_check -u; review the images (-o) first\n");
+        for (unsigned i = 0; i < n; i++) {
+            fprintf(fp, "%-5s %-8s 0x%08lX %8lu %6lu\n", results[i].port, results[i].name,
+                    (unsigned long)results[i].crc, (unsigned long)results[i].bytes,
+                    (unsigned long)results[i].transactions);
+        }
+        fclose(fp);
+        printf("baseline written to %s\n", golden);
+        return 0;
+    }
+    printf("%u of %u scenes failed\n", failed, n);
+    return failed != 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file scenes_ch32.c
+ * @brief scene_check scenes drawn through the CH32v003 driver
+ *
+ * Each scene uses a different drawing path of lib/gc9a01: fills, row
+ * producers, streaming, orientation, power modes, the incremental
+ * gauge and readout updates and the streamed shader fills.
+ */
+
+#include "lcd_hal.h"
+#include "gc9a01_driver.h"
+#include "gc9a01_sim.h"
+#include "gfx_aa.h"
+#include "gfx_font.h"
+#include "gfx_gauge.h"
+#include "gfx_readout.h"
+#include "gfx_shader.h"
+#include "scene.h"
+
+/// No symmetry, so a wrong window or orientation shows
+static UWORD Pattern(uint16_t x, uint16_t y)
+{
+    return (UWORD)(((x * 7) ^ (y * 3)) + (x < 40 && y < 20 ? 0xF800 : 0));
+}
+
+static void Pattern_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    for (uint16_t i = 0; i < width; i++) line[i] = Pattern(x0 + i, y);
+}
+
+static void Setup(void)
+{
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+}
+
+static void Init(void)
+{
+    LCD_HAL_Init();
+    GC9A01_Init();
+}
+
+static void Fill(void)
+{
+    GC9A01_FillScreen(LCD_COLOR_BLUE);
+    GC9A01_FillRect(20, 30, 220, 60, LCD_COLOR_RED);
+    GC9A01_FillRect(100, 0, 140, 240, LCD_COLOR_GREEN);
+    GC9A01_FillRect(0, 239, 240, 240, LCD_COLOR_WHITE);
+    GC9A01_FillRect(5, 5, 6, 6, LCD_COLOR_YELLOW);
+}
+
+static void Rows(void)
+{
+    GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL);
+    GC9A01_DrawRows(60, 70, 61, 200, Pattern_Row, NULL);
+}
+
+static void Present(void)
+{
+    GC9A01_Present(0, 0, LCD_WIDTH, LCD_HEIGHT, Pattern_Row, NULL);
+}
+
+static void Stream(void)
+{
+    GC9A01_StreamBegin(30, 40, 210, 200);
+    for (uint16_t y = 40; y < 200; y++) {
+        GC9A01_StreamRepeat(LCD_COLOR_CYAN, 60);
+        for (uint16_t x = 90; x < 210; x++) GC9A01_StreamPixel(Pattern(x, y));
+    }
+    GC9A01_StreamEnd();
+}
+
+static void Orient(void)
+{
+    static const UBYTE mirror[] = { GC9A01_MIRROR_NONE, GC9A01_MIRROR_X, GC9A01_MIRROR_Y,
+                                    GC9A01_MIRROR_X | GC9A01_MIRROR_Y };
+    for (UBYTE r = 0; r < 4; r++) {
+        GC9A01_SetOrientation(r, mirror[r]);
+        GC9A01_DrawRows(r * 50, 10, r * 50 + 40, 120, Pattern_Row, NULL);
+    }
+    GC9A01_SetOrientation(GC9A01_ROTATE_0, GC9A01_MIRROR_NONE);
+}
+
+static void Power(void)
+{
+    GC9A01_SetPowerMode(GC9A01_POWER_SLEEP);
+    GC9A01_FillRect(0, 0, 120, 120, LCD_COLOR_MAGENTA);      // Wakes the panel
+    GC9A01_SetPowerMode(GC9A01_POWER_IDLE);
+    GC9A01_FillRect(120, 120, 240, 240, LCD_COLOR_WHITE);
+    GC9A01_SetPowerMode(GC9A01_POWER_NORMAL);
+}
+
+// ----------------------------------------------------------------------------
+// Anti-aliased shapes and text
+// ----------------------------------------------------------------------------
+
+static GFX_AAShape shapes[3];
+static GFX_Text text = { &GFX_Font_Digits24, "12:34.5-6", 40, 180, 0xFFE0 };
+
+static void Shapes_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    for (uint16_t i = 0; i < width; i++) line[i] = 0x0010;
+    for (int k = 0; k < 3; k++) GFX_AA_RenderRow(&shapes[k], y, x0, width, line, GFX_ORDER_NATIVE);
+    GFX_Text_RenderRow(&text, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void Shapes(void)
+{
+    GFX_AA_Circle(&shapes[0], GFX_FIX(120), GFX_FIX(120), GFX_FIX(100), 0x07E0);
+    GFX_AA_Ring(&shapes[1], GFX_FIX(120), GFX_FIX(120), GFX_FIX(60), GFX_FIX(50), 0xF800);
+    GFX_AA_Line(&shapes[2], GFX_FIX(20), GFX_FIX(200), GFX_FIX(220), GFX_FIX(40) + 21, GFX_FIX(3), 0xFFFF);
+    GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Shapes_Row, NULL);
+}
+
+// ----------------------------------------------------------------------------
+// Incremental updates
+// ----------------------------------------------------------------------------
+
+static GFX_Gauge gauge;
+
+static void Gauge_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Gauge_RenderRow(&gauge, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void Gauge_Span(int16_t y, int16_t x0, int16_t x1, void *ctx)
+{
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y < 0 || y >= LCD_HEIGHT || x0 >= x1) return;
+    GC9A01_DrawRows(x0, y, x1, y + 1, Gauge_Row, NULL);
+}
+
+static void Gauge(void)
+{
+    GFX_Gauge_Init(&gauge, LCD_WIDTH / 2, LCD_HEIGHT / 2, LCD_WIDTH / 2 - 4);
+    GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, Gauge_Row, NULL);
+    for (int16_t v = 5; v <= 75; v += 7) GFX_Gauge_SetValue(&gauge, v, Gauge_Span, NULL);
+}
+
+static GFX_Readout readout;
+
+static void Readout_Row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Readout_RenderRow(&readout, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void Readout_Cell(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    GC9A01_DrawRows(x0, y0, x1, y1, Readout_Row, NULL);
+}
+
+static void Readout(void)
+{
+    GFX_Readout_Init(&readout, &GFX_Font_Digits24, 40, 100, 8);
+    for (int s = 0; s < 75; s++) {
+        GFX_Readout_SetClock(&readout, 23, 59, 30 + s % 30, Readout_Cell, NULL);
+    }
+    GFX_Readout_SetFixed(&readout, -12345, 2, Readout_Cell, NULL);
+}
+
+static UBYTE shader_open;
+
+static void Shader_Window(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    if (shader_open) GC9A01_StreamEnd();
+    GC9A01_StreamBegin(x0, y0, x1, y1);
+    shader_open = 1;
+}
+
+static void Shader_Run(uint16_t color, uint16_t count, void *ctx)
+{
+    GC9A01_StreamRepeat(color, count);
+}
+
+static void Shader_Fill(const GFX_Shader *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    shader_open = 0;
+    GFX_Shader_Fill(s, x0, y0, x1, y1, Shader_Window, Shader_Run, NULL);
+    if (shader_open) GC9A01_StreamEnd();
+}
+
+static void Shader(void)
+{
+    GFX_Shader s;
+
+    // Dial: radial face, tick ring, a sweep and two patterns in corners
+    GFX_Shader_Radial(&s, 120, 120, 96, 0x4A69, 0x0841);
+    GFX_Shader_SetMask(&s, 120, 120, 96);
+    Shader_Fill(&s, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    GFX_Shader_Ticks(&s, 120, 120, 96, 120, 60, 6, 0, 0x2104, LCD_COLOR_WHITE);
+    Shader_Fill(&s, 0, 0, LCD_WIDTH, LCD_HEIGHT);
+    GFX_Shader_Conic(&s, 120, 120, GFX_DEG(225), LCD_COLOR_GREEN, LCD_COLOR_BLUE);
+    GFX_Shader_SetMask(&s, 120, 120, 30);
+    Shader_Fill(&s, 60, 60, 180, 180);
+    GFX_Shader_Linear(&s, 70, 150, LCD_COLOR_BLUE, 170, 150, LCD_COLOR_RED);
+    Shader_Fill(&s, 70, 150, 170, 170);
+    GFX_Shader_Checker(&s, 0, 0, 8, LCD_COLOR_BLACK, LCD_COLOR_WHITE);
+    Shader_Fill(&s, 0, 0, 32, 32);
+    GFX_Shader_Stripes(&s, 208, 0, GFX_DEG(45), 8, 3, LCD_COLOR_BLACK, LCD_COLOR_YELLOW);
+    Shader_Fill(&s, 208, 0, 240, 32);
+}
+
+const Scene Scenes_CH32[] = {
+    { "ch32", "init",    NULL,  Init },
+    { "ch32", "fill",    Setup, Fill },
+    { "ch32", "rows",    Setup, Rows },
+    { "ch32", "present", Setup, Present },
+    { "ch32", "stream",  Setup, Stream },
+    { "ch32", "orient",  Setup, Orient },
+    { "ch32", "power",   Setup, Power },
+    { "ch32", "shapes",  Setup, Shapes },
+    { "ch32", "gauge",   Setup, Gauge },
+    { "ch32", "readout", Setup, Readout },
+    { "ch32", "shader",  Setup, Shader },
+};
+const unsigned Scenes_CH32_Count = sizeof(Scenes_CH32) / sizeof(Scenes_CH32[0]);
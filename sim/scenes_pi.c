@@ -0,0 +1,98 @@
+/**
+ * @file scenes_pi.c
+ * @brief scene_check scenes drawn through the Pi's LCD_1in28 driver
+ *
+ * The Waveshare flow: Paint into a canvas, then send it with
+ * LCD_1IN28_Display(), DisplayWindows() or DisplayRows(). The panel is
+ * the simulated GC9A01 behind dev_config_sim.c.
+ */
+
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+#include "GUI_Paint.h"
+#include "GUI_Palette.h"
+#include "scene.h"
+
+static UWORD canvas[LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT];
+static UBYTE canvas4[LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT / 2];
+
+static void Setup(void)
+{
+    DEV_ModuleInit();
+    LCD_1IN28_Init(HORIZONTAL);
+    LCD_1IN28_Clear(BLACK);
+}
+
+static void Init(void)
+{
+    DEV_ModuleInit();
+    LCD_1IN28_Init(HORIZONTAL);
+}
+
+static void Clear(void)
+{
+    LCD_1IN28_Clear(BLUE);
+}
+
+/// The demo's face: circles, lines, rectangles and text in every font size
+static void Draw_Face(void)
+{
+    Paint_NewImage(canvas, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, ROTATE_0, BLACK, 16);
+    Paint_Clear(BLACK);
+    Paint_DrawCircle(120, 120, 118, BLUE, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawCircle(120, 120, 20, RED, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawLine(120, 1, 120, 12, GREEN, DOT_PIXEL_4X4, LINE_STYLE_SOLID);
+    Paint_DrawLine(1, 120, 12, 120, GREEN, DOT_PIXEL_4X4, LINE_STYLE_SOLID);
+    Paint_DrawLine(120, 120, 70, 70, YELLOW, DOT_PIXEL_3X3, LINE_STYLE_SOLID);
+    Paint_DrawLine(120, 120, 176, 64, GRAY, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    Paint_DrawRectangle(40, 150, 200, 190, BROWN, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_EN(50, 160, "88.3 km/h", &Font20, BROWN, WHITE);
+    Paint_DrawString_EN(123, 123, "WAVESHARE", &Font16, BLACK, GREEN);
+    Paint_DrawString_EN(60, 200, "GC9A01", &Font12, CYAN, BLACK);
+    Paint_DrawNum(60, 40, 123456, &Font24, BLACK, WHITE);
+}
+
+static void Face(void)
+{
+    Draw_Face();
+    LCD_1IN28_Display(canvas);
+}
+
+static void Window(void)
+{
+    Draw_Face();
+    LCD_1IN28_DisplayWindows(40, 150, 200, 190, canvas);
+    LCD_1IN28_DisplayWindows(0, 0, 240, 30, canvas);
+}
+
+static void Rows(void)
+{
+    static const UWORD colors[4] = { BLACK, WHITE, RED, GREEN };
+    static PAINT_PALETTE palette;
+
+    Paint_NewPalette(&palette, 4, colors, 4);
+    Paint_NewImage((UWORD *)canvas4, LCD_1IN28_WIDTH, LCD_1IN28_HEIGHT, ROTATE_0, 0, 4);
+    Paint_Clear(0);
+    Paint_DrawCircle(120, 120, 100, 2, DOT_PIXEL_2X2, DRAW_FILL_EMPTY);
+    Paint_DrawRectangle(60, 100, 180, 140, 3, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    Paint_DrawString_EN(72, 110, "READY", &Font24, 1, 3);
+    LCD_1IN28_DisplayRows(0, 0, 240, 240, Paint_PaletteRow, &palette);
+}
+
+static void Orient(void)
+{
+    Draw_Face();
+    LCD_1IN28_SetOrientation(90, LCD_MIRROR_X);
+    LCD_1IN28_Display(canvas);
+    LCD_1IN28_SetOrientation(0, 0);
+}
+
+const Scene Scenes_Pi[] = {
+    { "pi", "init",   NULL,  Init },
+    { "pi", "clear",  Setup, Clear },
+    { "pi", "face",   Setup, Face },
+    { "pi", "window", Setup, Window },
+    { "pi", "rows",   Setup, Rows },
+    { "pi", "orient", Setup, Orient },
+};
+const unsigned Scenes_Pi_Count = sizeof(Scenes_Pi) / sizeof(Scenes_Pi[0]);
@@ -0,0 +1,504 @@
+/**
+ * @file trace_replay.c
+ * @brief Replay and compare LCD bus traces (lib/trace)
+ *
+ * Feeds a trace into the panel simulator at its recorded times and
+ * summarises the bus:
+ * - duration, bytes and utilisation (time spent clocking bytes)
+ * - idle gaps between bytes by length; gaps that contain a requested
+ *   delay (LCD_HAL_Delay_*, DEV_Delay_ms) are counted apart
+ * - per command: count, bytes (command and data), bus time, wall time
+ *   from the command byte to its last data byte, and requested delays
+ *   until the next command
+ *
+ * With -o the panel contents are saved as PPM at every MARK record, when
+ * the bus goes idle for IDLE_FRAME_MS after pixel data, and at the end
+ * (one file per panel when the trace drives several).
+ *
+ * --diff compares two traces: the summaries side by side, then the
+ * first byte the panels see differently (value, DC or chip selects) with
+ * the command it belongs to.
+ *
+ * Traces come from the simulator (LCD_TRACE=file ./bin/bench_...), from
+ * a CH32v003 built with LCD_TRACE_ENABLED (USART1 captured to a file) or
+ * from the Pi examples built with TRACE = -D LCD_TRACE.
+ *
+ * Usage: ./bin/trace_replay [-o prefix] trace.trc
+ *        ./bin/trace_replay --diff a.trc b.trc
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gc9a01_sim.h"
+#include "lcd_trace.h"
+
+/// Idle time after pixel data that counts as the end of a frame
+#define IDLE_FRAME_MS  20
+
+#define GAP_BUCKETS  5
+
+static const char *const gap_name[GAP_BUCKETS] = {
+    "< 10 us", "< 100 us", "< 1 ms", "< 10 ms", ">= 10 ms",
+};
+
+// ============================================================================
+// READER
+// ============================================================================
+
+typedef struct {
+    uint8_t *data;
+    uint32_t size, pos;
+    uint32_t ticks_per_sec, spi_hz;
+    uint64_t ticks;             ///< Time of the last record
+} Reader;
+
+typedef struct {
+    uint8_t tag;
+    uint64_t ns;                ///< Record time (BYTES: end of the first byte)
+    uint32_t value;             ///< PIN byte, DELAY us, MARK id
+    const uint8_t *bytes;
+    uint8_t count;
+} Record;
+
+static int Reader_Open(Reader *r, const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    long size;
+
+    memset(r, 0, sizeof(*r));
+    if (!fp) {
+        perror(path);
+        return -1;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    rewind(fp);
+    r->data = malloc(size > 0 ? size : 1);
+    r->size = fread(r->data, 1, size > 0 ? size : 0, fp);
+    fclose(fp);
+
+    if (r->size < LCD_TRACE_HEADER || memcmp(r->data, LCD_TRACE_MAGIC, 4) ||
+        r->data[4] != LCD_TRACE_VERSION) {
+        fprintf(stderr, "%s: not an LCD trace (version %d)\n", path, LCD_TRACE_VERSION);
+        return -1;
+    }
+    r->ticks_per_sec = r->data[8] | r->data[9] << 8 | r->data[10] << 16 | (uint32_t)r->data[11] << 24;
+    r->spi_hz = r->data[12] | r->data[13] << 8 | r->data[14] << 16 | (uint32_t)r->data[15] << 24;
+    if (!r->ticks_per_sec || !r->spi_hz) {
+        fprintf(stderr, "%s: bad header\n", path);
+        return -1;
+    }
+    r->pos = LCD_TRACE_HEADER;
+    return 0;
+}
+
+/**
+ * @return 1 with a record, 0 at the end, -1 on a truncated or bad record
+ */
+static int Reader_Next(Reader *r, Record *rec)
+{
+    uint32_t dt, n;
+
+    if (r->pos >= r->size) return 0;
+    rec->tag = r->data[r->pos++];
+    n = LCD_Trace_Varint(r->data + r->pos, r->size - r->pos, &dt);
+    if (!n) return -1;
+    r->pos += n;
+    r->ticks += dt;
+    rec->ns = r->ticks * 1000000000ULL / r->ticks_per_sec;
+
+    switch (rec->tag) {
+    case LCD_TRACE_PIN:
+        if (r->pos >= r->size) return -1;
+        rec->value = r->data[r->pos++];
+        return 1;
+    case LCD_TRACE_BYTES:
+        if (r->pos >= r->size) return -1;
+        rec->count = r->data[r->pos++];
+        if (!rec->count || rec->count > r->size - r->pos) return -1;
+        rec->bytes = r->data + r->pos;
+        r->pos += rec->count;
+        return 1;
+    case LCD_TRACE_DELAY:
+    case LCD_TRACE_MARK:
+        n = LCD_Trace_Varint(r->data + r->pos, r->size - r->pos, &rec->value);
+        if (!n) return -1;
+        r->pos += n;
+        return 1;
+    default:
+        return -1;
+    }
+}
+
+static uint64_t Byte_Ns(const Reader *r)
+{
+    return 8ULL * 1000000000ULL / r->spi_hz;
+}
+
+static const char *Command_Name(uint8_t cmd)
+{
+    switch (cmd) {
+    case 0x01: return "SWRESET";
+    case 0x10: return "SLPIN";
+    case 0x11: return "SLPOUT";
+    case 0x12: return "PTLON";
+    case 0x13: return "NORON";
+    case 0x20: return "INVOFF";
+    case 0x21: return "INVON";
+    case 0x28: return "DISPOFF";
+    case 0x29: return "DISPON";
+    case 0x2A: return "CASET";
+    case 0x2B: return "RASET";
+    case 0x2C: return "RAMWR";
+    case 0x30: return "PTLAR";
+    case 0x33: return "VSCRDEF";
+    case 0x34: return "TEOFF";
+    case 0x35: return "TEON";
+    case 0x36: return "MADCTL";
+    case 0x37: return "VSCSAD";
+    case 0x38: return "IDMOFF";
+    case 0x39: return "IDMON";
+    case 0x3A: return "COLMOD";
+    case 0x3C: return "RAMWRC";
+    case 0x44: return "STE";
+    case 0xFE: return "IREN1";
+    case 0xEF: return "IREN2";
+    default:   return "";
+    }
+}
+
+// ============================================================================
+// REPLAY AND SUMMARY
+// ============================================================================
+
+typedef struct {
+    uint32_t count, bytes;
+    uint64_t wall_ns;
+    uint64_t delay_us;
+} CommandStats;
+
+typedef struct {
+    uint64_t duration_ns, busy_ns;
+    uint32_t bytes, dropped, pins, delays, marks, frames;
+    uint64_t delay_us;
+    uint32_t gaps[GAP_BUCKETS];
+    uint64_t gap_ns[GAP_BUCKETS];
+    uint32_t requested;         ///< Gaps containing a requested delay
+    uint64_t requested_ns;
+    CommandStats cmd[256];
+} Summary;
+
+typedef struct {
+    const char *prefix;         ///< PPM prefix, NULL = no frames saved
+    uint8_t panels;             ///< Highest panel seen + 1
+    uint8_t pixels;             ///< Pixel data since the last save
+} Frames;
+
+static void Sim_To(uint64_t ns)
+{
+    uint64_t now = GC9A01_Sim_TimeNs();
+    if (ns > now) GC9A01_Sim_Advance(ns - now);
+}
+
+static void Save_Frame(Summary *s, Frames *f, const char *why)
+{
+    char path[512];
+
+    s->frames++;
+    f->pixels = 0;
+    if (!f->prefix) return;
+    for (uint8_t p = 0; p < f->panels; p++) {
+        if (f->panels > 1) snprintf(path, sizeof(path), "%s%03lu-p%d.ppm", f->prefix, (unsigned long)s->frames, p);
+        else snprintf(path, sizeof(path), "%s%03lu.ppm", f->prefix, (unsigned long)s->frames);
+        GC9A01_Sim_SelectPanel(p);
+        if (GC9A01_Sim_SavePPM(path)) perror(path);
+        else printf("frame %3lu at %10.3f ms (%s): %s\n", (unsigned long)s->frames,
+                    GC9A01_Sim_TimeNs() / 1e6, why, path);
+    }
+    GC9A01_Sim_SelectPanel(0);
+}
+
+static uint8_t Gap_Bucket(uint64_t ns)
+{
+    if (ns < 10000) return 0;
+    if (ns < 100000) return 1;
+    if (ns < 1000000) return 2;
+    if (ns < 10000000) return 3;
+    return 4;
+}
+
+/**
+ * @brief Replay a trace into the simulator and summarise it
+ *
+ * @return 0, or -1 if the trace is cut short (the summary covers what was read)
+ */
+static int Replay(Reader *r, Summary *s, Frames *f)
+{
+    const uint64_t byte_ns = Byte_Ns(r);
+    uint8_t cs = 0, dc = 1;
+    int cmd = -1;               // Current command, -1 = none yet
+    uint64_t cmd_start = 0, last_end = 0;
+    uint8_t have_byte = 0, delayed = 0;
+    Record rec;
+    int ret;
+
+    memset(s, 0, sizeof(*s));
+    GC9A01_Sim_Reset();
+
+    while ((ret = Reader_Next(r, &rec)) > 0) {
+        s->duration_ns = rec.ns;
+        switch (rec.tag) {
+        case LCD_TRACE_PIN: {
+            uint8_t panel = rec.value >> 3, level = rec.value & 1;
+            Sim_To(rec.ns);
+            s->pins++;
+            switch ((rec.value >> 1) & 3) {
+            case LCD_TRACE_CS:
+                if (panel >= GC9A01_SIM_PANELS) break;
+                if (panel >= f->panels) f->panels = panel + 1;
+                cs = level ? cs & ~(1 << panel) : cs | (1 << panel);
+                GC9A01_Sim_SetCS(panel, level);
+                break;
+            case LCD_TRACE_DC:  dc = level; GC9A01_Sim_SetDC(level); break;
+            case LCD_TRACE_RST: GC9A01_Sim_SetRST(panel, level); break;
+            default:            GC9A01_Sim_SetBL(level); break;
+            }
+            break;
+        }
+        case LCD_TRACE_DELAY:
+            s->delays++;
+            s->delay_us += rec.value;
+            if (cmd >= 0) s->cmd[cmd].delay_us += rec.value;
+            delayed = 1;
+            break;
+        case LCD_TRACE_MARK:
+            s->marks++;
+            Sim_To(rec.ns);
+            Save_Frame(s, f, "mark");
+            break;
+        default: {
+            uint64_t start = rec.ns - byte_ns;
+            // One bus: bytes stamped early (a sink faster than spi_hz) queue up
+            if (have_byte && start < last_end) start = last_end;
+            if (have_byte && start > last_end) {
+                uint64_t gap = start - last_end;
+                if (delayed) {
+                    s->requested++;
+                    s->requested_ns += gap;
+                } else {
+                    s->gaps[Gap_Bucket(gap)]++;
+                    s->gap_ns[Gap_Bucket(gap)] += gap;
+                }
+                if (f->pixels && gap >= IDLE_FRAME_MS * 1000000ULL) {
+                    Sim_To(last_end + IDLE_FRAME_MS * 1000000ULL);
+                    Save_Frame(s, f, "idle");
+                }
+            }
+            Sim_To(start);
+            for (uint8_t i = 0; i < rec.count; i++) {
+                GC9A01_Sim_Advance(byte_ns);
+                GC9A01_Sim_Byte(rec.bytes[i]);
+                s->bytes++;
+                s->busy_ns += byte_ns;
+                if (!cs) {
+                    s->dropped++;
+                    continue;
+                }
+                if (!dc) {
+                    if (cmd >= 0) s->cmd[cmd].wall_ns += last_end - cmd_start;
+                    cmd = rec.bytes[i];
+                    cmd_start = start + i * byte_ns;
+                    s->cmd[cmd].count++;
+                } else if (cmd == 0x2C || cmd == 0x3C) {
+                    f->pixels = 1;
+                }
+                if (cmd >= 0) s->cmd[cmd].bytes++;
+                last_end = start + (i + 1) * byte_ns;
+            }
+            have_byte = 1;
+            delayed = 0;
+            break;
+        }
+        }
+    }
+    if (cmd >= 0) s->cmd[cmd].wall_ns += last_end - cmd_start;
+    if (last_end > s->duration_ns) s->duration_ns = last_end;
+    if (f->pixels || !s->frames) Save_Frame(s, f, "end");
+    return ret < 0 ? -1 : 0;
+}
+
+static void Print_Summary(const Reader *r, const Summary *s)
+{
+    printf("%lu ticks/s, SPI %lu Hz (%.2f us/byte)\n", (unsigned long)r->ticks_per_sec,
+           (unsigned long)r->spi_hz, Byte_Ns(r) / 1e3);
+    printf("duration %.3f ms, %lu bytes (%lu with no CS low), busy %.3f ms, utilisation %.1f%%\n",
+           s->duration_ns / 1e6, (unsigned long)s->bytes, (unsigned long)s->dropped,
+           s->busy_ns / 1e6, s->duration_ns ? 100.0 * s->busy_ns / s->duration_ns : 0.0);
+    printf("%lu pin writes, %lu delays (%.3f ms requested), %lu marks, %lu frames\n",
+           (unsigned long)s->pins, (unsigned long)s->delays, s->delay_us / 1e3,
+           (unsigned long)s->marks, (unsigned long)s->frames);
+
+    printf("\nidle gaps between bytes     count      total ms\n");
+    for (int b = 0; b < GAP_BUCKETS; b++) {
+        printf("  %-24s %8lu  %12.3f\n", gap_name[b], (unsigned long)s->gaps[b], s->gap_ns[b] / 1e6);
+    }
+    printf("  %-24s %8lu  %12.3f\n", "with a requested delay", (unsigned long)s->requested,
+           s->requested_ns / 1e6);
+
+    printf("\ncmd   name       count     bytes     bus ms    wall ms   delay ms\n");
+    for (int c = 0; c < 256; c++) {
+        const CommandStats *k = &s->cmd[c];
+        if (!k->count) continue;
+        printf("0x%02X  %-8s %7lu %9lu %10.3f %10.3f %10.3f\n", c, Command_Name(c),
+               (unsigned long)k->count, (unsigned long)k->bytes, k->bytes * (Byte_Ns(r) / 1e6),
+               k->wall_ns / 1e6, k->delay_us / 1e3);
+    }
+}
+
+// ============================================================================
+// DIFF
+// ============================================================================
+
+/**
+ * @brief Walks the bytes the panels see (some CS low), with their context
+ */
+typedef struct {
+    Reader *r;
+    Record rec;
+    uint8_t i;                  ///< Next byte in rec
+    uint8_t cs, dc;
+    int cmd;                    ///< Current command, -1 = none yet
+    uint32_t arg;               ///< Data bytes since the command
+    uint32_t index;             ///< Bytes seen so far
+    uint64_t ns;                ///< End of the current byte
+    uint8_t value;
+} Walker;
+
+static int Walker_Next(Walker *w)
+{
+    for (;;) {
+        if (w->i < w->rec.count) {
+            uint8_t i = w->i++;
+            if (!w->cs) continue;
+            w->value = w->rec.bytes[i];
+            w->ns = w->rec.ns + i * Byte_Ns(w->r);
+            w->index++;
+            if (!w->dc) {
+                w->cmd = w->value;
+                w->arg = 0;
+            } else {
+                w->arg++;
+            }
+            return 1;
+        }
+        if (Reader_Next(w->r, &w->rec) <= 0) return 0;
+        w->i = 0;
+        if (w->rec.tag != LCD_TRACE_BYTES) {
+            w->rec.count = 0;
+            if (w->rec.tag != LCD_TRACE_PIN) continue;
+            uint8_t panel = w->rec.value >> 3, level = w->rec.value & 1;
+            if (((w->rec.value >> 1) & 3) == LCD_TRACE_CS && panel < 8) {
+                w->cs = level ? w->cs & ~(1 << panel) : w->cs | (1 << panel);
+            } else if (((w->rec.value >> 1) & 3) == LCD_TRACE_DC) {
+                w->dc = level;
+            }
+        }
+    }
+}
+
+static void Print_Position(const char *name, const Walker *w, int more)
+{
+    if (!more) {
+        printf("  %s: ended after %lu bytes\n", name, (unsigned long)w->index);
+        return;
+    }
+    printf("  %s: byte %lu at %.3f ms, CS mask 0x%02X, %s 0x%02X", name, (unsigned long)w->index,
+           w->ns / 1e6, w->cs, w->dc ? "data" : "command", w->value);
+    if (w->cmd >= 0 && w->dc) {
+        printf(" (byte %lu of 0x%02X %s)", (unsigned long)w->arg, w->cmd, Command_Name(w->cmd));
+    }
+    printf("\n");
+}
+
+static int Diff(const char *pa, const char *pb)
+{
+    Reader ra, rb;
+    static Summary sa, sb;
+    Frames fa = { NULL, 1, 0 }, fb = { NULL, 1, 0 };
+
+    if (Reader_Open(&ra, pa) || Reader_Open(&rb, pb)) return 2;
+    if (Replay(&ra, &sa, &fa)) fprintf(stderr, "%s: truncated\n", pa);
+    if (Replay(&rb, &sb, &fb)) fprintf(stderr, "%s: truncated\n", pb);
+
+    printf("                     %14s %14s %14s\n", "a", "b", "b - a");
+    printf("duration ms          %14.3f %14.3f %+14.3f\n", sa.duration_ns / 1e6, sb.duration_ns / 1e6,
+           ((double)sb.duration_ns - sa.duration_ns) / 1e6);
+    printf("bytes                %14lu %14lu %+14ld\n", (unsigned long)sa.bytes, (unsigned long)sb.bytes,
+           (long)sb.bytes - (long)sa.bytes);
+    printf("busy ms              %14.3f %14.3f %+14.3f\n", sa.busy_ns / 1e6, sb.busy_ns / 1e6,
+           ((double)sb.busy_ns - sa.busy_ns) / 1e6);
+    printf("requested delay ms   %14.3f %14.3f %+14.3f\n", sa.delay_us / 1e3, sb.delay_us / 1e3,
+           ((double)sb.delay_us - sa.delay_us) / 1e3);
+
+    printf("\ncmd   name     count a  count b    bytes a    bytes b  wall ms a  wall ms b\n");
+    for (int c = 0; c < 256; c++) {
+        const CommandStats *a = &sa.cmd[c], *b = &sb.cmd[c];
+        if (!a->count && !b->count) continue;
+        printf("0x%02X  %-8s %7lu  %7lu  %9lu  %9lu %10.3f %10.3f%s\n", c, Command_Name(c),
+               (unsigned long)a->count, (unsigned long)b->count, (unsigned long)a->bytes,
+               (unsigned long)b->bytes, a->wall_ns / 1e6, b->wall_ns / 1e6,
+               a->count != b->count || a->bytes != b->bytes ? "  *" : "");
+    }
+
+    // First byte the panels see differently
+    Walker wa, wb;
+    memset(&wa, 0, sizeof(wa));
+    memset(&wb, 0, sizeof(wb));
+    wa.r = &ra;
+    wb.r = &rb;
+    wa.dc = wb.dc = 1;
+    wa.cmd = wb.cmd = -1;
+    ra.pos = rb.pos = LCD_TRACE_HEADER;
+    ra.ticks = rb.ticks = 0;
+    for (;;) {
+        int ma = Walker_Next(&wa), mb = Walker_Next(&wb);
+        if (!ma && !mb) {
+            printf("\nsame bus contents (%lu bytes)\n", (unsigned long)wa.index);
+            return 0;
+        }
+        if (ma != mb || wa.value != wb.value || wa.dc != wb.dc || wa.cs != wb.cs) {
+            printf("\nfirst difference:\n");
+            Print_Position("a", &wa, ma);
+            Print_Position("b", &wb, mb);
+            return 1;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *prefix = NULL;
+    int i = 1;
+
+    if (argc == 4 && !strcmp(argv[1], "--diff")) return Diff(argv[2], argv[3]);
+    if (argc > 2 && !strcmp(argv[1], "-o")) {
+        prefix = argv[2];
+        i = 3;
+    }
+    if (i != argc - 1) {
+        fprintf(stderr, "usage: %s [-o prefix] trace.trc\n"
+                        "       %s --diff a.trc b.trc\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    Reader r;
+    static Summary s;
+    Frames f = { prefix, 1, 0 };
+    if (Reader_Open(&r, argv[i])) return 2;
+    int ret = Replay(&r, &s, &f);
+    if (ret) fprintf(stderr, "%s: truncated at byte %lu\n", argv[i], (unsigned long)r.pos);
+    Print_Summary(&r, &s);
+    return ret ? 1 : 0;
+}
@@ -34,11 +34,29 @@
  * 7 = SPI register verification test (check SPI is configured correctly)
  * 8 = Alternative init test (tries different register values)
  * 9 = Comprehensive test with slower SPI, CS timing, and alternative init sequences
+ * 10 = TE-synchronised needle animation (needs LCD_TE_ENABLED and the TE pad wired)
+ * 11 = Anti-aliased gauge rendered band by band (no frame buffer)
+ * 12 = Gauge widget with incremental needle updates (only the needle spans are resent)
+ * 13 = Host-driven screen over USART1 (PD5 TX, PD6 RX), fed by tools/frame_send.py
+ * 14 = Slow readout with automatic idle / partial / sleep between updates
+ * 15 = Clock and counter readouts (only changed digits are resent)
+ * 16 = Cooperative scheduler: 1 ms / 5 ms tasks keep running through a time-sliced redraw
+ * 17 = Two panels: shared background broadcast once, a different counter on each
+ *      (set LCD_PANEL_COUNT to 2 and wire the second CS to LCD_CS1_PIN)
+ * 18 = Procedural fills (gradients, sweep, patterns, tick ring) streamed with no buffer
  */
 
 #include "ch32fun.h"
 #include "lcd_hal.h"
 #include "gc9a01_driver.h"
+#include "gfx_aa.h"
+#include "gfx_gauge.h"
+#include "frame_link.h"
+#include "gc9a01_power.h"
+#include "gfx_readout.h"
+#include "gc9a01_job.h"
+#include "sched.h"
+#include "gfx_shader.h"
 
 // ============================================================================
 // DEBUGGING MODE SELECTION
@@ -1088,6 +1106,418 @@ void run_comprehensive_timing_test(void)
     }
 }
 
+#elif DEBUG_MODE == 10
+// TE-synchronised animation
+// A needle-sized block flips colour continuously through GC9A01_Present().
+// With TE wired it should update without visible tearing.
+static void needle_row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    UWORD color = *(const UWORD *)ctx;
+    for (uint16_t i = 0; i < width; i++) line[i] = color;
+}
+
+void run_present_test(void)
+{
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+    
+    uint8_t tick = 0;
+    while(1) {
+        UWORD color = (tick++ & 1) ? LCD_COLOR_RED : LCD_COLOR_WHITE;
+        GC9A01_Present(110, 20, 130, 120, needle_row, &color);
+    }
+}
+
+#elif DEBUG_MODE == 11
+// Anti-aliased gauge
+// Every row of the scene (dial arc, needle, hub) is produced on the fly into
+// the driver's line buffer; only the box swept by the needle is resent.
+#define GAUGE_C       GFX_FIX(120)
+#define GAUGE_NEEDLE  GFX_FIX(95)
+
+typedef struct {
+    GFX_AAShape shapes[4];
+    uint8_t count;
+} gauge_scene_t;
+
+static void gauge_row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    const gauge_scene_t *scene = (const gauge_scene_t *)ctx;
+    for (uint16_t i = 0; i < width; i++) line[i] = LCD_COLOR_BLACK;
+    for (uint8_t i = 0; i < scene->count; i++) {
+        GFX_AA_RenderRow(&scene->shapes[i], y, x0, width, line, GFX_ORDER_NATIVE);
+    }
+}
+
+static void gauge_needle_box(int32_t angle, int16_t box[4])
+{
+    int16_t tx = 120 + ((GFX_Sin(angle) * 95) >> 14);
+    int16_t ty = 120 - ((GFX_Cos(angle) * 95) >> 14);
+    box[0] = (tx < 120 ? tx : 120) - 8;
+    box[1] = (ty < 120 ? ty : 120) - 8;
+    box[2] = (tx > 120 ? tx : 120) + 8;
+    box[3] = (ty > 120 ? ty : 120) + 8;
+}
+
+void run_aa_gauge_test(void)
+{
+    gauge_scene_t scene;
+    int32_t angle = GFX_DEG(-135);
+    int32_t step = GFX_DEG(2);
+    int16_t prev[4], next[4];
+    uint8_t first = 1;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+
+    GFX_AA_Arc(&scene.shapes[0], GAUGE_C, GAUGE_C, GFX_FIX(114), GFX_FIX(106),
+               GFX_DEG(-135), GFX_DEG(135), LCD_COLOR_BLUE);
+    GFX_AA_Circle(&scene.shapes[2], GAUGE_C, GAUGE_C, GFX_FIX(7), LCD_COLOR_WHITE);
+    scene.count = 3;
+    gauge_needle_box(angle, prev);
+
+    while(1) {
+        GFX_AA_Line(&scene.shapes[1], GAUGE_C, GAUGE_C,
+                    GAUGE_C + ((GFX_Sin(angle) * GAUGE_NEEDLE) >> 14),
+                    GAUGE_C - ((GFX_Cos(angle) * GAUGE_NEEDLE) >> 14),
+                    GFX_FIX(3), LCD_COLOR_RED);
+        if (first) {
+            GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, gauge_row, &scene);
+            first = 0;
+        }
+
+        // Resend the union of the old and new needle boxes
+        gauge_needle_box(angle, next);
+        int16_t x0 = prev[0] < next[0] ? prev[0] : next[0];
+        int16_t y0 = prev[1] < next[1] ? prev[1] : next[1];
+        int16_t x1 = prev[2] > next[2] ? prev[2] : next[2];
+        int16_t y1 = prev[3] > next[3] ? prev[3] : next[3];
+        GC9A01_Present(x0 < 0 ? 0 : x0, y0 < 0 ? 0 : y0,
+                       x1 >= LCD_WIDTH ? LCD_WIDTH : x1 + 1,
+                       y1 >= LCD_HEIGHT ? LCD_HEIGHT : y1 + 1, gauge_row, &scene);
+        for (uint8_t i = 0; i < 4; i++) prev[i] = next[i];
+
+        angle += step;
+        if (angle >= GFX_DEG(135) || angle <= GFX_DEG(-135)) step = -step;
+    }
+}
+
+#elif DEBUG_MODE == 12
+// Gauge widget
+// After one full draw, each tick resends only the row spans the old and new
+// needle cover, one single-row window per span.
+static void widget_row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Gauge_RenderRow((const GFX_Gauge *)ctx, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void widget_span(int16_t y, int16_t x0, int16_t x1, void *ctx)
+{
+    if (x1 > LCD_WIDTH) x1 = LCD_WIDTH;
+    if (y < 0 || y >= LCD_HEIGHT || x0 >= x1) return;
+    GC9A01_DrawRows(x0, y, x1, y + 1, widget_row, ctx);
+}
+
+void run_gauge_widget_test(void)
+{
+    GFX_Gauge gauge;
+    int16_t value = 0;
+    int16_t step = 1;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+
+    GFX_Gauge_Init(&gauge, LCD_WIDTH / 2, LCD_HEIGHT / 2, LCD_WIDTH / 2 - 4);
+    GC9A01_DrawRows(0, 0, LCD_WIDTH, LCD_HEIGHT, widget_row, &gauge);
+
+    while(1) {
+        value += step;
+        if (value >= gauge.max || value <= gauge.min) step = -step;
+        GFX_Gauge_SetValue(&gauge, value, widget_span, &gauge);
+    }
+}
+
+#elif DEBUG_MODE == 13
+// UART frame link
+// The host sends changed rectangles (RLE / palette / delta coded); they are
+// decoded straight into the SPI stream. A quiet line drops half packets.
+#define FRAME_LINK_IDLE_US  50000
+
+void run_frame_link(void)
+{
+    FrameLink link;
+    UDOUBLE idle_us = 0;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+
+    LCD_HAL_UART_Init(LCD_UART_BAUD);
+    FrameLink_Init(&link);
+
+    while(1) {
+        if (FrameLink_Poll(&link)) {
+            idle_us = 0;
+        } else if (idle_us < FRAME_LINK_IDLE_US) {
+            Delay_Us(100);
+            idle_us += 100;
+            if (idle_us >= FRAME_LINK_IDLE_US) FrameLink_Timeout(&link);
+        }
+    }
+}
+
+#elif DEBUG_MODE == 14
+// Power policy
+// A band of rows changes every 20 s; in between the panel drops to idle after
+// 3 s, partial (only the band) after 6 s and sleep with the backlight off
+// after 12 s. The next update wakes it.
+#define READOUT_Y0         100
+#define READOUT_Y1         140
+#define READOUT_PERIOD_MS  20000
+
+void run_power_test(void)
+{
+    static const GC9A01_PowerPolicy policy = { 3000, 6000, 12000, READOUT_Y0, READOUT_Y1 };
+    static const UWORD colors[] = { LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE, LCD_COLOR_YELLOW };
+    UDOUBLE now_ms = 0;
+    UDOUBLE next_ms = 0;
+    UBYTE n = 0;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+    GC9A01_Power_Init(&policy, now_ms);
+
+    while(1) {
+        if (now_ms >= next_ms) {
+            GC9A01_FillRect(40, READOUT_Y0, LCD_WIDTH - 40, READOUT_Y1, colors[n++ & 3]);
+            next_ms += READOUT_PERIOD_MS;
+        }
+        GC9A01_Power_Tick(now_ms);
+        Delay_Ms(10);            // Clock good enough for second-scale timeouts
+        now_ms += 10;
+    }
+}
+
+#elif DEBUG_MODE == 15
+// Readouts
+// A clock and a counter in GFX_Font_Digits24. Each second usually changes
+// one or two character cells; only those are sent, one window per cell.
+static void readout_row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Readout_RenderRow((const GFX_Readout *)ctx, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void readout_cell(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    GC9A01_DrawRows(x0, y0, x1, y1, readout_row, ctx);
+}
+
+void run_readout_test(void)
+{
+    GFX_Readout clock, counter;
+    uint8_t h = 12, m = 0, s = 0;
+    int32_t count = 0;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+
+    GFX_Readout_Init(&clock, &GFX_Font_Digits24, 0, 84, 8);
+    clock.x = (LCD_WIDTH - clock.pitch * 8) / 2;
+    GFX_Readout_Init(&counter, &GFX_Font_Digits24, 0, 132, 6);
+    counter.x = (LCD_WIDTH - counter.pitch * 6) / 2;
+    counter.color = LCD_COLOR_YELLOW;
+
+    while(1) {
+        GFX_Readout_SetClock(&clock, h, m, s, readout_cell, &clock);
+        GFX_Readout_SetFixed(&counter, count++, 1, readout_cell, &counter);
+        Delay_Ms(1000);
+        if (++s == 60) { s = 0; if (++m == 60) { m = 0; if (++h == 24) h = 0; } }
+    }
+}
+
+#elif DEBUG_MODE == 16
+// Cooperative scheduler
+// A 1 ms task toggles the heartbeat pin (its jitter on a scope is the task
+// latency), a 5 ms task debounces a button from PA2 to GND, and the display
+// is a job: panel init, then a full-screen fill in 500 us steps, restarted
+// with the next colour on each press. The heartbeat keeps a steady 500 Hz
+// through the whole redraw instead of stopping for ~0.6 s.
+#define BUTTON_PIN        PA2     // Free without a crystal; PC1/PC2 stay free for I2C
+#define FILL_BUDGET_US    500
+
+enum { TASK_HEARTBEAT, TASK_BUTTON, TASK_DISPLAY, TASK_COUNT };
+
+static Sched_Task tasks[TASK_COUNT];
+static GC9A01_Job display_job;
+
+static UBYTE heartbeat_task(void *ctx)
+{
+    static UBYTE level = 0;
+    level ^= 1;
+    funDigitalWrite(DEBUG_HEARTBEAT_PIN, level);
+    return 0;
+}
+
+static UBYTE button_task(void *ctx)
+{
+    static const UWORD colors[] = { LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE, LCD_COLOR_BLACK };
+    static UBYTE history = 0xFF;
+    static UBYTE n = 0;
+
+    // Pressed: released once, then low for 7 samples (35 ms)
+    history = (history << 1) | funDigitalRead(BUTTON_PIN);
+    if (history == 0x80 && display_job.kind == GC9A01_JOB_IDLE) {
+        GC9A01_Job_Fill(&display_job, 0, 0, LCD_WIDTH, LCD_HEIGHT, colors[n++ & 3], FILL_BUDGET_US);
+        Sched_Wake(&tasks[TASK_DISPLAY]);
+    }
+    return 0;
+}
+
+static UBYTE display_task(void *ctx)
+{
+    return GC9A01_Job_Step(&display_job);
+}
+
+static Sched_Task tasks[TASK_COUNT] = {
+    SCHED_PERIODIC(heartbeat_task, NULL, SCHED_MS(1)),
+    SCHED_PERIODIC(button_task, NULL, SCHED_MS(5)),
+    SCHED_JOB(display_task, NULL),
+};
+
+void run_sched_test(void)
+{
+    SystemInit();
+    LCD_HAL_Init();
+    funPinMode(DEBUG_HEARTBEAT_PIN, GPIO_Speed_10MHz | GPIO_CNF_OUT_PP);
+    funPinMode(BUTTON_PIN, GPIO_CNF_IN_PUPD);
+    funDigitalWrite(BUTTON_PIN, FUN_HIGH);      // Pull-up
+
+    GC9A01_Job_Init(&display_job);
+    Sched_Init(tasks, TASK_COUNT);
+    Sched_Wake(&tasks[TASK_DISPLAY]);
+    Sched_Run();
+}
+
+#elif DEBUG_MODE == 17
+// Two panels on one bus
+// Init and the gauge face go to both panels at once (both CS lines low);
+// each panel then counts on its own readout, selected by its CS alone.
+#if LCD_PANEL_COUNT < 2
+#error "DEBUG_MODE 17 needs LCD_PANEL_COUNT 2 in lcd_config.h"
+#endif
+static void panel_row(uint16_t y, uint16_t x0, uint16_t width, UWORD *line, void *ctx)
+{
+    GFX_Readout_RenderRow((const GFX_Readout *)ctx, y, x0, width, line, GFX_ORDER_NATIVE);
+}
+
+static void panel_cell(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    GC9A01_DrawRows(x0, y0, x1, y1, panel_row, ctx);
+}
+
+void run_panels_test(void)
+{
+    GFX_Readout counter[2];
+    int32_t count = 0;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_SelectPanels(GC9A01_PANEL(0) | GC9A01_PANEL(1));
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+    GC9A01_FillRect(40, 60, 200, 180, LCD_COLOR_BLUE);
+
+    for (UBYTE p = 0; p < 2; p++) {
+        GFX_Readout_Init(&counter[p], &GFX_Font_Digits24, 0, 108, 5);
+        counter[p].x = (LCD_WIDTH - counter[p].pitch * 5) / 2;
+        counter[p].bg = LCD_COLOR_BLUE;
+    }
+
+    while(1) {
+        GC9A01_SelectPanels(GC9A01_PANEL(0));
+        GFX_Readout_SetFixed(&counter[0], count, 0, panel_cell, &counter[0]);
+        GC9A01_SelectPanels(GC9A01_PANEL(1));
+        GFX_Readout_SetFixed(&counter[1], 9999 - count, 0, panel_cell, &counter[1]);
+        count = (count + 1) % 10000;
+        Delay_Ms(250);
+    }
+}
+
+#elif DEBUG_MODE == 18
+// Procedural fills
+// Each background is computed pixel by pixel while it is clocked out:
+// one window per row inside the visible circle, runs of equal pixels
+// sent with GC9A01_StreamRepeat(). No bitmap, no line buffer.
+static UBYTE shader_open;
+
+static void shader_window(int16_t x0, int16_t y0, int16_t x1, int16_t y1, void *ctx)
+{
+    if (shader_open) GC9A01_StreamEnd();
+    GC9A01_StreamBegin(x0, y0, x1, y1);
+    shader_open = 1;
+}
+
+static void shader_run(uint16_t color, uint16_t count, void *ctx)
+{
+    GC9A01_StreamRepeat(color, count);
+}
+
+static void shader_fill(const GFX_Shader *s)
+{
+    shader_open = 0;
+    GFX_Shader_Fill(s, 0, 0, LCD_WIDTH, LCD_HEIGHT, shader_window, shader_run, NULL);
+    if (shader_open) GC9A01_StreamEnd();
+}
+
+void run_shader_test(void)
+{
+    const int16_t c = LCD_WIDTH / 2;
+    GFX_Shader s;
+    UBYTE step = 0;
+
+    SystemInit();
+    LCD_HAL_Init();
+    GC9A01_Init();
+    GC9A01_FillScreen(LCD_COLOR_BLACK);
+
+    while(1) {
+        switch (step) {
+        case 0:
+            GFX_Shader_Linear(&s, 0, 20, LCD_COLOR_BLUE, 0, 220, LCD_COLOR_RED);
+            break;
+        case 1:
+            GFX_Shader_Conic(&s, c, c, GFX_DEG(225), LCD_COLOR_GREEN, LCD_COLOR_BLUE);
+            break;
+        case 2:
+            GFX_Shader_Checker(&s, 0, 0, 20, LCD_COLOR_BLACK, LCD_COLOR_WHITE);
+            break;
+        case 3:
+            GFX_Shader_Stripes(&s, 0, 0, GFX_DEG(45), 16, 6, LCD_COLOR_BLACK, LCD_COLOR_YELLOW);
+            break;
+        default:
+            // Dial: radial face inside the ring, then the ring with its ticks
+            GFX_Shader_Radial(&s, c, c, 100, 0x4A69, 0x0841);
+            GFX_Shader_SetMask(&s, c, c, 100);
+            shader_fill(&s);
+            GFX_Shader_Ticks(&s, c, c, 100, c, 60, 6, 0, 0x2104, LCD_COLOR_WHITE);
+            break;
+        }
+        GFX_Shader_SetMask(&s, c, c, c);
+        shader_fill(&s);
+        step = step < 4 ? step + 1 : 0;
+        Delay_Ms(2000);
+    }
+}
+
 #else
 #error "Invalid DEBUG_MODE value"
 #endif
@@ -1117,6 +1547,24 @@ int main()
     run_alternative_init_test();
 #elif DEBUG_MODE == 9
     run_comprehensive_timing_test();
+#elif DEBUG_MODE == 10
+    run_present_test();
+#elif DEBUG_MODE == 11
+    run_aa_gauge_test();
+#elif DEBUG_MODE == 12
+    run_gauge_widget_test();
+#elif DEBUG_MODE == 13
+    run_frame_link();
+#elif DEBUG_MODE == 14
+    run_power_test();
+#elif DEBUG_MODE == 15
+    run_readout_test();
+#elif DEBUG_MODE == 16
+    run_sched_test();
+#elif DEBUG_MODE == 17
+    run_panels_test();
+#elif DEBUG_MODE == 18
+    run_shader_test();
 #endif
 }
 
@@ -0,0 +1,355 @@
+#!/usr/bin/env python3
+"""Send frames to the GC9A01 over the UART frame link (lib/frame_link).
+
+Each frame is compared with what is already on the panel. The changed
+area of every band of rows is sent as a rect packet, in whichever of
+RAW, RLE, PAL (palette runs) or DELTA (skips over unchanged pixels) is
+smallest. Pixels are decoded on the device straight into the SPI stream.
+
+Images are binary PPM (P6) files or raw big-endian RGB565 (*.rgb565), at
+most 240x240; smaller images are drawn at the top left.
+
+  tools/frame_send.py /dev/ttyUSB0 status.ppm          # board at 115200
+  tools/frame_send.py /dev/pts/5 a.ppm b.ppm --loop 10 # sim/bin/frame_link_pty
+  tools/frame_send.py - a.ppm b.ppm                    # sizes only, no device
+"""
+
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+
+WIDTH = HEIGHT = 240
+
+SYNC, ACK, NAK, GRANT = 0xA5, 0x06, 0x15, 0x11
+HELLO, RECT, END = ord('H'), ord('R'), ord('E')
+ENC_RAW, ENC_RLE, ENC_PAL, ENC_DELTA = range(4)
+ENC_NAMES = ('raw', 'rle', 'pal', 'delta')
+
+
+# --- Images -----------------------------------------------------------------
+
+def _ppm_tokens(data):
+    pos, tokens = 2, []
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        tokens.append(int(data[pos:end]))
+        pos = end
+    return tokens, pos + 1
+
+
+def load_image(path):
+    """Frame as a list of WIDTH * HEIGHT RGB565 values (black outside the image)."""
+    data = open(path, 'rb').read()
+    frame = [0] * (WIDTH * HEIGHT)
+    if path.endswith('.rgb565'):
+        w = WIDTH
+        h = len(data) // (2 * w)
+        pix = [(data[i] << 8) | data[i + 1] for i in range(0, 2 * w * h, 2)]
+    elif data[:2] == b'P6':
+        (w, h, maxval), start = _ppm_tokens(data)
+        if maxval != 255:
+            sys.exit('%s: only 8-bit PPM is supported' % path)
+        rgb = data[start:start + 3 * w * h]
+        pix = [((rgb[i] & 0xF8) << 8) | ((rgb[i + 1] & 0xFC) << 3) | (rgb[i + 2] >> 3)
+               for i in range(0, len(rgb), 3)]
+    else:
+        sys.exit('%s: not a P6 PPM or .rgb565 file' % path)
+    for y in range(min(h, HEIGHT)):
+        for x in range(min(w, WIDTH)):
+            frame[y * WIDTH + x] = pix[y * w + x]
+    return frame
+
+
+# --- Encoders ---------------------------------------------------------------
+
+def _px(c):
+    return bytes((c >> 8, c & 0xFF))
+
+
+def encode_raw(pixels, old):
+    return b''.join(_px(c) for c in pixels)
+
+
+def _runs(pixels):
+    i, n = 0, len(pixels)
+    while i < n:
+        j = i + 1
+        while j < n and pixels[j] == pixels[i]:
+            j += 1
+        yield pixels[i], j - i
+        i = j
+
+
+def _rle_tokens(pixels, lit_max, run_max, run_flag):
+    """Literal / run tokens; runs of 3+ always pay, runs of 2 only between runs."""
+    out = bytearray()
+    lit = []
+
+    def flush():
+        for k in range(0, len(lit), lit_max):
+            chunk = lit[k:k + lit_max]
+            out.append(len(chunk) - 1)
+            for c in chunk:
+                out.extend(_px(c))
+        del lit[:]
+
+    for color, n in _runs(pixels):
+        if n >= 3 or (n == 2 and not lit):
+            flush()
+            while n:
+                k = min(n, run_max)
+                out.append(run_flag | (k - 1))
+                out += _px(color)
+                n -= k
+        else:
+            lit.extend([color] * n)
+    flush()
+    return bytes(out)
+
+
+def encode_rle(pixels, old):
+    return _rle_tokens(pixels, 128, 128, 0x80)
+
+
+def encode_pal(pixels, old):
+    palette = sorted(set(pixels))
+    if len(palette) > 16:
+        return None
+    index = {c: i for i, c in enumerate(palette)}
+    out = bytearray([len(palette)])
+    for c in palette:
+        out += _px(c)
+    for color, n in _runs(pixels):
+        while n:
+            k = min(n, 16)
+            out.append(((k - 1) << 4) | index[color])
+            n -= k
+    return bytes(out)
+
+
+def encode_delta(pixels, old):
+    """Skip tokens over unchanged stretches of 2+ pixels, RLE for the rest."""
+    if old is None:
+        return None
+    out = bytearray()
+    i, n = 0, len(pixels)
+    while i < n:
+        j = i
+        while j < n and pixels[j] == old[j]:
+            j += 1
+        if j - i >= 2 or j == n:
+            while i < j:
+                k = min(j - i, 128)
+                out.append(0x80 | (k - 1))
+                i += k
+            continue
+        # Changed stretch: up to the next unchanged pair
+        j = i + 1
+        while j < n and not (pixels[j] == old[j] and (j + 1 == n or pixels[j + 1] == old[j + 1])):
+            j += 1
+        out += _rle_tokens(pixels[i:j], 64, 64, 0x40)
+        i = j
+    return bytes(out)
+
+
+ENCODERS = ((ENC_RAW, encode_raw), (ENC_RLE, encode_rle), (ENC_PAL, encode_pal),
+            (ENC_DELTA, encode_delta))
+
+
+def crc8(data, crc=0):
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def packet(ptype, payload=b''):
+    body = bytes((ptype, len(payload) & 0xFF, len(payload) >> 8)) + payload
+    return bytes((SYNC,)) + body + bytes((crc8(body),))
+
+
+def dirty_rects(frame, shadow, band):
+    """Changed bounding box of each band of rows (the whole band if the panel is unknown)."""
+    for y0 in range(0, HEIGHT, band):
+        y1 = min(y0 + band, HEIGHT)
+        if shadow is None:
+            yield 0, y0, WIDTH, y1
+            continue
+        rows = [y for y in range(y0, y1)
+                if frame[y * WIDTH:(y + 1) * WIDTH] != shadow[y * WIDTH:(y + 1) * WIDTH]]
+        if not rows:
+            continue
+        xa, xb = WIDTH, 0
+        for y in rows:
+            r, s = y * WIDTH, shadow
+            x = 0
+            while frame[r + x] == s[r + x]:
+                x += 1
+            xa = min(xa, x)
+            x = WIDTH - 1
+            while frame[r + x] == s[r + x]:
+                x -= 1
+            xb = max(xb, x + 1)
+        yield xa, rows[0], xb, rows[-1] + 1
+
+
+def encode_frame(frame, shadow, band, stats):
+    """Rect packets for the frame, cheapest encoding per rect."""
+    packets = []
+    for x0, y0, x1, y1 in dirty_rects(frame, shadow, band):
+        pixels = [frame[y * WIDTH + x] for y in range(y0, y1) for x in range(x0, x1)]
+        old = None if shadow is None else \
+            [shadow[y * WIDTH + x] for y in range(y0, y1) for x in range(x0, x1)]
+        best = None
+        for enc, fn in ENCODERS:
+            data = fn(pixels, old)
+            if data is not None and (best is None or len(data) < len(best[1])):
+                best = (enc, data)
+        enc, data = best
+        stats[ENC_NAMES[enc]] = stats.get(ENC_NAMES[enc], 0) + 1
+        packets.append(packet(RECT, bytes((x0, y0, x1 - x0, y1 - y0, enc)) + data))
+    packets.append(packet(END))
+    return packets
+
+
+# --- Link -------------------------------------------------------------------
+
+class Link:
+    def __init__(self, port, baud, timeout):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        self.timeout = timeout
+        attr = termios.tcgetattr(self.fd)
+        attr[0] = attr[1] = attr[3] = 0                       # raw in/out/local
+        attr[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        speed = getattr(termios, 'B%d' % baud, None)
+        if speed is None:
+            sys.exit('unsupported baud rate %d' % baud)
+        attr[4] = attr[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attr)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+        self.credit = 0
+        self.replies = []
+        self.rx = bytearray()
+
+    def _read(self, wait):
+        r, _, _ = select.select([self.fd], [], [], wait)
+        if not r:
+            return False
+        data = os.read(self.fd, 256)
+        self.rx += data
+        while self.rx:
+            b = self.rx[0]
+            if b == GRANT:
+                self.credit += self.grant
+                del self.rx[0]
+            elif b in (ACK, NAK):
+                self.replies.append(b)
+                del self.rx[0]
+            elif b == SYNC:
+                if len(self.rx) < 4 or len(self.rx) < 5 + self.rx[2] + (self.rx[3] << 8):
+                    break
+                n = 5 + self.rx[2] + (self.rx[3] << 8)
+                self.replies.append(bytes(self.rx[:n]))
+                del self.rx[:n]
+            else:
+                del self.rx[0]
+        return True
+
+    def hello(self):
+        self.grant = 0
+        os.write(self.fd, packet(HELLO))
+        deadline = time.time() + self.timeout
+        while time.time() < deadline:
+            self._read(0.05)
+            for r in self.replies:
+                if isinstance(r, bytes) and r[1] == ord('h') and crc8(r[1:-1]) == r[-1]:
+                    self.version = r[4]
+                    self.window = r[5] | (r[6] << 8)
+                    self.grant = r[7]
+                    self.credit = self.window
+                    self.replies = []
+                    return
+        sys.exit('no hello reply from the device')
+
+    def send(self, data):
+        view = memoryview(data)
+        while view:
+            while self.credit == 0:
+                if not self._read(self.timeout):
+                    raise TimeoutError('device stopped granting credit')
+            n = min(self.credit, len(view))
+            os.write(self.fd, view[:n])
+            self.credit -= n
+            view = view[n:]
+            self._read(0)
+
+    def wait_ack(self):
+        deadline = time.time() + self.timeout
+        while time.time() < deadline:
+            for i, r in enumerate(self.replies):
+                if r in (ACK, NAK):
+                    del self.replies[i]
+                    return r == ACK
+            self._read(0.05)
+        raise TimeoutError('no reply to the end packet')
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('port', help="serial device or pty, '-' to only report sizes")
+    ap.add_argument('images', nargs='+')
+    ap.add_argument('--baud', type=int, default=115200)
+    ap.add_argument('--band', type=int, default=16, help='rows per dirty-rect band')
+    ap.add_argument('--loop', type=int, default=1, help='send the image list this many times')
+    ap.add_argument('--timeout', type=float, default=5.0)
+    args = ap.parse_args()
+
+    frames = [load_image(p) for p in args.images]
+    link = None
+    if args.port != '-':
+        link = Link(args.port, args.baud, args.timeout)
+        link.hello()
+        print('device: protocol %d, window %d, credit %d' % (link.version, link.window, link.grant))
+
+    raw_bytes = WIDTH * HEIGHT * 2
+    shadow = None
+    for n in range(args.loop * len(frames)):
+        frame = frames[n % len(frames)]
+        stats = {}
+        packets = encode_frame(frame, shadow, args.band, stats)
+        size = sum(len(p) for p in packets)
+        t0 = time.time()
+        ok = True
+        if link:
+            try:
+                for p in packets:
+                    link.send(p)
+                ok = link.wait_ack()
+            except TimeoutError as e:
+                print('  %s, resynchronising' % e)
+                time.sleep(0.2)
+                link.hello()
+                ok = False
+        # After a NAK the panel contents are unknown: the next frame is sent in full
+        shadow = frame if ok else None
+        enc = ' '.join('%s %d' % (k, v) for k, v in sorted(stats.items()))
+        print('frame %d: %d rects (%s), %d bytes, %.2f s at %d baud (raw %.1f s)%s%s'
+              % (n + 1, len(packets) - 1, enc or 'none', size, size * 10.0 / args.baud,
+                 args.baud, raw_bytes * 10.0 / args.baud,
+                 ', sent in %.2f s' % (time.time() - t0) if link else '',
+                 '' if ok else ', NAK'))
+
+
+if __name__ == '__main__':
+    main()